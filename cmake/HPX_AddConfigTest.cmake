@@ -404,6 +404,14 @@ function(hpx_check_for_cxx17_std_aligned_alloc)
   )
 endfunction()
 
+function(hpx_check_for_cxx17_memory_resource)
+  add_hpx_config_test(
+    HPX_WITH_CXX17_MEMORY_RESOURCE
+    SOURCE cmake/tests/cxx17_memory_resource.cpp
+    FILE ${ARGN}
+  )
+endfunction()
+
 function(hpx_check_for_cxx17_std_execution_policies)
   add_hpx_config_test(
     HPX_WITH_CXX17_STD_EXECUTION_POLICES
@@ -60,6 +60,10 @@ function(hpx_perform_cxx_feature_tests)
     DEFINITIONS HPX_HAVE_CXX17_STD_EXECUTION_POLICES
   )
 
+  hpx_check_for_cxx17_memory_resource(
+    DEFINITIONS HPX_HAVE_CXX17_MEMORY_RESOURCE
+  )
+
   hpx_check_for_cxx17_filesystem(DEFINITIONS HPX_HAVE_CXX17_FILESYSTEM)
 
   hpx_check_for_cxx17_hardware_destructive_interference_size(
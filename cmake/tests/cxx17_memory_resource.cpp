@@ -0,0 +1,19 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// test for availability of std::pmr::memory_resource (C++17)
+
+#include <memory_resource>
+#include <vector>
+
+int main()
+{
+    std::pmr::monotonic_buffer_resource resource(1024);
+    std::pmr::vector<int> v(&resource);
+    v.push_back(42);
+
+    return v.get_allocator().resource() == &resource ? 0 : 1;
+}
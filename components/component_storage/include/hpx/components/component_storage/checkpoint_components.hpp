@@ -0,0 +1,160 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file checkpoint_components.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_colocated/get_colocation_id.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/components_base/traits/is_component.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/find_localities.hpp>
+
+#include <hpx/components/component_storage/component_storage.hpp>
+#include <hpx/components/component_storage/server/checkpoint_components.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components {
+
+    namespace detail {
+
+        inline hpx::future<std::size_t> accumulate_checkpoint_counts(
+            std::vector<hpx::future<std::size_t>>&& counts)
+        {
+            return hpx::when_all(HPX_MOVE(counts))
+                .then(hpx::launch::sync, [](auto&& f) {
+                    std::size_t count = 0;
+                    for (auto&& c : f.get())
+                    {
+                        count += c.get();
+                    }
+                    return count;
+                });
+        }
+    }    // namespace detail
+
+    /// Write a distributed checkpoint of the given components
+    ///
+    /// The function \a checkpoint_components<Component> groups the given
+    /// components by the locality they currently live on. Every locality
+    /// writes the state of its components in parallel to a local checkpoint
+    /// file named <basename>.<locality_id>, together with a manifest listing
+    /// the global ids of the stored components. Localities which do not hold
+    /// any of the components write an empty manifest.
+    ///
+    /// \param ids       [in] The global ids of the components to checkpoint.
+    /// \param basename  [in] The base name of the checkpoint files.
+    ///
+    /// \tparam  The only template argument specifies the component type of
+    ///          the components to checkpoint.
+    ///
+    /// \returns A future holding the overall number of stored components.
+    ///
+    template <typename Component>
+#if defined(DOXYGEN)
+    future<std::size_t>
+#else
+    inline typename std::enable_if<traits::is_component<Component>::value,
+        future<std::size_t>>::type
+#endif
+    checkpoint_components(
+        std::vector<hpx::id_type> const& ids, std::string const& basename)
+    {
+        std::vector<hpx::future<hpx::id_type>> localities;
+        localities.reserve(ids.size());
+        for (hpx::id_type const& id : ids)
+        {
+            localities.push_back(hpx::get_colocation_id(id));
+        }
+
+        return hpx::when_all(localities).then(
+            [ids, basename](auto&& f) -> hpx::future<std::size_t> {
+                auto&& colocation_ids = f.get();
+
+                // every locality writes its own manifest
+                std::map<hpx::id_type, std::vector<hpx::id_type>> per_locality;
+                for (hpx::id_type const& locality : hpx::find_all_localities())
+                {
+                    per_locality[locality];
+                }
+                for (std::size_t i = 0; i != ids.size(); ++i)
+                {
+                    per_locality[colocation_ids[i].get()].push_back(ids[i]);
+                }
+
+                using action_type =
+                    server::checkpoint_components_here_action<Component>;
+
+                std::vector<hpx::future<std::size_t>> counts;
+                counts.reserve(per_locality.size());
+                for (auto& p : per_locality)
+                {
+                    counts.push_back(hpx::async<action_type>(
+                        p.first, HPX_MOVE(p.second), basename));
+                }
+                return detail::accumulate_checkpoint_counts(HPX_MOVE(counts));
+            });
+    }
+
+    /// Restore the components stored in a distributed checkpoint
+    ///
+    /// The function \a restore_components<Component> restores all components
+    /// written by \a checkpoint_components<Component> with the same
+    /// \a basename. Every locality restores the components listed in its
+    /// manifest in parallel: the current instance of each component is
+    /// migrated to the given storage, its stored state is replaced by the
+    /// checkpointed state, and the component is resurrected on the locality
+    /// it was checkpointed on (see \a migrate_from_storage).
+    ///
+    /// \param storage   [in] The storage facility used to re-create the
+    ///                  components.
+    /// \param basename  [in] The base name of the checkpoint files.
+    ///
+    /// \tparam  The only template argument specifies the component type of
+    ///          the components to restore.
+    ///
+    /// \returns A future holding the overall number of restored components.
+    ///
+    /// \note    The global ids of the components have to be valid, i.e. the
+    ///          components are restored into the running application which
+    ///          created the checkpoint.
+    ///
+    template <typename Component>
+#if defined(DOXYGEN)
+    future<std::size_t>
+#else
+    inline typename std::enable_if<traits::is_component<Component>::value,
+        future<std::size_t>>::type
+#endif
+    restore_components(hpx::components::component_storage const& storage,
+        std::string const& basename)
+    {
+        using action_type = server::restore_components_here_action<Component>;
+
+        std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+
+        std::vector<hpx::future<std::size_t>> counts;
+        counts.reserve(localities.size());
+        for (hpx::id_type const& locality : localities)
+        {
+            counts.push_back(
+                hpx::async<action_type>(locality, storage.get_id(), basename));
+        }
+        return detail::accumulate_checkpoint_counts(HPX_MOVE(counts));
+    }
+}}    // namespace hpx::components
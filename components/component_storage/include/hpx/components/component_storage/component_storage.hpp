@@ -41,6 +41,11 @@ namespace hpx { namespace components {
         std::vector<char> migrate_from_here(
             launch::sync_policy, naming::gid_type const&);
 
+        hpx::future<void> replace_data(
+            naming::gid_type const&, std::vector<char> const&);
+        void replace_data(launch::sync_policy, naming::gid_type const&,
+            std::vector<char> const&);
+
         future<std::size_t> size() const;
         std::size_t size(launch::sync_policy) const;
     };
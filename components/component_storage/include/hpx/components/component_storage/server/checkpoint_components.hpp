@@ -0,0 +1,139 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/checkpoint/local_checkpoint_file.hpp>
+#include <hpx/components/get_ptr.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/find_here.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/components/component_storage/server/component_storage.hpp>
+#include <hpx/components/component_storage/server/migrate_from_storage.hpp>
+#include <hpx/components/component_storage/server/migrate_to_storage.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hpx::components::server {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Write the given (local) components to the checkpoint file of this
+    // locality. Every component is stored in the same format as used for
+    // migrating it to a component_storage.
+    template <typename Component>
+    std::size_t checkpoint_components_here(
+        std::vector<hpx::id_type> const& ids, std::string const& basename)
+    {
+        util::local_checkpoint_writer writer(basename, get_locality_id());
+
+        std::uint64_t index = 0;
+        for (hpx::id_type const& id : ids)
+        {
+            // this pins the object while it is being serialized
+            std::shared_ptr<Component> ptr =
+                hpx::get_ptr<Component>(launch::sync, id);
+
+            writer.save(
+                naming::detail::get_stripped_gid(id.get_gid()), index++, ptr);
+        }
+
+        return writer.close();
+    }
+
+    template <typename Component>
+    struct checkpoint_components_here_action
+      : ::hpx::actions::action<std::size_t (*)(
+                                   std::vector<hpx::id_type> const&,
+                                   std::string const&),
+            &checkpoint_components_here<Component>,
+            checkpoint_components_here_action<Component>>
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Restore all components stored in the checkpoint file of this locality.
+    //
+    // Each component is restored in three steps:
+    //
+    // 1) The live object is migrated to the given storage, which unbinds
+    //    its global id from the current object.
+    // 2) The data held by the storage is replaced with the checkpointed
+    //    state of the object.
+    // 3) The object is resurrected from the storage on this locality, which
+    //    re-creates the component from the checkpointed state.
+    //
+    template <typename Component>
+    std::size_t restore_components_here(
+        hpx::id_type const& storage, std::string const& basename)
+    {
+        util::local_checkpoint_reader const reader(
+            basename, get_locality_id());
+
+        hpx::id_type const here = find_here();
+
+        std::vector<hpx::future<hpx::id_type>> results;
+        results.reserve(reader.manifest().size());
+
+        for (util::checkpoint_manifest_entry const& entry : reader.manifest())
+        {
+            std::string_view const data = reader.get_data(entry);
+
+            hpx::id_type const id(
+                entry.id, hpx::id_type::management_type::unmanaged);
+
+            using to_storage_action =
+                trigger_migrate_to_storage_here_action<Component>;
+            using replace_action = component_storage::replace_data_action;
+            using from_storage_action =
+                trigger_migrate_from_storage_here_action<Component>;
+
+            results.push_back(
+                hpx::async<to_storage_action>(
+                    naming::get_locality_from_id(id), id, storage)
+                    .then([storage, gid = entry.id,
+                              state = std::vector<char>(
+                                  data.begin(), data.end())](auto&& f) {
+                        f.get();    // propagate exceptions
+                        return hpx::async<replace_action>(storage, gid, state);
+                    })
+                    .then([id, here](auto&& f) {
+                        f.get();    // propagate exceptions
+                        return hpx::async<from_storage_action>(
+                            naming::get_locality_from_id(id), id, here);
+                    }));
+        }
+
+        for (auto&& f : hpx::when_all(results).get())
+        {
+            f.get();
+        }
+
+        return reader.manifest().size();
+    }
+
+    template <typename Component>
+    struct restore_components_here_action
+      : ::hpx::actions::action<std::size_t (*)(
+                                   hpx::id_type const&, std::string const&),
+            &restore_components_here<Component>,
+            restore_components_here_action<Component>>
+    {
+    };
+}    // namespace hpx::components::server
@@ -37,6 +37,7 @@ namespace hpx::components::server {
         naming::gid_type migrate_to_here(
             std::vector<char> const&, hpx::id_type, naming::address const&);
         std::vector<char> migrate_from_here(naming::gid_type const&);
+        void replace_data(naming::gid_type const&, std::vector<char> const&);
         std::size_t size() const
         {
             return data_.size();
@@ -44,6 +45,7 @@ namespace hpx::components::server {
 
         HPX_DEFINE_COMPONENT_ACTION(component_storage, migrate_to_here)
         HPX_DEFINE_COMPONENT_ACTION(component_storage, migrate_from_here)
+        HPX_DEFINE_COMPONENT_ACTION(component_storage, replace_data)
         HPX_DEFINE_COMPONENT_ACTION(component_storage, size)
 
     private:
@@ -57,6 +59,9 @@ HPX_REGISTER_ACTION_DECLARATION(
 HPX_REGISTER_ACTION_DECLARATION(
     hpx::components::server::component_storage::migrate_from_here_action,
     component_storage_migrate_component_from_here_action)
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::components::server::component_storage::replace_data_action,
+    component_storage_replace_data_action)
 HPX_REGISTER_ACTION_DECLARATION(
     hpx::components::server::component_storage::size_action,
     component_storage_size_action)
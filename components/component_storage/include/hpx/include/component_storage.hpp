@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <hpx/components/component_storage/checkpoint_components.hpp>
 #include <hpx/components/component_storage/component_storage.hpp>
 #include <hpx/components/component_storage/migrate_from_storage.hpp>
 #include <hpx/components/component_storage/migrate_to_storage.hpp>
@@ -30,5 +30,8 @@ HPX_REGISTER_ACTION(
 HPX_REGISTER_ACTION(
     hpx::components::server::component_storage::migrate_from_here_action,
     component_storage_migrate_component_from_here_action)
+HPX_REGISTER_ACTION(
+    hpx::components::server::component_storage::replace_data_action,
+    component_storage_replace_data_action)
 HPX_REGISTER_ACTION(hpx::components::server::component_storage::size_action,
     component_storage_size_action)
@@ -70,6 +70,26 @@ namespace hpx { namespace components {
         return migrate_from_here(id).get();
     }
 
+    hpx::future<void> component_storage::replace_data(
+        naming::gid_type const& id, std::vector<char> const& data)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        typedef server::component_storage::replace_data_action action_type;
+        return hpx::async<action_type>(this->get_id(), id, data);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(id);
+        HPX_UNUSED(data);
+        return hpx::make_ready_future();
+#endif
+    }
+
+    void component_storage::replace_data(launch::sync_policy,
+        naming::gid_type const& id, std::vector<char> const& data)
+    {
+        replace_data(id, data).get();
+    }
+
     hpx::future<std::size_t> component_storage::size() const
     {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
@@ -46,6 +46,14 @@ namespace hpx { namespace components { namespace server {
         return data_.get_value(
             launch::sync, naming::detail::get_stripped_gid(id), true);
     }
+
+    void component_storage::replace_data(
+        naming::gid_type const& id, std::vector<char> const& data)
+    {
+        // the object has to be bound to this storage already (see
+        // migrate_to_here), only its serialized state is replaced
+        data_[naming::detail::get_stripped_gid(id)] = data;
+    }
 }}}    // namespace hpx::components::server
 
 HPX_REGISTER_UNORDERED_MAP(
@@ -0,0 +1,156 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/component_storage.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/naming.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::migration_support<
+        hpx::components::component_base<test_server>>
+{
+    using base_type = hpx::components::migration_support<
+        hpx::components::component_base<test_server>>;
+
+    test_server() = default;
+
+    // Components which should be migrated using hpx::migrate<> need to
+    // be Serializable and CopyConstructable.
+    test_server(test_server const& src)
+      : base_type(src)
+      , value_(src.value_)
+    {
+    }
+    test_server(test_server&& src) noexcept
+      : value_(src.value_)
+    {
+    }
+
+    test_server& operator=(test_server const&) = delete;
+    test_server& operator=(test_server&&) = delete;
+
+    int get_value() const
+    {
+        return value_;
+    }
+
+    void set_value(int value)
+    {
+        value_ = value;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, get_value, get_value_action)
+    HPX_DEFINE_COMPONENT_ACTION(test_server, set_value, set_value_action)
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & value_;
+        // clang-format on
+    }
+
+private:
+    int value_ = 0;
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+typedef test_server::get_value_action get_value_action;
+HPX_REGISTER_ACTION_DECLARATION(get_value_action)
+HPX_REGISTER_ACTION(get_value_action)
+
+typedef test_server::set_value_action set_value_action;
+HPX_REGISTER_ACTION_DECLARATION(set_value_action)
+HPX_REGISTER_ACTION(set_value_action)
+
+///////////////////////////////////////////////////////////////////////////////
+void remove_checkpoint_files(std::string const& basename)
+{
+    for (hpx::id_type const& locality : hpx::find_all_localities())
+    {
+        std::string const filename = hpx::util::get_local_checkpoint_filename(
+            basename, hpx::naming::get_locality_id_from_id(locality));
+
+        std::remove(filename.c_str());
+        std::remove((filename + ".manifest").c_str());
+    }
+}
+
+void test_checkpoint_components(hpx::components::component_storage storage)
+{
+    std::string const basename = "checkpoint_components";
+
+    // create components on all localities
+    std::vector<hpx::id_type> ids;
+    std::vector<hpx::id_type> localities;
+    for (hpx::id_type const& locality : hpx::find_all_localities())
+    {
+        for (int i = 0; i != 4; ++i)
+        {
+            ids.push_back(hpx::new_<test_server>(locality).get());
+            localities.push_back(locality);
+        }
+    }
+
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        set_value_action()(ids[i], static_cast<int>(i));
+    }
+
+    HPX_TEST_EQ(
+        hpx::components::checkpoint_components<test_server>(ids, basename)
+            .get(),
+        ids.size());
+
+    // modify the state of the components after the checkpoint was written
+    for (hpx::id_type const& id : ids)
+    {
+        set_value_action()(id, -1);
+    }
+
+    HPX_TEST_EQ(
+        hpx::components::restore_components<test_server>(storage, basename)
+            .get(),
+        ids.size());
+
+    // the components have the checkpointed state again and live on their
+    // original localities
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        HPX_TEST_EQ(get_value_action()(ids[i]), static_cast<int>(i));
+        HPX_TEST_EQ(
+            hpx::get_colocation_id(hpx::launch::sync, ids[i]), localities[i]);
+    }
+
+    HPX_TEST_EQ(storage.size(hpx::launch::sync), std::size_t(0));
+
+    remove_checkpoint_files(basename);
+}
+
+int main()
+{
+    hpx::components::component_storage storage(hpx::find_here());
+    test_checkpoint_components(storage);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,217 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/partitioned_vector_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/async_combinators/when_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/checkpoint/local_checkpoint_file.hpp>
+#include <hpx/components/get_ptr.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    namespace server {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Write the given (local) partitions of a partitioned_vector to the
+        // checkpoint file of this locality.
+        template <typename T, typename Data>
+        std::size_t save_partitions_here(
+            std::vector<hpx::id_type> const& partitions,
+            std::vector<std::uint64_t> const& indices,
+            std::string const& basename)
+        {
+            using server_type = hpx::server::partitioned_vector<T, Data>;
+
+            util::local_checkpoint_writer writer(
+                basename, hpx::get_locality_id());
+
+            for (std::size_t i = 0; i != partitions.size(); ++i)
+            {
+                std::shared_ptr<server_type> ptr =
+                    hpx::get_ptr<server_type>(launch::sync, partitions[i]);
+
+                writer.save(naming::detail::get_stripped_gid(
+                                partitions[i].get_gid()),
+                    indices[i], ptr->get_data());
+            }
+
+            return writer.close();
+        }
+
+        template <typename T, typename Data>
+        struct save_partitions_here_action
+          : ::hpx::actions::action<std::size_t (*)(
+                                       std::vector<hpx::id_type> const&,
+                                       std::vector<std::uint64_t> const&,
+                                       std::string const&),
+                &save_partitions_here<T, Data>,
+                save_partitions_here_action<T, Data>>
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Restore the given (local) partitions of a partitioned_vector from
+        // the checkpoint file of this locality. The partitions are matched by
+        // their sequence number, which allows to restore a checkpoint into a
+        // newly created partitioned_vector with the same layout.
+        template <typename T, typename Data>
+        std::size_t restore_partitions_here(
+            std::vector<hpx::id_type> const& partitions,
+            std::vector<std::uint64_t> const& indices,
+            std::string const& basename)
+        {
+            using server_type = hpx::server::partitioned_vector<T, Data>;
+
+            util::local_checkpoint_reader const reader(
+                basename, hpx::get_locality_id());
+
+            for (std::size_t i = 0; i != partitions.size(); ++i)
+            {
+                util::checkpoint_manifest_entry const* entry =
+                    reader.find(indices[i]);
+                if (entry == nullptr)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "hpx::server::restore_partitions_here",
+                        "partition {} is not stored in the checkpoint {} of "
+                        "this locality",
+                        indices[i], basename);
+                }
+
+                std::shared_ptr<server_type> ptr =
+                    hpx::get_ptr<server_type>(launch::sync, partitions[i]);
+                reader.restore(*entry, ptr->get_data());
+            }
+
+            return partitions.size();
+        }
+
+        template <typename T, typename Data>
+        struct restore_partitions_here_action
+          : ::hpx::actions::action<std::size_t (*)(
+                                       std::vector<hpx::id_type> const&,
+                                       std::vector<std::uint64_t> const&,
+                                       std::string const&),
+                &restore_partitions_here<T, Data>,
+                restore_partitions_here_action<T, Data>>
+        {
+        };
+    }    // namespace server
+
+    namespace detail {
+
+        // Invoke the given action once on every locality holding partitions
+        // of the given vector, return the accumulated results.
+        template <typename Action, typename T, typename Data>
+        hpx::future<std::size_t> for_each_partition_locality(
+            partitioned_vector<T, Data> const& v, std::string const& basename)
+        {
+            struct locality_partitions
+            {
+                hpx::id_type locality;
+                std::vector<hpx::id_type> partitions;
+                std::vector<std::uint64_t> indices;
+            };
+
+            std::map<std::uint32_t, locality_partitions> localities;
+
+            std::uint64_t index = 0;
+            for (auto const& part : v.partitions())
+            {
+                auto& l = localities[part.locality_id_];
+                if (!l.locality)
+                {
+                    l.locality =
+                        naming::get_locality_from_id(part.partition_);
+                }
+                l.partitions.push_back(part.partition_);
+                l.indices.push_back(index++);
+            }
+
+            std::vector<hpx::future<std::size_t>> results;
+            results.reserve(localities.size());
+            for (auto& p : localities)
+            {
+                auto& l = p.second;
+                results.push_back(hpx::async<Action>(l.locality,
+                    HPX_MOVE(l.partitions), HPX_MOVE(l.indices), basename));
+            }
+
+            return hpx::when_all(results).then(hpx::launch::sync,
+                [](auto&& f) {
+                    std::size_t count = 0;
+                    for (auto&& r : f.get())
+                    {
+                        count += r.get();
+                    }
+                    return count;
+                });
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Write a distributed checkpoint of the given partitioned_vector
+    ///
+    /// Every locality holding partitions of \a v writes those partitions in
+    /// parallel to a local checkpoint file named <basename>.<locality_id>,
+    /// together with a manifest describing the stored partitions. The vector
+    /// must not be modified while the checkpoint is written.
+    ///
+    /// \param v        The partitioned_vector to checkpoint
+    /// \param basename The base name of the checkpoint files
+    ///
+    /// \returns A future holding the overall number of stored partitions
+    template <typename T, typename Data>
+    hpx::future<std::size_t> checkpoint_partitions(
+        partitioned_vector<T, Data> const& v, std::string const& basename)
+    {
+        using action_type = server::save_partitions_here_action<T, Data>;
+        return detail::for_each_partition_locality<action_type>(v, basename);
+    }
+
+    /// Restore the partitions of the given partitioned_vector from a
+    /// distributed checkpoint
+    ///
+    /// Every locality restores its partitions of \a v in parallel from the
+    /// checkpoint file written by \a checkpoint_partitions. The vector has to
+    /// have the same layout (number and placement of partitions) as the
+    /// vector the checkpoint was created from. Partitions of a
+    /// partitioned_vector do not support migration, their contents are
+    /// replaced in place.
+    ///
+    /// \param v        The partitioned_vector to restore
+    /// \param basename The base name of the checkpoint files
+    ///
+    /// \returns A future holding the overall number of restored partitions
+    template <typename T, typename Data>
+    hpx::future<std::size_t> restore_partitions(
+        partitioned_vector<T, Data>& v, std::string const& basename)
+    {
+        using action_type = server::restore_partitions_here_action<T, Data>;
+        return detail::for_each_partition_locality<action_type>(v, basename);
+    }
+}    // namespace hpx
@@ -295,6 +295,24 @@ namespace hpx {
         std::vector<size_type> get_local_indices(
             std::vector<size_type> indices) const;
 
+        // Global indices grouped by the segment they refer to
+        struct partitioned_indices
+        {
+            // sequence numbers of the referenced segments
+            std::vector<std::size_t> parts_;
+
+            // local indices inside each of the referenced segments
+            std::vector<std::vector<size_type>> local_indices_;
+
+            // positions of the local indices in the original sequence
+            std::vector<std::vector<size_type>> positions_;
+        };
+
+        // Group the given global indices by the segment they refer to,
+        // preserving their relative order
+        partitioned_indices group_by_partition(
+            std::vector<size_type> const& indices) const;
+
         // Return the global index corresponding to the local index inside the
         // given segment.
         template <typename SegmentIter>
@@ -702,6 +720,10 @@ namespace hpx {
         /// Returns the elements at the positions \a pos in the vector
         /// container.
         ///
+        /// The positions are grouped by the partition holding them, which
+        /// results in one request per partition regardless of the order of
+        /// the positions. The requests are issued in parallel.
+        ///
         /// \param pos   Global position of the element in the vector
         ///
         /// \return Returns the value of the element at position represented by
@@ -715,65 +737,65 @@ namespace hpx {
             if (pos.empty())
                 return make_ready_future(std::vector<T>());
 
-            // current partition index of the block
-            size_type part_cur = get_partition(pos[0]);
+            partitioned_indices indices = group_by_partition(pos);
 
-            // iterator to the begin of current block
-            auto part_begin = pos.begin();
+            // all positions refer to the same partition, the values are
+            // returned in the requested order
+            if (indices.parts_.size() == 1)
+            {
+                return get_values(
+                    indices.parts_[0], indices.local_indices_[0]);
+            }
 
-            // vector holding futures of the values for all blocks
+            // vector holding futures of the values for all partitions
             std::vector<future<std::vector<T>>> part_values_future;
-            for (auto it = pos.begin(); it != pos.end(); ++it)
+            part_values_future.reserve(indices.parts_.size());
+
+            for (std::size_t i = 0; i != indices.parts_.size(); ++i)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
-                    continue;
-
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-
-                // this is the end of a block containing indexes ('pos')
-                // of the same partition ('part').
-                // get async values for this block
-                part_values_future.push_back(get_values(part_cur,
-                    get_local_indices(std::vector<size_type>(part_begin, it))));
-
-                // reset block variables to start a new one from here
-                part_cur = part;
-                part_begin = it;
+                part_values_future.push_back(
+                    get_values(indices.parts_[i], indices.local_indices_[i]));
             }
 
-            // the end of the vector is also an end of a block
-            // get async values for this block
-            part_values_future.push_back(get_values(part_cur,
-                get_local_indices(
-                    std::vector<size_type>(part_begin, pos.end()))));
-
             // This helper function unwraps the vectors from each partition
-            // and merge them to one vector
-            auto merge_func =
-                [&pos](std::vector<future<std::vector<T>>>&& part_values_f)
-                -> std::vector<T> {
+            // and places the values at their original positions. The values
+            // of each partition are ordered by their positions, so the result
+            // is assembled in index order without default constructing any
+            // of its elements.
+            auto merge_func = [size = pos.size(),
+                                  positions = HPX_MOVE(indices.positions_)](
+                                  std::vector<future<std::vector<T>>>&&
+                                      part_values_f) -> std::vector<T> {
+                // the partition holding the value of each position
+                std::vector<std::size_t> source(size);
+                std::vector<std::vector<T>> part_values;
+                part_values.reserve(part_values_f.size());
+                for (std::size_t i = 0; i != part_values_f.size(); ++i)
+                {
+                    part_values.push_back(part_values_f[i].get());
+                    HPX_ASSERT(part_values[i].size() == positions[i].size());
+
+                    for (size_type const position : positions[i])
+                    {
+                        source[position] = i;
+                    }
+                }
+
                 std::vector<T> values;
-                values.reserve(pos.size());
+                values.reserve(size);
 
-                for (future<std::vector<T>>& part_f : part_values_f)
+                std::vector<std::size_t> next(part_values.size(), 0);
+                for (std::size_t const i : source)
                 {
-                    std::vector<T> part_values = part_f.get();
-                    std::move(part_values.begin(), part_values.end(),
-                        std::back_inserter(values));
+                    values.push_back(HPX_MOVE(part_values[i][next[i]++]));
                 }
                 return values;
             };
 
             // when all values are here merge them to one vector
             // and return a future to this vector
-            return dataflow(
-                launch::async, merge_func, HPX_MOVE(part_values_future));
+            return dataflow(launch::sync, HPX_MOVE(merge_func),
+                HPX_MOVE(part_values_future));
         }
 
         /// Returns the elements at the positions \a pos
@@ -1058,6 +1080,10 @@ namespace hpx {
         /// Asynchronously set the element at position \a pos
         /// to the given value \a val.
         ///
+        /// The positions are grouped by the partition holding them, which
+        /// results in one request per partition regardless of the order of
+        /// the positions. The requests are issued in parallel.
+        ///
         /// \param pos   Global position of the element in the vector
         /// \param val   The value to be copied
         ///
@@ -1074,55 +1100,33 @@ namespace hpx {
             if (pos.empty())
                 return make_ready_future();
 
-            // partition index of the current block
-            size_type part_cur = get_partition(pos[0]);
+            partitioned_indices indices = group_by_partition(pos);
 
-            // iterator to the begin of current block
-            typename std::vector<size_type>::const_iterator pos_block_begin =
-                pos.begin();
-            typename std::vector<T>::const_iterator val_block_begin =
-                val.begin();
+            // all positions refer to the same partition
+            if (indices.parts_.size() == 1)
+            {
+                return set_values(
+                    indices.parts_[0], indices.local_indices_[0], val);
+            }
 
-            // vector holding futures of the state for all blocks
+            // vector holding futures of the state for all partitions
             std::vector<future<void>> part_futures;
+            part_futures.reserve(indices.parts_.size());
 
-            // going through the position vector
-            typename std::vector<size_type>::const_iterator pos_it =
-                pos.begin();
-            typename std::vector<T>::const_iterator val_it = val.begin();
-            for (/**/; pos_it != pos.end(); ++pos_it, ++val_it)
+            for (std::size_t i = 0; i != indices.parts_.size(); ++i)
             {
-                // get the partition of the current position
-                size_type part = get_partition(*pos_it);
-
-                // if the partition of the current position is the same
-                // as the rest of the current block go to next position
-                if (part == part_cur)
-                    continue;
-
-                // if the partition of the current position is NOT the same
-                // as the positions before the block ends here
-
-                // this is the end of a block containing indexes ('pos')
-                // of the same partition ('part').
-                // set asynchronous values for this block
-                part_futures.push_back(set_values(part_cur,
-                    get_local_indices(
-                        std::vector<size_type>(pos_block_begin, pos_it)),
-                    std::vector<T>(val_block_begin, val_it)));
-
-                // reset block variables to start a new one from here
-                part_cur = part;
-                pos_block_begin = pos_it;
-                val_block_begin = val_it;
-            }
+                std::vector<size_type> const& positions = indices.positions_[i];
 
-            // the end of the vector is also an end of a block
-            // get asynchronous values for this block
-            part_futures.push_back(set_values(part_cur,
-                get_local_indices(
-                    std::vector<size_type>(pos_block_begin, pos.end())),
-                std::vector<T>(val_block_begin, val.end())));
+                std::vector<T> part_values;
+                part_values.reserve(positions.size());
+                for (size_type position : positions)
+                {
+                    part_values.push_back(val[position]);
+                }
+
+                part_futures.push_back(set_values(indices.parts_[i],
+                    indices.local_indices_[i], part_values));
+            }
 
             return hpx::when_all(part_futures);
         }
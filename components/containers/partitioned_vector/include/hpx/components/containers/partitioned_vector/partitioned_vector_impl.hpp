@@ -238,6 +238,40 @@ namespace hpx {
         return indices;
     }
 
+    template <typename T, typename Data /*= std::vector<T> */>
+    HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
+        typename partitioned_vector<T, Data>::partitioned_indices
+        partitioned_vector<T, Data>::group_by_partition(
+            std::vector<size_type> const& indices) const
+    {
+        partitioned_indices result;
+
+        // maps the sequence number of a segment to its group
+        std::vector<std::size_t> groups(
+            partitions_.size(), static_cast<std::size_t>(-1));
+
+        for (std::size_t i = 0; i != indices.size(); ++i)
+        {
+            std::size_t const part = get_partition(indices[i]);
+            HPX_ASSERT(part < partitions_.size());
+
+            std::size_t& group = groups[part];
+            if (group == static_cast<std::size_t>(-1))
+            {
+                group = result.parts_.size();
+                result.parts_.push_back(part);
+                result.local_indices_.emplace_back();
+                result.positions_.emplace_back();
+            }
+
+            result.local_indices_[group].push_back(
+                get_local_index(part, indices[i]));
+            result.positions_[group].push_back(i);
+        }
+
+        return result;
+    }
+
     template <typename T, typename Data /*= std::vector<T> */>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
         typename partitioned_vector<T, Data>::local_iterator
@@ -7,4 +7,5 @@
 #pragma once
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector.hpp>
+#include <hpx/components/containers/partitioned_vector/partitioned_vector_checkpoint.hpp>
 #include <hpx/components/containers/partitioned_vector/serialization/partitioned_vector.hpp>
@@ -0,0 +1,90 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/include/parallel_fill.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/include/runtime.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// partitioned_vector<int> and partitioned_vector<double> are predefined in the
+// partitioned_vector module
+#if defined(HPX_HAVE_STATIC_LINKING)
+HPX_REGISTER_PARTITIONED_VECTOR(double)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+void remove_checkpoint_files(std::string const& basename)
+{
+    for (hpx::id_type const& locality : hpx::find_all_localities())
+    {
+        std::string const filename = hpx::util::get_local_checkpoint_filename(
+            basename, hpx::naming::get_locality_id_from_id(locality));
+
+        std::remove(filename.c_str());
+        std::remove((filename + ".manifest").c_str());
+    }
+}
+
+void test_checkpoint_partitions(std::size_t num_partitions)
+{
+    std::string const basename = "checkpoint_partitioned_vector";
+    std::size_t const size = 1000 * num_partitions;
+
+    auto const layout =
+        hpx::container_layout(num_partitions, hpx::find_all_localities());
+
+    hpx::partitioned_vector<double> v(size, layout);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        v.set_value(hpx::launch::sync, i, static_cast<double>(i));
+    }
+
+    HPX_TEST_EQ(hpx::checkpoint_partitions(v, basename).get(), num_partitions);
+
+    // restore the data in place
+    hpx::fill(hpx::execution::par, v.begin(), v.end(), 0.0);
+    HPX_TEST_EQ(hpx::restore_partitions(v, basename).get(), num_partitions);
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(v.get_value(hpx::launch::sync, i), static_cast<double>(i));
+    }
+
+    // restore the data into a new vector with the same layout
+    hpx::partitioned_vector<double> v2(size, 0.0, layout);
+    HPX_TEST_EQ(hpx::restore_partitions(v2, basename).get(), num_partitions);
+
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        HPX_TEST_EQ(
+            v2.get_value(hpx::launch::sync, i), static_cast<double>(i));
+    }
+
+    remove_checkpoint_files(basename);
+}
+
+int main()
+{
+    std::size_t const num_localities = hpx::find_all_localities().size();
+
+    test_checkpoint_partitions(num_localities);
+    test_checkpoint_partitions(4 * num_localities);
+
+    return hpx::util::report_errors();
+}
+
+#endif
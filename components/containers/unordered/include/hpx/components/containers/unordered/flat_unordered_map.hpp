@@ -0,0 +1,753 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/flat_unordered_map.hpp
+/// \brief This file contains the open-addressing hash table used as the
+///        storage of the partitions of hpx::unordered_map.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/type_support/construct_at.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                    \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HPX_FLAT_UNORDERED_MAP_HAVE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(HPX_MSVC)
+#include <intrin.h>
+#endif
+
+namespace hpx::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief An unordered map storing its elements in a flat open-addressing
+    ///        hash table.
+    ///
+    /// The slots of the table are organized in groups of 16. Every slot has
+    /// an associated control byte which marks it as empty, as deleted, or
+    /// holds 7 bits of the hash of the key stored in the slot. A lookup
+    /// compares the control bytes of a whole group at once (using SSE2 if
+    /// available) and touches the slots only for matching hash bits. Groups
+    /// are probed quadratically, the table grows once it is 7/8 full.
+    ///
+    /// Unlike std::unordered_map, inserting an element may invalidate all
+    /// iterators and references. The positions of the elements are stable as
+    /// long as no element is inserted, which allows to refer to an element
+    /// by its position (see \a iterator_at and \a position).
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+        typename KeyEqual = std::equal_to<Key>>
+    class flat_unordered_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<Key const, T>;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+
+    private:
+        using ctrl_type = std::int8_t;
+
+        static constexpr ctrl_type ctrl_empty = -128;
+        static constexpr ctrl_type ctrl_deleted = -2;
+
+        static constexpr size_type group_width = 16;
+
+        union slot_type
+        {
+            slot_type() noexcept {}
+            ~slot_type() {}
+
+            value_type value;
+        };
+
+        // The control bytes of a group of slots
+        class group
+        {
+        public:
+            explicit group(ctrl_type const* ctrl) noexcept
+#if defined(HPX_FLAT_UNORDERED_MAP_HAVE_SSE2)
+              : ctrl_(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl)))
+#else
+              : ctrl_(ctrl)
+#endif
+            {
+            }
+
+            // bit mask of the slots holding the given hash bits
+            [[nodiscard]] std::uint32_t match(ctrl_type h2) const noexcept
+            {
+#if defined(HPX_FLAT_UNORDERED_MAP_HAVE_SSE2)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(
+                    _mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_)));
+#else
+                return match_if([h2](ctrl_type c) { return c == h2; });
+#endif
+            }
+
+            // bit mask of the empty slots
+            [[nodiscard]] std::uint32_t match_empty() const noexcept
+            {
+                return match(ctrl_empty);
+            }
+
+            // bit mask of the empty or deleted slots, those are the only
+            // control bytes having their sign bit set
+            [[nodiscard]] std::uint32_t match_empty_or_deleted() const noexcept
+            {
+#if defined(HPX_FLAT_UNORDERED_MAP_HAVE_SSE2)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(ctrl_));
+#else
+                return match_if([](ctrl_type c) { return c < 0; });
+#endif
+            }
+
+        private:
+#if defined(HPX_FLAT_UNORDERED_MAP_HAVE_SSE2)
+            __m128i ctrl_;
+#else
+            template <typename F>
+            [[nodiscard]] std::uint32_t match_if(F&& f) const noexcept
+            {
+                std::uint32_t result = 0;
+                for (size_type i = 0; i != group_width; ++i)
+                {
+                    if (f(ctrl_[i]))
+                        result |= static_cast<std::uint32_t>(1) << i;
+                }
+                return result;
+            }
+
+            ctrl_type const* ctrl_;
+#endif
+        };
+
+        [[nodiscard]] static size_type lowest_bit(std::uint32_t mask) noexcept
+        {
+            HPX_ASSERT(mask != 0);
+#if defined(HPX_MSVC)
+            unsigned long index = 0;
+            _BitScanForward(&index, mask);
+            return static_cast<size_type>(index);
+#elif defined(__GNUC__)
+            return static_cast<size_type>(__builtin_ctz(mask));
+#else
+            size_type index = 0;
+            while ((mask & 1) == 0)
+            {
+                mask >>= 1;
+                ++index;
+            }
+            return index;
+#endif
+        }
+
+        template <typename Value>
+        class basic_iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = std::remove_const_t<Value>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            basic_iterator() = default;
+
+            // allow conversion from iterator to const_iterator
+            template <typename Value_,
+                typename =
+                    std::enable_if_t<std::is_same_v<Value_ const, Value> &&
+                        !std::is_same_v<Value_, Value>>>
+            basic_iterator(basic_iterator<Value_> const& rhs) noexcept
+              : ctrl_(rhs.ctrl_)
+              , end_(rhs.end_)
+              , slot_(rhs.slot_)
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                HPX_ASSERT(ctrl_ != end_);
+                return slot_->value;
+            }
+
+            pointer operator->() const noexcept
+            {
+                HPX_ASSERT(ctrl_ != end_);
+                return &slot_->value;
+            }
+
+            basic_iterator& operator++() noexcept
+            {
+                HPX_ASSERT(ctrl_ != end_);
+                ++ctrl_;
+                ++slot_;
+                skip_free_slots();
+                return *this;
+            }
+
+            basic_iterator operator++(int) noexcept
+            {
+                basic_iterator result = *this;
+                ++*this;
+                return result;
+            }
+
+            friend bool operator==(
+                basic_iterator const& lhs, basic_iterator const& rhs) noexcept
+            {
+                return lhs.ctrl_ == rhs.ctrl_;
+            }
+
+            friend bool operator!=(
+                basic_iterator const& lhs, basic_iterator const& rhs) noexcept
+            {
+                return lhs.ctrl_ != rhs.ctrl_;
+            }
+
+        private:
+            friend class flat_unordered_map;
+
+            template <typename Value_>
+            friend class basic_iterator;
+
+            basic_iterator(ctrl_type const* ctrl, ctrl_type const* end,
+                slot_type* slot) noexcept
+              : ctrl_(ctrl)
+              , end_(end)
+              , slot_(slot)
+            {
+                skip_free_slots();
+            }
+
+            void skip_free_slots() noexcept
+            {
+                while (ctrl_ != end_ && *ctrl_ < 0)
+                {
+                    ++ctrl_;
+                    ++slot_;
+                }
+            }
+
+            ctrl_type const* ctrl_ = nullptr;
+            ctrl_type const* end_ = nullptr;
+            slot_type* slot_ = nullptr;
+        };
+
+    public:
+        using iterator = basic_iterator<value_type>;
+        using const_iterator = basic_iterator<value_type const>;
+
+        ///////////////////////////////////////////////////////////////////////
+        flat_unordered_map() = default;
+
+        explicit flat_unordered_map(size_type bucket_count,
+            Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
+          : hash_(hash)
+          , key_equal_(equal)
+        {
+            reserve(bucket_count);
+        }
+
+        flat_unordered_map(flat_unordered_map const& rhs)
+          : hash_(rhs.hash_)
+          , key_equal_(rhs.key_equal_)
+        {
+            reserve(rhs.size_);
+            for (value_type const& value : rhs)
+            {
+                emplace_nonexisting(value.first, value.second);
+            }
+        }
+
+        flat_unordered_map(flat_unordered_map&& rhs) noexcept
+          : ctrl_(HPX_MOVE(rhs.ctrl_))
+          , slots_(HPX_MOVE(rhs.slots_))
+          , capacity_(rhs.capacity_)
+          , size_(rhs.size_)
+          , growth_left_(rhs.growth_left_)
+          , hash_(HPX_MOVE(rhs.hash_))
+          , key_equal_(HPX_MOVE(rhs.key_equal_))
+        {
+            rhs.capacity_ = 0;
+            rhs.size_ = 0;
+            rhs.growth_left_ = 0;
+        }
+
+        flat_unordered_map& operator=(flat_unordered_map const& rhs)
+        {
+            if (this != &rhs)
+            {
+                flat_unordered_map tmp(rhs);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        flat_unordered_map& operator=(flat_unordered_map&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                flat_unordered_map tmp(HPX_MOVE(rhs));
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ~flat_unordered_map()
+        {
+            destroy_slots();
+        }
+
+        void swap(flat_unordered_map& rhs) noexcept
+        {
+            using std::swap;
+            swap(ctrl_, rhs.ctrl_);
+            swap(slots_, rhs.slots_);
+            swap(capacity_, rhs.capacity_);
+            swap(size_, rhs.size_);
+            swap(growth_left_, rhs.growth_left_);
+            swap(hash_, rhs.hash_);
+            swap(key_equal_, rhs.key_equal_);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator begin() noexcept
+        {
+            return iterator_at(0);
+        }
+        const_iterator begin() const noexcept
+        {
+            return iterator_at(0);
+        }
+        const_iterator cbegin() const noexcept
+        {
+            return iterator_at(0);
+        }
+
+        iterator end() noexcept
+        {
+            return iterator_at(npos);
+        }
+        const_iterator end() const noexcept
+        {
+            return iterator_at(npos);
+        }
+        const_iterator cend() const noexcept
+        {
+            return iterator_at(npos);
+        }
+
+        /// Return an iterator referring to the first element stored at or
+        /// after the given position in the table.
+        iterator iterator_at(size_type pos) noexcept
+        {
+            if (pos > capacity_)
+                pos = capacity_;
+            return iterator(
+                ctrl_.get() + pos, ctrl_.get() + capacity_, slots_.get() + pos);
+        }
+        const_iterator iterator_at(size_type pos) const noexcept
+        {
+            if (pos > capacity_)
+                pos = capacity_;
+            return const_iterator(
+                ctrl_.get() + pos, ctrl_.get() + capacity_, slots_.get() + pos);
+        }
+
+        /// Return the position of the element referred to by the given
+        /// iterator in the table, or npos for the end iterator.
+        size_type position(const_iterator it) const noexcept
+        {
+            if (it.ctrl_ == it.end_)
+                return npos;
+            return static_cast<size_type>(it.ctrl_ - ctrl_.get());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        [[nodiscard]] size_type size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        [[nodiscard]] size_type max_size() const noexcept
+        {
+            return (std::numeric_limits<size_type>::max)() / sizeof(slot_type);
+        }
+
+        /// Returns the number of slots of the table
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+        [[nodiscard]] hasher hash_function() const
+        {
+            return hash_;
+        }
+
+        [[nodiscard]] key_equal key_eq() const
+        {
+            return key_equal_;
+        }
+
+        /// Make sure that the given number of elements can be stored without
+        /// growing the table.
+        void reserve(size_type count)
+        {
+            if (count <= size_ + growth_left_)
+                return;
+
+            size_type capacity = group_width;
+            while (max_load(capacity) < count)
+            {
+                capacity *= 2;
+            }
+            resize(capacity);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator find(Key const& key) noexcept
+        {
+            return iterator_at(find_position(key, hash_key(key)));
+        }
+        const_iterator find(Key const& key) const noexcept
+        {
+            return iterator_at(find_position(key, hash_key(key)));
+        }
+
+        [[nodiscard]] size_type count(Key const& key) const noexcept
+        {
+            return find_position(key, hash_key(key)) != npos ? 1 : 0;
+        }
+
+        [[nodiscard]] bool contains(Key const& key) const noexcept
+        {
+            return find_position(key, hash_key(key)) != npos;
+        }
+
+        T& operator[](Key const& key)
+        {
+            return try_emplace(key).first->second;
+        }
+
+        template <typename... Ts>
+        std::pair<iterator, bool> try_emplace(Key const& key, Ts&&... ts)
+        {
+            std::size_t const hash = hash_key(key);
+            size_type const pos = find_position(key, hash);
+            if (pos != npos)
+                return {iterator_at(pos), false};
+
+            return {iterator_at(emplace_nonexisting(
+                        hash, key, HPX_FORWARD(Ts, ts)...)),
+                true};
+        }
+
+        std::pair<iterator, bool> insert(value_type const& value)
+        {
+            return try_emplace(value.first, value.second);
+        }
+
+        template <typename T_>
+        std::pair<iterator, bool> insert_or_assign(Key const& key, T_&& val)
+        {
+            std::size_t const hash = hash_key(key);
+            size_type const pos = find_position(key, hash);
+            if (pos != npos)
+            {
+                slots_[pos].value.second = HPX_FORWARD(T_, val);
+                return {iterator_at(pos), false};
+            }
+
+            return {iterator_at(emplace_nonexisting(
+                        hash, key, HPX_FORWARD(T_, val))),
+                true};
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        iterator erase(const_iterator it)
+        {
+            size_type const pos = position(it);
+            HPX_ASSERT(pos != npos);
+
+            erase_at(pos);
+            return iterator_at(pos + 1);
+        }
+
+        size_type erase(Key const& key)
+        {
+            size_type const pos = find_position(key, hash_key(key));
+            if (pos == npos)
+                return 0;
+
+            erase_at(pos);
+            return 1;
+        }
+
+        void clear() noexcept
+        {
+            destroy_slots();
+            if (capacity_ != 0)
+            {
+                std::memset(ctrl_.get(), ctrl_empty, capacity_);
+            }
+            size_ = 0;
+            growth_left_ = max_load(capacity_);
+        }
+
+    private:
+        [[nodiscard]] static constexpr size_type max_load(
+            size_type capacity) noexcept
+        {
+            return capacity - capacity / 8;
+        }
+
+        // Mix the bits of the hash value, std::hash is the identity for
+        // integral types on many platforms.
+        [[nodiscard]] std::size_t hash_key(Key const& key) const
+        {
+            std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return static_cast<std::size_t>(h);
+        }
+
+        [[nodiscard]] static ctrl_type h2(std::size_t hash) noexcept
+        {
+            return static_cast<ctrl_type>(hash & 0x7f);
+        }
+
+        // Visit the groups in the probe sequence of the given hash value
+        // until the function returns true. The groups are visited in
+        // triangular order, which reaches every group as the number of groups
+        // is a power of two.
+        template <typename F>
+        void probe(std::size_t hash, F&& f) const
+        {
+            HPX_ASSERT(capacity_ != 0);
+
+            size_type const mask = capacity_ / group_width - 1;
+            size_type g = (hash >> 7) & mask;
+            for (size_type i = 1; !f(g * group_width); ++i)
+            {
+                HPX_ASSERT(i <= mask + 1);
+                g = (g + i) & mask;
+            }
+        }
+
+        [[nodiscard]] size_type find_position(
+            Key const& key, std::size_t hash) const
+        {
+            if (size_ == 0)
+                return npos;
+
+            size_type result = npos;
+            probe(hash, [&](size_type first) {
+                group const g(ctrl_.get() + first);
+                for (std::uint32_t m = g.match(h2(hash)); m != 0; m &= m - 1)
+                {
+                    size_type const pos = first + lowest_bit(m);
+                    if (key_equal_(slots_[pos].value.first, key))
+                    {
+                        result = pos;
+                        return true;
+                    }
+                }
+
+                // the key would have been stored in this group
+                return g.match_empty() != 0;
+            });
+            return result;
+        }
+
+        [[nodiscard]] size_type find_free_position(std::size_t hash) const
+        {
+            size_type result = npos;
+            probe(hash, [&](size_type first) {
+                group const g(ctrl_.get() + first);
+                std::uint32_t const m = g.match_empty_or_deleted();
+                if (m == 0)
+                    return false;
+
+                result = first + lowest_bit(m);
+                return true;
+            });
+            return result;
+        }
+
+        template <typename... Ts>
+        size_type emplace_nonexisting(
+            std::size_t hash, Key const& key, Ts&&... ts)
+        {
+            if (growth_left_ == 0)
+            {
+                // reclaim the deleted slots if that frees enough space,
+                // otherwise double the size of the table
+                resize(size_ < max_load(capacity_) / 2 ? capacity_ :
+                        (std::max) (2 * capacity_, group_width));
+            }
+
+            size_type const pos = find_free_position(hash);
+            hpx::construct_at(&slots_[pos].value, std::piecewise_construct,
+                std::forward_as_tuple(key),
+                std::forward_as_tuple(HPX_FORWARD(Ts, ts)...));
+
+            if (ctrl_[pos] == ctrl_empty)
+                --growth_left_;
+            ctrl_[pos] = h2(hash);
+            ++size_;
+
+            return pos;
+        }
+
+        template <typename... Ts>
+        size_type emplace_nonexisting(Key const& key, Ts&&... ts)
+        {
+            return emplace_nonexisting(
+                hash_key(key), key, HPX_FORWARD(Ts, ts)...);
+        }
+
+        void erase_at(size_type pos)
+        {
+            HPX_ASSERT(pos < capacity_ && ctrl_[pos] >= 0);
+
+            std::destroy_at(&slots_[pos].value);
+            --size_;
+
+            // A lookup stops at the first group having an empty slot. If the
+            // group of the erased element has one, no lookup can pass it and
+            // the slot can be marked as empty.
+            size_type const first = pos - pos % group_width;
+            if (group(ctrl_.get() + first).match_empty() != 0)
+            {
+                ctrl_[pos] = ctrl_empty;
+                ++growth_left_;
+            }
+            else
+            {
+                ctrl_[pos] = ctrl_deleted;
+            }
+        }
+
+        void resize(size_type capacity)
+        {
+            HPX_ASSERT(capacity % group_width == 0 && size_ <= capacity);
+
+            std::unique_ptr<ctrl_type[]> ctrl(new ctrl_type[capacity]);
+            std::unique_ptr<slot_type[]> slots(new slot_type[capacity]);
+            std::memset(ctrl.get(), ctrl_empty, capacity);
+
+            std::swap(ctrl, ctrl_);
+            std::swap(slots, slots_);
+
+            size_type const old_capacity = capacity_;
+            capacity_ = capacity;
+            growth_left_ = max_load(capacity) - size_;
+
+            for (size_type i = 0; i != old_capacity; ++i)
+            {
+                if (ctrl[i] < 0)
+                    continue;
+
+                value_type& value = slots[i].value;
+                std::size_t const hash = hash_key(value.first);
+                size_type const pos = find_free_position(hash);
+
+                hpx::construct_at(&slots_[pos].value, HPX_MOVE(value));
+                ctrl_[pos] = h2(hash);
+
+                std::destroy_at(&value);
+            }
+        }
+
+        void destroy_slots() noexcept
+        {
+            if constexpr (!std::is_trivially_destructible_v<value_type>)
+            {
+                for (size_type i = 0; i != capacity_; ++i)
+                {
+                    if (ctrl_[i] >= 0)
+                        std::destroy_at(&slots_[i].value);
+                }
+            }
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void save(Archive& ar, unsigned) const
+        {
+            ar << size_;
+            for (value_type const& value : *this)
+            {
+                ar << value.first << value.second;
+            }
+        }
+
+        template <typename Archive>
+        void load(Archive& ar, unsigned)
+        {
+            clear();
+
+            size_type size = 0;
+            ar >> size;
+            reserve(size);
+
+            for (size_type i = 0; i != size; ++i)
+            {
+                Key key;
+                T value;
+                ar >> key >> value;
+                insert_or_assign(key, HPX_MOVE(value));
+            }
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+    private:
+        std::unique_ptr<ctrl_type[]> ctrl_;
+        std::unique_ptr<slot_type[]> slots_;
+        size_type capacity_ = 0;
+        size_type size_ = 0;
+        size_type growth_left_ = 0;
+
+        Hash hash_;
+        KeyEqual key_equal_;
+    };
+}    // namespace hpx::detail
@@ -0,0 +1,333 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/hash_join.hpp
+/// \brief Distributed equi-join of the elements of two segmented ranges.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/functional/invoke_result.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/components/containers/unordered/flat_unordered_map.hpp>
+#include <hpx/components/containers/unordered/hash_shuffle.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::distributed::detail {
+
+    /// \cond NOINTERNAL
+
+    // The records of both inputs sent to one site.
+    template <typename R1, typename R2>
+    struct hash_join_batch
+    {
+        std::vector<R1> first_;
+        std::vector<R2> second_;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned /* version */)
+        {
+            // clang-format off
+            ar & first_ & second_;
+            // clang-format on
+        }
+    };
+
+    // The records of a segmented range as sent to the other sites.
+    template <typename SegIter>
+    struct hash_join_record
+    {
+        using local_iterator = typename hpx::traits::segmented_iterator_traits<
+            SegIter>::local_iterator;
+        using local_raw_iterator = typename hpx::traits::
+            segmented_local_iterator_traits<local_iterator>::local_raw_iterator;
+
+        using type = hash_shuffle_record_t<
+            typename std::iterator_traits<local_raw_iterator>::value_type>;
+    };
+
+    template <typename SegIter>
+    using hash_join_record_t = typename hash_join_record<SegIter>::type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Join the records received by one site, this function is executed on
+    // the locality of the segment. Every site sends its records to the sites
+    // owning their keys, Side denotes the input the local range belongs to.
+    // The records of the second input received by a site are collected in a
+    // hash table which is probed with the received records of the first
+    // input.
+    template <std::size_t Side, typename LocalIter, typename R1, typename R2,
+        typename KeyOf1, typename KeyOf2, typename F>
+    std::size_t hash_join_segment(std::string basename, std::size_t num_sites,
+        std::size_t this_site, LocalIter first, LocalIter last, KeyOf1 key_of1,
+        KeyOf2 key_of2, F f)
+    {
+        using traits = hpx::traits::segmented_local_iterator_traits<LocalIter>;
+        using key_type = std::decay_t<hpx::util::invoke_result_t<KeyOf2&,
+            R2 const&>>;
+        using batch_type = hash_join_batch<R1, R2>;
+
+        std::hash<key_type> hasher;
+
+        // all records sent to the same site are exchanged in one batch
+        std::vector<batch_type> batches(num_sites);
+
+        auto const end = traits::local(last);
+        for (auto it = traits::local(first); it != end; ++it)
+        {
+            if constexpr (Side == 0)
+            {
+                batches[hasher(HPX_INVOKE(key_of1, *it)) % num_sites]
+                    .first_.push_back(*it);
+            }
+            else
+            {
+                batches[hasher(HPX_INVOKE(key_of2, *it)) % num_sites]
+                    .second_.push_back(*it);
+            }
+        }
+
+        if (num_sites != 1)
+        {
+            using namespace hpx::collectives;
+
+            communicator comm = create_communicator(basename.c_str(),
+                num_sites_arg(num_sites), this_site_arg(this_site));
+
+            batches =
+                all_to_all(comm, HPX_MOVE(batches), this_site_arg(this_site))
+                    .get();
+        }
+
+        // build the hash table from the records of the second input
+        hpx::detail::flat_unordered_map<key_type, std::vector<R2>> table;
+        for (batch_type& batch : batches)
+        {
+            for (R2& r2 : batch.second_)
+            {
+                key_type const key = HPX_INVOKE(key_of2, r2);
+                table[key].push_back(HPX_MOVE(r2));
+            }
+        }
+
+        // probe the hash table with the records of the first input
+        std::size_t count = 0;
+        if (!table.empty())
+        {
+            for (batch_type const& batch : batches)
+            {
+                for (R1 const& r1 : batch.first_)
+                {
+                    auto const it = table.find(HPX_INVOKE(key_of1, r1));
+                    if (it != table.end())
+                    {
+                        for (R2 const& r2 : it->second)
+                        {
+                            HPX_INVOKE(f, r1, r2);
+                        }
+                        count += it->second.size();
+                    }
+                }
+            }
+        }
+        return count;
+    }
+
+    template <std::size_t Side, typename LocalIter, typename R1, typename R2,
+        typename KeyOf1, typename KeyOf2, typename F>
+    struct hash_join_segment_action
+      : hpx::actions::make_action<std::size_t (*)(std::string, std::size_t,
+                                      std::size_t, LocalIter, LocalIter,
+                                      KeyOf1, KeyOf2, F),
+            &hash_join_segment<Side, LocalIter, R1, R2, KeyOf1, KeyOf2, F>,
+            hash_join_segment_action<Side, LocalIter, R1, R2, KeyOf1, KeyOf2,
+                F>>::type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Distributed hash join: the segments of both inputs take part as sites
+    // in a single exchange, every site sends its records to the sites owning
+    // their keys and joins the records it receives.
+    template <typename ExPolicy, typename SegIter1, typename SegIter2,
+        typename KeyOf1, typename KeyOf2, typename F>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, std::size_t>
+    segmented_hash_join(ExPolicy const&, SegIter1 first1, SegIter1 last1,
+        SegIter2 first2, SegIter2 last2, KeyOf1&& key_of1, KeyOf2&& key_of2,
+        F&& f)
+    {
+        using local_iterator_type1 = typename hpx::traits::
+            segmented_iterator_traits<SegIter1>::local_iterator;
+        using local_iterator_type2 = typename hpx::traits::
+            segmented_iterator_traits<SegIter2>::local_iterator;
+        using record_type1 = hash_join_record_t<SegIter1>;
+        using record_type2 = hash_join_record_t<SegIter2>;
+        using result = hpx::parallel::util::detail::algorithm_result<ExPolicy,
+            std::size_t>;
+
+        auto const ranges1 =
+            hpx::parallel::detail::segment_ranges(first1, last1);
+        auto const ranges2 =
+            hpx::parallel::detail::segment_ranges(first2, last2);
+        if (ranges1.empty() || ranges2.empty())
+        {
+            return result::get(std::size_t(0));
+        }
+
+        std::size_t const num_sites = ranges1.size() + ranges2.size();
+        std::string const basename =
+            hpx::parallel::detail::segmented_basename("distributed_hash_join");
+
+        // all segments have to take part concurrently, even for a sequenced
+        // execution policy
+        using key_of_type1 = std::decay_t<KeyOf1>;
+        using key_of_type2 = std::decay_t<KeyOf2>;
+        using func_type = std::decay_t<F>;
+
+        hash_join_segment_action<0, local_iterator_type1, record_type1,
+            record_type2, key_of_type1, key_of_type2, func_type>
+            act1;
+        hash_join_segment_action<1, local_iterator_type2, record_type1,
+            record_type2, key_of_type1, key_of_type2, func_type>
+            act2;
+
+        std::vector<hpx::future<std::size_t>> segments;
+        segments.reserve(num_sites);
+        for (std::size_t i = 0; i != ranges1.size(); ++i)
+        {
+            segments.push_back(hpx::async(act1, hpx::colocated(ranges1[i].id),
+                basename, num_sites, i, ranges1[i].first, ranges1[i].last,
+                key_of_type1(key_of1), key_of_type2(key_of2), func_type(f)));
+        }
+        for (std::size_t i = 0; i != ranges2.size(); ++i)
+        {
+            segments.push_back(hpx::async(act2, hpx::colocated(ranges2[i].id),
+                basename, num_sites, ranges1.size() + i, ranges2[i].first,
+                ranges2[i].last, key_of_type1(key_of1), key_of_type2(key_of2),
+                func_type(f)));
+        }
+
+        return result::get(hpx::dataflow(
+            [](std::vector<hpx::future<std::size_t>>&& r) -> std::size_t {
+                // handle any remote exceptions, will throw on error
+                std::list<std::exception_ptr> errors;
+                hpx::parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy>::call(r, errors);
+
+                std::size_t count = 0;
+                for (hpx::future<std::size_t>& seg : r)
+                {
+                    count += seg.get();
+                }
+                return count;
+            },
+            HPX_MOVE(segments)));
+    }
+    /// \endcond
+}    // namespace hpx::distributed::detail
+
+namespace hpx::distributed {
+
+    /// Joins the elements in the range [first1, last1) with the elements in
+    /// the range [first2, last2) which have equal keys. Both ranges are
+    /// hash-partitioned by key to the localities of their segments, every
+    /// segment sends its elements in one batch per destination. The elements
+    /// of the second range which are received by a segment are collected in
+    /// a hash table, which is probed with the received elements of the first
+    /// range. The second range should therefore be the smaller one.
+    ///
+    /// \note   Complexity: O(\a last1 - \a first1 + \a last2 - \a first2)
+    ///         applications of the projections, plus one invocation of
+    ///         \a f for every pair of elements with equal keys.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     All segments take part in the operation
+    ///                     concurrently, the policy only controls whether
+    ///                     the call is asynchronous.
+    /// \tparam SegIter1    The type of the segmented iterators of the first
+    ///                     range (deduced), for instance the iterators of a
+    ///                     partitioned_vector or of an unordered_map.
+    /// \tparam SegIter2    The type of the segmented iterators of the second
+    ///                     range (deduced).
+    /// \tparam KeyOf1      The type of the projection returning the key of an
+    ///                     element of the first range (deduced).
+    /// \tparam KeyOf2      The type of the projection returning the key of an
+    ///                     element of the second range (deduced).
+    /// \tparam F           The type of the function invoked for the joined
+    ///                     elements (deduced).
+    ///
+    /// \param policy       The execution policy to use.
+    /// \param first1       Refers to the beginning of the first range.
+    /// \param last1        Refers to the end of the first range.
+    /// \param first2       Refers to the beginning of the second range.
+    /// \param last2        Refers to the end of the second range.
+    /// \param key_of1      Returns the key of an element of the first range.
+    /// \param key_of2      Returns the key of an element of the second range,
+    ///                     both projections have to return the same type,
+    ///                     which has to support std::hash and operator==.
+    /// \param f            Invoked for every pair of an element of the first
+    ///                     and an element of the second range with equal
+    ///                     keys. The signature should be equivalent to:
+    ///                     \code
+    ///                     void f(Type1 const& a, Type2 const& b);
+    ///                     \endcode \n
+    ///
+    /// The projections and \a f are invoked on the localities of the
+    /// segments, they have to be serializable. The elements of an
+    /// unordered_map are passed to them as std::pair<Key, T>.
+    ///
+    /// \returns  The \a hash_join algorithm returns a
+    ///           \a hpx::future<std::size_t> if the execution policy is of
+    ///           type \a sequenced_task_policy or \a parallel_task_policy
+    ///           and returns \a std::size_t otherwise. The value is the
+    ///           number of joined pairs of elements.
+    ///
+    // clang-format off
+    template <typename ExPolicy, typename SegIter1, typename SegIter2,
+        typename KeyOf1, typename KeyOf2, typename F,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter1> &&
+            hpx::traits::is_segmented_iterator_v<SegIter1> &&
+            hpx::traits::is_iterator_v<SegIter2> &&
+            hpx::traits::is_segmented_iterator_v<SegIter2>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, std::size_t>
+    hash_join(ExPolicy&& policy, SegIter1 first1, SegIter1 last1,
+        SegIter2 first2, SegIter2 last2, KeyOf1 key_of1, KeyOf2 key_of2, F f)
+    {
+        return detail::segmented_hash_join(HPX_FORWARD(ExPolicy, policy),
+            first1, last1, first2, last2, HPX_MOVE(key_of1), HPX_MOVE(key_of2),
+            HPX_MOVE(f));
+    }
+}    // namespace hpx::distributed
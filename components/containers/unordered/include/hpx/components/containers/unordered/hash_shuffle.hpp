@@ -0,0 +1,124 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/hash_shuffle.hpp
+/// \brief Common facilities of the algorithms which hash-partition the
+///        elements of segmented ranges to the sites owning their keys.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace hpx::distributed {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Function object returning the key of a key/value pair, as stored in
+    /// an hpx::unordered_map.
+    struct pair_key
+    {
+        template <typename Pair>
+        auto const& operator()(Pair const& p) const noexcept
+        {
+            return p.first;
+        }
+
+        template <typename Archive>
+        void serialize(Archive&, unsigned)
+        {
+        }
+    };
+
+    /// Function object returning the value of a key/value pair, as stored in
+    /// an hpx::unordered_map.
+    struct pair_value
+    {
+        template <typename Pair>
+        auto const& operator()(Pair const& p) const noexcept
+        {
+            return p.second;
+        }
+
+        template <typename Archive>
+        void serialize(Archive&, unsigned)
+        {
+        }
+    };
+}    // namespace hpx::distributed
+
+namespace hpx::distributed::detail {
+
+    /// \cond NOINTERNAL
+
+    // The records exchanged between the sites, the keys of the elements of
+    // an hpx::unordered_map are const.
+    template <typename T>
+    struct hash_shuffle_record
+    {
+        using type = T;
+    };
+
+    template <typename Key, typename T>
+    struct hash_shuffle_record<std::pair<Key const, T>>
+    {
+        using type = std::pair<Key, T>;
+    };
+
+    template <typename T>
+    using hash_shuffle_record_t = typename hash_shuffle_record<T>::type;
+
+    // Assign every target partition to the site which is responsible for
+    // writing its data. Sites located on the same locality as the partition
+    // are preferred, which keeps the final writes local whenever the input
+    // and the target are distributed alike.
+    inline std::vector<std::size_t> hash_shuffle_owners(
+        std::vector<hpx::id_type> const& sites,
+        std::vector<hpx::id_type> const& partitions)
+    {
+        std::vector<std::uint32_t> site_localities;
+        site_localities.reserve(sites.size());
+        for (hpx::id_type const& id : sites)
+        {
+            site_localities.push_back(naming::get_locality_id_from_id(id));
+        }
+
+        std::vector<std::size_t> owners;
+        owners.reserve(partitions.size());
+
+        std::vector<std::size_t> assigned(sites.size(), 0);
+        for (std::size_t p = 0; p != partitions.size(); ++p)
+        {
+            std::uint32_t const locality =
+                naming::get_locality_id_from_id(partitions[p]);
+
+            // pick the least loaded site on the same locality
+            std::size_t owner = sites.size();
+            for (std::size_t s = 0; s != sites.size(); ++s)
+            {
+                if (site_localities[s] == locality &&
+                    (owner == sites.size() || assigned[s] < assigned[owner]))
+                {
+                    owner = s;
+                }
+            }
+
+            if (owner == sites.size())
+            {
+                owner = p % sites.size();
+            }
+
+            ++assigned[owner];
+            owners.push_back(owner);
+        }
+        return owners;
+    }
+    /// \endcond
+}    // namespace hpx::distributed::detail
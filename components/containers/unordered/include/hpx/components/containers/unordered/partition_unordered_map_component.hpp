@@ -12,7 +12,7 @@
 ///
 /// \brief The partition_unordered_map as the hpx component is defined here.
 ///
-/// The partition_unordered_map is the wrapper to the stl unordered_map class
+/// The partition_unordered_map is the wrapper to an unordered map class
 /// except all API'are defined as component action. All the API's in client
 /// classes are asynchronous API which return the futures.
 
@@ -28,7 +28,8 @@
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
-#include <hpx/components_base/server/locking_hook.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/datastructures/serialization/optional.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
@@ -36,39 +37,59 @@
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/shared_mutex.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/unordered/flat_unordered_map.hpp>
+
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace server {
-    /// \brief This is the basic wrapper class for stl unordered_map.
+    /// \brief This is the basic wrapper class for the partition data of
+    ///        hpx::unordered_map.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The elements are stored in an open
+    /// addressing hash table (see hpx::detail::flat_unordered_map). All
+    /// operations invoked through actions are protected by a reader/writer
+    /// lock, which allows for concurrent lookups. Iterating over the local
+    /// data (see begin() and end()) is not protected and must not run
+    /// concurrently with modifications of the partition.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key>>
     class partition_unordered_map
-      : public components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+      : public hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
     {
     public:
-        typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
+        typedef hpx::detail::flat_unordered_map<Key, T, Hash, KeyEqual>
+            data_type;
 
         typedef typename data_type::size_type size_type;
         typedef typename data_type::iterator iterator_type;
         typedef typename data_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+        typedef hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
             base_type;
 
+        /// The position returned for the end of the partition
+        static constexpr size_type npos = data_type::npos;
+
     private:
+        typedef std::shared_lock<hpx::shared_mutex> read_lock_type;
+        typedef std::unique_lock<hpx::shared_mutex> write_lock_type;
+
+        mutable hpx::shared_mutex mtx_;
         data_type partition_unordered_map_;
 
     public:
@@ -94,7 +115,7 @@ namespace hpx { namespace server {
         // support components::copy
         partition_unordered_map(partition_unordered_map const& rhs)
           : base_type(rhs)
-          , partition_unordered_map_(rhs.partition_unordered_map_)
+          , partition_unordered_map_(rhs.get_copied_data())
         {
         }
 
@@ -102,8 +123,10 @@ namespace hpx { namespace server {
         {
             if (this != &rhs)
             {
+                data_type data = rhs.get_copied_data();
+
                 this->base_type::operator=(rhs);
-                partition_unordered_map_ = rhs.partition_unordered_map_;
+                set_copied_data(HPX_MOVE(data));
             }
             return *this;
         }
@@ -129,10 +152,12 @@ namespace hpx { namespace server {
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
+            read_lock_type l(mtx_);
             return partition_unordered_map_;
         }
         void set_copied_data(data_type&& d)
         {
+            write_lock_type l(mtx_);
             partition_unordered_map_ = HPX_MOVE(d);
         }
 
@@ -163,6 +188,24 @@ namespace hpx { namespace server {
             return partition_unordered_map_.cend();
         }
 
+        /// Return an iterator referring to the first element stored at or
+        /// after the position \a pos in the table of this partition.
+        iterator_type iterator_at(size_type pos)
+        {
+            return partition_unordered_map_.iterator_at(pos);
+        }
+        const_iterator_type iterator_at(size_type pos) const
+        {
+            return partition_unordered_map_.iterator_at(pos);
+        }
+
+        /// Return the position of the element referred to by \a it in the
+        /// table of this partition, npos for the end iterator.
+        size_type position(const_iterator_type it) const
+        {
+            return partition_unordered_map_.position(it);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Capacity Related API's in the server class
         ///////////////////////////////////////////////////////////////////////
@@ -170,6 +213,7 @@ namespace hpx { namespace server {
         /// Returns the number of elements
         size_type size() const
         {
+            read_lock_type l(mtx_);
             return partition_unordered_map_.size();
         }
 
@@ -183,6 +227,7 @@ namespace hpx { namespace server {
         /// allocated space for.
         size_type capacity() const
         {
+            read_lock_type l(mtx_);
             return partition_unordered_map_.capacity();
         }
 
@@ -190,6 +235,7 @@ namespace hpx { namespace server {
         /// begin() == end().
         bool empty() const
         {
+            read_lock_type l(mtx_);
             return partition_unordered_map_.empty();
         }
 
@@ -197,95 +243,174 @@ namespace hpx { namespace server {
         // Element access API's
         ///////////////////////////////////////////////////////////////////////
 
-        /// Return the element at the position \a pos in the partition_unordered_map
-        /// container.
+        /// Return the element with the given \a key in the
+        /// partition_unordered_map container.
         ///
-        /// \param pos Position of the element in the partition_unordered_map
+        /// \param key   Key of the element in the partition_unordered_map
+        /// \param erase Remove the element from the partition
         ///
-        /// \return Return the value of the element at position represented
-        ///         by \a pos.
+        /// \return Return the value of the element with the given \a key.
         ///
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it =
-                partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            if (!erase)
             {
-                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                    "partition_unordered_map::get_value",
-                    "unable to find requested key in this partition of the "
-                    "unordered_map");
+                read_lock_type l(mtx_);
+                return find_value(partition_unordered_map_, key,
+                    "partition_unordered_map::get_value")
+                    ->second;
             }
 
-            if (!erase)
-                return it->second;
+            write_lock_type l(mtx_);
+            auto it = find_value(partition_unordered_map_, key,
+                "partition_unordered_map::get_value");
 
-            auto on_exit = hpx::experimental::scope_exit(
-                [this, &it] { partition_unordered_map_.erase(it); });
-
-            return it->second;
+            T result = HPX_MOVE(it->second);
+            partition_unordered_map_.erase(it);
+            return result;
         }
 
-        /// Return the element at the position \a pos in the partition_unordered_map
-        /// container.
+        /// Return the elements with the given \a keys in the
+        /// partition_unordered_map container.
         ///
-        /// \param pos Positions of the elements in the partition_unordered_map
+        /// \param keys Keys of the elements in the partition_unordered_map
         ///
-        /// \return Return the values of the elements at position represented
-        ///         by \a pos.
+        /// \return Return the values of the elements with the given
+        ///         \a keys.
         ///
-        std::vector<T> get_values(std::vector<Key> const& keys)
+        std::vector<T> get_values(std::vector<Key> const& keys) const
         {
             std::vector<T> result;
             result.reserve(keys.size());
 
-            for (std::size_t i = 0; i != keys.size(); ++i)
+            read_lock_type l(mtx_);
+            for (Key const& key : keys)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
-                {
-                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
-                        "partition_unordered_map::get_values",
-                        "unable to find requested key in this partition of the "
-                        "unordered_map");
-                    break;
-                }
-                result.push_back(it->second);
+                result.push_back(find_value(partition_unordered_map_, key,
+                    "partition_unordered_map::get_values")
+                                     ->second);
             }
             return result;
         }
 
+        /// Look up the elements with the given \a keys in the
+        /// partition_unordered_map container.
+        ///
+        /// \param keys Keys of the elements in the partition_unordered_map
+        ///
+        /// \return Return the values of the elements with the given
+        ///         \a keys, or an empty optional for keys which are not
+        ///         stored in this partition.
+        ///
+        std::vector<hpx::optional<T>> find_values(
+            std::vector<Key> const& keys) const
+        {
+            std::vector<hpx::optional<T>> result;
+            result.reserve(keys.size());
+
+            read_lock_type l(mtx_);
+            for (Key const& key : keys)
+            {
+                auto it = partition_unordered_map_.find(key);
+                if (it != partition_unordered_map_.end())
+                    result.emplace_back(it->second);
+                else
+                    result.emplace_back();
+            }
+            return result;
+        }
+
+        /// Return the position of the first element stored at or after the
+        /// position \a pos in the table of this partition.
+        ///
+        /// \return Return npos if there is no such element.
+        ///
+        size_type next_position(size_type pos) const
+        {
+            read_lock_type l(mtx_);
+            return partition_unordered_map_.position(
+                partition_unordered_map_.iterator_at(pos));
+        }
+
+        /// Return the element stored at position \a pos in the table of
+        /// this partition.
+        std::pair<Key, T> get_position_value(size_type pos) const
+        {
+            read_lock_type l(mtx_);
+
+            auto it = partition_unordered_map_.iterator_at(pos);
+            if (partition_unordered_map_.position(it) != pos)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "partition_unordered_map::get_position_value",
+                    "no element is stored at the requested position in "
+                    "this partition of the unordered_map");
+            }
+            return std::pair<Key, T>(it->first, it->second);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         // Modifiers API's in server class
         ///////////////////////////////////////////////////////////////////////
 
-        /// Copy the value of \a val in the element at position \a pos in the
-        /// partition_unordered_map container.
-        ///
-        /// \param pos   Position of the element in the partition_unordered_map
+        /// Copy the value of \a val in the element with the given \a key in
+        /// the partition_unordered_map container.
         ///
+        /// \param key   Key of the element in the partition_unordered_map
         /// \param val   The value to be copied
         ///
-        void set_value(Key const& pos, T const& val)
+        void set_value(Key const& key, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            write_lock_type l(mtx_);
+            partition_unordered_map_.insert_or_assign(key, val);
         }
 
-        /// Copy the value of \a val for the elements at positions \a pos in
-        /// the partition_unordered_map container.
+        /// Copy the values \a val in the elements with the given \a keys
+        /// in the partition_unordered_map container.
         ///
-        /// \param pos   Positions of the elements in the partition_unordered_map
-        ///
-        /// \param val   The value to be copied
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        /// \param val   The values to be copied
         ///
         void set_values(std::vector<Key> const& keys, std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
+
+            write_lock_type l(mtx_);
+            partition_unordered_map_.reserve(
+                partition_unordered_map_.size() + keys.size());
 
             for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+                partition_unordered_map_.insert_or_assign(keys[i], val[i]);
+        }
+
+        /// Insert the values \a val with the given \a keys into the
+        /// partition_unordered_map container. Elements with keys already
+        /// stored in the partition are left unchanged.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        /// \param val   The values to be inserted
+        ///
+        /// \return Returns the number of inserted elements
+        ///
+        std::size_t insert_values(
+            std::vector<Key> const& keys, std::vector<T> const& val)
+        {
+            HPX_ASSERT(keys.size() == val.size());
+
+            write_lock_type l(mtx_);
+            partition_unordered_map_.reserve(
+                partition_unordered_map_.size() + keys.size());
+
+            std::size_t inserted = 0;
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                if (partition_unordered_map_.try_emplace(keys[i], val[i])
+                        .second)
+                {
+                    ++inserted;
+                }
+            }
+            return inserted;
         }
 
         /// Remove all elements from the vector leaving the
@@ -293,12 +418,14 @@ namespace hpx { namespace server {
         ///
         void clear()
         {
+            write_lock_type l(mtx_);
             partition_unordered_map_.clear();
         }
 
         /// Erase the given element
         std::size_t erase(Key const& key)
         {
+            write_lock_type l(mtx_);
             return partition_unordered_map_.erase(key);
         }
 
@@ -307,9 +434,17 @@ namespace hpx { namespace server {
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, get_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, find_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, next_position)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, get_position_value)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_value)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, insert_values)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase)
 
@@ -317,6 +452,20 @@ namespace hpx { namespace server {
             partition_unordered_map, get_copied_data)
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(
             partition_unordered_map, set_copied_data)
+
+    private:
+        template <typename Data>
+        static auto find_value(Data& data, Key const& key, char const* func)
+        {
+            auto it = data.find(key);
+            if (it == data.end())
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter, func,
+                    "unable to find requested key in this partition of the "
+                    "unordered_map");
+            }
+            return it;
+        }
     };
 }}    // namespace hpx::server
 
@@ -352,6 +501,19 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_action,      \
         HPX_PP_CAT(__unordered_map_get_values_action_, name))                  \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::find_values_action,     \
+        HPX_PP_CAT(__unordered_map_find_values_action_, name))                 \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::next_position_action,   \
+        HPX_PP_CAT(__unordered_map_next_position_action_, name))               \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map,                                    \
+            __LINE__)::get_position_value_action,                              \
+        HPX_PP_CAT(__unordered_map_get_position_value_action_, name))          \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::insert_values_action,   \
+        HPX_PP_CAT(__unordered_map_insert_values_action_, name))               \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_value_action,       \
         HPX_PP_CAT(__unordered_map_set_value_action_, name))                   \
@@ -409,6 +571,19 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_values_action,      \
         HPX_PP_CAT(__unordered_map_get_values_action_, name))                  \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::find_values_action,     \
+        HPX_PP_CAT(__unordered_map_find_values_action_, name))                 \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::next_position_action,   \
+        HPX_PP_CAT(__unordered_map_next_position_action_, name))               \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map,                                    \
+            __LINE__)::get_position_value_action,                              \
+        HPX_PP_CAT(__unordered_map_get_position_value_action_, name))          \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(partition_unordered_map, __LINE__)::insert_values_action,   \
+        HPX_PP_CAT(__unordered_map_insert_values_action_, name))               \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::set_value_action,       \
         HPX_PP_CAT(__unordered_map_set_value_action_, name))                   \
@@ -637,6 +812,99 @@ namespace hpx {
                 this->get_id(), keys, vals);
         }
 
+        /// Look up the elements with the given \a keys in the
+        /// partition_unordered_map component.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        ///
+        /// \return Returns the values of the elements, keys which are not
+        ///         stored in the partition result in an empty optional
+        ///
+        std::vector<hpx::optional<T>> find_values(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return find_values(keys).get();
+        }
+
+        /// Look up the elements with the given \a keys in the
+        /// partition_unordered_map component.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        ///
+        /// \return This returns the values as the hpx::future
+        ///
+        future<std::vector<hpx::optional<T>>> find_values(
+            std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::find_values_action>(
+                this->get_id(), keys);
+        }
+
+        /// Insert the values \a vals with the given \a keys into the
+        /// partition_unordered_map component, existing elements are left
+        /// unchanged.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        /// \param vals  The values to be inserted
+        ///
+        /// \return Returns the number of inserted elements
+        ///
+        std::size_t insert_values(launch::sync_policy,
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            return insert_values(keys, vals).get();
+        }
+
+        /// Insert the values \a vals with the given \a keys into the
+        /// partition_unordered_map component, existing elements are left
+        /// unchanged.
+        ///
+        /// \param keys  Keys of the elements in the partition_unordered_map
+        /// \param vals  The values to be inserted
+        ///
+        /// \return This returns the hpx::future containing the number of
+        ///         inserted elements
+        ///
+        future<std::size_t> insert_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::insert_values_action>(
+                this->get_id(), keys, vals);
+        }
+
+        /// Return the position of the first element stored at or after the
+        /// position \a pos in the table of the partition_unordered_map
+        /// component, npos if there is no such element.
+        std::size_t next_position(launch::sync_policy, std::size_t pos) const
+        {
+            return next_position(pos).get();
+        }
+
+        future<std::size_t> next_position(std::size_t pos) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::next_position_action>(
+                this->get_id(), pos);
+        }
+
+        /// Return the element stored at position \a pos in the table of the
+        /// partition_unordered_map component.
+        std::pair<Key, T> get_position_value(
+            launch::sync_policy, std::size_t pos) const
+        {
+            return get_position_value(pos).get();
+        }
+
+        future<std::pair<Key, T>> get_position_value(std::size_t pos) const
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<
+                typename server_type::get_position_value_action>(
+                this->get_id(), pos);
+        }
+
         /// Erase all values with the given key from the partition_unordered_map
         /// container.
         ///
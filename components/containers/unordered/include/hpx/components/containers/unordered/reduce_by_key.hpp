@@ -0,0 +1,354 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/containers/unordered/reduce_by_key.hpp
+/// \brief Distributed group-by of the elements of a segmented range into an
+///        hpx::unordered_map.
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/components/containers/unordered/flat_unordered_map.hpp>
+#include <hpx/components/containers/unordered/hash_shuffle.hpp>
+#include <hpx/components/containers/unordered/unordered_map.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::distributed::detail {
+
+    /// \cond NOINTERNAL
+
+    // The reduced values sent to one site or written to one partition.
+    template <typename Key, typename T>
+    struct reduce_by_key_batch
+    {
+        std::vector<Key> keys_;
+        std::vector<T> values_;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned /* version */)
+        {
+            // clang-format off
+            ar & keys_ & values_;
+            // clang-format on
+        }
+    };
+
+    template <typename Table, typename Key, typename Value, typename Reduce>
+    void reduce_by_key_accumulate(
+        Table& table, Key const& key, Value&& value, Reduce& reduce)
+    {
+        // try_emplace leaves the value untouched if the key is already stored
+        auto result = table.try_emplace(key, HPX_FORWARD(Value, value));
+        if (!result.second)
+        {
+            result.first->second = HPX_INVOKE(reduce,
+                HPX_MOVE(result.first->second), HPX_FORWARD(Value, value));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Reduce the local range of one site, this function is executed on the
+    // locality of the segment. All sites run concurrently and exchange their
+    // pre-aggregated values through a communicator. Every site reduces the
+    // values of the keys belonging to the partitions it owns and writes the
+    // results into these partitions.
+    template <typename LocalIter, typename Key, typename T, typename Hash,
+        typename KeyEqual, typename KeyOf, typename ValueOf, typename Reduce>
+    void reduce_by_key_segment(std::string basename, std::size_t num_sites,
+        std::size_t this_site, LocalIter first, LocalIter last,
+        std::vector<hpx::id_type> partitions, std::vector<std::size_t> owners,
+        hpx::detail::unordered_hasher<Hash> hasher,
+        hpx::detail::unordered_comparator<KeyEqual> equal, KeyOf key_of,
+        ValueOf value_of, Reduce reduce)
+    {
+        using traits = hpx::traits::segmented_local_iterator_traits<LocalIter>;
+        using table_type = hpx::detail::flat_unordered_map<Key, T,
+            hpx::detail::unordered_hasher<Hash>,
+            hpx::detail::unordered_comparator<KeyEqual>>;
+        using batch_type = reduce_by_key_batch<Key, T>;
+
+        HPX_ASSERT(owners.size() == partitions.size());
+
+        // pre-aggregate the local data, only one value per key is sent
+        table_type table(0, hasher, equal);
+
+        auto const end = traits::local(last);
+        for (auto it = traits::local(first); it != end; ++it)
+        {
+            reduce_by_key_accumulate(table, HPX_INVOKE(key_of, *it),
+                HPX_INVOKE(value_of, *it), reduce);
+        }
+
+        if (num_sites != 1)
+        {
+            std::vector<batch_type> batches(num_sites);
+            for (auto& value : table)
+            {
+                batch_type& batch =
+                    batches[owners[hasher(value.first) % partitions.size()]];
+                batch.keys_.push_back(value.first);
+                batch.values_.push_back(HPX_MOVE(value.second));
+            }
+
+            using namespace hpx::collectives;
+
+            communicator comm = create_communicator(basename.c_str(),
+                num_sites_arg(num_sites), this_site_arg(this_site));
+
+            // send the values of every key to the site owning it and reduce
+            // the received values
+            batches =
+                all_to_all(comm, HPX_MOVE(batches), this_site_arg(this_site))
+                    .get();
+
+            table.clear();
+            for (batch_type& batch : batches)
+            {
+                HPX_ASSERT(batch.keys_.size() == batch.values_.size());
+                for (std::size_t i = 0; i != batch.keys_.size(); ++i)
+                {
+                    reduce_by_key_accumulate(table, batch.keys_[i],
+                        HPX_MOVE(batch.values_[i]), reduce);
+                }
+            }
+        }
+
+        // every partition is written using a single operation
+        std::vector<batch_type> parts(partitions.size());
+        for (auto& value : table)
+        {
+            std::size_t const part = hasher(value.first) % partitions.size();
+            HPX_ASSERT(owners[part] == this_site);
+
+            parts[part].keys_.push_back(value.first);
+            parts[part].values_.push_back(HPX_MOVE(value.second));
+        }
+
+        std::vector<hpx::future<void>> writes;
+        for (std::size_t part = 0; part != parts.size(); ++part)
+        {
+            if (!parts[part].keys_.empty())
+            {
+                writes.push_back(
+                    hpx::partition_unordered_map<Key, T, Hash, KeyEqual>(
+                        partitions[part])
+                        .set_values(parts[part].keys_, parts[part].values_));
+            }
+        }
+
+        hpx::wait_all(writes);
+        for (hpx::future<void>& f : writes)
+        {
+            f.get();    // rethrow exceptions
+        }
+    }
+
+    template <typename LocalIter, typename Key, typename T, typename Hash,
+        typename KeyEqual, typename KeyOf, typename ValueOf, typename Reduce>
+    struct reduce_by_key_segment_action
+      : hpx::actions::make_action<void (*)(std::string, std::size_t,
+                                      std::size_t, LocalIter, LocalIter,
+                                      std::vector<hpx::id_type>,
+                                      std::vector<std::size_t>,
+                                      hpx::detail::unordered_hasher<Hash>,
+                                      hpx::detail::unordered_comparator<
+                                          KeyEqual>,
+                                      KeyOf, ValueOf, Reduce),
+            &reduce_by_key_segment<LocalIter, Key, T, Hash, KeyEqual, KeyOf,
+                ValueOf, Reduce>,
+            reduce_by_key_segment_action<LocalIter, Key, T, Hash, KeyEqual,
+                KeyOf, ValueOf, Reduce>>::type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Distributed hash aggregation: every segment reduces the values of its
+    // elements by key, sends the pre-aggregated values to the sites owning
+    // the partitions of the keys in the destination, which reduce the
+    // received values and write the results.
+    template <typename ExPolicy, typename SegIter, typename Key, typename T,
+        typename Hash, typename KeyEqual, typename KeyOf, typename ValueOf,
+        typename Reduce>
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy>
+    segmented_reduce_by_key(ExPolicy const&, SegIter first, SegIter last,
+        hpx::unordered_map<Key, T, Hash, KeyEqual>& dest, KeyOf&& key_of,
+        ValueOf&& value_of, Reduce&& reduce)
+    {
+        using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+        using local_iterator_type = typename traits::local_iterator;
+        using result = hpx::parallel::util::detail::algorithm_result<ExPolicy>;
+
+        auto const ranges = hpx::parallel::detail::segment_ranges(first, last);
+        if (ranges.empty())
+        {
+            return result::get();
+        }
+
+        std::vector<hpx::id_type> sites;
+        sites.reserve(ranges.size());
+        for (auto const& range : ranges)
+        {
+            sites.push_back(range.id);
+        }
+
+        std::vector<hpx::id_type> const partitions = dest.get_partition_ids();
+        std::vector<std::size_t> const owners =
+            hash_shuffle_owners(sites, partitions);
+
+        std::string const basename = hpx::parallel::detail::segmented_basename(
+            "distributed_reduce_by_key");
+
+        // all segments have to take part concurrently, even for a sequenced
+        // execution policy
+        using key_of_type = std::decay_t<KeyOf>;
+        using value_of_type = std::decay_t<ValueOf>;
+        using reduce_type = std::decay_t<Reduce>;
+        reduce_by_key_segment_action<local_iterator_type, Key, T, Hash,
+            KeyEqual, key_of_type, value_of_type, reduce_type>
+            act;
+
+        hpx::detail::unordered_hasher<Hash> const hasher(dest.hash_function());
+        hpx::detail::unordered_comparator<KeyEqual> const equal(dest.key_eq());
+
+        std::vector<hpx::future<void>> segments;
+        segments.reserve(ranges.size());
+        for (std::size_t i = 0; i != ranges.size(); ++i)
+        {
+            segments.push_back(hpx::async(act, hpx::colocated(ranges[i].id),
+                basename, ranges.size(), i, ranges[i].first, ranges[i].last,
+                partitions, owners, hasher, equal, key_of_type(key_of),
+                value_of_type(value_of), reduce_type(reduce)));
+        }
+
+        return result::get(hpx::dataflow(
+            [](std::vector<hpx::future<void>>&& r) -> void {
+                // handle any remote exceptions, will throw on error
+                std::list<std::exception_ptr> errors;
+                hpx::parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy>::call(r, errors);
+            },
+            HPX_MOVE(segments)));
+    }
+    /// \endcond
+}    // namespace hpx::distributed::detail
+
+namespace hpx::distributed {
+
+    /// Groups the elements in the range [first, last) by their keys and
+    /// stores the reduction of the values of every group in \a dest. The
+    /// elements are hash-partitioned to the localities owning the partitions
+    /// of their keys in \a dest. Every segment of the input reduces the
+    /// values of its elements by key before the values are exchanged, which
+    /// sends a single value per key and segment over the network.
+    ///
+    /// \note   Complexity: O(\a last - \a first) applications of the
+    ///         projections and of \a reduce.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     All segments take part in the operation
+    ///                     concurrently, the policy only controls whether
+    ///                     the call is asynchronous.
+    /// \tparam SegIter     The type of the segmented iterators used
+    ///                     (deduced), for instance the iterators of a
+    ///                     partitioned_vector or of an unordered_map.
+    /// \tparam KeyOf       The type of the projection returning the key of
+    ///                     an element (deduced).
+    /// \tparam ValueOf     The type of the projection returning the value of
+    ///                     an element (deduced).
+    /// \tparam Reduce      The type of the binary reduction (deduced).
+    ///
+    /// \param policy       The execution policy to use.
+    /// \param first        Refers to the beginning of the elements to group.
+    /// \param last         Refers to the end of the elements to group.
+    /// \param dest         The unordered_map receiving the reduced values.
+    /// \param key_of       Returns the key of an element, the result has to
+    ///                     be convertible to \a Key.
+    /// \param value_of     Returns the value of an element, the result has
+    ///                     to be convertible to \a T.
+    /// \param reduce       Combines two values of type \a T, it has to be
+    ///                     associative and commutative as the order in which
+    ///                     the values of a group are combined is unspecified.
+    ///
+    /// The projections and \a reduce are invoked on the localities of the
+    /// segments, they have to be serializable. The reduced value of every
+    /// key replaces any value previously stored in \a dest for this key,
+    /// all other elements of \a dest are left unchanged.
+    ///
+    /// \returns  The \a reduce_by_key algorithm returns a \a hpx::future<void>
+    ///           if the execution policy is of type \a sequenced_task_policy
+    ///           or \a parallel_task_policy and returns \a void otherwise.
+    ///
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Key, typename T,
+        typename Hash, typename KeyEqual, typename KeyOf, typename ValueOf,
+        typename Reduce = std::plus<T>,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> reduce_by_key(
+        ExPolicy&& policy, SegIter first, SegIter last,
+        hpx::unordered_map<Key, T, Hash, KeyEqual>& dest, KeyOf key_of,
+        ValueOf value_of, Reduce reduce = Reduce())
+    {
+        return detail::segmented_reduce_by_key(HPX_FORWARD(ExPolicy, policy),
+            first, last, dest, HPX_MOVE(key_of), HPX_MOVE(value_of),
+            HPX_MOVE(reduce));
+    }
+
+    /// Groups the key/value pairs in the range [first, last) by their keys
+    /// and stores the reduction of the values of every group in \a dest.
+    /// This is equivalent to invoking \a reduce_by_key with \a pair_key and
+    /// \a pair_value as the projections, which allows to aggregate the
+    /// elements of an unordered_map into another one.
+    ///
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Key, typename T,
+        typename Hash, typename KeyEqual, typename Reduce = std::plus<T>,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> reduce_by_key(
+        ExPolicy&& policy, SegIter first, SegIter last,
+        hpx::unordered_map<Key, T, Hash, KeyEqual>& dest,
+        Reduce reduce = Reduce())
+    {
+        return detail::segmented_reduce_by_key(HPX_FORWARD(ExPolicy, policy),
+            first, last, dest, pair_key(), pair_value(), HPX_MOVE(reduce));
+    }
+}    // namespace hpx::distributed
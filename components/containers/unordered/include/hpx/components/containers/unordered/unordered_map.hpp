@@ -11,17 +11,19 @@
 #include <hpx/config.hpp>
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_local/dataflow.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/distribution_policies/container_distribution_policy.hpp>
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/runtime_components/distributed_metadata_base.hpp>
 #include <hpx/runtime_components/new.hpp>
 #include <hpx/runtime_distributed/copy_component.hpp>
 #include <hpx/serialization/serialize.hpp>
-#include <hpx/serialization/unordered_map.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/type_support/unused.hpp>
 
@@ -159,6 +161,17 @@ namespace hpx {
                 return hasher_(key);
             }
 
+            Hash const& get() const
+            {
+                return hasher_;
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & hasher_;
+            }
+
             Hash hasher_;
         };
 
@@ -174,6 +187,11 @@ namespace hpx {
             {
                 return Hash()(key);
             }
+
+            Hash get() const
+            {
+                return Hash();
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -196,6 +214,17 @@ namespace hpx {
                 return equal_(lhs, rhs);
             }
 
+            KeyEqual const& get() const
+            {
+                return equal_;
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & equal_;
+            }
+
             KeyEqual equal_;
         };
 
@@ -211,6 +240,11 @@ namespace hpx {
             {
                 return KeyEqual()(lhs, rhs);
             }
+
+            KeyEqual get() const
+            {
+                return KeyEqual();
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -366,15 +400,70 @@ namespace hpx {
             return this->hasher_(key) % partitions_.size();
         }
 
-        std::vector<hpx::id_type> get_partition_ids() const
+        ///////////////////////////////////////////////////////////////////////
+        static constexpr size_type npos = partition_unordered_map_server::npos;
+
+        // Return the position of the first element stored at or after the
+        // position pos in the table of the given partition
+        size_type next_position(size_type part, size_type pos) const
         {
-            std::vector<hpx::id_type> ids;
-            ids.reserve(partitions_.size());
-            for (partition_data const& pd : partitions_)
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+                return part_data.local_data_->next_position(pos);
+
+            return partition_unordered_map_client(part_data.partition_)
+                .next_position(launch::sync, pos);
+        }
+
+        // Return the partition and the position of the first element stored
+        // at or after the position pos in the table of the given partition
+        std::pair<size_type, size_type> next_element(
+            size_type part, size_type pos) const
+        {
+            for (/**/; part < partitions_.size(); ++part, pos = 0)
             {
-                ids.push_back(pd.get_id());
+                size_type next = next_position(part, pos);
+                if (next != npos)
+                    return std::make_pair(part, next);
             }
-            return ids;
+            return std::make_pair(partitions_.size(), npos);
+        }
+
+        // The given keys grouped by the partition they belong to, preserving
+        // their relative order
+        struct partitioned_keys
+        {
+            // sequence numbers of the referenced partitions
+            std::vector<std::size_t> parts_;
+
+            // keys belonging to each of the referenced partitions
+            std::vector<std::vector<Key>> keys_;
+
+            // original positions of the keys of each partition
+            std::vector<std::vector<std::size_t>> positions_;
+        };
+
+        partitioned_keys group_by_partition(std::vector<Key> const& keys) const
+        {
+            // map partitions to their index in the result
+            std::vector<std::size_t> index(partitions_.size(), npos);
+
+            partitioned_keys result;
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                std::size_t part = get_partition(keys[i]);
+                if (index[part] == npos)
+                {
+                    index[part] = result.parts_.size();
+                    result.parts_.push_back(part);
+                    result.keys_.emplace_back();
+                    result.positions_.emplace_back();
+                }
+
+                result.keys_[index[part]].push_back(keys[i]);
+                result.positions_[index[part]].push_back(i);
+            }
+            return result;
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -629,6 +718,32 @@ namespace hpx {
             return partitions_.size();
         }
 
+        /// Returns the global ids of the partitions of this unordered_map. The
+        /// partition a key is stored in is given by the value of the hash
+        /// function for the key modulo the number of partitions.
+        std::vector<hpx::id_type> get_partition_ids() const
+        {
+            std::vector<hpx::id_type> ids;
+            ids.reserve(partitions_.size());
+            for (partition_data const& pd : partitions_)
+            {
+                ids.push_back(pd.get_id());
+            }
+            return ids;
+        }
+
+        /// Returns the hash function used to assign the keys to partitions.
+        Hash hash_function() const
+        {
+            return this->hasher_.get();
+        }
+
+        /// Returns the function used to compare the keys for equality.
+        KeyEqual key_eq() const
+        {
+            return this->equal_.get();
+        }
+
         /// \brief Array subscript operator. This does not throw any exception.
         ///
         /// \param pos Position of the element in the unordered_map
@@ -878,6 +993,163 @@ namespace hpx {
                 .erase(key);
         }
 
+        /// Asynchronously look up the elements with the given \a keys in the
+        /// unordered_map. The keys are grouped by the partition they belong
+        /// to, every partition is accessed using a single operation.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the order of the given keys. Keys which are not stored in
+        ///         the unordered_map result in an empty optional.
+        ///
+        future<std::vector<hpx::optional<T>>> find_values(
+            std::vector<Key> const& keys) const
+        {
+            if (keys.empty())
+            {
+                return make_ready_future(std::vector<hpx::optional<T>>());
+            }
+
+            partitioned_keys parts = group_by_partition(keys);
+
+            std::vector<future<std::vector<hpx::optional<T>>>> part_values;
+            part_values.reserve(parts.parts_.size());
+
+            for (std::size_t i = 0; i != parts.parts_.size(); ++i)
+            {
+                partition_data const& part_data = partitions_[parts.parts_[i]];
+                if (part_data.local_data_)
+                {
+                    part_values.push_back(make_ready_future(
+                        part_data.local_data_->find_values(parts.keys_[i])));
+                }
+                else
+                {
+                    part_values.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .find_values(parts.keys_[i]));
+                }
+            }
+
+            // This helper function unwraps the vectors from each partition
+            // and places the values at their original positions
+            auto merge_func =
+                [size = keys.size(), positions = HPX_MOVE(parts.positions_)](
+                    std::vector<future<std::vector<hpx::optional<T>>>>&&
+                        part_values_f) -> std::vector<hpx::optional<T>> {
+                std::vector<hpx::optional<T>> values(size);
+                for (std::size_t i = 0; i != part_values_f.size(); ++i)
+                {
+                    std::vector<hpx::optional<T>> part_values =
+                        part_values_f[i].get();
+                    HPX_ASSERT(part_values.size() == positions[i].size());
+
+                    for (std::size_t j = 0; j != part_values.size(); ++j)
+                    {
+                        values[positions[i][j]] = HPX_MOVE(part_values[j]);
+                    }
+                }
+                return values;
+            };
+
+            return hpx::dataflow(
+                launch::sync, HPX_MOVE(merge_func), HPX_MOVE(part_values));
+        }
+
+        /// Look up the elements with the given \a keys in the unordered_map.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements in the order of the
+        ///         given keys. Keys which are not stored in the unordered_map
+        ///         result in an empty optional.
+        ///
+        std::vector<hpx::optional<T>> find_values(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return find_values(keys).get();
+        }
+
+        /// Asynchronously insert the values \a vals with the given \a keys
+        /// into the unordered_map. Elements with keys already stored in the
+        /// unordered_map are left unchanged. The keys are grouped by the
+        /// partition they belong to, every partition is accessed using a
+        /// single operation.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be inserted
+        ///
+        /// \return Returns the hpx::future to the number of inserted
+        ///         elements.
+        ///
+        future<std::size_t> insert_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+            if (keys.empty())
+            {
+                return make_ready_future(std::size_t(0));
+            }
+
+            partitioned_keys parts = group_by_partition(keys);
+
+            std::vector<future<std::size_t>> inserted;
+            inserted.reserve(parts.parts_.size());
+
+            for (std::size_t i = 0; i != parts.parts_.size(); ++i)
+            {
+                std::vector<T> part_vals;
+                part_vals.reserve(parts.positions_[i].size());
+                for (std::size_t pos : parts.positions_[i])
+                {
+                    part_vals.push_back(vals[pos]);
+                }
+
+                partition_data const& part_data = partitions_[parts.parts_[i]];
+                if (part_data.local_data_)
+                {
+                    inserted.push_back(
+                        make_ready_future(part_data.local_data_->insert_values(
+                            parts.keys_[i], part_vals)));
+                }
+                else
+                {
+                    inserted.push_back(
+                        partition_unordered_map_client(part_data.partition_)
+                            .insert_values(parts.keys_[i], part_vals));
+                }
+            }
+
+            return hpx::dataflow(
+                launch::sync,
+                [](std::vector<future<std::size_t>>&& inserted_f)
+                    -> std::size_t {
+                    std::size_t result = 0;
+                    for (future<std::size_t>& f : inserted_f)
+                    {
+                        result += f.get();
+                    }
+                    return result;
+                },
+                HPX_MOVE(inserted));
+        }
+
+        /// Insert the values \a vals with the given \a keys into the
+        /// unordered_map. Elements with keys already stored in the
+        /// unordered_map are left unchanged.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be inserted
+        ///
+        /// \return Returns the number of inserted elements.
+        ///
+        std::size_t insert_values(launch::sync_policy,
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            return insert_values(keys, vals).get();
+        }
+
         ///////////////////////////////////////////////////////////////////////
         typedef segmented::segment_unordered_map_iterator<Key, T, Hash,
             KeyEqual, typename partitions_vector_type::iterator>
@@ -916,5 +1188,129 @@ namespace hpx {
         {
             return const_segment_iterator(partitions_.cend(), this);
         }
+
+        ///////////////////////////////////////////////////////////////////////
+        typedef segmented::unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef segmented::const_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            const_iterator;
+
+        typedef segmented::local_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            local_iterator;
+        typedef segmented::const_local_unordered_map_iterator<Key, T, Hash,
+            KeyEqual>
+            const_local_iterator;
+
+        /// Return the iterator referring to the first element of the
+        /// unordered_map.
+        ///
+        /// \note Inserting elements into the unordered_map invalidates all
+        ///       iterators.
+        ///
+        iterator begin()
+        {
+            return get_iterator(0, 0);
+        }
+        const_iterator begin() const
+        {
+            return get_iterator(0, 0);
+        }
+        const_iterator cbegin() const
+        {
+            return get_iterator(0, 0);
+        }
+
+        /// Return the iterator referring past the last element of the
+        /// unordered_map.
+        iterator end()
+        {
+            return iterator(this, partitions_.size(), npos);
+        }
+        const_iterator end() const
+        {
+            return const_iterator(this, partitions_.size(), npos);
+        }
+        const_iterator cend() const
+        {
+            return const_iterator(this, partitions_.size(), npos);
+        }
+
+        // Return the iterator referring to the first element stored at or
+        // after the given position in the table of the given partition.
+        iterator get_iterator(size_type part, size_type pos)
+        {
+            std::pair<size_type, size_type> p = next_element(part, pos);
+            return iterator(this, p.first, p.second);
+        }
+        const_iterator get_iterator(size_type part, size_type pos) const
+        {
+            std::pair<size_type, size_type> p = next_element(part, pos);
+            return const_iterator(this, p.first, p.second);
+        }
+
+        // Return the element stored at the given position in the table of the
+        // given partition.
+        std::pair<Key, T> get_position_value(
+            launch::sync_policy, size_type part, size_type pos) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+                return part_data.local_data_->get_position_value(pos);
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_position_value(launch::sync, pos);
+        }
+
+        // Return the segment iterator referring to the given partition.
+        segment_iterator get_segment_iterator(size_type part)
+        {
+            return segment_iterator(partitions_.begin() + part, this);
+        }
+        const_segment_iterator get_segment_iterator(size_type part) const
+        {
+            return const_segment_iterator(partitions_.cbegin() + part, this);
+        }
+
+        // Return the sequence number of the partition referred to by the
+        // given segment iterator.
+        template <typename SegmentIter>
+        size_type get_partition_index(SegmentIter const& it) const
+        {
+            return static_cast<size_type>(it.base() - partitions_.cbegin());
+        }
+
+        // Return the local iterator referring to the given position in the
+        // table of the given partition.
+        local_iterator get_local_iterator(size_type part, size_type pos)
+        {
+            if (part == partitions_.size())
+            {
+                // refer to the end of the last partition
+                HPX_ASSERT(part != 0);
+                --part;
+                pos = npos;
+            }
+
+            partition_data const& part_data = partitions_[part];
+            return local_iterator(
+                part_data.partition_, pos, part_data.local_data_);
+        }
+        const_local_iterator get_local_iterator(
+            size_type part, size_type pos) const
+        {
+            if (part == partitions_.size())
+            {
+                // refer to the end of the last partition
+                HPX_ASSERT(part != 0);
+                --part;
+                pos = npos;
+            }
+
+            partition_data const& part_data = partitions_[part];
+            return const_local_iterator(
+                part_data.partition_, pos, part_data.local_data_);
+        }
     };
 }    // namespace hpx
@@ -14,16 +14,22 @@
 // http://lafstern.org/matt/segmented.pdf.
 
 #include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
 #include <hpx/iterator_support/iterator_adaptor.hpp>
+#include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/naming_base/id_type.hpp>
 
 #include <hpx/components/containers/unordered/partition_unordered_map_component.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <limits>
 #include <memory>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace hpx {
@@ -79,8 +85,9 @@ namespace hpx { namespace segmented {
 
         bool is_at_end() const
         {
-            return data_ == 0 ||
-                this->base_type::base_reference() == data_->partitions_.end();
+            return data_ == nullptr ||
+                this->base_type::base_reference() ==
+                    data_->segment_end().base();
         }
 
     private:
@@ -117,101 +124,761 @@ namespace hpx { namespace segmented {
 
         bool is_at_end() const
         {
-            return data_ == 0 ||
-                this->base_type::base_reference() == data_->partitions_.end();
+            return data_ == nullptr ||
+                this->base_type::base_reference() ==
+                    data_->segment_end().base();
         }
 
     private:
         unordered_map<Key, T, Hash, KeyEqual> const* data_;
     };
 
-    //     ///////////////////////////////////////////////////////////////////////////
-    //     namespace detail
-    //     {
-    //         template <typename BaseIterator>
-    //         struct is_requested_locality
-    //         {
-    //             typedef typename std::iterator_traits<BaseIterator>::reference
-    //                 reference;
-    //
-    //             is_requested_locality(std::uint32_t locality_id =
-    //                     naming::invalid_locality_id)
-    //               : locality_id_(locality_id)
-    //             {}
-    //
-    //             bool operator()(reference val) const
-    //             {
-    //                 return locality_id_ == naming::invalid_locality_id ||
-    //                        locality_id_ == val.locality_id_;
-    //             }
-    //
-    //             std::uint32_t locality_id_;
-    //         };
-    //     }
-    //
-    //     /// This class implement the local segmented iterator for the
-    //     /// hpx::partitioned_vector.
-    //     template <typename T, typename BaseIter>
-    //     class local_segment_vector_iterator
-    //       : public hpx::util::iterator_adaptor<
-    //             segmented::local_segment_vector_iterator<T, BaseIter>, BaseIter,
-    //             std::vector<T>, std::forward_iterator_tag
-    //         >
-    //     {
-    //     private:
-    //         typedef hpx::util::iterator_adaptor<
-    //                 segmented::local_segment_vector_iterator<T, BaseIter>, BaseIter,
-    //                 std::vector<T>, std::forward_iterator_tag
-    //             > base_type;
-    //         typedef detail::is_requested_locality<BaseIter> predicate;
-    //
-    //     public:
-    //         local_segment_vector_iterator(BaseIter const& end)
-    //           : base_type(end), predicate_(), end_(end)
-    //         {}
-    //
-    //         local_segment_vector_iterator(
-    //                 BaseIter const& it, BaseIter const& end,
-    //                 std::uint32_t locality_id)
-    //           : base_type(it), predicate_(locality_id), end_(end)
-    //         {
-    //             satisfy_predicate();
-    //         }
-    //
-    //         bool is_at_end() const
-    //         {
-    //             return !data_ || this->base() == end_;
-    //         }
-    //
-    //     private:
-    //         friend class hpx::util::iterator_core_access;
-    //
-    //         typename base_type::reference dereference() const
-    //         {
-    //             HPX_ASSERT(!is_at_end());
-    //             return data_->get_data();
-    //         }
-    //
-    //         void increment()
-    //         {
-    //             ++(this->base_reference());
-    //             satisfy_predicate();
-    //         }
-    //
-    //         void satisfy_predicate()
-    //         {
-    //             while (this->base() != end_ && !predicate_(*this->base()))
-    //                 ++(this->base_reference());
-    //
-    //             if (this->base() != end_)
-    //                 data_ = this->base()->local_data_;
-    //             else
-    //                 data_.reset();
-    //         }
-    //
-    //     private:
-    //         std::shared_ptr<server::partitioned_vector<T> > data_;
-    //         predicate predicate_;
-    //         BaseIter end_;
-    //     };
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class local_unordered_map_iterator;
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class const_local_unordered_map_iterator;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This class wraps plain a iterator into the data of a partition of the
+    // unordered_map
+    template <typename Key, typename T, typename Hash, typename KeyEqual,
+        typename BaseIter>
+    class local_raw_unordered_map_iterator
+      : public hpx::util::iterator_adaptor<
+            local_raw_unordered_map_iterator<Key, T, Hash, KeyEqual, BaseIter>,
+            BaseIter>
+    {
+    private:
+        typedef hpx::util::iterator_adaptor<
+            local_raw_unordered_map_iterator<Key, T, Hash, KeyEqual, BaseIter>,
+            BaseIter>
+            base_type;
+        typedef server::partition_unordered_map<Key, T, Hash, KeyEqual>
+            server_type;
+
+    public:
+        typedef segmented::local_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            local_iterator;
+
+        local_raw_unordered_map_iterator() = default;
+
+        local_raw_unordered_map_iterator(
+            BaseIter const& it, std::shared_ptr<server_type> data)
+          : base_type(it)
+          , data_(HPX_MOVE(data))
+        {
+        }
+
+        local_iterator remote() const
+        {
+            HPX_ASSERT(data_);
+            return local_iterator(
+                partition_unordered_map<Key, T, Hash, KeyEqual>(
+                    data_->get_id()),
+                data_->position(this->base()), data_);
+        }
+
+    private:
+        std::shared_ptr<server_type> data_;
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual,
+        typename BaseIter>
+    class const_local_raw_unordered_map_iterator
+      : public hpx::util::iterator_adaptor<
+            const_local_raw_unordered_map_iterator<Key, T, Hash, KeyEqual,
+                BaseIter>,
+            BaseIter>
+    {
+    private:
+        typedef hpx::util::iterator_adaptor<
+            const_local_raw_unordered_map_iterator<Key, T, Hash, KeyEqual,
+                BaseIter>,
+            BaseIter>
+            base_type;
+        typedef server::partition_unordered_map<Key, T, Hash, KeyEqual>
+            server_type;
+
+    public:
+        typedef segmented::const_local_unordered_map_iterator<Key, T, Hash,
+            KeyEqual>
+            local_iterator;
+
+        const_local_raw_unordered_map_iterator() = default;
+
+        const_local_raw_unordered_map_iterator(
+            BaseIter const& it, std::shared_ptr<server_type> data)
+          : base_type(it)
+          , data_(HPX_MOVE(data))
+        {
+        }
+
+        local_iterator remote() const
+        {
+            HPX_ASSERT(data_);
+            return local_iterator(
+                partition_unordered_map<Key, T, Hash, KeyEqual>(
+                    data_->get_id()),
+                data_->position(this->base()), data_);
+        }
+
+    private:
+        std::shared_ptr<server_type> data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// This class implements the local iterator functionality for the
+    /// partitioned backend of a hpx::unordered_map. The iterator refers to an
+    /// element by its position in the table of the partition, which stays
+    /// valid as long as no elements are inserted into the partition.
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class local_unordered_map_iterator
+      : public hpx::util::iterator_facade<
+            local_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key const, T>, std::forward_iterator_tag,
+            std::pair<Key const, T>>
+    {
+    private:
+        typedef hpx::util::iterator_facade<
+            local_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key const, T>, std::forward_iterator_tag,
+            std::pair<Key const, T>>
+            base_type;
+        typedef server::partition_unordered_map<Key, T, Hash, KeyEqual>
+            server_type;
+
+    public:
+        typedef std::size_t size_type;
+
+        typedef segmented::local_raw_unordered_map_iterator<Key, T, Hash,
+            KeyEqual, typename server_type::iterator_type>
+            local_raw_iterator;
+        typedef segmented::const_local_raw_unordered_map_iterator<Key, T, Hash,
+            KeyEqual, typename server_type::const_iterator_type>
+            local_raw_const_iterator;
+
+        // constructors
+        local_unordered_map_iterator() = default;
+
+        local_unordered_map_iterator(
+            partition_unordered_map<Key, T, Hash, KeyEqual> partition,
+            size_type position, std::shared_ptr<server_type> data)
+          : partition_(HPX_MOVE(partition))
+          , position_(position)
+          , data_(HPX_MOVE(data))
+        {
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        local_raw_iterator local()
+        {
+            std::shared_ptr<server_type> const& data = get_data();
+            return local_raw_iterator(
+                data->iterator_at(position_), data);    //-V522
+        }
+        local_raw_const_iterator local() const
+        {
+            std::shared_ptr<server_type> const& data = get_data();
+            return local_raw_const_iterator(
+                data->iterator_at(position_), data);    //-V522
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned /* version */)
+        {
+            ar & partition_ & position_;
+        }
+
+    protected:
+        friend class hpx::util::iterator_core_access;
+
+        bool equal(local_unordered_map_iterator const& other) const
+        {
+            return partition_ == other.partition_ &&
+                position_ == other.position_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(position_ != server_type::npos);
+
+            std::pair<Key, T> value = data_ ?
+                data_->get_position_value(position_) :
+                partition_.get_position_value(launch::sync, position_);
+
+            return {HPX_MOVE(value.first), HPX_MOVE(value.second)};
+        }
+
+        void increment()
+        {
+            HPX_ASSERT(position_ != server_type::npos);
+            position_ = data_ ?
+                data_->next_position(position_ + 1) :
+                partition_.next_position(launch::sync, position_ + 1);
+        }
+
+    public:
+        partition_unordered_map<Key, T, Hash, KeyEqual> const& get_partition()
+            const
+        {
+            return partition_;
+        }
+
+        size_type get_position() const
+        {
+            return position_;
+        }
+
+        std::shared_ptr<server_type> const& get_data() const
+        {
+            if (!data_ && partition_)
+            {
+                data_ = partition_.get_ptr();
+            }
+            return data_;
+        }
+
+    protected:
+        // refer to a partition of the unordered_map
+        partition_unordered_map<Key, T, Hash, KeyEqual> partition_;
+
+        // position in the table of the referenced partition
+        size_type position_ = server_type::npos;
+
+        // caching address of component
+        mutable std::shared_ptr<server_type> data_;
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class const_local_unordered_map_iterator
+      : public hpx::util::iterator_facade<
+            const_local_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key const, T> const, std::forward_iterator_tag,
+            std::pair<Key const, T> const>
+    {
+    private:
+        typedef hpx::util::iterator_facade<
+            const_local_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key const, T> const, std::forward_iterator_tag,
+            std::pair<Key const, T> const>
+            base_type;
+        typedef server::partition_unordered_map<Key, T, Hash, KeyEqual>
+            server_type;
+
+    public:
+        typedef std::size_t size_type;
+
+        typedef segmented::const_local_raw_unordered_map_iterator<Key, T, Hash,
+            KeyEqual, typename server_type::const_iterator_type>
+            local_raw_iterator;
+        typedef local_raw_iterator local_raw_const_iterator;
+
+        // constructors
+        const_local_unordered_map_iterator() = default;
+
+        const_local_unordered_map_iterator(
+            partition_unordered_map<Key, T, Hash, KeyEqual> partition,
+            size_type position, std::shared_ptr<server_type> data)
+          : partition_(HPX_MOVE(partition))
+          , position_(position)
+          , data_(HPX_MOVE(data))
+        {
+        }
+
+        const_local_unordered_map_iterator(
+            local_unordered_map_iterator<Key, T, Hash, KeyEqual> const& it)
+          : partition_(it.get_partition())
+          , position_(it.get_position())
+          , data_(it.get_data())
+        {
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        local_raw_const_iterator local() const
+        {
+            std::shared_ptr<server_type> const& data = get_data();
+            return local_raw_const_iterator(
+                data->iterator_at(position_), data);    //-V522
+        }
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned /* version */)
+        {
+            ar & partition_ & position_;
+        }
+
+    protected:
+        friend class hpx::util::iterator_core_access;
+
+        bool equal(const_local_unordered_map_iterator const& other) const
+        {
+            return partition_ == other.partition_ &&
+                position_ == other.position_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(position_ != server_type::npos);
+
+            std::pair<Key, T> value = data_ ?
+                data_->get_position_value(position_) :
+                partition_.get_position_value(launch::sync, position_);
+
+            return {HPX_MOVE(value.first), HPX_MOVE(value.second)};
+        }
+
+        void increment()
+        {
+            HPX_ASSERT(position_ != server_type::npos);
+            position_ = data_ ?
+                data_->next_position(position_ + 1) :
+                partition_.next_position(launch::sync, position_ + 1);
+        }
+
+    public:
+        partition_unordered_map<Key, T, Hash, KeyEqual> const& get_partition()
+            const
+        {
+            return partition_;
+        }
+
+        size_type get_position() const
+        {
+            return position_;
+        }
+
+        std::shared_ptr<server_type> const& get_data() const
+        {
+            if (!data_ && partition_)
+            {
+                data_ = partition_.get_ptr();
+            }
+            return data_;
+        }
+
+    protected:
+        // refer to a partition of the unordered_map
+        partition_unordered_map<Key, T, Hash, KeyEqual> partition_;
+
+        // position in the table of the referenced partition
+        size_type position_ = server_type::npos;
+
+        // caching address of component
+        mutable std::shared_ptr<server_type> data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// This class implements the (global) iterator functionality for
+    /// hpx::unordered_map. The iterator refers to an element by the sequence
+    /// number of its partition and its position in the table of that
+    /// partition. Dereferencing the iterator returns a copy of the element.
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class unordered_map_iterator
+      : public hpx::util::iterator_facade<
+            unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key const, T>, std::forward_iterator_tag,
+            std::pair<Key const, T>>
+    {
+    private:
+        typedef hpx::util::iterator_facade<
+            unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key const, T>, std::forward_iterator_tag,
+            std::pair<Key const, T>>
+            base_type;
+
+    public:
+        typedef std::size_t size_type;
+        typedef typename unordered_map<Key, T, Hash, KeyEqual>::segment_iterator
+            segment_iterator;
+        typedef typename unordered_map<Key, T, Hash, KeyEqual>::local_iterator
+            local_iterator;
+
+        // constructors
+        unordered_map_iterator() = default;
+
+        unordered_map_iterator(unordered_map<Key, T, Hash, KeyEqual>* data,
+            size_type part, size_type position)
+          : data_(data)
+          , part_(part)
+          , position_(position)
+        {
+        }
+
+        unordered_map<Key, T, Hash, KeyEqual>* get_data() const
+        {
+            return data_;
+        }
+
+        size_type get_partition() const
+        {
+            return part_;
+        }
+
+        size_type get_position() const
+        {
+            return position_;
+        }
+
+    protected:
+        friend class hpx::util::iterator_core_access;
+
+        bool equal(unordered_map_iterator const& other) const
+        {
+            return data_ == other.data_ && part_ == other.part_ &&
+                position_ == other.position_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(data_);
+
+            std::pair<Key, T> value =
+                data_->get_position_value(launch::sync, part_, position_);
+
+            return {HPX_MOVE(value.first), HPX_MOVE(value.second)};
+        }
+
+        void increment()
+        {
+            HPX_ASSERT(data_);
+            *this = data_->get_iterator(part_, position_ + 1);
+        }
+
+        // refer to the unordered_map
+        unordered_map<Key, T, Hash, KeyEqual>* data_ = nullptr;
+
+        // sequence number of the partition and position in its table
+        size_type part_ = 0;
+        size_type position_ = static_cast<size_type>(-1);
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class const_unordered_map_iterator
+      : public hpx::util::iterator_facade<
+            const_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key const, T> const, std::forward_iterator_tag,
+            std::pair<Key const, T> const>
+    {
+    private:
+        typedef hpx::util::iterator_facade<
+            const_unordered_map_iterator<Key, T, Hash, KeyEqual>,
+            std::pair<Key const, T> const, std::forward_iterator_tag,
+            std::pair<Key const, T> const>
+            base_type;
+
+    public:
+        typedef std::size_t size_type;
+        typedef typename unordered_map<Key, T, Hash,
+            KeyEqual>::const_segment_iterator segment_iterator;
+        typedef typename unordered_map<Key, T, Hash,
+            KeyEqual>::const_local_iterator local_iterator;
+
+        // constructors
+        const_unordered_map_iterator() = default;
+
+        const_unordered_map_iterator(
+            unordered_map<Key, T, Hash, KeyEqual> const* data, size_type part,
+            size_type position)
+          : data_(data)
+          , part_(part)
+          , position_(position)
+        {
+        }
+
+        const_unordered_map_iterator(
+            unordered_map_iterator<Key, T, Hash, KeyEqual> const& it)
+          : data_(it.get_data())
+          , part_(it.get_partition())
+          , position_(it.get_position())
+        {
+        }
+
+        unordered_map<Key, T, Hash, KeyEqual> const* get_data() const
+        {
+            return data_;
+        }
+
+        size_type get_partition() const
+        {
+            return part_;
+        }
+
+        size_type get_position() const
+        {
+            return position_;
+        }
+
+    protected:
+        friend class hpx::util::iterator_core_access;
+
+        bool equal(const_unordered_map_iterator const& other) const
+        {
+            return data_ == other.data_ && part_ == other.part_ &&
+                position_ == other.position_;
+        }
+
+        typename base_type::reference dereference() const
+        {
+            HPX_ASSERT(data_);
+
+            std::pair<Key, T> value =
+                data_->get_position_value(launch::sync, part_, position_);
+
+            return {HPX_MOVE(value.first), HPX_MOVE(value.second)};
+        }
+
+        void increment()
+        {
+            HPX_ASSERT(data_);
+            *this = data_->get_iterator(part_, position_ + 1);
+        }
+
+        // refer to the unordered_map
+        unordered_map<Key, T, Hash, KeyEqual> const* data_ = nullptr;
+
+        // sequence number of the partition and position in its table
+        size_type part_ = 0;
+        size_type position_ = static_cast<size_type>(-1);
+    };
 }}    // namespace hpx::segmented
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace traits {
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    struct segmented_iterator_traits<
+        segmented::unordered_map_iterator<Key, T, Hash, KeyEqual>>
+    {
+        typedef std::true_type is_segmented_iterator;
+
+        typedef segmented::unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef typename iterator::segment_iterator segment_iterator;
+        typedef typename iterator::local_iterator local_iterator;
+
+        typedef typename local_iterator::local_raw_iterator local_raw_iterator;
+
+        //  Conceptually this function is supposed to denote which segment
+        //  the iterator is currently pointing to (i.e. just global iterator).
+        static segment_iterator segment(iterator const& iter)
+        {
+            return iter.get_data()->get_segment_iterator(iter.get_partition());
+        }
+
+        //  This function should return which is the current segment and
+        //  the exact position to which local iterator is pointing.
+        static local_iterator local(iterator const& iter)
+        {
+            HPX_ASSERT(iter.get_data());
+            return iter.get_data()->get_local_iterator(
+                iter.get_partition(), iter.get_position());
+        }
+
+        //  Build a full iterator from the segment and local iterators
+        static iterator compose(
+            segment_iterator seg_iter, local_iterator const& local_iter)
+        {
+            hpx::unordered_map<Key, T, Hash, KeyEqual>* data =
+                seg_iter.get_data();
+
+            std::size_t part = data->get_partition_index(seg_iter);
+            if (seg_iter.is_at_end())
+            {
+                --part;    // the local iterator refers to the last segment
+            }
+
+            std::size_t position = local_iter.get_position();
+            if (position == static_cast<std::size_t>(-1))
+            {
+                // the end of a segment refers to the next element
+                return data->get_iterator(part + 1, 0);
+            }
+            return iterator(data, part, position);
+        }
+
+        //  This function should return the local iterator which is at the
+        //  beginning of the partition.
+        static local_iterator begin(segment_iterator seg_iter)
+        {
+            std::size_t position = 0;
+            if (seg_iter.is_at_end())
+            {
+                // return iterator to the end of last segment
+                --seg_iter;
+                position = static_cast<std::size_t>(-1);
+            }
+
+            return local_iterator(seg_iter.base()->partition_, position,
+                seg_iter.base()->local_data_);
+        }
+
+        //  This function should return the local iterator which is at the
+        //  end of the partition.
+        static local_iterator end(segment_iterator seg_iter)
+        {
+            if (seg_iter.is_at_end())
+            {
+                --seg_iter;    // return iterator to the end of last segment
+            }
+
+            return local_iterator(seg_iter.base()->partition_,
+                static_cast<std::size_t>(-1), seg_iter.base()->local_data_);
+        }
+
+        // Extract the base id for the segment referenced by the given segment
+        // iterator.
+        static id_type get_id(segment_iterator const& iter)
+        {
+            return iter->get_id();
+        }
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    struct segmented_iterator_traits<
+        segmented::const_unordered_map_iterator<Key, T, Hash, KeyEqual>>
+    {
+        typedef std::true_type is_segmented_iterator;
+
+        typedef segmented::const_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef typename iterator::segment_iterator segment_iterator;
+        typedef typename iterator::local_iterator local_iterator;
+
+        typedef typename local_iterator::local_raw_iterator local_raw_iterator;
+
+        //  Conceptually this function is supposed to denote which segment
+        //  the iterator is currently pointing to (i.e. just global iterator).
+        static segment_iterator segment(iterator const& iter)
+        {
+            return iter.get_data()->get_segment_iterator(iter.get_partition());
+        }
+
+        //  This function should return which is the current segment and
+        //  the exact position to which local iterator is pointing.
+        static local_iterator local(iterator const& iter)
+        {
+            HPX_ASSERT(iter.get_data());
+            return iter.get_data()->get_local_iterator(
+                iter.get_partition(), iter.get_position());
+        }
+
+        //  Build a full iterator from the segment and local iterators
+        static iterator compose(
+            segment_iterator const& seg_iter, local_iterator const& local_iter)
+        {
+            hpx::unordered_map<Key, T, Hash, KeyEqual> const* data =
+                seg_iter.get_data();
+
+            std::size_t part = data->get_partition_index(seg_iter);
+            if (seg_iter.is_at_end())
+            {
+                --part;    // the local iterator refers to the last segment
+            }
+
+            std::size_t position = local_iter.get_position();
+            if (position == static_cast<std::size_t>(-1))
+            {
+                // the end of a segment refers to the next element
+                return data->get_iterator(part + 1, 0);
+            }
+            return iterator(data, part, position);
+        }
+
+        //  This function should return the local iterator which is at the
+        //  beginning of the partition.
+        static local_iterator begin(segment_iterator seg_iter)
+        {
+            std::size_t position = 0;
+            if (seg_iter.is_at_end())
+            {
+                // return iterator to the end of last segment
+                --seg_iter;
+                position = static_cast<std::size_t>(-1);
+            }
+
+            return local_iterator(seg_iter.base()->partition_, position,
+                seg_iter.base()->local_data_);
+        }
+
+        //  This function should return the local iterator which is at the
+        //  end of the partition.
+        static local_iterator end(segment_iterator seg_iter)
+        {
+            if (seg_iter.is_at_end())
+            {
+                --seg_iter;    // return iterator to the end of last segment
+            }
+
+            return local_iterator(seg_iter.base()->partition_,
+                static_cast<std::size_t>(-1), seg_iter.base()->local_data_);
+        }
+
+        // Extract the base id for the segment referenced by the given segment
+        // iterator.
+        static id_type get_id(segment_iterator const& iter)
+        {
+            return iter->get_id();
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Some 'remote' iterators need to be mapped before being applied to the
+    // local algorithms.
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    struct segmented_local_iterator_traits<
+        segmented::local_unordered_map_iterator<Key, T, Hash, KeyEqual>>
+    {
+        typedef std::true_type is_segmented_local_iterator;
+
+        typedef segmented::unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef segmented::local_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            local_iterator;
+        typedef typename local_iterator::local_raw_iterator local_raw_iterator;
+
+        // Extract base iterator from local_iterator
+        static local_raw_iterator local(local_iterator it)
+        {
+            return it.local();
+        }
+
+        // Construct remote local_iterator from local_raw_iterator
+        static local_iterator remote(local_raw_iterator const& it)
+        {
+            return it.remote();
+        }
+    };
+
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    struct segmented_local_iterator_traits<
+        segmented::const_local_unordered_map_iterator<Key, T, Hash, KeyEqual>>
+    {
+        typedef std::true_type is_segmented_local_iterator;
+
+        typedef segmented::const_unordered_map_iterator<Key, T, Hash, KeyEqual>
+            iterator;
+        typedef segmented::const_local_unordered_map_iterator<Key, T, Hash,
+            KeyEqual>
+            local_iterator;
+        typedef typename local_iterator::local_raw_iterator local_raw_iterator;
+
+        // Extract base iterator from local_iterator
+        static local_raw_iterator local(local_iterator const& it)
+        {
+            return it.local();
+        }
+
+        // Construct remote local_iterator from local_raw_iterator
+        static local_iterator remote(local_raw_iterator const& it)
+        {
+            return it.remote();
+        }
+    };
+}}    // namespace hpx::traits
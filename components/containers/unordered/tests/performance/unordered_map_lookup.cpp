@@ -0,0 +1,173 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure lookups of random keys in an unordered_map distributed over all
+// localities, comparing one request per key (get_value) with the bulk lookup
+// (find_values) issuing one request per partition. The lookups of all
+// partitions stored on the calling locality bypass the parcel layer, which
+// makes the lookup performance of the partition storage itself visible.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/iostream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_UNORDERED_MAP(std::uint64_t, double)
+
+using map_type = hpx::unordered_map<std::uint64_t, double>;
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t lookup_elementwise(
+    map_type const& m, std::vector<std::uint64_t> const& keys)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<hpx::future<double>> values;
+        values.reserve(keys.size());
+        for (std::uint64_t key : keys)
+        {
+            values.push_back(m.get_value(key));
+        }
+        hpx::wait_all(values);
+    }
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+std::uint64_t lookup_bulk(
+    map_type const& m, std::vector<std::uint64_t> const& keys)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        m.find_values(keys).get();
+    }
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t map_size = vm["map_size"].as<std::size_t>();
+    std::size_t num_keys = vm["num_keys"].as<std::size_t>();
+    std::size_t num_partitions = vm["num_partitions"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // verify that input is within domain of program
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << std::flush;
+        return hpx::finalize();
+    }
+    if (map_size == 0 || num_partitions == 0)
+    {
+        hpx::cout << "map_size and num_partitions cannot be zero...\n"
+                  << std::flush;
+        return hpx::finalize();
+    }
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    map_type m(map_size / num_partitions,
+        hpx::container_layout(num_partitions, localities));
+
+    // fill the map using one bulk insertion per partition
+    {
+        std::vector<std::uint64_t> keys(map_size);
+        std::vector<double> values(map_size);
+        for (std::size_t i = 0; i != map_size; ++i)
+        {
+            keys[i] = i;
+            values[i] = static_cast<double>(i);
+        }
+        m.insert_values(keys, values).get();
+    }
+
+    // all looked up keys are stored in the map
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dist(0, map_size - 1);
+
+    std::vector<std::uint64_t> keys(num_keys);
+    for (std::uint64_t& key : keys)
+    {
+        key = dist(gen);
+    }
+
+    double const per_key = 1.0 / static_cast<double>(num_keys);
+
+    hpx::cout << "localities: " << localities.size()
+              << ", partitions: " << num_partitions
+              << ", map size: " << map_size << ", keys: " << num_keys << "\n";
+    hpx::cout << "lookup, get_value [ns/key]: "
+              << lookup_elementwise(m, keys) * per_key << "\n";
+    hpx::cout << "lookup, find_values [ns/key]: "
+              << lookup_bulk(m, keys) * per_key << "\n"
+              << std::flush;
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("map_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1000000)
+        , "number of elements stored in the map (default: 1000000)")
+
+        ("num_keys"
+        , hpx::program_options::value<std::size_t>()->default_value(10000)
+        , "number of random keys looked up per test (default: 10000)")
+
+        ("num_partitions"
+        , hpx::program_options::value<std::size_t>()->default_value(16)
+        , "number of partitions of the map (default: 16)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to be averaged (default: 10)")
+
+        ("seed,s"
+        , hpx::program_options::value<unsigned int>()
+        , "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
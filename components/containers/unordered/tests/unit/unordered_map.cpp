@@ -7,6 +7,8 @@
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 #include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_count.hpp>
+#include <hpx/include/parallel_for_each.hpp>
 #include <hpx/include/runtime.hpp>
 #include <hpx/include/traits.hpp>
 #include <hpx/include/unordered_map.hpp>
@@ -31,40 +33,41 @@ void test_global_iteration(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
 {
     std::size_t size = m.size();
 
-//     typedef typename hpx::unordered_map<Key, Value>::iterator iterator;
-//     typedef hpx::traits::segmented_iterator_traits<iterator> traits;
-//     HPX_TEST(traits::is_segmented_iterator::value);
+    typedef typename hpx::unordered_map<Key, Value, Hash, KeyEqual>::iterator
+        iterator;
+    typedef hpx::traits::segmented_iterator_traits<iterator> traits;
+    HPX_TEST(traits::is_segmented_iterator::value);
 
-//     typedef typename hpx::unordered_map<Key, Value>::const_iterator const_iterator;
-//     typedef hpx::traits::segmented_iterator_traits<const_iterator> const_traits;
-//     HPX_TEST(const_traits::is_segmented_iterator::value);
+    typedef typename hpx::unordered_map<Key, Value, Hash,
+        KeyEqual>::const_iterator const_iterator;
+    typedef hpx::traits::segmented_iterator_traits<const_iterator> const_traits;
+    HPX_TEST(const_traits::is_segmented_iterator::value);
 
-    for(std::size_t i = 0; i != size; ++i)
+    for (std::size_t i = 0; i != size; ++i)
     {
         std::string idx = std::to_string(i);
         HPX_TEST_EQ(m[idx], val);
-        m[idx] = Value(i+1);
-        HPX_TEST_EQ(m[idx], Value(i+1));
-    }
-
-//     // test normal iteration
-//     std::size_t count = 0;
-//     std::size_t i = 42;
-//     for (iterator it = v.begin(); it != v.end(); ++it, ++i, ++count)
-//     {
-//         HPX_TEST_NEQ(*it, val);
-//         *it = T(i);
-//         HPX_TEST_EQ(*it, T(i));
-//     }
-//     HPX_TEST_EQ(count, size);
-//
-//     count = 0;
-//     i = 42;
-//     for (const_iterator cit = v.cbegin(); cit != v.cend(); ++cit, ++i, ++count)
-//     {
-//         HPX_TEST_EQ(*cit, T(i));
-//     }
-//     HPX_TEST_EQ(count, size);
+        m[idx] = Value(i + 1);
+        HPX_TEST_EQ(m[idx], Value(i + 1));
+    }
+
+    // test normal iteration
+    std::size_t count = 0;
+    for (iterator it = m.begin(); it != m.end(); ++it, ++count)
+    {
+        auto value = *it;
+        HPX_TEST_EQ(value.second, Value(std::stoul(value.first) + 1));
+    }
+    HPX_TEST_EQ(count, size);
+
+    count = 0;
+    hpx::unordered_map<Key, Value, Hash, KeyEqual> const& cm = m;
+    for (const_iterator cit = cm.cbegin(); cit != cm.cend(); ++cit, ++count)
+    {
+        auto value = *cit;
+        HPX_TEST_EQ(value.second, Value(std::stoul(value.first) + 1));
+    }
+    HPX_TEST_EQ(count, size);
 }
 
 template <typename Key, typename Value, typename Hash, typename KeyEqual>
@@ -153,17 +156,115 @@ void trivial_tests()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+struct increment_value
+{
+    template <typename Value>
+    void operator()(Value& value) const
+    {
+        ++value.second;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+struct is_even_value
+{
+    template <typename Value>
+    bool operator()(Value const& value) const
+    {
+        return static_cast<std::size_t>(value.second) % 2 == 0;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+template <typename Key, typename Value, typename DistPolicy>
+void bulk_tests(DistPolicy const& policy)
+{
+    hpx::unordered_map<Key, Value> m(policy);
+
+    std::vector<Key> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != 107; ++i)
+    {
+        keys.push_back(std::to_string(i));
+        values.push_back(Value(i));
+    }
+
+    HPX_TEST_EQ(m.insert_values(hpx::launch::sync, keys, values), keys.size());
+    HPX_TEST_EQ(m.size(), keys.size());
+
+    // existing elements are left unchanged
+    std::vector<Value> other_values(keys.size(), Value(42));
+    HPX_TEST_EQ(m.insert_values(keys, other_values).get(), std::size_t(0));
+
+    // look up existing and missing keys in shuffled order
+    std::vector<Key> lookup = keys;
+    lookup.push_back("missing");
+    std::reverse(lookup.begin(), lookup.end());
+
+    std::vector<hpx::optional<Value>> found =
+        m.find_values(hpx::launch::sync, lookup);
+    HPX_TEST_EQ(found.size(), lookup.size());
+
+    HPX_TEST(!found[0]);
+    for (std::size_t i = 1; i != found.size(); ++i)
+    {
+        HPX_TEST(found[i].has_value());
+        HPX_TEST_EQ(*found[i], Value(std::stoul(lookup[i])));
+    }
+}
+
+template <typename Key, typename Value, typename DistPolicy>
+void segmented_algorithm_tests(DistPolicy const& policy)
+{
+    hpx::unordered_map<Key, Value> m(policy);
+    fill_unordered_map(m, 107, Value(42));
+
+    hpx::for_each(hpx::execution::seq, m.begin(), m.end(), increment_value());
+    hpx::for_each(hpx::execution::par, m.begin(), m.end(), increment_value());
+
+    for (std::size_t i = 0; i != 107; ++i)
+    {
+        HPX_TEST_EQ(m[std::to_string(i)], Value(44));
+    }
+
+    HPX_TEST_EQ(hpx::count_if(hpx::execution::seq, m.begin(), m.end(),
+                    is_even_value()),
+        std::ptrdiff_t(107));
+
+    m[std::to_string(3)] = Value(3);
+    HPX_TEST_EQ(hpx::count_if(hpx::execution::par, m.begin(), m.end(),
+                    is_even_value()),
+        std::ptrdiff_t(106));
+}
+
+template <typename Key, typename Value, typename DistPolicy>
+void container_tests(DistPolicy const& policy)
+{
+    trivial_tests<Key, Value>(policy);
+    bulk_tests<Key, Value>(policy);
+    segmented_algorithm_tests<Key, Value>(policy);
+}
+
 int main()
 {
     trivial_tests<std::string, double>();
 
     std::vector<hpx::id_type> localities = hpx::find_all_localities();
 
-    trivial_tests<std::string, double>(hpx::container_layout);
-    trivial_tests<std::string, double>(hpx::container_layout(3));
-    trivial_tests<std::string, double>(hpx::container_layout(3, localities));
-    trivial_tests<std::string, double>(hpx::container_layout(localities));
+    container_tests<std::string, double>(hpx::container_layout);
+    container_tests<std::string, double>(hpx::container_layout(3));
+    container_tests<std::string, double>(hpx::container_layout(3, localities));
+    container_tests<std::string, double>(hpx::container_layout(localities));
 
-    return 0;
+    return hpx::util::report_errors();
 }
 #endif
@@ -0,0 +1,312 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/components/containers/unordered/hash_join.hpp>
+#include <hpx/components/containers/unordered/reduce_by_key.hpp>
+
+#include <cstddef>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The partitioned_vector<int> is defined in the partitioned_vector module.
+HPX_REGISTER_UNORDERED_MAP(int, int)
+
+///////////////////////////////////////////////////////////////////////////////
+struct modulo_key
+{
+    int modulus = 1;
+
+    int operator()(int value) const
+    {
+        return value % modulus;
+    }
+
+    int operator()(std::pair<int, int> const& value) const
+    {
+        return value.first % modulus;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & modulus;
+        // clang-format on
+    }
+};
+
+struct count_value
+{
+    int operator()(int) const
+    {
+        return 1;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+struct identity_value
+{
+    int operator()(int value) const
+    {
+        return value;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+struct max_value
+{
+    int operator()(int lhs, int rhs) const
+    {
+        return lhs < rhs ? rhs : lhs;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+struct check_join
+{
+    int modulus = 1;
+
+    void operator()(int lhs, std::pair<int, int> const& rhs) const
+    {
+        HPX_TEST_EQ(lhs % modulus, rhs.first);
+    }
+
+    void operator()(int lhs, int rhs) const
+    {
+        HPX_TEST_EQ(lhs % modulus, rhs % modulus);
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & modulus;
+        // clang-format on
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> fill_random(hpx::partitioned_vector<int>& v)
+{
+    std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<> dist(0, 1000);
+
+    std::vector<std::size_t> pos(v.size());
+    std::vector<int> values(v.size());
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        pos[i] = i;
+        values[i] = dist(gen);
+    }
+
+    v.set_values(hpx::launch::sync, pos, values);
+    return values;
+}
+
+template <typename Map>
+void check_map(hpx::unordered_map<int, int>& m, Map const& expected)
+{
+    HPX_TEST_EQ(m.size(), expected.size());
+
+    std::vector<int> keys;
+    for (auto const& value : expected)
+    {
+        keys.push_back(value.first);
+    }
+
+    std::vector<hpx::optional<int>> const values =
+        m.find_values(hpx::launch::sync, keys);
+    HPX_TEST_EQ(values.size(), keys.size());
+
+    std::size_t i = 0;
+    for (auto const& value : expected)
+    {
+        HPX_TEST(values[i].has_value());
+        if (values[i].has_value())
+        {
+            HPX_TEST_EQ(*values[i], value.second);
+        }
+        ++i;
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename DistPolicy>
+void group_by_tests(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    hpx::partitioned_vector<int> v(size, policy);
+    std::vector<int> const values = fill_random(v);
+
+    // count the elements of the partitioned_vector by their residue
+    int const modulus = 17;
+
+    std::map<int, int> counts;
+    for (int value : values)
+    {
+        ++counts[value % modulus];
+    }
+
+    hpx::unordered_map<int, int> m(policy);
+    hpx::distributed::reduce_by_key(
+        par, v.begin(), v.end(), m, modulo_key{modulus}, count_value());
+    check_map(m, counts);
+
+    // reducing a subrange replaces the values of the affected keys only
+    std::map<int, int> maxima = counts;
+    std::map<int, int> sub_maxima;
+    for (std::size_t i = 3; i < size - 5; ++i)
+    {
+        auto const it = sub_maxima.find(values[i] % modulus);
+        if (it == sub_maxima.end() || it->second < values[i])
+        {
+            sub_maxima[values[i] % modulus] = values[i];
+        }
+    }
+    for (auto const& value : sub_maxima)
+    {
+        maxima[value.first] = value.second;
+    }
+
+    hpx::future<void> f = hpx::distributed::reduce_by_key(par(task),
+        v.begin() + 3, v.begin() + (size - 5), m, modulo_key{modulus},
+        identity_value(), max_value());
+    f.get();
+    check_map(m, maxima);
+
+    // group the elements of an unordered_map by a coarser key
+    hpx::unordered_map<int, int> exact(policy);
+    hpx::distributed::reduce_by_key(
+        seq, v.begin(), v.end(), exact, modulo_key{modulus}, count_value());
+    check_map(exact, counts);
+
+    std::map<int, int> coarse_counts;
+    for (auto const& value : counts)
+    {
+        coarse_counts[value.first % 5] += value.second;
+    }
+
+    hpx::unordered_map<int, int> coarse(policy);
+    hpx::distributed::reduce_by_key(par, exact.begin(), exact.end(), coarse,
+        modulo_key{5}, hpx::distributed::pair_value());
+    check_map(coarse, coarse_counts);
+
+    // without projections the key/value pairs are used as they are
+    hpx::unordered_map<int, int> copy(policy);
+    f = hpx::distributed::reduce_by_key(
+        seq(task), exact.begin(), exact.end(), copy);
+    f.get();
+    check_map(copy, counts);
+}
+
+template <typename DistPolicy>
+void hash_join_tests(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    hpx::partitioned_vector<int> v1(size, policy);
+    hpx::partitioned_vector<int> v2(size / 3, policy);
+    std::vector<int> const values1 = fill_random(v1);
+    std::vector<int> const values2 = fill_random(v2);
+
+    int const modulus = 101;
+
+    std::map<int, std::size_t> counts1;
+    for (int value : values1)
+    {
+        ++counts1[value % modulus];
+    }
+
+    std::map<int, std::size_t> counts2;
+    for (int value : values2)
+    {
+        ++counts2[value % modulus];
+    }
+
+    std::size_t expected = 0;
+    for (auto const& value : counts1)
+    {
+        auto const it = counts2.find(value.first);
+        if (it != counts2.end())
+        {
+            expected += value.second * it->second;
+        }
+    }
+
+    std::size_t const count = hpx::distributed::hash_join(par, v1.begin(),
+        v1.end(), v2.begin(), v2.end(), modulo_key{modulus},
+        modulo_key{modulus}, check_join{modulus});
+    HPX_TEST_EQ(count, expected);
+
+    // join the elements of a partitioned_vector with the keys of an
+    // unordered_map
+    hpx::unordered_map<int, int> m(policy);
+    hpx::distributed::reduce_by_key(
+        par, v2.begin(), v2.end(), m, modulo_key{modulus}, count_value());
+
+    expected = 0;
+    for (auto const& value : counts1)
+    {
+        if (counts2.find(value.first) != counts2.end())
+        {
+            expected += value.second;
+        }
+    }
+
+    hpx::future<std::size_t> f = hpx::distributed::hash_join(seq(task),
+        v1.begin(), v1.end(), m.begin(), m.end(), modulo_key{modulus},
+        hpx::distributed::pair_key(), check_join{modulus});
+    HPX_TEST_EQ(f.get(), expected);
+
+    // joining with an empty range does not invoke the function
+    HPX_TEST_EQ(hpx::distributed::hash_join(seq, v1.begin(), v1.end(),
+                    v2.begin(), v2.begin(), modulo_key{modulus},
+                    modulo_key{modulus}, check_join{modulus}),
+        std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    group_by_tests(length, hpx::container_layout);
+    group_by_tests(length, hpx::container_layout(3));
+    group_by_tests(length, hpx::container_layout(3, localities));
+    group_by_tests(length, hpx::container_layout(localities));
+
+    hash_join_tests(length, hpx::container_layout);
+    hash_join_tests(length, hpx::container_layout(3, localities));
+    hash_join_tests(length, hpx::container_layout(localities));
+
+    return hpx::util::report_errors();
+}
+#endif
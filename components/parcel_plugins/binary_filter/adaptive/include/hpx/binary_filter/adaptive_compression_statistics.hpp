@@ -0,0 +1,82 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/hashing.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/type_support.hpp>
+
+#include <hpx/performance_counters/counters_fwd.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Statistics collected by the adaptive compression policy for all
+    // messages sent for one action
+    struct compression_statistics
+    {
+        // number of messages handled, and how many of those were compressed
+        std::atomic<std::int64_t> num_messages{0};
+        std::atomic<std::int64_t> num_compressed{0};
+
+        // number of bytes before and after applying the policy
+        std::atomic<std::int64_t> uncompressed_bytes{0};
+        std::atomic<std::int64_t> compressed_bytes{0};
+
+        // time spent sampling and compressing the data [ns]
+        std::atomic<std::int64_t> compression_time{0};
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    class compression_statistics_registry
+    {
+        using mutex_type = hpx::spinlock;
+
+    public:
+        HPX_NON_COPYABLE(compression_statistics_registry);
+
+        compression_statistics_registry() = default;
+
+        static compression_statistics_registry& instance();
+
+        // Return the statistics for the given action, the statistics are
+        // created if needed. The returned reference stays valid for the
+        // lifetime of the registry.
+        compression_statistics& get(std::string const& name);
+
+        bool counter_discoverer(performance_counters::counter_info const& info,
+            performance_counters::counter_path_elements& p,
+            performance_counters::discover_counter_func const& f,
+            performance_counters::discover_counters_mode mode, error_code& ec);
+
+    private:
+        struct tag
+        {
+        };
+
+        friend struct hpx::util::static_<compression_statistics_registry, tag>;
+
+        using map_type = std::unordered_map<std::string,
+            std::unique_ptr<compression_statistics>, hpx::util::jenkins_hash>;
+
+        mutable mutex_type mtx_;
+        map_type map_;
+    };
+}    // namespace hpx::plugins::compression
+
+#endif
@@ -0,0 +1,78 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/binary_filter/adaptive_serialization_filter_registration.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    // The adaptive_serialization_filter decides for each message whether
+    // compressing it is worthwhile. Messages smaller than a configurable size
+    // are always sent uncompressed. For larger messages, a sample of the data
+    // is compressed first. The whole message is compressed only if the
+    // sampled compression ratio and speed promise to reduce the overall time
+    // needed to transfer the message over a link of the configured bandwidth.
+    //
+    // The compressed data is prefixed with a single byte identifying the
+    // codec used (or that the data was stored uncompressed).
+    struct HPX_LIBRARY_EXPORT adaptive_serialization_filter
+      : public serialization::binary_filter
+    {
+        adaptive_serialization_filter(bool compress = false,
+            serialization::binary_filter* next_filter = nullptr) noexcept
+          : current_(0)
+          , name_(nullptr)
+          , compress_(compress)
+        {
+        }
+
+        void load(void* dst, std::size_t dst_count) override;
+        void save(void const* src, std::size_t src_count) override;
+        bool flush(
+            void* dst, std::size_t dst_count, std::size_t& written) override;
+
+        void set_max_length(std::size_t size) override;
+        std::size_t init_data(void const* buffer, std::size_t size,
+            std::size_t buffer_size) override;
+
+        void set_name(char const* name) noexcept override
+        {
+            name_ = name;
+        }
+
+    private:
+        // serialization support
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        HPX_FORCEINLINE void serialize(Archive& ar, const unsigned int)
+        {
+        }
+
+        HPX_SERIALIZATION_POLYMORPHIC(adaptive_serialization_filter, override);
+
+        std::vector<char> buffer_;
+        std::size_t current_;
+        char const* name_;
+        bool compress_;
+    };
+}    // namespace hpx::plugins::compression
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,143 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/util.hpp>
+
+#include <hpx/binary_filter/adaptive_compression_statistics.hpp>
+#include <hpx/performance_counters/counters.hpp>
+
+#include <memory>
+#include <mutex>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    compression_statistics_registry&
+    compression_statistics_registry::instance()
+    {
+        hpx::util::static_<compression_statistics_registry, tag> registry;
+        return registry.get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    compression_statistics& compression_statistics_registry::get(
+        std::string const& name)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        auto it = map_.find(name);
+        if (it == map_.end())
+        {
+            it = map_.emplace(name, std::make_unique<compression_statistics>())
+                     .first;
+        }
+        return *it->second;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool compression_statistics_registry::counter_discoverer(
+        performance_counters::counter_info const& info,
+        performance_counters::counter_path_elements& p,
+        performance_counters::discover_counter_func const& f,
+        performance_counters::discover_counters_mode mode, error_code& ec)
+    {
+        if (mode == performance_counters::discover_counters_mode::minimal ||
+            p.parentinstancename_.empty() || p.instancename_.empty())
+        {
+            if (p.parentinstancename_.empty())
+            {
+                p.parentinstancename_ = "locality#*";
+                p.parentinstanceindex_ = -1;
+            }
+
+            if (p.instancename_.empty())
+            {
+                p.instancename_ = "total";
+                p.instanceindex_ = -1;
+            }
+        }
+
+        if (p.parameters_.empty())
+        {
+            if (mode == performance_counters::discover_counters_mode::minimal)
+            {
+                std::string fullname;
+                performance_counters::get_counter_name(p, fullname, ec);
+                if (ec)
+                    return false;
+
+                performance_counters::counter_info cinfo = info;
+                cinfo.fullname_ = fullname;
+                return f(cinfo, ec) && !ec;
+            }
+
+#if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 110000
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wrestrict"
+#endif
+            p.parameters_ = "*";
+#if defined(HPX_GCC_VERSION) && HPX_GCC_VERSION >= 110000
+#pragma GCC diagnostic pop
+#endif
+        }
+
+        // Statistics for an action are created once the first message for
+        // it is sent, explicitly given action names are always accepted.
+        std::vector<performance_counters::counter_path_elements> counters;
+        if (p.parameters_.find_first_of("*?[]") != std::string::npos)
+        {
+            std::string const str_rx(
+                util::regex_from_pattern(p.parameters_, ec));
+            if (ec)
+                return false;
+
+            std::regex const rx(str_rx);
+
+            std::lock_guard<mutex_type> l(mtx_);
+            for (auto const& e : map_)
+            {
+                if (!std::regex_match(e.first, rx))
+                    continue;
+
+                performance_counters::counter_path_elements cp = p;
+                cp.parameters_ = e.first;
+                counters.push_back(HPX_MOVE(cp));
+            }
+        }
+        else
+        {
+            counters.push_back(p);
+        }
+
+        for (auto&& cp : counters)
+        {
+            std::string fullname;
+            performance_counters::get_counter_name(cp, fullname, ec);
+            if (ec)
+                return false;
+
+            performance_counters::counter_info cinfo = info;
+            cinfo.fullname_ = fullname;
+
+            if (!f(cinfo, ec) || ec)
+                return false;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
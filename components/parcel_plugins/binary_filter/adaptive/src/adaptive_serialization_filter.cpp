@@ -0,0 +1,439 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <hpx/binary_filter/adaptive_compression_statistics.hpp>
+#include <hpx/binary_filter/adaptive_serialization_filter.hpp>
+#include <hpx/plugin_factories/binary_filter_factory.hpp>
+#include <hpx/plugin_factories/plugin_registry.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <string>
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+#include <lz4.h>
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+#include <zstd.h>
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::traits {
+
+    // Inject additional configuration data into the factory registry for this
+    // type. This information ends up in the system wide configuration database
+    // under the plugin specific section:
+    //
+    //      [hpx.plugins.adaptive_serialization_filter]
+    //      ...
+    //      codec = lz4
+    //      min_size = 1024
+    //      sample_size = 4096
+    //      max_ratio = 90
+    //      link_bandwidth = 1000
+    //
+    template <>
+    struct plugin_config_data<
+        hpx::plugins::compression::adaptive_serialization_filter>
+    {
+        static constexpr char const* call() noexcept
+        {
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+            return "codec = lz4\n"
+#else
+            return "codec = zstd\n"
+#endif
+                   "min_size = 1024\n"
+                   "sample_size = 4096\n"
+                   "max_ratio = 90\n"
+                   "link_bandwidth = 1000";
+        }
+    };
+}    // namespace hpx::traits
+
+///////////////////////////////////////////////////////////////////////////////
+HPX_REGISTER_PLUGIN_MODULE_DYNAMIC()
+HPX_REGISTER_BINARY_FILTER_FACTORY(
+    hpx::plugins::compression::adaptive_serialization_filter,
+    adaptive_serialization_filter)
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::plugins::compression {
+
+    namespace detail {
+
+        // identifies the encoding of the data, stored as the first byte of
+        // the compressed data
+        enum class codec : std::uint8_t
+        {
+            none = 0,
+            lz4 = 1,
+            zstd = 2
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // returns zero if the codec can't compress data of the given size
+        std::size_t compress_bound(codec c, std::size_t size)
+        {
+            switch (c)
+            {
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+            case codec::lz4:
+                if (size > LZ4_MAX_INPUT_SIZE)
+                    return 0;
+                return static_cast<std::size_t>(
+                    LZ4_compressBound(static_cast<int>(size)));
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+            case codec::zstd:
+                return ZSTD_compressBound(size);
+#endif
+            default:
+                break;
+            }
+            return size;
+        }
+
+        // returns zero if the data could not be compressed
+        std::size_t compress(codec c, char const* src, std::size_t size,
+            char* dst, std::size_t dst_size)
+        {
+            switch (c)
+            {
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+            case codec::lz4:
+            {
+                int const result =
+                    LZ4_compress_default(src, dst, static_cast<int>(size),
+                        static_cast<int>(
+                            (std::min)(dst_size, std::size_t(INT_MAX))));
+                return result > 0 ? static_cast<std::size_t>(result) : 0;
+            }
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+            case codec::zstd:
+            {
+                std::size_t const result =
+                    ZSTD_compress(dst, dst_size, src, size, 1);
+                return ZSTD_isError(result) ? 0 : result;
+            }
+#endif
+            default:
+                break;
+            }
+            return 0;
+        }
+
+        bool decompress(codec c, char const* src, std::size_t size, char* dst,
+            std::size_t dst_size)
+        {
+            switch (c)
+            {
+            case codec::none:
+                if (size != dst_size)
+                    return false;
+                std::memcpy(dst, src, size);
+                return true;
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+            case codec::lz4:
+            {
+                if (size > INT_MAX || dst_size > INT_MAX)
+                    return false;
+
+                int const result = LZ4_decompress_safe(src, dst,
+                    static_cast<int>(size), static_cast<int>(dst_size));
+                return result >= 0 &&
+                    static_cast<std::size_t>(result) == dst_size;
+            }
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+            case codec::zstd:
+            {
+                std::size_t const result =
+                    ZSTD_decompress(dst, dst_size, src, size);
+                return !ZSTD_isError(result) && result == dst_size;
+            }
+#endif
+            default:
+                break;
+            }
+            return false;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        struct policy_parameters
+        {
+            codec codec_;
+
+            // messages smaller than this are never compressed
+            std::size_t min_size_;
+
+            // number of bytes compressed to estimate the compressibility
+            std::size_t sample_size_;
+
+            // compress only if the sampled ratio is not larger than this
+            double max_ratio_;
+
+            // bandwidth of the network link [bytes/ns], zero if the
+            // decision should not take the bandwidth into account
+            double link_bandwidth_;
+        };
+
+        std::size_t get_entry(char const* key, std::size_t dflt)
+        {
+            return hpx::util::from_string<std::size_t>(
+                hpx::get_config_entry(
+                    std::string("hpx.plugins.adaptive_serialization_filter.") +
+                        key,
+                    dflt),
+                dflt);
+        }
+
+        policy_parameters read_policy_parameters()
+        {
+            policy_parameters params{};
+
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+            params.codec_ = codec::lz4;
+            std::string const dflt_codec = "lz4";
+#else
+            params.codec_ = codec::zstd;
+            std::string const dflt_codec = "zstd";
+#endif
+            std::string const name = hpx::get_config_entry(
+                "hpx.plugins.adaptive_serialization_filter.codec",
+                dflt_codec);
+#if defined(HPX_HAVE_COMPRESSION_LZ4)
+            if (name == "lz4")
+                params.codec_ = codec::lz4;
+#endif
+#if defined(HPX_HAVE_COMPRESSION_ZSTD)
+            if (name == "zstd")
+                params.codec_ = codec::zstd;
+#endif
+
+            params.min_size_ = get_entry("min_size", 1024);
+            params.sample_size_ =
+                (std::max)(get_entry("sample_size", 4096), std::size_t(1));
+            params.max_ratio_ =
+                static_cast<double>(get_entry("max_ratio", 90)) / 100.;
+
+            // the bandwidth is configured in MB/s
+            params.link_bandwidth_ =
+                static_cast<double>(get_entry("link_bandwidth", 1000)) * 1e-3;
+
+            return params;
+        }
+
+        // the parameters are read only once, filters are created for each
+        // message
+        policy_parameters const& get_policy_parameters()
+        {
+            static policy_parameters const params = read_policy_parameters();
+            return params;
+        }
+
+        // Compressing pays off if the time needed to compress and decompress
+        // the data is smaller than the time saved while transferring the
+        // smaller amount of data. The time needed for decompression is
+        // estimated to be the same as for compression (all supported codecs
+        // decompress faster than they compress).
+        bool compression_pays_off(policy_parameters const& params,
+            std::size_t sample_size, std::size_t compressed_size,
+            std::int64_t sample_time)
+        {
+            if (compressed_size == 0)
+                return false;
+
+            double const ratio = static_cast<double>(compressed_size) /
+                static_cast<double>(sample_size);
+            if (ratio > params.max_ratio_)
+                return false;
+
+            if (params.link_bandwidth_ == 0.0)
+                return true;
+
+            // 2 * sample_time / sample_size < (1 - ratio) / link_bandwidth
+            return 2. * static_cast<double>(sample_time) *
+                params.link_bandwidth_ <
+                (1. - ratio) * static_cast<double>(sample_size);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::set_max_length(std::size_t size)
+    {
+        buffer_.reserve(size);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t adaptive_serialization_filter::init_data(
+        void const* buffer, std::size_t size, std::size_t buffer_size)
+    {
+        if (size == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "adaptive_serialization_filter::init_data",
+                "archive data bstream is too short");
+        }
+
+        char const* data = static_cast<char const*>(buffer);
+        auto const c = static_cast<detail::codec>(data[0]);
+
+        buffer_.resize(buffer_size);
+        if (!detail::decompress(
+                c, data + 1, size - 1, buffer_.data(), buffer_size))
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "adaptive_serialization_filter::init_data",
+                "decompression failure, corrupted archive data or "
+                "unsupported codec ({})",
+                static_cast<int>(c));
+        }
+
+        current_ = 0;
+        return buffer_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::load(void* dst, std::size_t dst_count)
+    {
+        if (current_ + dst_count > buffer_.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "adaptive_serialization_filter::load",
+                "archive data bstream is too short");
+            return;
+        }
+
+        std::memcpy(dst, &buffer_[current_], dst_count);
+        current_ += dst_count;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void adaptive_serialization_filter::save(
+        void const* src, std::size_t src_count)
+    {
+        char const* src_begin = static_cast<char const*>(src);
+        std::copy(
+            src_begin, src_begin + src_count, std::back_inserter(buffer_));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool adaptive_serialization_filter::flush(
+        void* dst, std::size_t dst_count, std::size_t& written)
+    {
+        detail::policy_parameters const& params =
+            detail::get_policy_parameters();
+
+        std::size_t const size = buffer_.size();
+        detail::codec c = compress_ && size >= params.min_size_ ?
+            params.codec_ :
+            detail::codec::none;
+
+        std::size_t const bound = detail::compress_bound(c, size);
+        if (bound == 0)
+        {
+            c = detail::codec::none;
+        }
+
+        // make sure we have enough memory
+        std::size_t const needed = 1 + (std::max)(size, bound);
+        if (needed > dst_count)
+        {
+            written = 0;
+            return false;
+        }
+
+        char* const dst_begin = static_cast<char*>(dst);
+        std::size_t compressed_size = 0;
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+        if (c != detail::codec::none)
+        {
+            // compress a sample taken from the middle of the data, the
+            // destination buffer is large enough to hold it
+            std::size_t const sample_size =
+                (std::min)(size, params.sample_size_);
+            std::size_t const offset = (size - sample_size) / 2;
+
+            compressed_size = detail::compress(c, buffer_.data() + offset,
+                sample_size, dst_begin + 1, dst_count - 1);
+
+            auto const sample_time = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now() - start);
+
+            if (!detail::compression_pays_off(
+                    params, sample_size, compressed_size, sample_time))
+            {
+                c = detail::codec::none;
+            }
+            else if (sample_size != size)
+            {
+                compressed_size = detail::compress(c, buffer_.data(), size,
+                    dst_begin + 1, dst_count - 1);
+
+                // fall back to storing the data if it didn't compress well
+                if (compressed_size == 0 || compressed_size >= size)
+                {
+                    c = detail::codec::none;
+                }
+            }
+        }
+
+        if (c == detail::codec::none)
+        {
+            if (size != 0)
+            {
+                std::memcpy(dst_begin + 1, buffer_.data(), size);
+            }
+            compressed_size = size;
+        }
+
+        dst_begin[0] = static_cast<char>(c);
+        written = compressed_size + 1;
+
+        // update the statistics for the action the data belongs to
+        if (name_ != nullptr)
+        {
+            compression_statistics& stats =
+                compression_statistics_registry::instance().get(name_);
+
+            stats.num_messages.fetch_add(1, std::memory_order_relaxed);
+            if (c != detail::codec::none)
+            {
+                stats.num_compressed.fetch_add(1, std::memory_order_relaxed);
+            }
+            stats.uncompressed_bytes.fetch_add(
+                static_cast<std::int64_t>(size), std::memory_order_relaxed);
+            stats.compressed_bytes.fetch_add(
+                static_cast<std::int64_t>(written), std::memory_order_relaxed);
+            stats.compression_time.fetch_add(
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now() - start),
+                std::memory_order_relaxed);
+        }
+
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+#endif
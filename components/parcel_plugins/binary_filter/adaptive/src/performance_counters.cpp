@@ -0,0 +1,242 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_COMPRESSION_ADAPTIVE)
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/util.hpp>
+
+#include <hpx/binary_filter/adaptive_compression_statistics.hpp>
+#include <hpx/components_base/component_startup_shutdown.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+namespace hpx::plugins::compression {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Discoverer for the counters of the adaptive compression policy, invokes
+    // the supplied function f for all known actions.
+    bool counter_discoverer(hpx::performance_counters::counter_info const& info,
+        hpx::performance_counters::discover_counter_func const& f,
+        hpx::performance_counters::discover_counters_mode mode,
+        hpx::error_code& ec)
+    {
+        performance_counters::counter_path_elements p;
+        performance_counters::counter_status status =
+            get_counter_path_elements(info.fullname_, p, ec);
+        if (!status_is_valid(status))
+            return false;
+
+        bool result =
+            compression_statistics_registry::instance().counter_discoverer(
+                info, p, f, mode, ec);
+        if (!result || ec)
+            return false;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Extract the statistics for the action given as the counter parameter
+    compression_statistics* get_statistics(
+        hpx::performance_counters::counter_info const& info,
+        performance_counters::counter_type type, char const* func,
+        hpx::error_code& ec)
+    {
+        if (info.type_ != type)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, func,
+                "invalid counter type requested");
+            return nullptr;
+        }
+
+        performance_counters::counter_path_elements paths;
+        performance_counters::get_counter_path_elements(
+            info.fullname_, paths, ec);
+        if (ec)
+            return nullptr;
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, func,
+                "invalid counter name for compression statistics (instance "
+                "name must not be a valid base counter name)");
+            return nullptr;
+        }
+
+        if (paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter, func,
+                "invalid counter parameter for compression statistics: must "
+                "specify an action type");
+            return nullptr;
+        }
+
+        return &compression_statistics_registry::instance().get(
+            paths.parameters_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::naming::gid_type num_messages_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        compression_statistics* stats = get_statistics(info,
+            performance_counters::counter_type::monotonically_increasing,
+            "num_messages_counter_creator", ec);
+        if (stats == nullptr)
+            return naming::invalid_gid;
+
+        return performance_counters::detail::create_raw_counter(
+            info,
+            [stats](bool reset) {
+                return util::get_and_reset_value(stats->num_messages, reset);
+            },
+            ec);
+    }
+
+    hpx::naming::gid_type num_compressed_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        compression_statistics* stats = get_statistics(info,
+            performance_counters::counter_type::monotonically_increasing,
+            "num_compressed_counter_creator", ec);
+        if (stats == nullptr)
+            return naming::invalid_gid;
+
+        return performance_counters::detail::create_raw_counter(
+            info,
+            [stats](bool reset) {
+                return util::get_and_reset_value(stats->num_compressed, reset);
+            },
+            ec);
+    }
+
+    hpx::naming::gid_type compression_ratio_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        compression_statistics* stats =
+            get_statistics(info, performance_counters::counter_type::raw,
+                "compression_ratio_counter_creator", ec);
+        if (stats == nullptr)
+            return naming::invalid_gid;
+
+        // ratio of the number of bytes sent to the number of bytes
+        // serialized (in 0.01%)
+        return performance_counters::detail::create_raw_counter(
+            info,
+            [stats](bool reset) -> std::int64_t {
+                std::int64_t const compressed =
+                    util::get_and_reset_value(stats->compressed_bytes, reset);
+                std::int64_t const uncompressed =
+                    util::get_and_reset_value(stats->uncompressed_bytes, reset);
+                if (uncompressed == 0)
+                    return 0;
+                return (compressed * 10000) / uncompressed;
+            },
+            ec);
+    }
+
+    hpx::naming::gid_type compression_time_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        compression_statistics* stats = get_statistics(info,
+            performance_counters::counter_type::monotonically_increasing,
+            "compression_time_counter_creator", ec);
+        if (stats == nullptr)
+            return naming::invalid_gid;
+
+        return performance_counters::detail::create_raw_counter(
+            info,
+            [stats](bool reset) {
+                return util::get_and_reset_value(
+                    stats->compression_time, reset);
+            },
+            ec);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This function will be registered as a startup function for HPX below.
+    //
+    // That means it will be executed in a HPX-thread before hpx_main, but after
+    // the runtime has been initialized and started.
+    void startup()
+    {
+        using namespace hpx::performance_counters;
+
+        // define the counter types
+        generic_counter_type_data const counter_types[] = {
+            // /compression(...)/count/messages@action-name
+            {"/compression/count/messages",
+                counter_type::monotonically_increasing,
+                "returns the number of messages handled by the adaptive "
+                "compression policy for the action which is given by the "
+                "counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1, &num_messages_counter_creator,
+                &counter_discoverer, ""},
+            // /compression(...)/count/compressed@action-name
+            {"/compression/count/compressed",
+                counter_type::monotonically_increasing,
+                "returns the number of messages the adaptive compression "
+                "policy decided to compress for the action which is given by "
+                "the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1, &num_compressed_counter_creator,
+                &counter_discoverer, ""},
+            // /compression(...)/ratio@action-name
+            {"/compression/ratio", counter_type::raw,
+                "returns the ratio of the number of bytes sent to the number "
+                "of bytes serialized for the action which is given by the "
+                "counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1, &compression_ratio_counter_creator,
+                &counter_discoverer, "0.01%"},
+            // /compression(...)/time/compress@action-name
+            {"/compression/time/compress",
+                counter_type::monotonically_increasing,
+                "returns the overall time spent sampling and compressing the "
+                "data of the action which is given by the counter parameter",
+                HPX_PERFORMANCE_COUNTER_V1, &compression_time_counter_creator,
+                &counter_discoverer, "ns"}};
+
+        // Install the counter types, un-installation of the types is handled
+        // automatically.
+        install_counter_types(counter_types, std::size(counter_types));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool get_startup(
+        hpx::startup_function_type& startup_func, bool& pre_startup)
+    {
+        // return our startup-function if performance counters are required
+        startup_func = startup;    // function to run during startup
+        pre_startup = true;        // run 'startup' as pre-startup function
+        return true;
+    }
+}    // namespace hpx::plugins::compression
+
+///////////////////////////////////////////////////////////////////////////////
+// Register a startup function which will be called as a HPX-thread during
+// runtime startup. We use this function to register our performance counter
+// type and performance counter instances.
+//
+// Note that this macro can be used not more than once in one module.
+HPX_REGISTER_STARTUP_MODULE_DYNAMIC(hpx::plugins::compression::get_startup)
+
+#endif
@@ -47,6 +47,8 @@ namespace hpx::plugins::parcel {
             get_counter_type num_messages;
             get_counter_type num_parcels_per_message;
             get_counter_type average_time_between_parcels;
+            get_counter_type num_deadline_flushes;
+            get_counter_type num_size_limit_flushes;
             get_counter_values_creator_type
                 time_between_parcels_histogram_creator;
             std::int64_t min_boundary = 0, max_boundary = 0, num_buckets = 0;
@@ -64,6 +66,8 @@ namespace hpx::plugins::parcel {
             get_counter_type const& num_messages,
             get_counter_type const& time_between_parcels,
             get_counter_type const& average_time_between_parcels,
+            get_counter_type const& num_deadline_flushes,
+            get_counter_type const& num_size_limit_flushes,
             get_counter_values_creator_type const&
                 time_between_parcels_histogram_creator);
 
@@ -73,6 +77,10 @@ namespace hpx::plugins::parcel {
             std::string const& name) const;
         get_counter_type get_average_time_between_parcels_counter(
             std::string const& name) const;
+        get_counter_type get_deadline_flushes_counter(
+            std::string const& name) const;
+        get_counter_type get_size_limit_flushes_counter(
+            std::string const& name) const;
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
             std::int64_t max_boundary, std::int64_t num_buckets);
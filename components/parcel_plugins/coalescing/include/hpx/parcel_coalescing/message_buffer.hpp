@@ -164,6 +164,16 @@ namespace hpx::plugins::parcel::detail {
             return max_messages_;
         }
 
+        // change the number of messages after which the buffer is full, this
+        // is used by the adaptive coalescing mode before a new batch starts
+        void set_capacity(std::size_t max_messages)
+        {
+            HPX_ASSERT(messages_.size() < max_messages);
+            max_messages_ = max_messages;
+            messages_.reserve(max_messages);
+            handlers_.reserve(max_messages);
+        }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
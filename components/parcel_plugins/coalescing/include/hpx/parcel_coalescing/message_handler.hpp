@@ -56,6 +56,8 @@ namespace hpx::plugins::parcel {
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_deadline_flushes_count(bool reset);
+        std::int64_t get_size_limit_flushes_count(bool reset);
         std::vector<std::int64_t> get_time_between_parcels_histogram(
             bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -74,6 +76,11 @@ namespace hpx::plugins::parcel {
 
         void update_num_messages();
         void update_interval();
+        void update_latency_budget();
+
+        // recompute the number of parcels per message and the flush interval
+        // from the measured parcel arrival rate (adaptive mode only)
+        void adapt_parameters();
 
     private:
         mutable mutex_type mtx_;
@@ -86,6 +93,16 @@ namespace hpx::plugins::parcel {
         bool allow_background_flush_;
         std::string action_name_;
 
+        // adaptive coalescing: the number of parcels per message and the
+        // flush interval are derived from the (exponentially smoothed) time
+        // between parcels such that no parcel is held back longer than the
+        // latency budget
+        bool adaptive_;
+        std::size_t latency_budget_;
+        std::size_t min_coalesced_parcels_;
+        std::size_t max_coalesced_parcels_;
+        double smoothed_time_between_parcels_;
+
         // performance counter data
         std::int64_t num_parcels_;
         std::int64_t reset_num_parcels_;
@@ -96,6 +113,10 @@ namespace hpx::plugins::parcel {
         std::int64_t started_at_;
         std::int64_t reset_time_num_parcels_;
         std::int64_t last_parcel_time_;
+        std::int64_t num_deadline_flushes_;
+        std::int64_t reset_num_deadline_flushes_;
+        std::int64_t num_size_limit_flushes_;
+        std::int64_t reset_num_size_limit_flushes_;
 
         // collects percentiles
         using histogram_collector_type =
@@ -34,6 +34,8 @@ namespace hpx::plugins::parcel {
         get_counter_type const& num_messages,
         get_counter_type const& num_parcels_per_message,
         get_counter_type const& average_time_between_parcels,
+        get_counter_type const& num_deadline_flushes,
+        get_counter_type const& num_size_limit_flushes,
         get_counter_values_creator_type const&
             time_between_parcels_histogram_creator)
     {
@@ -51,6 +53,7 @@ namespace hpx::plugins::parcel {
         {
             counter_functions data = {num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
+                num_deadline_flushes, num_size_limit_flushes,
                 time_between_parcels_histogram_creator, 0, 0, 1};
 
             map_.emplace(name, HPX_MOVE(data));
@@ -63,6 +66,8 @@ namespace hpx::plugins::parcel {
             it->second.num_parcels_per_message = num_parcels_per_message;
             it->second.average_time_between_parcels =
                 average_time_between_parcels;
+            it->second.num_deadline_flushes = num_deadline_flushes;
+            it->second.num_size_limit_flushes = num_size_limit_flushes;
             it->second.time_between_parcels_histogram_creator =
                 time_between_parcels_histogram_creator;
 
@@ -79,6 +84,8 @@ namespace hpx::plugins::parcel {
             (void) it->second.num_messages;
             (void) it->second.num_parcels_per_message;
             (void) it->second.average_time_between_parcels;
+            (void) it->second.num_deadline_flushes;
+            (void) it->second.num_size_limit_flushes;
             (void) it->second.time_between_parcels_histogram_creator;
         }
     }
@@ -171,6 +178,40 @@ namespace hpx::plugins::parcel {
         return it->second.average_time_between_parcels;
     }
 
+    coalescing_counter_registry::get_counter_type
+    coalescing_counter_registry::get_deadline_flushes_counter(
+        std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "coalescing_counter_registry::get_deadline_flushes_counter",
+                "unknown action type");
+        }
+        return it->second.num_deadline_flushes;
+    }
+
+    coalescing_counter_registry::get_counter_type
+    coalescing_counter_registry::get_size_limit_flushes_counter(
+        std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "coalescing_counter_registry::get_size_limit_flushes_counter",
+                "unknown action type");
+        }
+        return it->second.num_size_limit_flushes;
+    }
+
     coalescing_counter_registry::get_counter_values_type
     coalescing_counter_registry::get_time_between_parcels_histogram_counter(
         std::string const& name, std::int64_t min_boundary,
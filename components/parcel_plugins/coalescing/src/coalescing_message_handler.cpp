@@ -23,6 +23,7 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -41,6 +42,10 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      adaptive = 0
+    //      latency_budget = 100
+    //      min_messages = 1
+    //      max_messages = 1024
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,7 +54,11 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
-                   "allow_background_flush = 1";
+                   "allow_background_flush = 1\n"
+                   "adaptive = 0\n"
+                   "latency_budget = 100\n"
+                   "min_messages = 1\n"
+                   "max_messages = 1024";
         }
     };
 }    // namespace hpx::traits
@@ -84,6 +93,36 @@ namespace hpx::plugins::parcel {
                 "1");
             return !value.empty() && value[0] != '0';
         }
+
+        bool get_adaptive()
+        {
+            std::string value = hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.adaptive", "0");
+            return !value.empty() && value[0] != '0';
+        }
+
+        std::size_t get_latency_budget(std::size_t latency_budget)
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.latency_budget",
+                latency_budget));
+        }
+
+        std::size_t get_min_messages()
+        {
+            return (std::max)(std::size_t(1),
+                hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                    "hpx.plugins.coalescing_message_handler.min_messages",
+                    std::size_t(1))));
+        }
+
+        std::size_t get_max_messages(std::size_t min_messages)
+        {
+            return (std::max)(min_messages,
+                hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                    "hpx.plugins.coalescing_message_handler.max_messages",
+                    std::size_t(1024))));
+        }
     }    // namespace detail
 
     void coalescing_message_handler::update_num_messages()
@@ -99,6 +138,41 @@ namespace hpx::plugins::parcel {
         interval_ = detail::get_interval(interval_);
     }
 
+    void coalescing_message_handler::update_latency_budget()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        latency_budget_ = detail::get_latency_budget(latency_budget_);
+    }
+
+    void coalescing_message_handler::adapt_parameters()
+    {
+        HPX_ASSERT(adaptive_);
+
+        // Parcels arriving further apart than the latency budget don't
+        // benefit from being coalesced, they are sent right away. Otherwise,
+        // collect as many parcels as are expected to arrive within the
+        // latency budget.
+        double const budget = double(latency_budget_) * 1000.0;    // [ns]
+        double const arrival = (std::max)(smoothed_time_between_parcels_, 1.0);
+
+        std::size_t num = min_coalesced_parcels_;
+        if (arrival < budget)
+        {
+            num = (std::min)(
+                std::size_t(budget / arrival), max_coalesced_parcels_);
+            num = (std::max)(num, min_coalesced_parcels_);
+        }
+        num_coalesced_parcels_ = num;
+
+        // Flush a partially filled message if the parcels did not arrive at
+        // the expected rate. Allow for twice the expected time to fill the
+        // message, but never wait longer than the latency budget.
+        auto const expected =
+            std::size_t(2.0 * double(num) * arrival / 1000.0);    // [us]
+        interval_ = (std::min)((std::max)(expected, std::size_t(1)),
+            (std::max)(latency_budget_, std::size_t(1)));
+    }
+
     coalescing_message_handler::coalescing_message_handler(
         char const* action_name, parcelset::parcelport* pp, std::size_t num,
         std::size_t interval)
@@ -112,6 +186,12 @@ namespace hpx::plugins::parcel {
       , stopped_(false)
       , allow_background_flush_(detail::get_background_flush())
       , action_name_(action_name)
+      , adaptive_(detail::get_adaptive())
+      , latency_budget_(detail::get_latency_budget(interval_))
+      , min_coalesced_parcels_(detail::get_min_messages())
+      , max_coalesced_parcels_(
+            detail::get_max_messages(min_coalesced_parcels_))
+      , smoothed_time_between_parcels_(double(interval_) * 1000.0)
       , num_parcels_(0)
       , reset_num_parcels_(0)
       , reset_num_parcels_per_message_parcels_(0)
@@ -121,6 +201,10 @@ namespace hpx::plugins::parcel {
       , started_at_(hpx::chrono::high_resolution_clock::now())
       , reset_time_num_parcels_(0)
       , last_parcel_time_(started_at_)
+      , num_deadline_flushes_(0)
+      , reset_num_deadline_flushes_(0)
+      , num_size_limit_flushes_(0)
+      , reset_num_size_limit_flushes_(0)
       , histogram_min_boundary_(-1)
       , histogram_max_boundary_(-1)
       , histogram_num_buckets_(-1)
@@ -137,6 +221,11 @@ namespace hpx::plugins::parcel {
             hpx::bind_front(
                 &coalescing_message_handler::get_average_time_between_parcels,
                 this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_deadline_flushes_count, this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_size_limit_flushes_count,
+                this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
                 this));
@@ -148,6 +237,10 @@ namespace hpx::plugins::parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             hpx::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.latency_budget",
+            hpx::bind(
+                &coalescing_message_handler::update_latency_budget, this));
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -165,6 +258,25 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
+        // in adaptive mode, derive the coalescing parameters for the next
+        // message from the smoothed time between parcels
+        if (adaptive_)
+        {
+            smoothed_time_between_parcels_ +=
+                (double(time_since_last_parcel) -
+                    smoothed_time_between_parcels_) /
+                8.0;
+
+            if (buffer_.empty())
+            {
+                adapt_parameters();
+                if (buffer_.capacity() != num_coalesced_parcels_)
+                {
+                    buffer_.set_capacity(num_coalesced_parcels_);
+                }
+            }
+        }
+
         std::chrono::microseconds interval(interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
@@ -195,6 +307,7 @@ namespace hpx::plugins::parcel {
             break;
 
         case detail::message_buffer::buffer_now_full:
+            ++num_size_limit_flushes_;
             flush_locked(l,
                 parcelset::policies::message_handler::flush_mode_buffer_full,
                 false, true);
@@ -215,6 +328,7 @@ namespace hpx::plugins::parcel {
         std::unique_lock<mutex_type> l(mtx_);
         if (!buffer_.empty())
         {
+            ++num_deadline_flushes_;
             flush_locked(l,
                 parcelset::policies::message_handler::flush_mode_timer, false,
                 false);
@@ -376,6 +490,28 @@ namespace hpx::plugins::parcel {
         return num_messages;
     }
 
+    std::int64_t coalescing_message_handler::get_deadline_flushes_count(
+        bool reset)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        std::int64_t num_flushes =
+            num_deadline_flushes_ - reset_num_deadline_flushes_;
+        if (reset)
+            reset_num_deadline_flushes_ = num_deadline_flushes_;
+        return num_flushes;
+    }
+
+    std::int64_t coalescing_message_handler::get_size_limit_flushes_count(
+        bool reset)
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        std::int64_t num_flushes =
+            num_size_limit_flushes_ - reset_num_size_limit_flushes_;
+        if (reset)
+            reset_num_size_limit_flushes_ = num_size_limit_flushes_;
+        return num_flushes;
+    }
+
     std::vector<std::int64_t>
     coalescing_message_handler::get_time_between_parcels_histogram(
         bool /* reset */)
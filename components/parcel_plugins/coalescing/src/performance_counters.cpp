@@ -378,6 +378,166 @@ namespace hpx::plugins::parcel {
             ec);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    struct num_deadline_flushes_counter_surrogate
+    {
+        explicit num_deadline_flushes_counter_surrogate(
+            std::string const& parameters)
+          : parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ = coalescing_counter_registry::instance()
+                               .get_deadline_flushes_counter(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    hpx::naming::gid_type num_deadline_flushes_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        if (info.type_ !=
+            performance_counters::counter_type::monotonically_increasing)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "num_deadline_flushes_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+
+        performance_counters::counter_path_elements paths;
+        performance_counters::get_counter_path_elements(
+            info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "num_deadline_flushes_counter_creator",
+                "invalid counter name for number of deadline flushes "
+                "(instance name must not be a valid base counter name)");
+            return naming::invalid_gid;
+        }
+
+        if (paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "num_deadline_flushes_counter_creator",
+                "invalid counter parameter for number of deadline flushes: "
+                "must specify an action type");
+            return naming::invalid_gid;
+        }
+
+        // ask registry
+        hpx::function<std::int64_t(bool)> f =
+            coalescing_counter_registry::instance()
+                .get_deadline_flushes_counter(paths.parameters_);
+
+        if (!f.empty())
+        {
+            return performance_counters::detail::create_raw_counter(
+                info, HPX_MOVE(f), ec);
+        }
+
+        // the counter is not available yet, create surrogate function
+        return performance_counters::detail::create_raw_counter(info,
+            num_deadline_flushes_counter_surrogate(paths.parameters_), ec);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct num_size_limit_flushes_counter_surrogate
+    {
+        explicit num_size_limit_flushes_counter_surrogate(
+            std::string const& parameters)
+          : parameters_(parameters)
+        {
+        }
+
+        std::int64_t operator()(bool reset)
+        {
+            if (counter_.empty())
+            {
+                counter_ = coalescing_counter_registry::instance()
+                               .get_size_limit_flushes_counter(parameters_);
+                if (counter_.empty())
+                    return 0;    // no counter available yet
+            }
+
+            // dispatch to actual counter
+            return counter_(reset);
+        }
+
+        hpx::function<std::int64_t(bool)> counter_;
+        std::string parameters_;
+    };
+
+    hpx::naming::gid_type num_size_limit_flushes_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        if (info.type_ !=
+            performance_counters::counter_type::monotonically_increasing)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "num_size_limit_flushes_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+
+        performance_counters::counter_path_elements paths;
+        performance_counters::get_counter_path_elements(
+            info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        if (paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "num_size_limit_flushes_counter_creator",
+                "invalid counter name for number of size limit flushes "
+                "(instance name must not be a valid base counter name)");
+            return naming::invalid_gid;
+        }
+
+        if (paths.parameters_.empty())
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "num_size_limit_flushes_counter_creator",
+                "invalid counter parameter for number of size limit flushes: "
+                "must specify an action type");
+            return naming::invalid_gid;
+        }
+
+        // ask registry
+        hpx::function<std::int64_t(bool)> f =
+            coalescing_counter_registry::instance()
+                .get_size_limit_flushes_counter(paths.parameters_);
+
+        if (!f.empty())
+        {
+            return performance_counters::detail::create_raw_counter(
+                info, HPX_MOVE(f), ec);
+        }
+
+        // the counter is not available yet, create surrogate function
+        return performance_counters::detail::create_raw_counter(info,
+            num_size_limit_flushes_counter_surrogate(paths.parameters_), ec);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     struct time_between_parcels_histogram_counter_surrogate
     {
@@ -571,6 +731,24 @@ namespace hpx::plugins::parcel {
                 HPX_PERFORMANCE_COUNTER_V1,
                 &average_time_between_parcels_counter_creator,
                 &counter_discoverer, "ns"},
+            // /coalescing(...)/count/deadline-flushes@action-name
+            {"/coalescing/count/deadline-flushes",
+                counter_type::monotonically_increasing,
+                "returns the number of messages sent for the action which is "
+                "given by the counter parameter because the coalescing "
+                "interval expired before the message was full",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &num_deadline_flushes_counter_creator, &counter_discoverer,
+                ""},
+            // /coalescing(...)/count/size-limit-flushes@action-name
+            {"/coalescing/count/size-limit-flushes",
+                counter_type::monotonically_increasing,
+                "returns the number of messages sent for the action which is "
+                "given by the counter parameter because the maximal number "
+                "of parcels per message was reached",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &num_size_limit_flushes_counter_creator, &counter_discoverer,
+                ""},
             // /coalescing(...)/time/between-parcels-histogram@action-name,min,max,buckets
             {"/coalescing/time/between-parcels-histogram",
                 counter_type::histogram,
@@ -0,0 +1,127 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Throughput of many small actions sent to a remote locality while message
+// coalescing is enabled. The receiving locality decodes the parcels of large
+// coalesced messages in parallel, run with
+// --hpx:ini=hpx.parcel.parallel_decode_threshold=0 to measure the sequential
+// decoding instead.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t small_action(std::uint64_t value, std::vector<double> const&)
+{
+    return value + 1;
+}
+
+HPX_DECLARE_PLAIN_ACTION(small_action, small_action_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(small_action_action)
+HPX_PLAIN_ACTION(small_action, small_action_action)
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::vector<hpx::id_type> const localities =
+        hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        std::cout << "This benchmark needs to be run on at least two "
+                     "localities\n";
+        return hpx::finalize();
+    }
+    hpx::id_type const there = localities[0];
+
+    auto const num_actions = vm["actions"].as<std::size_t>();
+    auto const payload = vm["payload"].as<std::size_t>();
+    auto const iterations = vm["iterations"].as<std::size_t>();
+    auto const skip = vm["skip"].as<std::size_t>();
+
+    std::vector<double> const data(payload, 1.0);
+
+    std::vector<hpx::future<std::uint64_t>> results;
+    results.reserve(num_actions);
+
+    small_action_action act;
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations + skip; ++i)
+    {
+        // do not measure the warm up phase
+        if (i == skip)
+        {
+            t.restart();
+        }
+
+        for (std::size_t j = 0; j != num_actions; ++j)
+        {
+            results.push_back(hpx::async(act, there, j, data));
+        }
+        hpx::wait_all(results);
+        results.clear();
+    }
+
+    double const elapsed = t.elapsed();
+    double const actions = static_cast<double>(num_actions * iterations);
+
+    std::cout << "# coalesced small actions, parallel decode threshold: "
+              << hpx::get_config_entry(
+                     "hpx.parcel.parallel_decode_threshold", "64")
+              << "\n# actions/iteration: " << num_actions
+              << ", payload (doubles): " << payload
+              << "\n# time (s): " << elapsed
+              << "\n# throughput (actions/s): " << actions / elapsed
+              << std::endl;
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("actions",
+         hpx::program_options::value<std::size_t>()->default_value(10000),
+         "number of actions sent per iteration (default: 10000)")
+        ("payload",
+         hpx::program_options::value<std::size_t>()->default_value(4),
+         "number of doubles sent with each action (default: 4)")
+        ("iterations",
+         hpx::program_options::value<std::size_t>()->default_value(20),
+         "number of iterations (default: 20)")
+        ("skip",
+         hpx::program_options::value<std::size_t>()->default_value(2),
+         "number of iterations used for warming up (default: 2)")
+        ;
+    // clang-format on
+
+    // enable message coalescing, allow for large coalesced messages
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=0",
+        "hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.num_messages=1024"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
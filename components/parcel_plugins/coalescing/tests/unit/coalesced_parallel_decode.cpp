@@ -0,0 +1,141 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Send many coalesced actions carrying arguments of varying size (including
+// arguments large enough to be sent as zero-copy chunks and shared pointers
+// referring to the same object) and verify that the remote locality decodes
+// all of them correctly. This test is run with parallel decoding enabled for
+// all coalesced messages and a second time with sequential decoding, both
+// runs have to produce the same results.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_actions = 1000;
+
+// every 16th action carries a payload large enough to be sent as a zero-copy
+// chunk
+std::vector<double> make_payload(std::uint64_t i)
+{
+    std::size_t const size = (i % 16 == 0) ? 4096 : (i % 7);
+    std::vector<double> payload(size);
+    for (std::size_t j = 0; j != size; ++j)
+    {
+        payload[j] = static_cast<double>(i + j);
+    }
+    return payload;
+}
+
+std::uint64_t checksum(std::uint64_t i, std::vector<double> const& payload,
+    std::string const& name, std::shared_ptr<std::uint64_t> const& p1,
+    std::shared_ptr<std::uint64_t> const& p2)
+{
+    std::uint64_t result = i;
+    for (double d : payload)
+    {
+        result = result * 31 + static_cast<std::uint64_t>(d);
+    }
+    for (char c : name)
+    {
+        result = result * 31 + static_cast<unsigned char>(c);
+    }
+
+    // both pointers refer to the same object on the sending side
+    result = result * 31 + *p1;
+    if (p1 != p2)
+    {
+        result = 0;
+    }
+    return result;
+}
+
+HPX_DECLARE_PLAIN_ACTION(checksum, checksum_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(checksum_action)
+HPX_PLAIN_ACTION(checksum, checksum_action)
+
+std::uint64_t direct_checksum(std::uint64_t i,
+    std::vector<double> const& payload, std::string const& name,
+    std::shared_ptr<std::uint64_t> const& p1,
+    std::shared_ptr<std::uint64_t> const& p2)
+{
+    return checksum(i, payload, name, p1, p2);
+}
+
+HPX_DECLARE_PLAIN_ACTION(direct_checksum, direct_checksum_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(direct_checksum_action)
+HPX_PLAIN_DIRECT_ACTION(direct_checksum, direct_checksum_action)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action>
+void test_decode(hpx::id_type const& there)
+{
+    std::vector<hpx::future<std::uint64_t>> results;
+    results.reserve(num_actions);
+
+    std::vector<std::uint64_t> expected;
+    expected.reserve(num_actions);
+
+    Action act;
+    for (std::uint64_t i = 0; i != num_actions; ++i)
+    {
+        std::vector<double> payload = make_payload(i);
+        std::string const name = "parcel-" + std::to_string(i);
+        auto p = std::make_shared<std::uint64_t>(i * i);
+
+        expected.push_back(checksum(i, payload, name, p, p));
+        results.push_back(hpx::async(act, there, i, payload, name, p, p));
+    }
+
+    for (std::size_t i = 0; i != num_actions; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_decode<checksum_action>(id);
+        test_decode<direct_checksum_action>(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // enable message coalescing, allow for large coalesced messages that are
+    // decoded in parallel (unless overridden on the command line)
+    std::vector<std::string> const cfg = {"hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.num_messages=256",
+        "hpx.parcel.parallel_decode_threshold=16"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -17,6 +17,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <type_traits>
@@ -230,6 +231,34 @@ void print_counters(char const* name)
     }
 }
 
+std::int64_t get_counter_value(std::string const& name)
+{
+    hpx::performance_counters::performance_counter c(name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+// every message flushed because of the deadline or because it was full is
+// also counted as a sent message
+void check_flush_counters(std::string const& action)
+{
+    std::string const prefix = "/coalescing{locality#0/total}/count/";
+
+    std::int64_t const deadline_flushes =
+        get_counter_value(prefix + "deadline-flushes@" + action);
+    std::int64_t const size_limit_flushes =
+        get_counter_value(prefix + "size-limit-flushes@" + action);
+    std::int64_t const messages =
+        get_counter_value(prefix + "messages@" + action);
+
+    hpx::cout << action << ": messages: " << messages
+              << ", deadline flushes: " << deadline_flushes
+              << ", size limit flushes: " << size_limit_flushes << std::endl;
+
+    HPX_TEST_LTE(std::int64_t(0), deadline_flushes);
+    HPX_TEST_LTE(std::int64_t(0), size_limit_flushes);
+    HPX_TEST_LTE(deadline_flushes + size_limit_flushes, messages);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -253,6 +282,9 @@ int hpx_main(hpx::program_options::variables_map& vm)
     print_counters("/coalescing{locality#0/total}/count/messages@test1_action");
     print_counters("/coalescing{locality#0/total}/count/messages@test2_action");
 
+    check_flush_counters("test1_action");
+    check_flush_counters("test2_action");
+
     return hpx::finalize();
 }
 
@@ -0,0 +1,612 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/cache/statistics/no_statistics.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/concurrency/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util::cache {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \class concurrent_cache concurrent_cache.hpp hpx/cache/concurrent_cache.hpp
+    ///
+    /// \brief The \a concurrent_cache implements a local (non-distributed)
+    ///        cache which can be accessed concurrently without external
+    ///        locking.
+    ///
+    /// The entries are distributed over a number of shards based on the hash
+    /// of their keys. Every shard is protected by its own spinlock and stores
+    /// its entries in an open-addressing hash table using linear probing. If
+    /// a shard reaches its share of the capacity of the cache, entries are
+    /// evicted using the CLOCK algorithm (an approximation of LRU): every
+    /// access marks an entry as referenced, the clock hand sweeping over the
+    /// table clears the marks and evicts the first entry which has not been
+    /// referenced since the last sweep.
+    ///
+    /// The interface of this cache is compatible with the \a lru_cache.
+    ///
+    /// \tparam Key           The type of the keys to use to identify the
+    ///                       entries stored in the cache
+    /// \tparam Entry         The type of the items to be held in the cache.
+    /// \tparam Statistics    A (optional) type allowing to collect some basic
+    ///                       statistics about the operation of the cache
+    ///                       instance. The type must conform to the
+    ///                       CacheStatistics concept. The statistics are
+    ///                       collected per shard and combined on request. The
+    ///                       default value is the type
+    ///                       \a statistics#no_statistics.
+    /// \tparam Hash          The hash function object used for the keys. The
+    ///                       default is std::hash<Key>.
+    /// \tparam KeyEqual      The function object used to compare keys for
+    ///                       equality. The default is std::equal_to<Key>.
+    template <typename Key, typename Entry,
+        typename Statistics = statistics::no_statistics,
+        typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+    class concurrent_cache
+    {
+    public:
+        using key_type = Key;
+        using entry_type = Entry;
+        using statistics_type = Statistics;
+        using entry_pair = std::pair<key_type, entry_type>;
+        using size_type = std::size_t;
+
+    private:
+        using update_on_exit = typename statistics_type::update_on_exit;
+        using lock_type = hpx::util::spinlock;
+
+        static constexpr size_type npos = static_cast<size_type>(-1);
+        static constexpr size_type min_table_size = 16;
+
+        struct slot
+        {
+            std::optional<entry_pair> value;
+            size_type hash = 0;
+            bool referenced = false;
+        };
+
+        struct shard
+        {
+            mutable lock_type mtx;
+            std::vector<slot> slots;
+            size_type size = 0;
+            size_type capacity = 0;    // zero means no limitation
+            size_type hand = 0;        // position of the clock hand
+            statistics_type statistics;
+        };
+
+        using shard_type = hpx::util::cache_aligned_data_derived<shard>;
+
+    public:
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Construct an instance of a concurrent_cache.
+        ///
+        /// \param max_size   [in] The maximal number of entries this cache is
+        ///                   allowed to hold at any time. The default is zero
+        ///                   (no size limitation). The capacity is split
+        ///                   evenly among the shards.
+        /// \param num_shards [in] The number of shards to use, this is rounded
+        ///                   up to the next power of two. The default is 16.
+        ///
+        explicit concurrent_cache(
+            size_type max_size = 0, size_type num_shards = 16)
+          : max_size_(max_size)
+        {
+            while ((static_cast<size_type>(1) << shard_bits_) < num_shards)
+            {
+                ++shard_bits_;
+            }
+            shards_.reset(new shard_type[num_shards_()]);
+            set_shard_capacities();
+        }
+
+        concurrent_cache(concurrent_cache const&) = delete;
+        concurrent_cache(concurrent_cache&&) = delete;
+        concurrent_cache& operator=(concurrent_cache const&) = delete;
+        concurrent_cache& operator=(concurrent_cache&&) = delete;
+
+        ~concurrent_cache() = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return current number of entries held by the cache.
+        [[nodiscard]] size_type size() const
+        {
+            size_type result = 0;
+            for (size_type i = 0; i != num_shards_(); ++i)
+            {
+                std::lock_guard<lock_type> l(shards_[i].mtx);
+                result += shards_[i].size;
+            }
+            return result;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Access the maximum number of entries the cache is allowed
+        ///        to hold.
+        [[nodiscard]] size_type capacity() const noexcept
+        {
+            return max_size_;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Change the maximum number of entries this cache can hold,
+        ///        evicting entries if necessary.
+        void reserve(size_type max_size)
+        {
+            max_size_ = max_size;
+            set_shard_capacities();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Check whether the cache currently holds an entry identified
+        ///        by the given key
+        ///
+        /// \note         This function does not mark the entry as referenced.
+        [[nodiscard]] bool holds_key(key_type const& key) const
+        {
+            size_type const hash = hash_key(key);
+            shard const& s = get_shard(hash);
+
+            std::lock_guard<lock_type> l(s.mtx);
+            return find(s, key, hash) != npos;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param realkey[out] Return the full real key found in the cache
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \note         The function marks the entry as referenced if the
+        ///               key was found in the cache.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(
+            key_type const& key, key_type& realkey, entry_type& entry)
+        {
+            size_type const hash = hash_key(key);
+            shard& s = get_shard(hash);
+
+            std::lock_guard<lock_type> l(s.mtx);
+            update_on_exit update(s.statistics, statistics::method::get_entry);
+
+            size_type const pos = find(s, key, hash);
+            if (pos == npos)
+            {
+                s.statistics.got_miss();
+                return false;
+            }
+
+            slot& sl = s.slots[pos];
+            sl.referenced = true;
+            s.statistics.got_hit();
+
+            realkey = sl.value->first;
+            entry = sl.value->second;
+            return true;
+        }
+
+        /// \brief Get a specific entry identified by the given key.
+        ///
+        /// \param key    [in] The key for the entry which should be retrieved
+        ///               from the cache.
+        /// \param entry  [out] If the entry indexed by the key is found in the
+        ///               cache this value on successful return will be a copy
+        ///               of the corresponding entry.
+        ///
+        /// \returns      This function returns \a true if the cache holds the
+        ///               referenced entry, otherwise it returns \a false.
+        bool get_entry(key_type const& key, entry_type& entry)
+        {
+            key_type tmp;
+            return get_entry(key, tmp, entry);
+        }
+
+        /// \brief Insert a new entry into this cache
+        ///
+        /// \param key    [in] The key for the entry which should be added to
+        ///               the cache.
+        /// \param entry  [in] The entry which should be added to the cache.
+        ///
+        /// \returns      This function returns \a false if the cache already
+        ///               holds an entry for the given key, otherwise it
+        ///               returns \a true.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        bool insert(key_type const& key, Entry_&& entry)
+        {
+            size_type const hash = hash_key(key);
+            shard& s = get_shard(hash);
+
+            std::lock_guard<lock_type> l(s.mtx);
+            update_on_exit update(
+                s.statistics, statistics::method::insert_entry);
+
+            if (find(s, key, hash) != npos)
+            {
+                return false;
+            }
+
+            insert_nonexist(s, key, hash, HPX_FORWARD(Entry_, entry));
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache.
+        ///
+        /// \note         The entry is added to the cache if the key was not
+        ///               found.
+        template <typename Entry_,
+            typename = std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>>>
+        void update(key_type const& key, Entry_&& entry)
+        {
+            size_type const hash = hash_key(key);
+            shard& s = get_shard(hash);
+
+            std::lock_guard<lock_type> l(s.mtx);
+            update_on_exit update(
+                s.statistics, statistics::method::update_entry);
+
+            size_type const pos = find(s, key, hash);
+            if (pos == npos)
+            {
+                s.statistics.got_miss();
+                insert_nonexist(s, key, hash, HPX_FORWARD(Entry_, entry));
+                return;
+            }
+
+            slot& sl = s.slots[pos];
+            sl.value->second = HPX_FORWARD(Entry_, entry);
+            sl.referenced = true;
+            s.statistics.got_hit();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Update an existing element in this cache
+        ///
+        /// \param key    [in] The key for the value which should be updated in
+        ///               the cache.
+        /// \param entry  [in] The entry which should be used as a replacement
+        ///               for the existing value in the cache.
+        /// \param f      [in] A callable taking two arguments, \a k and the
+        ///               key found in the cache (in that order). If \a f
+        ///               returns true, then the update will continue. If \a f
+        ///               returns false, then the update will not succeed.
+        ///
+        /// \returns      This function returns \a true if the entry has been
+        ///               successfully updated or inserted, otherwise it
+        ///               returns \a false.
+        template <typename F, typename Entry_,
+            std::enable_if_t<
+                std::is_convertible_v<std::decay_t<Entry_>, entry_type>, int> =
+                0>
+        bool update_if(key_type const& key, Entry_&& entry, F&& f)
+        {
+            size_type const hash = hash_key(key);
+            shard& s = get_shard(hash);
+
+            std::lock_guard<lock_type> l(s.mtx);
+            update_on_exit update(
+                s.statistics, statistics::method::update_entry);
+
+            size_type const pos = find(s, key, hash);
+            if (pos == npos)
+            {
+                s.statistics.got_miss();
+                insert_nonexist(s, key, hash, HPX_FORWARD(Entry_, entry));
+                return true;
+            }
+
+            slot& sl = s.slots[pos];
+            if (!f(key, sl.value->first))
+                return false;
+
+            sl.value->second = HPX_FORWARD(Entry_, entry);
+            sl.referenced = true;
+            s.statistics.got_hit();
+
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Remove stored entries from the cache for which the supplied
+        ///        function object returns true.
+        ///
+        /// \param ep     [in] This parameter has to be a (unary) function
+        ///               object. It is invoked for each of the entries
+        ///               currently held in the cache (as a pair of the key
+        ///               and the entry). An entry is removed from the cache
+        ///               whenever the value returned from this invocation is
+        ///               \a true.
+        ///
+        /// \returns      This function returns the number of removed entries.
+        template <typename Func>
+        size_type erase(Func const& ep)
+        {
+            size_type erased = 0;
+            for (size_type i = 0; i != num_shards_(); ++i)
+            {
+                shard& s = shards_[i];
+
+                std::lock_guard<lock_type> l(s.mtx);
+                update_on_exit update(
+                    s.statistics, statistics::method::erase_entry);
+
+                // erasing an entry may move a later entry into its slot,
+                // which therefore has to be checked again
+                for (size_type pos = 0; pos != s.slots.size(); /**/)
+                {
+                    slot& sl = s.slots[pos];
+                    if (sl.value && ep(std::as_const(*sl.value)))
+                    {
+                        erase_at(s, pos);
+                        ++erased;
+                        s.statistics.got_eviction();
+                    }
+                    else
+                    {
+                        ++pos;
+                    }
+                }
+            }
+            return erased;
+        }
+
+        /// \brief Remove all stored entries from the cache
+        ///
+        /// \returns      This function returns the number of removed entries.
+        size_type erase()
+        {
+            return clear();
+        }
+
+        /// \brief Clear the cache
+        ///
+        /// Unconditionally removes all stored entries from the cache.
+        size_type clear()
+        {
+            size_type erased = 0;
+            for (size_type i = 0; i != num_shards_(); ++i)
+            {
+                shard& s = shards_[i];
+
+                std::lock_guard<lock_type> l(s.mtx);
+                erased += s.size;
+                s.slots.clear();
+                s.size = 0;
+                s.hand = 0;
+            }
+            return erased;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \brief Return the combined statistics of all shards
+        ///
+        /// \param reset  [in] Reset the statistics of all shards after they
+        ///               have been combined.
+        [[nodiscard]] statistics_type get_statistics(bool reset = false)
+        {
+            statistics_type result;
+            for (size_type i = 0; i != num_shards_(); ++i)
+            {
+                shard& s = shards_[i];
+
+                std::lock_guard<lock_type> l(s.mtx);
+                result += s.statistics;
+                if (reset)
+                {
+                    s.statistics = statistics_type();
+                }
+            }
+            return result;
+        }
+
+    private:
+        [[nodiscard]] size_type num_shards_() const noexcept
+        {
+            return static_cast<size_type>(1) << shard_bits_;
+        }
+
+        // Mix the bits of the hash value, std::hash is the identity for
+        // integral types on many platforms.
+        [[nodiscard]] size_type hash_key(key_type const& key) const
+        {
+            std::uint64_t h = static_cast<std::uint64_t>(hash_(key));
+            h ^= h >> 33;
+            h *= 0xff51afd7ed558ccdULL;
+            h ^= h >> 33;
+            return static_cast<size_type>(h);
+        }
+
+        // the shards are selected by the upper bits of the hash value, the
+        // slots in a shard by the lower bits
+        [[nodiscard]] shard& get_shard(size_type hash) const noexcept
+        {
+            if (shard_bits_ == 0)
+                return shards_[0];
+            return shards_[hash >> (sizeof(size_type) * 8 - shard_bits_)];
+        }
+
+        void set_shard_capacities()
+        {
+            size_type const num_shards = num_shards_();
+            size_type const capacity =
+                (max_size_ + num_shards - 1) / num_shards;
+
+            for (size_type i = 0; i != num_shards; ++i)
+            {
+                shard& s = shards_[i];
+
+                std::lock_guard<lock_type> l(s.mtx);
+                s.capacity = capacity;
+                while (s.capacity != 0 && s.size > s.capacity)
+                {
+                    evict(s);
+                }
+            }
+        }
+
+        [[nodiscard]] size_type find(
+            shard const& s, key_type const& key, size_type hash) const
+        {
+            if (s.slots.empty())
+                return npos;
+
+            size_type const mask = s.slots.size() - 1;
+            for (size_type pos = hash & mask; /**/; pos = (pos + 1) & mask)
+            {
+                slot const& sl = s.slots[pos];
+                if (!sl.value)
+                    return npos;
+                if (sl.hash == hash && key_equal_(sl.value->first, key))
+                    return pos;
+            }
+        }
+
+        // place an entry into the first free slot of its probe sequence
+        static void place(shard& s, slot&& sl)
+        {
+            size_type const mask = s.slots.size() - 1;
+            size_type pos = sl.hash & mask;
+            while (s.slots[pos].value)
+            {
+                pos = (pos + 1) & mask;
+            }
+            s.slots[pos] = HPX_MOVE(sl);
+        }
+
+        // keep the load factor of the table at or below one half
+        static void grow(shard& s)
+        {
+            std::vector<slot> slots(
+                s.slots.empty() ? min_table_size : 2 * s.slots.size());
+            std::swap(slots, s.slots);
+            s.hand = 0;
+
+            for (slot& sl : slots)
+            {
+                if (sl.value)
+                {
+                    place(s, HPX_MOVE(sl));
+                }
+            }
+        }
+
+        template <typename Entry_>
+        void insert_nonexist(
+            shard& s, key_type const& key, size_type hash, Entry_&& entry)
+        {
+            // Do we need to evict a cache entry?
+            if (s.capacity != 0 && s.size >= s.capacity)
+            {
+                evict(s);
+            }
+
+            if (2 * (s.size + 1) > s.slots.size())
+            {
+                grow(s);
+            }
+
+            // new entries start out as referenced, giving them a chance to
+            // be accessed before the clock hand reaches them
+            slot sl;
+            sl.value.emplace(key, HPX_FORWARD(Entry_, entry));
+            sl.hash = hash;
+            sl.referenced = true;
+            place(s, HPX_MOVE(sl));
+
+            ++s.size;
+            s.statistics.got_insertion();
+        }
+
+        // Remove the entry at the given position. The following entries of
+        // the same cluster are shifted back if this brings them closer to
+        // their home slot, which keeps all entries reachable without the need
+        // for tombstones.
+        static void erase_at(shard& s, size_type pos)
+        {
+            size_type const mask = s.slots.size() - 1;
+
+            s.slots[pos].value.reset();
+            --s.size;
+
+            for (size_type next = (pos + 1) & mask; s.slots[next].value;
+                 next = (next + 1) & mask)
+            {
+                // the entry may be moved to the free slot only if its home
+                // slot is not located cyclically in (pos, next]
+                size_type const home = s.slots[next].hash & mask;
+                bool const stays = pos <= next ?
+                    (pos < home && home <= next) :
+                    (pos < home || home <= next);
+                if (!stays)
+                {
+                    s.slots[pos] = HPX_MOVE(s.slots[next]);
+                    s.slots[next].value.reset();
+                    pos = next;
+                }
+            }
+        }
+
+        // evict the first entry the clock hand finds not being referenced
+        static void evict(shard& s)
+        {
+            if (s.size == 0)
+                return;
+
+            size_type const mask = s.slots.size() - 1;
+            while (true)
+            {
+                slot& sl = s.slots[s.hand];
+                if (sl.value)
+                {
+                    if (!sl.referenced)
+                    {
+                        erase_at(s, s.hand);
+                        s.statistics.got_eviction();
+                        return;
+                    }
+                    sl.referenced = false;
+                }
+                s.hand = (s.hand + 1) & mask;
+            }
+        }
+
+    private:
+        size_type max_size_;
+        size_type shard_bits_ = 0;
+        std::unique_ptr<shard_type[]> shards_;
+
+        Hash hash_;
+        KeyEqual key_equal_;
+    };
+}    // namespace hpx::util::cache
@@ -10,12 +10,13 @@
 #include <hpx/cache/policies/always.hpp>
 #include <hpx/cache/statistics/no_statistics.hpp>
 
-#include <algorithm>
-#include <deque>
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx::util::cache {
@@ -107,8 +108,19 @@ namespace hpx::util::cache {
         using iterator = typename storage_type::iterator;
         using const_iterator = typename storage_type::const_iterator;
 
-        using heap_type = std::deque<iterator>;
-        using heap_iterator = typename heap_type::iterator;
+        // Every heap element refers to its slot in the heap index, which
+        // holds the current position of the element in the heap. This allows
+        // to restore the heap property for a single changed entry in
+        // O(log n) instead of rebuilding the whole heap.
+        struct heap_entry
+        {
+            iterator it;
+            std::size_t* index;
+        };
+
+        using heap_type = std::vector<heap_entry>;
+        using heap_index_type =
+            std::unordered_map<storage_value_type const*, std::size_t>;
 
         using adapted_update_policy_type = adapt<UpdatePolicy, iterator>;
 
@@ -142,9 +154,36 @@ namespace hpx::util::cache {
         {
         }
 
-        local_cache(local_cache const& other) = default;
+        // the heap refers to the entries of the copied storage, it has to
+        // be rebuilt for the new storage
+        local_cache(local_cache const& other)
+          : max_size_(other.max_size_)
+          , current_size_(other.current_size_)
+          , store_(other.store_)
+          , update_policy_(other.update_policy_)
+          , insert_policy_(other.insert_policy_)
+          , statistics_(other.statistics_)
+        {
+            rebuild_heap();
+        }
+
         local_cache(local_cache&& other) = default;
-        local_cache& operator=(local_cache const& other) = default;
+
+        local_cache& operator=(local_cache const& other)
+        {
+            if (this != &other)
+            {
+                max_size_ = other.max_size_;
+                current_size_ = other.current_size_;
+                store_ = other.store_;
+                update_policy_ = other.update_policy_;
+                insert_policy_ = other.insert_policy_;
+                statistics_ = other.statistics_;
+                rebuild_heap();
+            }
+            return *this;
+        }
+
         local_cache& operator=(local_cache&& other) = default;
 
         ~local_cache() = default;
@@ -248,8 +287,7 @@ namespace hpx::util::cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -292,8 +330,7 @@ namespace hpx::util::cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -335,8 +372,7 @@ namespace hpx::util::cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -435,9 +471,7 @@ namespace hpx::util::cache {
             current_size_ += entry_size;
 
             // update the entry heap
-            entry_heap_.push_back(p.first);
-            std::push_heap(
-                entry_heap_.begin(), entry_heap_.end(), update_policy_);
+            heap_push(p.first);
 
             // update statistics
             statistics_.got_insertion();
@@ -492,8 +526,7 @@ namespace hpx::util::cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -555,8 +588,7 @@ namespace hpx::util::cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -618,8 +650,7 @@ namespace hpx::util::cache {
             if ((*it).second.touch())
             {
                 // reorder heap based on the changed entry attributes
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_update(it);
             }
 
             // update statistics
@@ -650,30 +681,23 @@ namespace hpx::util::cache {
             update_on_exit update(statistics_, statistics::method::erase_entry);
 
             size_type erased = 0;
-            for (heap_iterator it = entry_heap_.begin();
-                 it != entry_heap_.end();
-                /**/)
+            for (iterator it = store_.begin(); it != store_.end(); /**/)
             {
-                iterator sit = *it;
-
                 // check if this item needs to be erased
                 // do not remove this entry from the cache if either the
                 // function object or the entries' remove function return false
-                typename storage_type::value_type& val = *sit;
+                typename storage_type::value_type& val = *it;
                 if (ep(val) && val.second.remove())
                 {
                     // update the current size and the overall size of the
                     // removed items
-                    size_type entry_size = (*(*it)).second.get_size();
+                    size_type entry_size = val.second.get_size();
                     current_size_ -= entry_size;
                     erased += entry_size;
 
-                    // we remove the element manually, forcing the heap to be
-                    // rebuilt at the end
-                    it = entry_heap_.erase(it);
-
-                    // remove the cache entry
-                    store_.erase(sit);
+                    // remove the entry from the heap and from the cache
+                    heap_erase(heap_position(it));
+                    it = store_.erase(it);
 
                     // update statistics
                     statistics_.got_eviction();
@@ -685,10 +709,6 @@ namespace hpx::util::cache {
                 }
             }
 
-            // reorder heap based on the changed entry list
-            std::make_heap(
-                entry_heap_.begin(), entry_heap_.end(), update_policy_);
-
             return erased;
         }
 
@@ -718,6 +738,7 @@ namespace hpx::util::cache {
         {
             store_.clear();
             entry_heap_.clear();
+            heap_index_.clear();
             statistics_.clear();
             current_size_ = 0;
         }
@@ -746,65 +767,154 @@ namespace hpx::util::cache {
             if (entry_heap_.empty())
                 return false;
 
-            bool is_heap = true;
-            for (heap_iterator it = entry_heap_.begin();
-                 num_free > 0 && it != entry_heap_.end();
-                /**/)
+            // evict the 'oldest' entries first, entries refusing to be
+            // removed are added back to the heap afterwards
+            std::vector<iterator> kept;
+            while (num_free > 0 && !entry_heap_.empty())
             {
-                iterator sit = *it;
+                iterator sit = entry_heap_.front().it;
+                heap_erase(0);
+
                 if (!(*sit).second.remove())
                 {
-                    ++it;    // do not remove this entry from the cache
+                    kept.push_back(sit);    // do not remove this entry
+                    continue;
                 }
-                else
-                {
-                    size_type entry_size = (*(*it)).second.get_size();
-
-                    if (it == entry_heap_.begin())
-                    {
-                        // if we're at the top of the list, just pop the item
-                        // this doesn't disturb the heap property of the heap
-                        ++it;
-                        std::pop_heap(entry_heap_.begin(), entry_heap_.end(),
-                            update_policy_);
-                        entry_heap_.pop_back();
-                    }
-                    else
-                    {
-                        // otherwise we remove the element manually, forcing
-                        // the heap to be rebuilt at the end
-                        it = entry_heap_.erase(it);
-                        is_heap = false;
-                    }
-
-                    // remove the cache entry
-                    store_.erase(sit);
-                    num_free -= static_cast<long>(entry_size);
-                    current_size_ -= entry_size;
 
-                    // update statistics
-                    statistics_.got_eviction();
-                }
+                size_type entry_size = (*sit).second.get_size();
+
+                // remove the cache entry
+                store_.erase(sit);
+                num_free -= static_cast<long>(entry_size);
+                current_size_ -= entry_size;
+
+                // update statistics
+                statistics_.got_eviction();
             }
 
-            // reorder heap based on the changed entry list
-            if (!is_heap)
+            for (iterator sit : kept)
             {
-                std::make_heap(
-                    entry_heap_.begin(), entry_heap_.end(), update_policy_);
+                heap_push(sit);
             }
 
             return num_free <= 0;
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Maintain the heap of entries. The heap is ordered such that the
+        // entry to be discarded first is at its front.
+        std::size_t heap_position(iterator it) const
+        {
+            return heap_index_.find(&*it)->second;
+        }
+
+        void heap_set(std::size_t pos, heap_entry const& e) noexcept
+        {
+            entry_heap_[pos] = e;
+            *e.index = pos;
+        }
+
+        void heap_sift_up(std::size_t pos)
+        {
+            heap_entry const e = entry_heap_[pos];
+            while (pos != 0)
+            {
+                std::size_t const parent = (pos - 1) / 2;
+                if (!update_policy_(entry_heap_[parent].it, e.it))
+                    break;
+
+                heap_set(pos, entry_heap_[parent]);
+                pos = parent;
+            }
+            heap_set(pos, e);
+        }
+
+        void heap_sift_down(std::size_t pos)
+        {
+            heap_entry const e = entry_heap_[pos];
+            std::size_t const size = entry_heap_.size();
+            while (2 * pos + 1 < size)
+            {
+                std::size_t child = 2 * pos + 1;
+                if (child + 1 < size &&
+                    update_policy_(
+                        entry_heap_[child].it, entry_heap_[child + 1].it))
+                {
+                    ++child;
+                }
+                if (!update_policy_(e.it, entry_heap_[child].it))
+                    break;
+
+                heap_set(pos, entry_heap_[child]);
+                pos = child;
+            }
+            heap_set(pos, e);
+        }
+
+        void heap_push(iterator it)
+        {
+            std::size_t& index = heap_index_[&*it];
+            index = entry_heap_.size();
+            entry_heap_.push_back(heap_entry{it, &index});
+            heap_sift_up(index);
+        }
+
+        // restore the heap property for the element at the given position
+        void heap_restore(std::size_t pos)
+        {
+            std::size_t const* index = entry_heap_[pos].index;
+            heap_sift_up(pos);
+            if (*index == pos)
+            {
+                heap_sift_down(pos);
+            }
+        }
+
+        // restore the heap property after the given entry has changed
+        void heap_update(iterator it)
+        {
+            heap_restore(heap_position(it));
+        }
+
+        void heap_erase(std::size_t pos)
+        {
+            storage_value_type const* key = &*entry_heap_[pos].it;
+
+            std::size_t const last = entry_heap_.size() - 1;
+            if (pos != last)
+            {
+                heap_set(pos, entry_heap_[last]);
+            }
+            entry_heap_.pop_back();
+            heap_index_.erase(key);
+
+            if (pos != last)
+            {
+                heap_restore(pos);
+            }
+        }
+
+        void rebuild_heap()
+        {
+            entry_heap_.clear();
+            heap_index_.clear();
+            entry_heap_.reserve(store_.size());
+            for (iterator it = store_.begin(); it != store_.end(); ++it)
+            {
+                heap_push(it);
+            }
+        }
+
     private:
         size_type max_size_;        // cache capacity
         size_type current_size_;    // current cache size
         storage_type store_;        // the cache itself
 
-        // we store a list of pointers to the held keys in a std::heap which
-        // is being sorted based on the criteria defined by the UpdatePolicy
+        // we store a list of pointers to the held keys in a binary heap which
+        // is being sorted based on the criteria defined by the UpdatePolicy,
+        // the heap index maps the entries to their position in the heap
         heap_type entry_heap_;
+        heap_index_type heap_index_;
 
         adapted_update_policy_type update_policy_;
         insert_policy_type insert_policy_;
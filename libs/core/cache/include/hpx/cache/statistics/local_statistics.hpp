@@ -103,6 +103,16 @@ namespace hpx::util::cache::statistics {
             insertions_ = 0;
         }
 
+        /// \brief Combine the statistics of another instance with this one
+        local_statistics& operator+=(local_statistics const& rhs) noexcept
+        {
+            hits_ += rhs.hits_;
+            misses_ += rhs.misses_;
+            insertions_ += rhs.insertions_;
+            evictions_ += rhs.evictions_;
+            return *this;
+        }
+
     private:
         std::size_t hits_ = 0;
         std::size_t misses_ = 0;
@@ -62,6 +62,12 @@ namespace hpx::util::cache::statistics {
         /// \brief Reset all statistics
         static constexpr void clear() noexcept {}
 
+        /// \brief Combine the statistics of another instance with this one
+        constexpr no_statistics& operator+=(no_statistics const&) noexcept
+        {
+            return *this;
+        }
+
         /// Helper class to update timings and counts on function exit
         struct update_on_exit
         {
@@ -0,0 +1,213 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the latency of cache hits and of insertions evicting an entry for
+// the different entry types of the local_cache, depending on the number of
+// entries held by the cache. A lookup in a plain std::map serves as the
+// baseline.
+
+#include <hpx/cache/entries/fifo_entry.hpp>
+#include <hpx/cache/entries/lfu_entry.hpp>
+#include <hpx/cache/entries/lru_entry.hpp>
+#include <hpx/cache/entries/size_entry.hpp>
+#include <hpx/cache/local_cache.hpp>
+#include <hpx/chrono.hpp>
+#include <hpx/format.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/program_options.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = (unsigned int) std::random_device{}();
+std::size_t accesses = 1000000;
+
+struct timing
+{
+    double hit = 0.0;
+    double insert = 0.0;
+};
+
+std::vector<std::uint64_t> random_keys(std::size_t size)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::uint64_t> dist(0, size - 1);
+
+    std::vector<std::uint64_t> keys(accesses);
+    for (auto& key : keys)
+    {
+        key = dist(gen);
+    }
+    return keys;
+}
+
+template <typename Entry>
+Entry make_entry(std::uint64_t value)
+{
+    return Entry(value);
+}
+
+template <>
+hpx::util::cache::entries::size_entry<std::uint64_t>
+make_entry<hpx::util::cache::entries::size_entry<std::uint64_t>>(
+    std::uint64_t value)
+{
+    return hpx::util::cache::entries::size_entry<std::uint64_t>(value, 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Entry>
+timing measure_cache(std::size_t size)
+{
+    using cache_type = hpx::util::cache::local_cache<std::uint64_t, Entry>;
+
+    cache_type cache(size);
+    for (std::uint64_t i = 0; i != size; ++i)
+    {
+        cache.insert(i, make_entry<Entry>(i));
+    }
+
+    std::vector<std::uint64_t> const keys = random_keys(size);
+
+    timing result;
+
+    // all accessed keys are held by the cache
+    std::uint64_t sum = 0;
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+    for (std::uint64_t key : keys)
+    {
+        std::uint64_t value = 0;
+        cache.get_entry(key, value);
+        sum += value;
+    }
+    result.hit = static_cast<double>(
+                     hpx::chrono::high_resolution_clock::now() - start) /
+        static_cast<double>(keys.size());
+
+    // every insertion of a new key evicts an existing entry
+    start = hpx::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i != keys.size(); ++i)
+    {
+        cache.insert(size + i, make_entry<Entry>(i));
+    }
+    result.insert = static_cast<double>(
+                        hpx::chrono::high_resolution_clock::now() - start) /
+        static_cast<double>(keys.size());
+
+    HPX_TEST_NEQ(sum, static_cast<std::uint64_t>(-1));
+    return result;
+}
+
+timing measure_map(std::size_t size)
+{
+    std::map<std::uint64_t, std::uint64_t> map;
+    for (std::uint64_t i = 0; i != size; ++i)
+    {
+        map.emplace(i, i);
+    }
+
+    std::vector<std::uint64_t> const keys = random_keys(size);
+
+    timing result;
+
+    std::uint64_t sum = 0;
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+    for (std::uint64_t key : keys)
+    {
+        sum += map.find(key)->second;
+    }
+    result.hit = static_cast<double>(
+                     hpx::chrono::high_resolution_clock::now() - start) /
+        static_cast<double>(keys.size());
+
+    start = hpx::chrono::high_resolution_clock::now();
+    for (std::uint64_t i = 0; i != keys.size(); ++i)
+    {
+        map.erase(map.begin());
+        map.emplace(size + i, i);
+    }
+    result.insert = static_cast<double>(
+                        hpx::chrono::high_resolution_clock::now() - start) /
+        static_cast<double>(keys.size());
+
+    HPX_TEST_NEQ(sum, static_cast<std::uint64_t>(-1));
+    return result;
+}
+
+void print_timing(char const* kind, std::size_t size, timing const& t)
+{
+    hpx::util::format_to(
+        std::cout, "{},{},{},{}\n", kind, size, t.hit, t.insert)
+        << std::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::size_t const min_size = vm["min_size"].as<std::size_t>();
+    std::size_t const max_size = vm["max_size"].as<std::size_t>();
+
+    using namespace hpx::util::cache::entries;
+
+    if (vm.count("no-header") == 0)
+    {
+        std::cout << "kind,cache_size,hit_latency[ns],insert_latency[ns]\n";
+    }
+
+    for (std::size_t size = min_size; size <= max_size; size *= 4)
+    {
+        print_timing("std::map", size, measure_map(size));
+        print_timing(
+            "lru_entry", size, measure_cache<lru_entry<std::uint64_t>>(size));
+        print_timing(
+            "lfu_entry", size, measure_cache<lfu_entry<std::uint64_t>>(size));
+        print_timing("fifo_entry", size,
+            measure_cache<fifo_entry<std::uint64_t>>(size));
+        print_timing("size_entry", size,
+            measure_cache<size_entry<std::uint64_t>>(size));
+    }
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    using namespace hpx::program_options;
+    options_description desc_commandline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("min_size", value<std::size_t>()->default_value(256),
+            "smallest number of cache entries (default: 256)")
+        ("max_size", value<std::size_t>()->default_value(1048576),
+            "largest number of cache entries (default: 1048576)")
+        ("accesses", value<std::size_t>(&accesses)->default_value(1000000),
+            "number of measured accesses per cache size (default: 1000000)")
+        ("no-header", "do not print out the csv header row")
+        ("seed,s", value<unsigned int>(),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::local::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
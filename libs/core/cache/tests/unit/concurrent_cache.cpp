@@ -0,0 +1,241 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/cache/concurrent_cache.hpp>
+#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/cache/statistics/local_statistics.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_update()
+{
+    using cache_type = hpx::util::cache::concurrent_cache<std::string,
+        std::string, hpx::util::cache::statistics::local_statistics>;
+
+    cache_type c;
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.capacity());
+
+    HPX_TEST(c.insert("white", "255,255,255"));
+    HPX_TEST(c.insert("yellow", "255,255,0"));
+    HPX_TEST(!c.insert("white", "0,0,0"));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(2), c.size());
+
+    std::string value;
+    HPX_TEST(c.get_entry("white", value));
+    HPX_TEST_EQ(value, "255,255,255");
+    HPX_TEST(!c.get_entry("black", value));
+
+    c.update("white", "0,0,0");
+    HPX_TEST(c.get_entry("white", value));
+    HPX_TEST_EQ(value, "0,0,0");
+
+    // update inserts missing entries
+    c.update("green", "0,255,0");
+    HPX_TEST(c.holds_key("green"));
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.size());
+
+    // update_if proceeds only if the function returns true
+    HPX_TEST(!c.update_if("green", "1,1,1",
+        [](std::string const&, std::string const&) { return false; }));
+    HPX_TEST(c.get_entry("green", value));
+    HPX_TEST_EQ(value, "0,255,0");
+
+    HPX_TEST(c.update_if("green", "1,1,1",
+        [](std::string const&, std::string const&) { return true; }));
+    HPX_TEST(c.get_entry("green", value));
+    HPX_TEST_EQ(value, "1,1,1");
+
+    auto stats = c.get_statistics(true);
+    HPX_TEST_EQ(stats.hits(), static_cast<std::size_t>(6));
+    HPX_TEST_EQ(stats.misses(), static_cast<std::size_t>(2));
+    HPX_TEST_EQ(stats.insertions(), static_cast<std::size_t>(3));
+    HPX_TEST_EQ(stats.evictions(), static_cast<std::size_t>(0));
+
+    stats = c.get_statistics();
+    HPX_TEST_EQ(stats.hits(), static_cast<std::size_t>(0));
+    HPX_TEST_EQ(stats.insertions(), static_cast<std::size_t>(0));
+
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(3), c.clear());
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+    HPX_TEST(!c.holds_key("white"));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_evict()
+{
+    using cache_type = hpx::util::cache::concurrent_cache<int, int,
+        hpx::util::cache::statistics::local_full_statistics>;
+
+    // a single shard makes the eviction order predictable
+    cache_type c(64, 1);
+
+    for (int i = 0; i != 256; ++i)
+    {
+        HPX_TEST(c.insert(i, i));
+        HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(64));
+    }
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(64), c.size());
+
+    auto stats = c.get_statistics(true);
+    HPX_TEST_EQ(stats.insertions(), static_cast<std::size_t>(256));
+    HPX_TEST_EQ(stats.evictions(), static_cast<std::size_t>(192));
+    HPX_TEST_EQ(stats.get_insert_entry_count(false), 256);
+
+    // an entry which is referenced regularly survives
+    for (int i = 256; i != 1024; ++i)
+    {
+        int value = 0;
+        HPX_TEST(c.get_entry(255, value));
+        HPX_TEST_EQ(value, 255);
+
+        HPX_TEST(c.insert(i, i));
+    }
+    HPX_TEST(c.holds_key(255));
+
+    // shrinking the cache evicts entries
+    c.reserve(16);
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(16), c.capacity());
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(16));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_erase()
+{
+    using cache_type = hpx::util::cache::concurrent_cache<int, int>;
+
+    cache_type c(0, 4);
+    std::map<int, int> expected;
+
+    // compare a random sequence of operations with a std::map
+    std::mt19937 gen(42);
+    for (int i = 0; i != 10000; ++i)
+    {
+        int const key = static_cast<int>(gen() % 500);
+        switch (gen() % 4)
+        {
+        case 0:
+            HPX_TEST_EQ(c.insert(key, i), expected.emplace(key, i).second);
+            break;
+
+        case 1:
+            c.update(key, i);
+            expected[key] = i;
+            break;
+
+        case 2:
+        {
+            int value = 0;
+            auto it = expected.find(key);
+            HPX_TEST_EQ(c.get_entry(key, value), it != expected.end());
+            if (it != expected.end())
+            {
+                HPX_TEST_EQ(value, it->second);
+            }
+        }
+        break;
+
+        default:
+        {
+            int const m = key % 7;
+            std::size_t erased = 0;
+            for (auto it = expected.begin(); it != expected.end(); /**/)
+            {
+                if (it->first % 7 == m)
+                {
+                    it = expected.erase(it);
+                    ++erased;
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+            HPX_TEST_EQ(c.erase([m](std::pair<int, int> const& p) {
+                return p.first % 7 == m;
+            }),
+                erased);
+        }
+        break;
+        }
+
+        HPX_TEST_EQ(c.size(), expected.size());
+    }
+
+    for (auto const& p : expected)
+    {
+        int value = 0;
+        HPX_TEST(c.get_entry(p.first, value));
+        HPX_TEST_EQ(value, p.second);
+    }
+
+    HPX_TEST_EQ(c.erase(), expected.size());
+    HPX_TEST_EQ(static_cast<cache_type::size_type>(0), c.size());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_access()
+{
+    using cache_type = hpx::util::cache::concurrent_cache<int, int,
+        hpx::util::cache::statistics::local_statistics>;
+
+    cache_type c(1024);
+
+    std::size_t const num_threads = 4;
+    int const accesses = 100000;
+
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t != num_threads; ++t)
+    {
+        threads.emplace_back([&c, t]() {
+            for (int i = 0; i != accesses; ++i)
+            {
+                int const key = (i * 7 + static_cast<int>(t)) % 4096;
+
+                int value = 0;
+                if (c.get_entry(key, value))
+                {
+                    HPX_TEST_EQ(value, key);
+                }
+                else
+                {
+                    c.insert(key, key);
+                }
+            }
+        });
+    }
+
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // the capacity is split evenly among the shards
+    HPX_TEST_LTE(c.size(), static_cast<cache_type::size_type>(1024));
+
+    auto const stats = c.get_statistics();
+    HPX_TEST_EQ(stats.hits() + stats.misses(),
+        static_cast<std::size_t>(num_threads * accesses));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    test_insert_update();
+    test_evict();
+    test_erase();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
@@ -81,6 +81,11 @@ namespace hpx {
                 std::reference_wrapper<hpx::runtime const> rt_;
             };
 
+            // Print the collected lock contention statistics at shutdown, if
+            // requested. Does nothing if lock contention profiling is not
+            // enabled.
+            HPX_CORE_EXPORT void add_lock_contention_report(hpx::runtime& rt);
+
             // Default params to initialize the init_params struct
             [[maybe_unused]] static int dummy_argc = 1;
             [[maybe_unused]] static char app_name[256] = HPX_APPLICATION_STRING;
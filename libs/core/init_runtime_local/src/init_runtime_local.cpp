@@ -40,6 +40,7 @@
 #include <hpx/runtime_local/startup_function.hpp>
 #include <hpx/string_util/classification.hpp>
 #include <hpx/string_util/split.hpp>
+#include <hpx/synchronization/detail/lock_contention.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -265,6 +266,10 @@ namespace hpx {
                 util::detail::set_spinlock_deadlock_detection_limit(
                     cmdline.rtcfg_.get_spinlock_deadlock_detection_limit());
 #endif
+#ifdef HPX_HAVE_LOCK_CONTENTION_PROFILING
+                util::enable_lock_contention_profiling(
+                    cmdline.rtcfg_.enable_lock_contention_profiling());
+#endif
 #if defined(HPX_HAVE_LOGGING)
                 util::detail::init_logging_local(cmdline.rtcfg_);
 #else
@@ -272,6 +277,27 @@ namespace hpx {
 #endif
             }
 
+            ///////////////////////////////////////////////////////////////////////
+            void add_lock_contention_report(
+                [[maybe_unused]] hpx::runtime& rt)
+            {
+#ifdef HPX_HAVE_LOCK_CONTENTION_PROFILING
+                if (!util::lock_contention_profiling_enabled())
+                    return;
+
+                auto const& cfg = rt.get_config();
+                std::string report = cfg.get_lock_contention_report();
+                if (report.empty())
+                    return;
+
+                rt.add_shutdown_function(
+                    [report = HPX_MOVE(report),
+                        format = cfg.get_lock_contention_report_format()]() {
+                        util::print_lock_contention_data(report, format);
+                    });
+#endif
+            }
+
             ///////////////////////////////////////////////////////////////////////
             void add_startup_functions(hpx::runtime& rt,
                 hpx::program_options::variables_map const& vm,
@@ -301,6 +327,8 @@ namespace hpx {
 
                 if (vm.count("hpx:dump-config"))
                     rt.add_startup_function(dump_config(rt));
+
+                add_lock_contention_report(rt);
             }
 
             ///////////////////////////////////////////////////////////////////////
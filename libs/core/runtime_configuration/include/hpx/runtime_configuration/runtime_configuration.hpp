@@ -102,6 +102,12 @@ namespace hpx::util {
         // Enable lock detection during suspension
         bool enable_lock_detection() const;
 
+        // Enable collecting lock contention statistics, and where and how to
+        // report them at shutdown
+        bool enable_lock_contention_profiling() const;
+        std::string get_lock_contention_report() const;
+        std::string get_lock_contention_report_format() const;
+
         // Enable minimal deadlock detection for HPX threads
         bool enable_minimal_deadlock_detection() const;
         bool enable_spinlock_deadlock_detection() const;
@@ -127,6 +127,12 @@ namespace hpx::util {
 #endif
             "throw_on_held_lock = ${HPX_THROW_ON_HELD_LOCK:1}",
 #endif
+#ifdef HPX_HAVE_LOCK_CONTENTION_PROFILING
+            "lock_contention_profiling = ${HPX_LOCK_CONTENTION_PROFILING:0}",
+            "lock_contention_report = ${HPX_LOCK_CONTENTION_REPORT:}",
+            "lock_contention_report_format = "
+            "${HPX_LOCK_CONTENTION_REPORT_FORMAT:text}",
+#endif
 #ifdef HPX_HAVE_THREAD_MINIMAL_DEADLOCK_DETECTION
 #ifdef HPX_DEBUG
             "minimal_deadlock_detection = ${HPX_MINIMAL_DEADLOCK_DETECTION:1}",
@@ -942,6 +948,43 @@ namespace hpx::util {
         return false;
     }
 
+    // Enable collecting lock contention statistics
+    bool runtime_configuration::enable_lock_contention_profiling() const
+    {
+#ifdef HPX_HAVE_LOCK_CONTENTION_PROFILING
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            return hpx::util::get_entry_as<int>(
+                       *sec, "lock_contention_profiling", 0) != 0;
+        }
+#endif
+        return false;
+    }
+
+    // Destination of the lock contention report written at shutdown
+    std::string runtime_configuration::get_lock_contention_report() const
+    {
+#ifdef HPX_HAVE_LOCK_CONTENTION_PROFILING
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            return sec->get_entry("lock_contention_report", "");
+        }
+#endif
+        return "";
+    }
+
+    std::string runtime_configuration::get_lock_contention_report_format()
+        const
+    {
+#ifdef HPX_HAVE_LOCK_CONTENTION_PROFILING
+        if (util::section const* sec = get_section("hpx"); nullptr != sec)
+        {
+            return sec->get_entry("lock_contention_report_format", "text");
+        }
+#endif
+        return "text";
+    }
+
     // Enable minimal deadlock detection for HPX threads
     bool runtime_configuration::enable_minimal_deadlock_detection() const
     {
@@ -39,7 +39,8 @@ namespace hpx::serialization {
         disable_receive_data_chunking = 0x00040000,
         archive_is_saving = 0x00080000,
         archive_is_preprocessing = 0x00100000,
-        all_archive_flags = 0x001fe000    // all of the above
+        enable_type_ids = 0x00200000,
+        all_archive_flags = 0x003fe000    // all of the above
     };
 
     constexpr archive_flags operator|(
@@ -145,6 +146,13 @@ namespace hpx::serialization {
                     flags_ & archive_flags::disable_receive_data_chunking);
         }
 
+        // Polymorphic types are sent with integer ids derived from their
+        // names, which speeds up looking up the types on the receiving end.
+        [[nodiscard]] constexpr bool enable_type_ids() const noexcept
+        {
+            return static_cast<bool>(flags_ & archive_flags::enable_type_ids);
+        }
+
         [[nodiscard]] constexpr std::uint32_t flags() const noexcept
         {
             return flags_;
@@ -32,6 +32,10 @@ namespace hpx::serialization {
             void const* buffer, std::size_t size, std::size_t buffer_size) = 0;
         virtual void load(void* dst, std::size_t dst_count) = 0;
 
+        // Filters collecting statistics about the processed data may use the
+        // given name to attribute them (for instance to an action).
+        virtual void set_name(char const* /* name */) noexcept {}
+
         template <typename T>
         constexpr void serialize(T& /*ar*/, unsigned) noexcept
         {
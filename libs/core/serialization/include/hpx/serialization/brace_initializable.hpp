@@ -8,165 +8,370 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/assert.hpp>
 
+#include <hpx/serialization/access.hpp>
 #include <hpx/serialization/brace_initializable_fwd.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/std_tuple.hpp>
 #include <hpx/serialization/traits/brace_initializable_traits.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_serializable.hpp>
+#include <hpx/serialization/traits/polymorphic_traits.hpp>
 
+#include <array>
+#include <cstddef>
+#include <memory>
 // We use std::tuple instead of hpx::tuple to avoid circular dependencies
 // between the serialization and datastructure modules.
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 namespace hpx::serialization {
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<0>)
-    {
-        serialize(archive, t, version);
-    }
+    namespace detail {
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<1>)
-    {
-        auto& [p1] = t;
-        auto&& data = std::forward_as_tuple(p1);
-        serialize(archive, data, version);
-    }
+        ////////////////////////////////////////////////////////////////////////
+        // Expose the members of a (brace-initializable) struct as a tuple of
+        // references.
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<1>) noexcept
+        {
+            auto& [p1] = t;
+            return std::forward_as_tuple(p1);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<2>)
-    {
-        auto& [p1, p2] = t;
-        auto&& data = std::forward_as_tuple(p1, p2);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<2>) noexcept
+        {
+            auto& [p1, p2] = t;
+            return std::forward_as_tuple(p1, p2);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<3>)
-    {
-        auto& [p1, p2, p3] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<3>) noexcept
+        {
+            auto& [p1, p2, p3] = t;
+            return std::forward_as_tuple(p1, p2, p3);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<4>)
-    {
-        auto& [p1, p2, p3, p4] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<4>) noexcept
+        {
+            auto& [p1, p2, p3, p4] = t;
+            return std::forward_as_tuple(p1, p2, p3, p4);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<5>)
-    {
-        auto& [p1, p2, p3, p4, p5] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<5>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5] = t;
+            return std::forward_as_tuple(p1, p2, p3, p4, p5);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<6>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<6>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6] = t;
+            return std::forward_as_tuple(p1, p2, p3, p4, p5, p6);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<7>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<7>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7] = t;
+            return std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<8>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<8>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8] = t;
+            return std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<9>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
-        auto&& data = std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<9>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9] = t;
+            return std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<10>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
-        auto&& data =
-            std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<10>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = t;
+            return std::forward_as_tuple(
+                p1, p2, p3, p4, p5, p6, p7, p8, p9, p10);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<11>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
-        auto&& data =
-            std::forward_as_tuple(p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<11>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = t;
+            return std::forward_as_tuple(
+                p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<12>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
-        auto&& data = std::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<12>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = t;
+            return std::forward_as_tuple(
+                p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12);
+        }
 
-    template <typename Archive, typename T>
-    void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<13>)
-    {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = t;
-        auto&& data = std::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13);
-        serialize(archive, data, version);
-    }
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<13>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = t;
+            return std::forward_as_tuple(
+                p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13);
+        }
+
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<14>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13,
+                p14] = t;
+            return std::forward_as_tuple(
+                p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14);
+        }
+
+        template <typename T>
+        HPX_FORCEINLINE auto struct_members(
+            T& t, hpx::traits::detail::size<15>) noexcept
+        {
+            auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14,
+                p15] = t;
+            return std::forward_as_tuple(
+                p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14,
+                p15);
+        }
+
+        template <typename T>
+        using struct_members_t = decltype(struct_members(
+            std::declval<T&>(), hpx::traits::detail::arity<T>()));
+
+        ////////////////////////////////////////////////////////////////////////
+        // Members that are serialized by copying their bytes (as opposed to
+        // members that have their own serialization functions or integral
+        // values that are promoted before being written).
+        template <typename T>
+        constexpr bool is_bitwise_member() noexcept
+        {
+            if constexpr (std::is_const_v<T> || std::is_pointer_v<T> ||
+                std::is_array_v<T> || std::is_empty_v<T>)
+            {
+                return false;
+            }
+            else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+            {
+                return true;
+            }
+            else
+            {
+                return !hpx::traits::is_intrusive_polymorphic_v<T> &&
+                    !hpx::traits::is_nonintrusive_polymorphic_v<T> &&
+                    !access::has_serialize_v<T> &&
+                    !hpx::traits::has_serialize_adl_v<T> &&
+                    (hpx::traits::is_bitwise_serializable_v<T> ||
+                        !hpx::traits::is_not_bitwise_serializable_v<T>);
+            }
+        }
+
+        template <std::size_t N>
+        struct struct_layout_info
+        {
+            // offset of each member as computed from the member types
+            std::array<std::size_t, N> offsets{};
+
+            // number of bytes covered by the run of contiguous bitwise
+            // members starting at the given member, zero if the member
+            // does not start such a run
+            std::array<std::size_t, N> run_size{};
+
+            // index of the last member of the run starting at the given
+            // member
+            std::array<std::size_t, N> run_last{};
+
+            // the member is covered by a run started by a preceding member
+            std::array<bool, N> in_run{};
+
+            bool has_runs = false;
+        };
+
+        // Analyze the layout of a struct at compile time to find runs of
+        // (at least two) adjacent members that can be copied using a single
+        // memcpy. The member offsets are derived from the member types, which
+        // is reliable for standard-layout types only. The computed layout is
+        // verified against the size of the struct.
+        template <typename T, typename... Ms>
+        constexpr struct_layout_info<sizeof...(Ms)>
+        analyze_struct_layout() noexcept
+        {
+            constexpr std::size_t N = sizeof...(Ms);
+            constexpr std::size_t sizes[] = {sizeof(Ms)...};
+            constexpr std::size_t alignments[] = {alignof(Ms)...};
+            constexpr bool bitwise[] = {is_bitwise_member<Ms>()...};
+
+            struct_layout_info<N> info;
+
+            std::size_t end = 0;
+            for (std::size_t i = 0; i != N; ++i)
+            {
+                info.offsets[i] =
+                    (end + alignments[i] - 1) / alignments[i] * alignments[i];
+                end = info.offsets[i] + sizes[i];
+            }
+
+            if (!std::is_standard_layout_v<T> ||
+                !std::is_copy_assignable_v<T> ||
+                (end + alignof(T) - 1) / alignof(T) * alignof(T) != sizeof(T))
+            {
+                return info;
+            }
+
+            for (std::size_t i = 0; i != N; /**/)
+            {
+                std::size_t last = i;
+                if (bitwise[i])
+                {
+                    while (last + 1 != N && bitwise[last + 1] &&
+                        info.offsets[last + 1] ==
+                            info.offsets[last] + sizes[last])
+                    {
+                        ++last;
+                    }
+                }
+
+                if (last != i)
+                {
+                    info.run_size[i] =
+                        info.offsets[last] + sizes[last] - info.offsets[i];
+                    info.run_last[i] = last;
+                    for (std::size_t j = i + 1; j <= last; ++j)
+                    {
+                        info.in_run[j] = true;
+                    }
+                    info.has_runs = true;
+                }
+                i = last + 1;
+            }
+            return info;
+        }
+
+        template <typename T, typename Members>
+        struct struct_layout;
+
+        template <typename T, typename... Ms>
+        struct struct_layout<T, std::tuple<Ms&...>>
+        {
+            static constexpr struct_layout_info<sizeof...(Ms)> info =
+                analyze_struct_layout<std::remove_cv_t<T>,
+                    std::remove_cv_t<Ms>...>();
+        };
+
+        ////////////////////////////////////////////////////////////////////////
+        template <typename Layout, std::size_t I, typename Archive,
+            typename Members>
+        HPX_FORCEINLINE void serialize_struct_member(
+            Archive& ar, Members& members)
+        {
+            if constexpr (Layout::info.run_size[I] != 0)
+            {
+                constexpr std::size_t last = Layout::info.run_last[I];
+
+                HPX_ASSERT(reinterpret_cast<char const*>(
+                               std::addressof(std::get<last>(members))) -
+                        reinterpret_cast<char const*>(
+                            std::addressof(std::get<I>(members))) ==
+                    static_cast<std::ptrdiff_t>(
+                        Layout::info.offsets[last] - Layout::info.offsets[I]));
+
+                if constexpr (std::is_same_v<Archive, input_archive>)
+                {
+                    ar.load_binary(std::addressof(std::get<I>(members)),
+                        Layout::info.run_size[I]);
+                }
+                else
+                {
+                    ar.save_binary(std::addressof(std::get<I>(members)),
+                        Layout::info.run_size[I]);
+                }
+            }
+            else if constexpr (!Layout::info.in_run[I])
+            {
+                serialize_one(ar, std::get<I>(members));
+            }
+        }
+
+        template <typename Layout, typename Archive, typename Members,
+            std::size_t... Is>
+        HPX_FORCEINLINE void serialize_struct_members(
+            Archive& ar, Members& members, std::index_sequence<Is...>)
+        {
+            (serialize_struct_member<Layout, Is>(ar, members), ...);
+        }
+
+        // Serialize the members of a struct, runs of adjacent bitwise
+        // serializable members are handled as a single block of bytes.
+        template <typename T, typename Archive, typename... Ms>
+        void serialize_struct_members(Archive& ar, std::tuple<Ms&...>& members,
+            unsigned int const version)
+        {
+            using layout = struct_layout<T, std::tuple<Ms&...>>;
+            if constexpr (layout::info.has_runs)
+            {
+#if !defined(HPX_SERIALIZATION_HAVE_ALL_TYPES_ARE_BITWISE_SERIALIZABLE)
+                if (ar.disable_array_optimization() || ar.endianess_differs())
+                {
+                    serialize(ar, members, version);
+                    return;
+                }
+#else
+                HPX_ASSERT(!(
+                    ar.disable_array_optimization() || ar.endianess_differs()));
+#endif
+                serialize_struct_members<layout>(
+                    ar, members, std::index_sequence_for<Ms...>());
+            }
+            else
+            {
+                serialize(ar, members, version);
+            }
+        }
+    }    // namespace detail
 
     template <typename Archive, typename T>
     void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<14>)
+        hpx::traits::detail::size<0>)
     {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14] = t;
-        auto&& data = std::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14);
-        serialize(archive, data, version);
+        serialize(archive, t, version);
     }
 
-    template <typename Archive, typename T>
+    template <typename Archive, typename T, std::size_t N>
     void serialize_struct(Archive& archive, T& t, const unsigned int version,
-        hpx::traits::detail::size<15>)
+        hpx::traits::detail::size<N> arity)
     {
-        auto& [p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14,
-            p15] = t;
-        auto&& data = std::forward_as_tuple(
-            p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15);
-        serialize(archive, data, version);
+        auto members = detail::struct_members(t, arity);
+        detail::serialize_struct_members<T>(archive, members, version);
     }
 
     template <typename Archive, typename T>
@@ -46,5 +46,7 @@ namespace hpx::serialization {
         virtual void load_binary(void* address, std::size_t count) = 0;
         virtual void load_binary_chunk(
             void* address, std::size_t count, bool allow_zero_copy_receive) = 0;
+        virtual void set_position(
+            std::size_t pos, std::size_t chunk, std::size_t chunk_offset) = 0;
     };
 }    // namespace hpx::serialization
@@ -0,0 +1,96 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::serialization {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A monotonic memory resource used for constructing the containers created
+    // while de-serializing data using an input_archive. The memory is handed
+    // out from a small number of larger blocks and is not reused until all of
+    // it is returned at once.
+    //
+    // The arena keeps track of the number of allocations that have not been
+    // returned yet. It destroys itself once its owner has released it and all
+    // allocations have been returned, i.e. it stays alive for as long as any
+    // of the containers using it (for instance the arguments of an action)
+    // are alive.
+    //
+    // Containers using the arena may outlive the action they were created
+    // for and may grow on different threads, allocating memory from the
+    // arena is therefore serialized.
+    class HPX_CORE_EXPORT deserialization_arena final
+      : public std::pmr::memory_resource
+    {
+        struct release_arena
+        {
+            void operator()(deserialization_arena* arena) const noexcept
+            {
+                arena->release();
+            }
+        };
+
+    public:
+        using pointer_type =
+            std::unique_ptr<deserialization_arena, release_arena>;
+
+        // Create a new arena, the size of the first block of memory is given
+        // by initial_size. The blocks are allocated from the given upstream
+        // resource (the default memory resource at the time of creation if
+        // none is given). The returned pointer represents the reference held
+        // by the owner of the arena.
+        [[nodiscard]] static pointer_type create(std::size_t initial_size,
+            std::pmr::memory_resource* upstream = nullptr);
+
+        deserialization_arena(deserialization_arena const&) = delete;
+        deserialization_arena(deserialization_arena&&) = delete;
+        deserialization_arena& operator=(deserialization_arena const&) = delete;
+        deserialization_arena& operator=(deserialization_arena&&) = delete;
+
+        // Return the number of allocations that have not been returned to the
+        // arena
+        [[nodiscard]] std::size_t num_allocations() const noexcept
+        {
+            return count_.load(std::memory_order_relaxed) - 1;
+        }
+
+    private:
+        deserialization_arena(
+            std::size_t initial_size, std::pmr::memory_resource* upstream);
+        ~deserialization_arena() override;
+
+        void release() noexcept;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(
+            void* p, std::size_t bytes, std::size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(
+            std::pmr::memory_resource const& other) const noexcept override;
+
+        std::mutex mtx_;
+        std::pmr::monotonic_buffer_resource resource_;
+
+        // number of allocations not returned yet plus one while the arena
+        // is owned
+        std::atomic<std::size_t> count_;
+    };
+}    // namespace hpx::serialization
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -102,11 +102,22 @@ namespace hpx::serialization {
             {
                 static Pointer call(input_archive& ar)
                 {
+                    // the type name is sent in any case, the receiver
+                    // might not know of all types sharing the same id
+                    std::uint32_t id = 0;
+                    if (ar.enable_type_ids())
+                    {
+                        ar >> id;
+                    }
+
                     std::string name;
                     ar >> name;
 
-                    Pointer t(polymorphic_intrusive_factory::instance()
-                                  .create<referred_type>(name));
+                    Pointer t(ar.enable_type_ids() ?
+                            polymorphic_intrusive_factory::instance()
+                                .create<referred_type>(id, name) :
+                            polymorphic_intrusive_factory::instance()
+                                .create<referred_type>(name));
                     ar >> *t;
                     return t;
                 }
@@ -180,6 +191,10 @@ namespace hpx::serialization {
                 static void call(output_archive& ar, Pointer const& ptr)
                 {
                     std::string const name = access::get_name(ptr.get());
+                    if (ar.enable_type_ids())
+                    {
+                        ar << get_polymorphic_type_id(name);
+                    }
                     ar << name;
                     ar << *ptr;
                 }
@@ -16,12 +16,20 @@
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <string>
 #include <unordered_map>
 
 namespace hpx::serialization::detail {
 
+    // Polymorphic types are identified on the wire by an id derived from their
+    // (portable) name. The id is computed the same way on all localities, it
+    // is however unique only among the types registered on the receiving
+    // locality if that locality doesn't know of any colliding type name.
+    [[nodiscard]] HPX_CORE_EXPORT std::uint32_t get_polymorphic_type_id(
+        std::string const& name) noexcept;
+
     class polymorphic_intrusive_factory
     {
     public:
@@ -32,6 +40,10 @@ namespace hpx::serialization::detail {
         using ctor_map_type =
             std::unordered_map<std::string, ctor_type, std::hash<std::string>>;
 
+        // types whose names map to the same id are stored with a nullptr
+        using id_map_type = std::unordered_map<std::uint32_t,
+            ctor_map_type::value_type const*>;
+
     public:
         polymorphic_intrusive_factory() = default;
 
@@ -49,8 +61,22 @@ namespace hpx::serialization::detail {
             return static_cast<T*>(create(name));
         }
 
+        // Create the type with the given id and name. The id is only used to
+        // avoid hashing the name, the type is always verified by its name as
+        // the sender might know of a type with the same id the receiver
+        // doesn't know of.
+        [[nodiscard]] HPX_CORE_EXPORT void* create(
+            std::uint32_t id, std::string const& name) const;
+
+        template <typename T>
+        [[nodiscard]] T* create(std::uint32_t id, std::string const& name) const
+        {
+            return static_cast<T*>(create(id, name));
+        }
+
     private:
         ctor_map_type map_;
+        id_map_type id_map_;
     };
 
     template <typename T, typename Enable = void>
@@ -22,6 +22,7 @@
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
 #include <hpx/type_support/static.hpp>
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -106,36 +107,25 @@ namespace hpx::serialization::detail {
         HPX_NON_COPYABLE(polymorphic_nonintrusive_factory);
 
     public:
+        struct registered_class
+        {
+            function_bunch_type bunch;
+            std::uint32_t id;
+        };
+
         using serializer_map_type = std::unordered_map<std::string,
-            function_bunch_type, std::hash<std::string>>;
+            registered_class, std::hash<std::string>>;
         using serializer_typeinfo_map_type = std::unordered_map<std::string,
-            std::string, std::hash<std::string>>;
+            serializer_map_type::value_type const*, std::hash<std::string>>;
 
-        HPX_CORE_EXPORT static polymorphic_nonintrusive_factory& instance();
+        // types whose names map to the same id are stored with a nullptr
+        using serializer_id_map_type = std::unordered_map<std::uint32_t,
+            serializer_map_type::value_type const*>;
 
-        void register_class(std::type_info const& typeinfo,
-            std::string const& class_name, function_bunch_type const& bunch)
-        {
-            if (!typeinfo.name() && std::string(typeinfo.name()).empty())
-            {
-                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
-                    "polymorphic_nonintrusive_factory::register_class",
-                    "Cannot register a factory with an empty type name");
-            }
-            if (class_name.empty())
-            {
-                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
-                    "polymorphic_nonintrusive_factory::register_class",
-                    "Cannot register a factory with an empty name");
-            }
-            auto const it = map_.find(class_name);
-            auto const jt = typeinfo_map_.find(typeinfo.name());
+        HPX_CORE_EXPORT static polymorphic_nonintrusive_factory& instance();
 
-            if (it == map_.end())
-                map_[class_name] = bunch;
-            if (jt == typeinfo_map_.end())
-                typeinfo_map_[typeinfo.name()] = class_name;
-        }
+        HPX_CORE_EXPORT void register_class(std::type_info const& typeinfo,
+            std::string const& class_name, function_bunch_type const& bunch);
 
         // the following templates are defined in *.ipp file
         template <typename T>
@@ -154,8 +144,14 @@ namespace hpx::serialization::detail {
 
         friend struct hpx::util::static_<polymorphic_nonintrusive_factory>;
 
+        // read the type id and name sent by save() and return the functions
+        // registered for it
+        [[nodiscard]] HPX_CORE_EXPORT function_bunch_type const& locate(
+            input_archive& ar) const;
+
         serializer_map_type map_;
         serializer_typeinfo_map_type typeinfo_map_;
+        serializer_id_map_type id_map_;
     };
 
     template <typename Derived>
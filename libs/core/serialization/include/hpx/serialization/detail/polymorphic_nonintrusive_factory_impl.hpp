@@ -22,32 +22,27 @@ namespace hpx::serialization::detail {
     void polymorphic_nonintrusive_factory::save(output_archive& ar, T const& t)
     {
         // It's safe to call typeid here. The typeid(t) return value is
-        // only used for local lookup to the portable string that goes over the
-        // wire
-        std::string const class_name = typeinfo_map_.at(typeid(t).name());
+        // only used for local lookup to the portable id and string that go
+        // over the wire
+        auto const& [class_name, entry] = *typeinfo_map_.at(typeid(t).name());
+        if (ar.enable_type_ids())
+        {
+            ar << entry.id;
+        }
         ar << class_name;
 
-        map_.at(class_name).save_function(ar, &t);
+        entry.bunch.save_function(ar, &t);
     }
 
     template <typename T>
     void polymorphic_nonintrusive_factory::load(input_archive& ar, T& t)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        map_.at(class_name).load_function(ar, &t);
+        locate(ar).load_function(ar, &t);
     }
 
     template <typename T>
     T* polymorphic_nonintrusive_factory::load(input_archive& ar)
     {
-        std::string class_name;
-        ar >> class_name;
-
-        function_bunch_type const& bunch = map_.at(class_name);
-        T* t = static_cast<T*>(bunch.create_function(ar));
-
-        return t;
+        return static_cast<T*>(locate(ar).create_function(ar));
     }
 }    // namespace hpx::serialization::detail
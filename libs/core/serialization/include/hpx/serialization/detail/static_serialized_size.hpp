@@ -0,0 +1,108 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/access.hpp>
+#include <hpx/serialization/brace_initializable.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_not_bitwise_serializable.hpp>
+#include <hpx/serialization/traits/is_serializable.hpp>
+#include <hpx/serialization/traits/polymorphic_traits.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::serialization::detail {
+
+    inline constexpr std::size_t dynamic_serialized_size =
+        static_cast<std::size_t>(-1);
+
+    template <typename T>
+    constexpr std::size_t static_serialized_size() noexcept;
+
+    template <typename Layout, typename... Ms, std::size_t... Is>
+    constexpr std::size_t static_struct_serialized_size(
+        std::tuple<Ms&...>*, std::index_sequence<Is...>) noexcept
+    {
+        constexpr std::size_t sizes[] = {(Layout::info.run_size[Is] != 0 ?
+                Layout::info.run_size[Is] :
+                (Layout::info.in_run[Is] ?
+                        0 :
+                        static_serialized_size<std::remove_cv_t<Ms>>()))...};
+
+        std::size_t size = 0;
+        for (std::size_t const s : sizes)
+        {
+            if (s == dynamic_serialized_size)
+            {
+                return dynamic_serialized_size;
+            }
+            size += s;
+        }
+        return size;
+    }
+
+    // Return the number of bytes written when serializing any object of the
+    // given type, or dynamic_serialized_size if this depends on the value of
+    // the object. The result assumes that the array optimizations are enabled
+    // for the archive and that the endianess of both ends is the same.
+    //
+    // This mirrors the dispatch performed by output_archive::save.
+    template <typename T>
+    constexpr std::size_t static_serialized_size() noexcept
+    {
+        if constexpr (std::is_same_v<T, bool> || std::is_same_v<T, char> ||
+            std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>)
+        {
+            return sizeof(T);
+        }
+        else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>)
+        {
+            // integral values are promoted to 64 bit
+            return sizeof(std::uint64_t);
+        }
+        else if constexpr (std::is_floating_point_v<T>)
+        {
+            return sizeof(T);
+        }
+        else if constexpr (std::is_pointer_v<T> || std::is_array_v<T> ||
+            hpx::traits::is_nonintrusive_polymorphic_v<T> ||
+            hpx::traits::is_intrusive_polymorphic_v<T> ||
+            access::has_serialize_v<T> || hpx::traits::has_serialize_adl_v<T>)
+        {
+            return dynamic_serialized_size;
+        }
+        else if constexpr (std::is_empty_v<T>)
+        {
+            return 0;
+        }
+        else if constexpr (hpx::traits::is_bitwise_serializable_v<T> ||
+            !hpx::traits::is_not_bitwise_serializable_v<T>)
+        {
+            return sizeof(T);
+        }
+        else if constexpr (hpx::traits::has_struct_serialization_v<T>)
+        {
+            using members = struct_members_t<T>;
+            return static_struct_serialized_size<struct_layout<T, members>>(
+                static_cast<members*>(nullptr),
+                std::make_index_sequence<std::tuple_size_v<members>>());
+        }
+        else
+        {
+            return dynamic_serialized_size;
+        }
+    }
+
+    template <typename T>
+    inline constexpr bool has_static_serialized_size_v =
+        static_serialized_size<T>() != dynamic_serialized_size;
+}    // namespace hpx::serialization::detail
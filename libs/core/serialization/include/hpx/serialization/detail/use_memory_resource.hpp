@@ -0,0 +1,62 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+#include <memory_resource>
+#endif
+
+namespace hpx::serialization::detail {
+
+    template <typename Allocator>
+    struct is_polymorphic_allocator : std::false_type
+    {
+    };
+
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+    template <typename T>
+    struct is_polymorphic_allocator<std::pmr::polymorphic_allocator<T>>
+      : std::true_type
+    {
+    };
+#endif
+
+    template <typename Allocator>
+    inline constexpr bool is_polymorphic_allocator_v =
+        is_polymorphic_allocator<Allocator>::value;
+
+    // Make sure the given (allocator-aware) container is using the memory
+    // resource of the archive, if any. This is done only for containers using
+    // a polymorphic allocator. The container is about to be overwritten by
+    // the data loaded from the archive.
+    template <typename Archive, typename Container>
+    void use_memory_resource(
+        [[maybe_unused]] Archive& ar, [[maybe_unused]] Container& c)
+    {
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+        using allocator_type = typename Container::allocator_type;
+        if constexpr (is_polymorphic_allocator_v<allocator_type>)
+        {
+            std::pmr::memory_resource* resource = ar.get_memory_resource();
+            if (resource != nullptr && c.get_allocator().resource() != resource)
+            {
+                // Polymorphic allocators are not propagated when assigning
+                // containers, the container has to be re-created instead.
+                std::destroy_at(&c);
+                ::new (static_cast<void*>(std::addressof(c)))
+                    Container(allocator_type(resource));
+            }
+        }
+#endif
+    }
+}    // namespace hpx::serialization::detail
@@ -27,6 +27,10 @@
 #include <type_traits>
 #include <vector>
 
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+#include <memory_resource>
+#endif
+
 #include <hpx/config/warnings_prefix.hpp>
 
 namespace hpx::serialization {
@@ -251,11 +255,40 @@ namespace hpx::serialization {
         }
 #endif
 
+        // Continue reading at the given position. This allows to concurrently
+        // de-serialize independent parts of the same data using separate
+        // archives. All positions have to correspond to the state the archive
+        // would be in if all preceding data had been read (pos is the position
+        // in the data, chunk and chunk_offset refer to the serialization
+        // chunks, and archive_pos is the overall number of bytes read).
+        void set_position(std::size_t pos, std::size_t chunk,
+            std::size_t chunk_offset, std::size_t archive_pos)
+        {
+            buffer_->set_position(pos, chunk, chunk_offset);
+            size_ = archive_pos;
+        }
+
         [[nodiscard]] constexpr std::size_t bytes_read() const noexcept
         {
             return current_pos();
         }
 
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+        // Containers using a std::pmr::polymorphic_allocator are constructed
+        // using the given memory resource (if any) while being de-serialized.
+        constexpr void set_memory_resource(
+            std::pmr::memory_resource* resource) noexcept
+        {
+            memory_resource_ = resource;
+        }
+
+        [[nodiscard]] constexpr std::pmr::memory_resource* get_memory_resource()
+            const noexcept
+        {
+            return memory_resource_;
+        }
+#endif
+
         // this function is needed to avoid a MSVC linker error
         [[nodiscard]] constexpr std::size_t current_pos() const noexcept
         {
@@ -310,6 +343,10 @@ namespace hpx::serialization {
 
     private:
         std::unique_ptr<erased_input_container> buffer_;
+
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+        std::pmr::memory_resource* memory_resource_ = nullptr;
+#endif
     };
 }    // namespace hpx::serialization
 
@@ -212,6 +212,36 @@ namespace hpx::serialization {
             }
         }
 
+        // Continue reading at the given position in the (unfiltered) data.
+        // The chunk index and the offset into that chunk have to correspond
+        // to the given position.
+        void set_position(std::size_t pos, std::size_t chunk,
+            std::size_t chunk_offset) override
+        {
+            if (filter_ != nullptr || pos > access_traits::size(cont_))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "input_container::set_position",
+                    "archive data bstream can't be repositioned");
+            }
+
+            current_ = pos;
+            if (chunks_ != nullptr)
+            {
+                if (chunk > get_num_chunks() ||
+                    (chunk != get_num_chunks() &&
+                        chunk_offset > get_chunk_size(chunk)))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "input_container::set_position",
+                        "archive data bstream chunk position mismatch");
+                }
+
+                current_chunk_ = chunk;
+                current_chunk_size_ = chunk_offset;
+            }
+        }
+
         Container const& cont_;
         std::size_t current_;
         std::unique_ptr<binary_filter> filter_;
@@ -9,6 +9,7 @@
 
 #include <hpx/config/endian.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/serialization/detail/use_memory_resource.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
@@ -115,6 +116,7 @@ namespace hpx::serialization {
         std::uint64_t size;
         ar >> size;    //-V128
 
+        detail::use_memory_resource(ar, t);
         t.clear();
         for (std::size_t i = 0; i < size; ++i)
         {
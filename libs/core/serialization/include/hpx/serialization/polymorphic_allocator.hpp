@@ -0,0 +1,47 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+
+#include <memory>
+#include <memory_resource>
+#include <new>
+
+namespace hpx::serialization {
+
+    // A polymorphic allocator is not sent over the wire, the loaded allocator
+    // refers to the memory resource of the input archive (if any), or to the
+    // default memory resource otherwise.
+    template <typename T>
+    void serialize(
+        input_archive& ar, std::pmr::polymorphic_allocator<T>& alloc, unsigned)
+    {
+        std::pmr::memory_resource* resource = ar.get_memory_resource();
+        if (resource == nullptr)
+        {
+            resource = std::pmr::get_default_resource();
+        }
+
+        // polymorphic allocators can't be assigned to
+        std::destroy_at(&alloc);
+        ::new (static_cast<void*>(std::addressof(alloc)))
+            std::pmr::polymorphic_allocator<T>(resource);
+    }
+
+    template <typename T>
+    void serialize(
+        output_archive&, std::pmr::polymorphic_allocator<T> const&, unsigned)
+    {
+    }
+}    // namespace hpx::serialization
+
+#endif
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/serialization/detail/use_memory_resource.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 
 #include <cstdint>
@@ -22,6 +23,7 @@ namespace hpx::serialization {
         std::uint64_t size = 0;
         ar >> size;    //-V128
 
+        detail::use_memory_resource(ar, s);
         s.clear();
         if (s.size() < size)
             s.resize(size);
@@ -8,6 +8,7 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/serialization/detail/use_memory_resource.hpp>
 #include <hpx/serialization/map.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
@@ -32,6 +33,7 @@ namespace hpx::serialization {
         size_type size;
         ar >> size;    //-V128
 
+        detail::use_memory_resource(ar, t);
         t.clear();
         for (size_type i = 0; i < size; ++i)
         {
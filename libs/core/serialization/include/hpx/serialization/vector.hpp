@@ -12,6 +12,8 @@
 #include <hpx/assert.hpp>
 #include <hpx/serialization/array.hpp>
 #include <hpx/serialization/detail/serialize_collection.hpp>
+#include <hpx/serialization/detail/static_serialized_size.hpp>
+#include <hpx/serialization/detail/use_memory_resource.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/traits/is_bitwise_serializable.hpp>
@@ -49,6 +51,7 @@ namespace hpx::serialization {
     template <typename T, typename Allocator>
     void serialize(input_archive& ar, std::vector<T, Allocator>& v, unsigned)
     {
+        detail::use_memory_resource(ar, v);
         v.clear();
 
         std::uint64_t size;
@@ -148,6 +151,23 @@ namespace hpx::serialization {
         }
         else
         {
+            if constexpr (std::is_default_constructible_v<element_type> &&
+                detail::has_static_serialized_size_v<element_type>)
+            {
+                // the number of bytes needed for the elements is known
+                // without having to look at them, this is all the
+                // preprocessing pass is interested in
+                if (ar.is_preprocessing() &&
+                    !(ar.disable_array_optimization() ||
+                        ar.endianess_differs()))
+                {
+                    ar.save_binary(v.data(),
+                        size *
+                            detail::static_serialized_size<element_type>());
+                    return;
+                }
+            }
+
             // normal save ...
             detail::save_collection(ar, v);
         }
@@ -0,0 +1,74 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+#include <hpx/assert.hpp>
+#include <hpx/serialization/deserialization_arena.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+#include <mutex>
+
+namespace hpx::serialization {
+
+    deserialization_arena::pointer_type deserialization_arena::create(
+        std::size_t initial_size, std::pmr::memory_resource* upstream)
+    {
+        if (upstream == nullptr)
+        {
+            upstream = std::pmr::get_default_resource();
+        }
+        return pointer_type(new deserialization_arena(initial_size, upstream));
+    }
+
+    deserialization_arena::deserialization_arena(
+        std::size_t initial_size, std::pmr::memory_resource* upstream)
+      : resource_(initial_size != 0 ? initial_size : 1, upstream)
+      , count_(1)
+    {
+    }
+
+    deserialization_arena::~deserialization_arena() = default;
+
+    void deserialization_arena::release() noexcept
+    {
+        if (count_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete this;
+        }
+    }
+
+    void* deserialization_arena::do_allocate(
+        std::size_t bytes, std::size_t alignment)
+    {
+        void* p;
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            p = resource_.allocate(bytes, alignment);
+        }
+        count_.fetch_add(1, std::memory_order_relaxed);
+        return p;
+    }
+
+    void deserialization_arena::do_deallocate(
+        [[maybe_unused]] void* p, std::size_t, std::size_t)
+    {
+        // the memory is returned to the system once the arena is destroyed
+        HPX_ASSERT(count_.load(std::memory_order_relaxed) != 0);
+        release();
+    }
+
+    bool deserialization_arena::do_is_equal(
+        std::pmr::memory_resource const& other) const noexcept
+    {
+        return this == &other;
+    }
+}    // namespace hpx::serialization
+
+#endif
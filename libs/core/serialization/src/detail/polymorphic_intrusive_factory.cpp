@@ -12,10 +12,24 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/type_support/static.hpp>
 
+#include <cstdint>
 #include <string>
 
 namespace hpx::serialization::detail {
 
+    std::uint32_t get_polymorphic_type_id(std::string const& name) noexcept
+    {
+        // 32 bit FNV-1a, this doesn't depend on the platform or the build
+        std::uint32_t id = 2166136261u;
+        for (char const c : name)
+        {
+            id ^= static_cast<unsigned char>(c);
+            id *= 16777619u;
+        }
+
+        return id;
+    }
+
     polymorphic_intrusive_factory& polymorphic_intrusive_factory::instance()
     {
         hpx::util::static_<polymorphic_intrusive_factory> factory;
@@ -32,10 +46,19 @@ namespace hpx::serialization::detail {
                 "Cannot register a factory with an empty name");
         }
 
-        auto const it = map_.find(name);
-        if (it == map_.end())
+        auto const p = map_.emplace(name, fun);
+        if (!p.second)
+        {
+            return;
+        }
+
+        // Types whose ids collide can't be identified by their id, they are
+        // looked up by name instead.
+        auto const it =
+            id_map_.emplace(get_polymorphic_type_id(name), &*p.first);
+        if (!it.second)
         {
-            map_.emplace(name, fun);
+            it.first->second = nullptr;
         }
     }
 
@@ -43,4 +66,16 @@ namespace hpx::serialization::detail {
     {
         return map_.at(name)();
     }
+
+    void* polymorphic_intrusive_factory::create(
+        std::uint32_t id, std::string const& name) const
+    {
+        auto const it = id_map_.find(id);
+        if (it != id_map_.end() && it->second != nullptr &&
+            it->second->first == name)
+        {
+            return it->second->second();
+        }
+        return create(name);
+    }
 }    // namespace hpx::serialization::detail
@@ -7,7 +7,16 @@
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/detail/polymorphic_intrusive_factory.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/string.hpp>
+
+#include <cstdint>
+#include <string>
+#include <typeinfo>
 
 namespace hpx::serialization::detail {
 
@@ -17,4 +26,64 @@ namespace hpx::serialization::detail {
         hpx::util::static_<polymorphic_nonintrusive_factory> factory;
         return factory.get();
     }
+
+    void polymorphic_nonintrusive_factory::register_class(
+        std::type_info const& typeinfo, std::string const& class_name,
+        function_bunch_type const& bunch)
+    {
+        if (!typeinfo.name() && std::string(typeinfo.name()).empty())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "polymorphic_nonintrusive_factory::register_class",
+                "Cannot register a factory with an empty type name");
+        }
+        if (class_name.empty())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "polymorphic_nonintrusive_factory::register_class",
+                "Cannot register a factory with an empty name");
+        }
+
+        std::uint32_t const id = get_polymorphic_type_id(class_name);
+        auto const it = map_.emplace(class_name, registered_class{bunch, id});
+        typeinfo_map_.emplace(typeinfo.name(), &*it.first);
+        if (!it.second)
+        {
+            return;
+        }
+
+        // Types whose ids collide can't be identified by their id, they are
+        // looked up by name instead.
+        auto const jt = id_map_.emplace(id, &*it.first);
+        if (!jt.second)
+        {
+            jt.first->second = nullptr;
+        }
+    }
+
+    function_bunch_type const& polymorphic_nonintrusive_factory::locate(
+        input_archive& ar) const
+    {
+        // the type name is sent in any case, the receiver might not know of
+        // all types sharing the same id
+        std::uint32_t id = 0;
+        if (ar.enable_type_ids())
+        {
+            ar >> id;
+        }
+
+        std::string class_name;
+        ar >> class_name;
+
+        if (ar.enable_type_ids())
+        {
+            auto const it = id_map_.find(id);
+            if (it != id_map_.end() && it->second != nullptr &&
+                it->second->first == class_name)
+            {
+                return it->second->second.bunch;
+            }
+        }
+        return map_.at(class_name).bunch;
+    }
 }    // namespace hpx::serialization::detail
@@ -0,0 +1,213 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark compares the size of the serialized data and the time needed
+// for (de-)serializing polymorphic objects that are identified by their type
+// names with the same objects being identified by integer type ids (which are
+// sent in addition to the type names).
+
+#include <hpx/serialization/base_object.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace hpx_test {
+
+    struct shape
+    {
+        virtual ~shape() = default;
+
+        [[nodiscard]] virtual double area() const = 0;
+
+        template <typename Archive>
+        void serialize(Archive&, unsigned)
+        {
+        }
+        HPX_SERIALIZATION_POLYMORPHIC_ABSTRACT(shape)
+    };
+
+    struct rectangle : shape
+    {
+        rectangle() = default;
+
+        rectangle(double w, double h)
+          : width(w)
+          , height(h)
+        {
+        }
+
+        [[nodiscard]] double area() const override
+        {
+            return width * height;
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar& hpx::serialization::base_object<shape>(*this);
+            ar& width& height;
+        }
+        HPX_SERIALIZATION_POLYMORPHIC(rectangle, override)
+
+        double width = 0;
+        double height = 0;
+    };
+
+    struct circle : shape
+    {
+        circle() = default;
+
+        explicit circle(double r)
+          : radius(r)
+        {
+        }
+
+        [[nodiscard]] double area() const override
+        {
+            return 3.0 * radius * radius;
+        }
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            ar& hpx::serialization::base_object<shape>(*this);
+            ar& radius;
+        }
+        HPX_SERIALIZATION_POLYMORPHIC(circle, override)
+
+        double radius = 0;
+    };
+
+    using shapes = std::vector<std::shared_ptr<shape>>;
+
+    double total_area(shapes const& data)
+    {
+        double result = 0;
+        for (auto const& s : data)
+        {
+            result += s->area();
+        }
+        return result;
+    }
+
+    void run_benchmark(char const* name, shapes const& data,
+        std::size_t iterations, std::uint32_t flags)
+    {
+        using clock = std::chrono::high_resolution_clock;
+
+        clock::duration save_time{};
+        clock::duration load_time{};
+
+        std::vector<char> buffer;
+        shapes result;
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            buffer.clear();
+            result.clear();
+
+            auto const start = clock::now();
+            {
+                hpx::serialization::output_archive archive(buffer, flags);
+                archive << data;
+            }
+            auto const saved = clock::now();
+            {
+                hpx::serialization::input_archive archive(buffer);
+                archive >> result;
+            }
+            auto const loaded = clock::now();
+
+            save_time += saved - start;
+            load_time += loaded - saved;
+        }
+
+        if (total_area(result) != total_area(data))
+        {
+            throw std::logic_error(
+                std::string(name) + ": deserialization failed");
+        }
+
+        auto const ms = [](clock::duration d) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(d)
+                .count();
+        };
+
+        std::cout << name << ": size = " << buffer.size() << " bytes"
+                  << ", save = " << ms(save_time) << " ms"
+                  << ", load = " << ms(load_time) << " ms" << std::endl;
+    }
+}    // namespace hpx_test
+
+void hpx_serialization_test(std::size_t iterations, std::size_t count)
+{
+    using namespace hpx_test;
+
+    shapes data;
+    data.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        auto const d = static_cast<double>(i);
+        if (i % 2 == 0)
+        {
+            data.push_back(std::make_shared<rectangle>(d, d + 1));
+        }
+        else
+        {
+            data.push_back(std::make_shared<circle>(d));
+        }
+    }
+
+    auto const type_ids = static_cast<std::uint32_t>(
+        hpx::serialization::archive_flags::enable_type_ids);
+
+    run_benchmark("type names", data, iterations, 0);
+    run_benchmark("type ids", data, iterations, type_ids);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " N [M]";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " N  -- number of iterations" << std::endl;
+        std::cout << " M  -- number of objects (default: 10000)" << std::endl
+                  << std::endl;
+        return 0;
+    }
+
+    std::size_t iterations;
+    std::size_t count = 10000;
+    try
+    {
+        iterations = hpx::util::from_string<std::size_t>(argv[1]);
+        if (argc > 2)
+        {
+            count = hpx::util::from_string<std::size_t>(argv[2]);
+        }
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "Positional arguments must be integers." << std::endl;
+        return -1;
+    }
+
+    hpx_serialization_test(iterations, count);
+}
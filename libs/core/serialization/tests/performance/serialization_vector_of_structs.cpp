@@ -0,0 +1,239 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This benchmark measures the (de-)serialization of vectors of structs that
+// are not bitwise serializable as a whole and are serialized member by member
+// using the automatic struct serialization. The runs are repeated with array
+// optimizations disabled, which forces every member to be handled separately.
+
+#include <hpx/serialization/brace_initializable.hpp>
+#include <hpx/serialization/detail/preprocess_container.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace hpx_test {
+
+    // the members x to flags are copied as one block of bytes
+    struct particle
+    {
+        std::string name;
+        double x, y, z;
+        double vx, vy, vz;
+        std::int32_t id;
+        std::int32_t flags;
+    };
+
+    bool operator==(particle const& lhs, particle const& rhs)
+    {
+        return lhs.name == rhs.name && lhs.x == rhs.x && lhs.y == rhs.y &&
+            lhs.z == rhs.z && lhs.vx == rhs.vx && lhs.vy == rhs.vy &&
+            lhs.vz == rhs.vz && lhs.id == rhs.id && lhs.flags == rhs.flags;
+    }
+
+    // bitwise serializable, but not trivially copyable
+    struct timestamp
+    {
+        timestamp() = default;
+
+        explicit timestamp(std::int64_t t) noexcept
+          : ticks(t)
+        {
+        }
+
+        timestamp(timestamp const& rhs) noexcept
+          : ticks(rhs.ticks)
+        {
+        }
+
+        timestamp& operator=(timestamp const& rhs) noexcept
+        {
+            ticks = rhs.ticks;
+            return *this;
+        }
+
+        std::int64_t ticks = 0;
+    };
+
+    // the serialized size of a sample is known at compile time
+    struct sample
+    {
+        timestamp time;
+        double value;
+        std::int64_t source;
+    };
+
+    bool operator==(sample const& lhs, sample const& rhs)
+    {
+        return lhs.time.ticks == rhs.time.ticks && lhs.value == rhs.value &&
+            lhs.source == rhs.source;
+    }
+}    // namespace hpx_test
+
+HPX_IS_BITWISE_SERIALIZABLE(hpx_test::timestamp)
+
+namespace hpx_test {
+
+    template <typename T>
+    std::size_t to_buffer(std::vector<T> const& data,
+        std::vector<char>& buffer, std::uint32_t flags)
+    {
+        std::size_t size = 0;
+        {
+            hpx::serialization::detail::preprocess_container p;
+            hpx::serialization::output_archive archive(p, flags);
+            archive << data;
+            size = p.size();
+        }
+
+        buffer.clear();
+        buffer.reserve(size);
+
+        hpx::serialization::output_archive archive(buffer, flags);
+        archive << data;
+        archive.flush();
+
+        return size;
+    }
+
+    template <typename T>
+    void from_buffer(std::vector<T>& data, std::vector<char> const& buffer)
+    {
+        hpx::serialization::input_archive archive(buffer, buffer.size());
+        archive >> data;
+    }
+
+    template <typename T>
+    void run_benchmark(char const* name, std::vector<T> const& data,
+        std::size_t iterations, std::uint32_t flags)
+    {
+        std::vector<char> buffer;
+        std::vector<T> result;
+
+        if (to_buffer(data, buffer, flags) != buffer.size())
+        {
+            throw std::logic_error(
+                std::string(name) + ": preprocessing size mismatch");
+        }
+
+        from_buffer(result, buffer);
+        if (result != data)
+        {
+            throw std::logic_error(
+                std::string(name) + ": deserialization failed");
+        }
+
+        using clock = std::chrono::high_resolution_clock;
+
+        clock::duration preprocess_time{};
+        clock::duration save_time{};
+        clock::duration load_time{};
+
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            auto const start = clock::now();
+            {
+                hpx::serialization::detail::preprocess_container p;
+                hpx::serialization::output_archive archive(p, flags);
+                archive << data;
+            }
+            auto const preprocessed = clock::now();
+
+            to_buffer(data, buffer, flags);
+            auto const saved = clock::now();
+
+            from_buffer(result, buffer);
+            auto const loaded = clock::now();
+
+            preprocess_time += preprocessed - start;
+            save_time += saved - preprocessed;
+            load_time += loaded - saved;
+        }
+
+        auto const ms = [](clock::duration d) {
+            return std::chrono::duration_cast<std::chrono::milliseconds>(d)
+                .count();
+        };
+
+        std::cout << name << ": size = " << buffer.size() << " bytes"
+                  << ", preprocess = " << ms(preprocess_time) << " ms"
+                  << ", save (incl. preprocess) = " << ms(save_time) << " ms"
+                  << ", load = " << ms(load_time) << " ms" << std::endl;
+    }
+}    // namespace hpx_test
+
+void hpx_serialization_test(std::size_t iterations, std::size_t count)
+{
+    using namespace hpx_test;
+
+    std::vector<particle> particles;
+    std::vector<sample> samples;
+
+    particles.reserve(count);
+    samples.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        auto const d = static_cast<double>(i);
+        auto const n = static_cast<std::int32_t>(i);
+        particles.push_back(particle{"particle" + std::to_string(i), d,
+            d + 1, d + 2, -d, -d - 1, -d - 2, n, n % 7});
+        samples.push_back(sample{timestamp(static_cast<std::int64_t>(i)),
+            d * 0.5, static_cast<std::int64_t>(i % 13)});
+    }
+
+    auto const member_wise = static_cast<std::uint32_t>(
+        hpx::serialization::archive_flags::disable_array_optimization);
+
+    run_benchmark("particles", particles, iterations, 0);
+    run_benchmark("particles (member-wise)", particles, iterations,
+        member_wise);
+
+    run_benchmark("samples", samples, iterations, 0);
+    run_benchmark("samples (member-wise)", samples, iterations, member_wise);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cout << "usage: " << argv[0] << " N [M]";
+        std::cout << std::endl << std::endl;
+        std::cout << "arguments: " << std::endl;
+        std::cout << " N  -- number of iterations" << std::endl;
+        std::cout << " M  -- number of vector elements (default: 10000)"
+                  << std::endl
+                  << std::endl;
+        return 0;
+    }
+
+    std::size_t iterations;
+    std::size_t count = 10000;
+    try
+    {
+        iterations = hpx::util::from_string<std::size_t>(argv[1]);
+        if (argc > 2)
+        {
+            count = hpx::util::from_string<std::size_t>(argv[2]);
+        }
+    }
+    catch (std::exception& exc)
+    {
+        std::cerr << "Error: " << exc.what() << std::endl;
+        std::cerr << "Positional arguments must be integers." << std::endl;
+        return -1;
+    }
+
+    hpx_serialization_test(iterations, count);
+}
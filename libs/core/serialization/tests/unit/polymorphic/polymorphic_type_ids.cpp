@@ -0,0 +1,293 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Polymorphic types are sent with an id if the archive was created with the
+// archive_flags::enable_type_ids flag. The id is derived from the type name,
+// the name is sent as well and is used whenever the id doesn't identify the
+// registered type with that name.
+
+#include <hpx/serialization/base_object.hpp>
+#include <hpx/serialization/detail/polymorphic_intrusive_factory.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/shared_ptr.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// intrusively serialized types
+struct A
+{
+    explicit A(int a = 1)
+      : a(a)
+    {
+    }
+    virtual ~A() = default;
+
+    virtual std::string foo() const = 0;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar& a;
+    }
+    HPX_SERIALIZATION_POLYMORPHIC_ABSTRACT(A)
+
+    int a;
+};
+
+struct B : A
+{
+    explicit B(int b = 2)
+      : b(b)
+    {
+    }
+
+    std::string foo() const override
+    {
+        return "B::foo";
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar& hpx::serialization::base_object<A>(*this);
+        ar& b;
+    }
+    HPX_SERIALIZATION_POLYMORPHIC(B, override)
+
+    int b;
+};
+
+// the FNV-1a hashes of the names of these two types collide
+struct E : A
+{
+    std::string foo() const override
+    {
+        return "E::foo";
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar& hpx::serialization::base_object<A>(*this);
+    }
+    HPX_SERIALIZATION_POLYMORPHIC_WITH_NAME(E, "costarring", override)
+};
+
+struct F : A
+{
+    std::string foo() const override
+    {
+        return "F::foo";
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        ar& hpx::serialization::base_object<A>(*this);
+    }
+    HPX_SERIALIZATION_POLYMORPHIC_WITH_NAME(F, "liquid", override)
+};
+
+// non-intrusively serialized types
+struct C
+{
+    explicit C(int c = 3)
+      : c(c)
+    {
+    }
+    virtual ~C() = default;
+
+    virtual std::string foo() const = 0;
+
+    int c;
+};
+
+template <typename Archive>
+void serialize(Archive& ar, C& c, unsigned)
+{
+    ar& c.c;
+}
+HPX_TRAITS_NONINTRUSIVE_POLYMORPHIC(C)
+
+struct D : C
+{
+    explicit D(int d = 4)
+      : d(d)
+    {
+    }
+
+    std::string foo() const override
+    {
+        return "D::foo";
+    }
+
+    int d;
+};
+
+template <typename Archive>
+void serialize(Archive& ar, D& d, unsigned)
+{
+    ar& hpx::serialization::base_object<C>(d);
+    ar& d.d;
+}
+HPX_SERIALIZATION_REGISTER_CLASS(D)
+
+// the FNV-1a hashes of the names of these two types collide
+struct G : C
+{
+    std::string foo() const override
+    {
+        return "G::foo";
+    }
+};
+
+template <typename Archive>
+void serialize(Archive& ar, G& g, unsigned)
+{
+    ar& hpx::serialization::base_object<C>(g);
+}
+HPX_SERIALIZATION_REGISTER_CLASS_NAME(G, "declinate")
+
+struct H : C
+{
+    std::string foo() const override
+    {
+        return "H::foo";
+    }
+};
+
+template <typename Archive>
+void serialize(Archive& ar, H& h, unsigned)
+{
+    ar& hpx::serialization::base_object<C>(h);
+}
+HPX_SERIALIZATION_REGISTER_CLASS_NAME(H, "macallums")
+
+void test_roundtrip(std::uint32_t flags)
+{
+    std::vector<std::shared_ptr<A>> ia;
+    std::vector<std::shared_ptr<C>> ic;
+    for (int i = 0; i != 10; ++i)
+    {
+        ia.push_back(std::make_shared<B>(i));
+        ic.push_back(std::make_shared<D>(i));
+    }
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << ia << ic;
+    }
+
+    std::vector<std::shared_ptr<A>> oa;
+    std::vector<std::shared_ptr<C>> oc;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> oa >> oc;
+    }
+
+    HPX_TEST_EQ(oa.size(), ia.size());
+    HPX_TEST_EQ(oc.size(), ic.size());
+    for (std::size_t i = 0; i != oa.size(); ++i)
+    {
+        HPX_TEST_EQ(oa[i]->foo(), std::string("B::foo"));
+        HPX_TEST_EQ(oa[i]->a, 1);
+        HPX_TEST_EQ(static_cast<B*>(oa[i].get())->b, static_cast<int>(i));
+
+        HPX_TEST_EQ(oc[i]->foo(), std::string("D::foo"));
+        HPX_TEST_EQ(oc[i]->c, 3);
+        HPX_TEST_EQ(static_cast<D*>(oc[i].get())->d, static_cast<int>(i));
+    }
+}
+
+void test_collisions(std::uint32_t flags)
+{
+    std::vector<std::shared_ptr<A>> ia = {std::make_shared<E>(),
+        std::make_shared<F>(), std::make_shared<B>()};
+    std::vector<std::shared_ptr<C>> ic = {std::make_shared<G>(),
+        std::make_shared<H>(), std::make_shared<D>()};
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer, flags);
+        oarchive << ia << ic;
+    }
+
+    std::vector<std::shared_ptr<A>> oa;
+    std::vector<std::shared_ptr<C>> oc;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive >> oa >> oc;
+    }
+
+    HPX_TEST_EQ(oa.size(), ia.size());
+    HPX_TEST_EQ(oc.size(), ic.size());
+    for (std::size_t i = 0; i != oa.size(); ++i)
+    {
+        HPX_TEST_EQ(oa[i]->foo(), ia[i]->foo());
+        HPX_TEST_EQ(oc[i]->foo(), ic[i]->foo());
+    }
+}
+
+void test_create()
+{
+    using hpx::serialization::detail::get_polymorphic_type_id;
+    using hpx::serialization::detail::polymorphic_intrusive_factory;
+
+    auto const& factory = polymorphic_intrusive_factory::instance();
+
+    std::unique_ptr<A> a(
+        factory.create<A>(get_polymorphic_type_id("B"), std::string("B")));
+    HPX_TEST_EQ(a->foo(), std::string("B::foo"));
+
+    // the id of a type the receiver doesn't know may match another type
+    a.reset(factory.create<A>(
+        get_polymorphic_type_id("B"), std::string("costarring")));
+    HPX_TEST_EQ(a->foo(), std::string("E::foo"));
+
+    // colliding ids are resolved by name
+    a.reset(factory.create<A>(
+        get_polymorphic_type_id("liquid"), std::string("costarring")));
+    HPX_TEST_EQ(a->foo(), std::string("E::foo"));
+
+    a.reset(factory.create<A>(
+        get_polymorphic_type_id("costarring"), std::string("liquid")));
+    HPX_TEST_EQ(a->foo(), std::string("F::foo"));
+}
+
+int main()
+{
+    using hpx::serialization::detail::get_polymorphic_type_id;
+
+    // the ids don't depend on the platform, the build, or the locality
+    HPX_TEST_EQ(get_polymorphic_type_id(""), std::uint32_t(0x811c9dc5));
+    HPX_TEST_EQ(get_polymorphic_type_id("a"), std::uint32_t(0xe40c292c));
+    HPX_TEST_EQ(get_polymorphic_type_id("costarring"),
+        get_polymorphic_type_id("liquid"));
+    HPX_TEST_EQ(get_polymorphic_type_id("declinate"),
+        get_polymorphic_type_id("macallums"));
+
+    auto const type_ids = static_cast<std::uint32_t>(
+        hpx::serialization::archive_flags::enable_type_ids);
+
+    test_roundtrip(0);
+    test_roundtrip(type_ids);
+
+    test_collisions(0);
+    test_collisions(type_ids);
+
+    test_create();
+
+    return hpx::util::report_errors();
+}
@@ -8,9 +8,13 @@
 
 #include <hpx/modules/serialization.hpp>
 #include <hpx/modules/testing.hpp>
+#include <hpx/serialization/detail/preprocess_container.hpp>
+#include <hpx/serialization/detail/static_serialized_size.hpp>
 
+#include <cstdint>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 struct A
@@ -77,6 +81,103 @@ bool operator==(const B& b1, const B& b2)
     return std::tie(b1.a, b1.sign) == std::tie(b2.a, b2.sign);
 }
 
+// the members x to flags are copied as one block of bytes
+struct C
+{
+    std::string name;
+    double x, y, z;
+    std::int32_t id;
+    std::int32_t flags;
+    std::vector<double> history;
+};
+
+bool operator==(const C& c1, const C& c2)
+{
+    return std::tie(c1.name, c1.x, c1.y, c1.z, c1.id, c1.flags, c1.history) ==
+        std::tie(c2.name, c2.x, c2.y, c2.z, c2.id, c2.flags, c2.history);
+}
+
+using C_layout = hpx::serialization::detail::struct_layout<C,
+    hpx::serialization::detail::struct_members_t<C>>;
+
+// the layout can be analyzed for standard-layout types only
+static_assert(!std::is_standard_layout_v<C> ||
+        C_layout::info.run_size[1] ==
+            3 * sizeof(double) + 2 * sizeof(std::int32_t),
+    "C_layout::info.run_size[1] == "
+    "3 * sizeof(double) + 2 * sizeof(std::int32_t)");
+static_assert(!hpx::serialization::detail::has_static_serialized_size_v<C>,
+    "!has_static_serialized_size_v<C>");
+
+// bitwise serializable, but not trivially copyable
+struct weight
+{
+    weight() = default;
+
+    explicit weight(double v) noexcept
+      : value(v)
+    {
+    }
+
+    weight(weight const& rhs) noexcept
+      : value(rhs.value)
+    {
+    }
+
+    weight& operator=(weight const& rhs) noexcept
+    {
+        value = rhs.value;
+        return *this;
+    }
+
+    double value = 0.0;
+};
+
+HPX_IS_BITWISE_SERIALIZABLE(weight)
+
+// not bitwise serializable, but all members are
+struct D
+{
+    std::int64_t id;
+    double value;
+    weight w;
+};
+
+bool operator==(const D& d1, const D& d2)
+{
+    return d1.id == d2.id && d1.value == d2.value && d1.w.value == d2.w.value;
+}
+
+static_assert(!hpx::traits::is_bitwise_serializable_v<D>,
+    "!is_bitwise_serializable_v<D>");
+static_assert(hpx::serialization::detail::static_serialized_size<D>() ==
+        sizeof(std::int64_t) + sizeof(double) + sizeof(weight),
+    "static_serialized_size<D>() == "
+    "sizeof(std::int64_t) + sizeof(double) + sizeof(weight)");
+
+template <typename T>
+void test_vector(std::vector<T> const& v, std::uint32_t flags = 0)
+{
+    std::vector<char> buf;
+    hpx::serialization::output_archive oar(buf, flags);
+    oar << v;
+    oar.flush();
+
+    std::vector<T> deserialized;
+    hpx::serialization::input_archive iar(buf, buf.size());
+    iar >> deserialized;
+
+    HPX_TEST(v == deserialized);
+
+    // the preprocessing pass has to agree with the data written
+    hpx::serialization::detail::preprocess_container p;
+    hpx::serialization::output_archive par(p, flags);
+    par << v;
+    par.flush();
+
+    HPX_TEST_EQ(p.size(), buf.size());
+}
+
 int main()
 {
     std::vector<char> buf;
@@ -102,5 +203,35 @@ int main()
         HPX_TEST(b == deserialized_b);
     }
 
+    {
+        C c{"test_string", 1.0, 2.0, 3.0, -42, 7, {4.0, 5.0}};
+        oar << c;
+        C deserialized_c;
+        iar >> deserialized_c;
+
+        HPX_TEST(c == deserialized_c);
+    }
+
+    {
+        std::vector<C> cs;
+        std::vector<D> ds;
+        for (int i = 0; i != 100; ++i)
+        {
+            cs.push_back(C{std::to_string(i), i + 0.1, i + 0.2, i + 0.3, i,
+                -i, std::vector<double>(i % 5, i + 0.4)});
+            ds.push_back(D{i, i + 0.5, weight(i + 0.6)});
+        }
+
+        test_vector(cs);
+        test_vector(ds);
+
+        // member-wise serialization is used if array optimizations are
+        // disabled
+        std::uint32_t const flags = static_cast<std::uint32_t>(
+            hpx::serialization::archive_flags::disable_array_optimization);
+        test_vector(cs, flags);
+        test_vector(ds, flags);
+    }
+
     return hpx::util::report_errors();
 }
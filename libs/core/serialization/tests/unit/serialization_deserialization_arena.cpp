@@ -0,0 +1,237 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+#include <hpx/serialization/deserialization_arena.hpp>
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/map.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <memory_resource>
+#include <string>
+#include <thread>
+#include <vector>
+
+using string_type = std::pmr::string;
+using vector_type = std::pmr::vector<string_type>;
+using map_type = std::pmr::map<string_type, std::pmr::vector<double>>;
+using buffer_type = hpx::serialization::serialize_buffer<double,
+    std::pmr::polymorphic_allocator<double>>;
+
+// Memory resource keeping track of the memory handed out through it
+class counting_resource final : public std::pmr::memory_resource
+{
+public:
+    std::size_t allocations = 0;
+    std::size_t outstanding = 0;    // bytes not returned yet
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        outstanding += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(
+        void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        outstanding -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(
+        std::pmr::memory_resource const& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+void test_arena()
+{
+    vector_type iv;
+    map_type im;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        // long enough to not fit into the small string buffer
+        iv.emplace_back("a string that is stored on the heap " +
+            std::to_string(i));
+        im[string_type("key " + std::to_string(i) + " of the map")] =
+            std::pmr::vector<double>(i, static_cast<double>(i));
+    }
+
+    buffer_type ib(100);
+    for (std::size_t i = 0; i != ib.size(); ++i)
+    {
+        ib[i] = static_cast<double>(i);
+    }
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << iv << im << ib;
+    }
+
+    // all memory of the arena is taken from the upstream resource, nothing
+    // may be allocated from the default resource while loading
+    counting_resource upstream;
+    counting_resource fallback;
+
+    auto arena =
+        hpx::serialization::deserialization_arena::create(1024, &upstream);
+    auto* resource = arena.get();
+    HPX_TEST_EQ(upstream.allocations, std::size_t(0));
+
+    auto ov = std::make_unique<vector_type>();
+    auto om = std::make_unique<map_type>();
+    auto ob = std::make_unique<buffer_type>();
+    {
+        std::pmr::memory_resource* const default_resource =
+            std::pmr::set_default_resource(&fallback);
+
+        hpx::serialization::input_archive iarchive(buffer);
+        iarchive.set_memory_resource(resource);
+        HPX_TEST(iarchive.get_memory_resource() == resource);
+
+        iarchive >> *ov >> *om >> *ob;
+
+        std::pmr::set_default_resource(default_resource);
+    }
+
+    HPX_TEST_EQ(fallback.allocations, std::size_t(0));
+    HPX_TEST_LT(std::size_t(0), upstream.allocations);
+
+    // the arena hands out memory from a few large blocks
+    HPX_TEST_LT(upstream.allocations, arena->num_allocations());
+
+    HPX_TEST(ov->get_allocator().resource() == resource);
+    HPX_TEST(om->get_allocator().resource() == resource);
+
+    for (auto const& s : *ov)
+    {
+        HPX_TEST(s.get_allocator().resource() == resource);
+    }
+    for (auto const& p : *om)
+    {
+        HPX_TEST(p.first.get_allocator().resource() == resource);
+        HPX_TEST(p.second.get_allocator().resource() == resource);
+    }
+
+    // the arena stays alive as long as its memory is in use
+    arena.reset();
+    HPX_TEST_LT(std::size_t(0), upstream.outstanding);
+
+    HPX_TEST(*ov == iv);
+    HPX_TEST(*om == im);
+    HPX_TEST_EQ(ob->size(), ib.size());
+    for (std::size_t i = 0; i != ib.size(); ++i)
+    {
+        HPX_TEST_EQ((*ob)[i], ib[i]);
+    }
+
+    // the arena returns its memory once the last object using it is gone
+    ov.reset();
+    om.reset();
+    ob.reset();
+    HPX_TEST_EQ(upstream.outstanding, std::size_t(0));
+}
+
+void test_no_arena()
+{
+    vector_type iv(10, string_type("a string that is stored on the heap"));
+
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << iv;
+    }
+
+    vector_type ov;
+    {
+        hpx::serialization::input_archive iarchive(buffer);
+        HPX_TEST(iarchive.get_memory_resource() == nullptr);
+
+        iarchive >> ov;
+    }
+
+    HPX_TEST(ov.get_allocator().resource() == std::pmr::get_default_resource());
+    HPX_TEST(ov == iv);
+}
+
+// containers created from the arena may grow concurrently after the arena
+// has been released by its owner
+void test_concurrent_growth()
+{
+    // the upstream resource is used only while the arena is locked
+    counting_resource upstream;
+
+    auto arena =
+        hpx::serialization::deserialization_arena::create(256, &upstream);
+
+    constexpr std::size_t num_threads = 8;
+    constexpr std::size_t num_elements = 10000;
+
+    std::vector<std::pmr::vector<std::size_t>> values;
+    values.reserve(num_threads);
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        values.emplace_back(arena.get());
+    }
+    arena.reset();
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        threads.emplace_back([&v = values[i], i]() {
+            for (std::size_t j = 0; j != num_elements; ++j)
+            {
+                v.push_back(i * num_elements + j);
+            }
+        });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    for (std::size_t i = 0; i != num_threads; ++i)
+    {
+        HPX_TEST_EQ(values[i].size(), num_elements);
+        for (std::size_t j = 0; j != num_elements; ++j)
+        {
+            HPX_TEST_EQ(values[i][j], i * num_elements + j);
+        }
+    }
+
+    values.clear();
+    HPX_TEST_EQ(upstream.outstanding, std::size_t(0));
+}
+
+int main()
+{
+    test_arena();
+    test_no_arena();
+    test_concurrent_growth();
+
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
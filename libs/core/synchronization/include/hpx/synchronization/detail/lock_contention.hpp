@@ -0,0 +1,192 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING) &&                             \
+    defined(HPX_HAVE_CXX20_SOURCE_LOCATION)
+#include <source_location>
+#endif
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::util {
+
+    // The statistics collected for all locks constructed at the same source
+    // location (lock site). All times are in nanoseconds.
+    struct lock_contention_waiter
+    {
+        std::int64_t wait_time = 0;
+        std::string thread;    // description of the waiting thread
+    };
+
+    struct lock_contention_data
+    {
+        std::string site;
+        std::string kind;
+        std::uint64_t acquisitions = 0;
+        std::uint64_t contentions = 0;    // acquisitions that had to wait
+        std::uint64_t suspensions = 0;    // suspensions of waiting threads
+        std::int64_t wait_time = 0;
+        std::int64_t max_wait_time = 0;
+        std::int64_t hold_time = 0;    // exclusive ownership only
+        std::int64_t max_hold_time = 0;
+
+        // the longest waits, longest first
+        std::vector<lock_contention_waiter> worst_waiters;
+    };
+
+    // Always provide function exports, which guarantees ABI compatibility of
+    // builds with and without HPX_WITH_LOCK_CONTENTION_PROFILING. Without it
+    // no data is collected.
+    HPX_CORE_EXPORT void enable_lock_contention_profiling(
+        bool enable = true) noexcept;
+    HPX_CORE_EXPORT bool lock_contention_profiling_enabled() noexcept;
+
+    // return the statistics of all lock sites, optionally resetting them
+    HPX_CORE_EXPORT std::vector<lock_contention_data> get_lock_contention_data(
+        bool reset = false);
+
+    // print the statistics of all lock sites used so far (sorted by overall
+    // wait time) either as text or as JSON
+    HPX_CORE_EXPORT void print_lock_contention_data(
+        std::ostream& os, bool json = false);
+
+    // print the statistics to the given destination ("cout", "cerr", or a
+    // file name) using the given format ("text" or "json")
+    HPX_CORE_EXPORT void print_lock_contention_data(
+        std::string const& destination, std::string const& format);
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+
+    // The lock site identifies the place a lock was constructed at.
+#if defined(HPX_HAVE_CXX20_SOURCE_LOCATION)
+    using lock_site = std::source_location;
+#else
+    struct lock_site
+    {
+        static constexpr lock_site current() noexcept
+        {
+            return {};
+        }
+
+        [[nodiscard]] static constexpr char const* file_name() noexcept
+        {
+            return "";
+        }
+
+        [[nodiscard]] static constexpr std::uint_least32_t line() noexcept
+        {
+            return 0;
+        }
+    };
+#endif
+
+    namespace detail {
+
+        struct lock_contention_site;
+
+        HPX_CORE_EXPORT extern std::atomic<bool> lock_contention_profiling;
+
+        HPX_FORCEINLINE std::int64_t lock_contention_now() noexcept
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count();
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Per lock instance bookkeeping, all statistics are accumulated for the
+    // lock site.
+    class lock_contention_profile
+    {
+    public:
+        constexpr lock_contention_profile(char const* kind,
+            char const* description, lock_site const& location) noexcept
+          : kind_(kind)
+          , description_(description)
+          , location_(location)
+          , site_(nullptr)
+          , acquired_at_(0)
+        {
+        }
+
+        lock_contention_profile(lock_contention_profile const&) = delete;
+        lock_contention_profile(lock_contention_profile&&) = delete;
+        lock_contention_profile& operator=(
+            lock_contention_profile const&) = delete;
+        lock_contention_profile& operator=(lock_contention_profile&&) = delete;
+
+        // Returns the current time if profiling is enabled (zero otherwise),
+        // to be passed to acquired() once the lock has been acquired.
+        [[nodiscard]] static std::int64_t start() noexcept
+        {
+            if (!detail::lock_contention_profiling.load(
+                    std::memory_order_relaxed))
+            {
+                return 0;
+            }
+            return detail::lock_contention_now();
+        }
+
+        // Record an acquisition of the lock. Only exclusive acquisitions are
+        // taken into account for the hold time, released() must be called
+        // while the lock is still held. Shared owners never touch the hold
+        // time bookkeeping as any number of them may acquire the lock
+        // concurrently.
+        void acquired(std::int64_t start, bool contended,
+            std::size_t suspensions = 0, bool exclusive = true) noexcept
+        {
+            std::int64_t now = 0;
+            if (start != 0)
+            {
+                now = detail::lock_contention_now();
+                record_acquired(now - start, contended, suspensions);
+            }
+
+            if (exclusive)
+            {
+                acquired_at_ = now;
+            }
+        }
+
+        void released() noexcept
+        {
+            if (acquired_at_ != 0)
+            {
+                record_released(detail::lock_contention_now() - acquired_at_);
+                acquired_at_ = 0;
+            }
+        }
+
+    private:
+        HPX_CORE_EXPORT void record_acquired(std::int64_t wait_time,
+            bool contended, std::size_t suspensions) noexcept;
+        HPX_CORE_EXPORT void record_released(std::int64_t hold_time) noexcept;
+        HPX_CORE_EXPORT detail::lock_contention_site* get_site() noexcept;
+
+        char const* kind_;
+        char const* description_;
+        lock_site location_;
+        std::atomic<detail::lock_contention_site*> site_;
+        std::int64_t acquired_at_;
+    };
+#endif
+}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
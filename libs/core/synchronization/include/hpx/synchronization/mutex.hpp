@@ -16,6 +16,7 @@
 #include <hpx/coroutines/thread_id_type.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/detail/lock_contention.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/threading_base/threading_base_fwd.hpp>
 #include <hpx/timing/steady_clock.hpp>
@@ -84,7 +85,22 @@ namespace hpx {
         ///
         /// \param description description of the \a mutex.
         ///
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        /// \param site the location the \a mutex is constructed at, used to
+        ///             collect lock contention statistics.
+        ///
 #if defined(HPX_HAVE_ITTNOTIFY)
+        HPX_CORE_EXPORT mutex(char const* const description = "",
+            util::lock_site const& site = util::lock_site::current());
+#else
+        HPX_HOST_DEVICE_CONSTEXPR mutex(char const* const description = "",
+            util::lock_site const& site = util::lock_site::current()) noexcept
+          : owner_id_(threads::invalid_thread_id)
+          , profile_("hpx::mutex", description, site)
+        {
+        }
+#endif
+#elif defined(HPX_HAVE_ITTNOTIFY)
         HPX_CORE_EXPORT mutex(char const* const description = "");
 #else
         HPX_HOST_DEVICE_CONSTEXPR mutex(char const* const = "") noexcept
@@ -240,6 +256,9 @@ namespace hpx {
         mutable mutex_type mtx_;
         threads::thread_id_type owner_id_;
         hpx::lcos::local::detail::condition_variable cond_;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        util::lock_contention_profile profile_;
+#endif
         /// \endcond NOPROTECTED
     };
 
@@ -271,7 +290,12 @@ namespace hpx {
         ///
         /// \param description Description of the \a timed_mutex.
         ///
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        HPX_CORE_EXPORT timed_mutex(char const* const description = "",
+            util::lock_site const& site = util::lock_site::current());
+#else
         HPX_CORE_EXPORT timed_mutex(char const* const description = "");
+#endif
 
         /// \brief Destroys the \a timed_mutex. The behavior is undefined if
         ///        the mutex is owned by any thread or if any thread terminates
@@ -17,10 +17,12 @@
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/memory.hpp>
 #include <hpx/synchronization/detail/condition_variable.hpp>
+#include <hpx/synchronization/detail/lock_contention.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/type_support/assert_owns_lock.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <mutex>
 
@@ -32,10 +34,18 @@ namespace hpx::detail {
     {
         using mutex_type = Mutex;
 
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        explicit shared_mutex_data(util::lock_site const& site) noexcept
+          : profile("hpx::shared_mutex", nullptr, site)
+          , count_(1)
+        {
+        }
+#else
         HPX_HOST_DEVICE_CONSTEXPR shared_mutex_data() noexcept
           : count_(1)
         {
         }
+#endif
 
         struct state_data
         {
@@ -66,6 +76,11 @@ namespace hpx::detail {
         util::cache_aligned_data_derived<condition_variable> exclusive_cond;
         util::cache_aligned_data_derived<condition_variable> upgrade_cond;
 
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        // hold times are collected for exclusive ownership only
+        util::lock_contention_profile profile;
+#endif
+
         void release_waiters(std::unique_lock<mutex_type>& lk)
         {
             [[maybe_unused]] util::ignore_while_checking il(&lk);
@@ -99,11 +114,18 @@ namespace hpx::detail {
 
         void lock_shared()
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            std::int64_t const start = profile.start();
+            std::size_t suspensions = 0;
+#endif
             while (true)
             {
                 auto s = state.load(std::memory_order_acquire);
                 while (s.data.exclusive || s.data.exclusive_waiting_blocked)
                 {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                    ++suspensions;
+#endif
                     {
                         std::unique_lock<mutex_type> lk(state_change);
                         shared_cond.wait(lk);
@@ -120,6 +142,9 @@ namespace hpx::detail {
                     break;
                 }
             }
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.acquired(start, suspensions != 0, suspensions, false);
+#endif
         }
 
         bool try_lock_shared()
@@ -140,6 +165,9 @@ namespace hpx::detail {
                     break;
                 }
             }
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.acquired(profile.start(), false, 0, false);
+#endif
             return true;
         }
 
@@ -188,11 +216,19 @@ namespace hpx::detail {
 
         void lock()
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            std::int64_t const start = profile.start();
+            bool contended = false;
+            std::size_t suspensions = 0;
+#endif
             while (true)
             {
                 auto s = state.load(std::memory_order_acquire);
                 while (s.data.shared_count != 0 || s.data.exclusive)
                 {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                    contended = true;
+#endif
                     auto s1 = s;
 
                     s.data.exclusive_waiting_blocked = true;
@@ -200,6 +236,9 @@ namespace hpx::detail {
                     if (set_state(s1, s, lk))
                     {
                         HPX_ASSERT_OWNS_LOCK(lk);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                        ++suspensions;
+#endif
                         exclusive_cond.wait(lk);
                     }
 
@@ -214,6 +253,9 @@ namespace hpx::detail {
                     break;
                 }
             }
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.acquired(start, contended, suspensions);
+#endif
         }
 
         bool try_lock()
@@ -234,11 +276,17 @@ namespace hpx::detail {
                     break;
                 }
             }
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.acquired(profile.start(), false);
+#endif
             return true;
         }
 
         void unlock()
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.released();
+#endif
             while (true)
             {
                 auto s = state.load(std::memory_order_acquire);
@@ -259,12 +307,19 @@ namespace hpx::detail {
 
         void lock_upgrade()
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            std::int64_t const start = profile.start();
+            std::size_t suspensions = 0;
+#endif
             while (true)
             {
                 auto s = state.load(std::memory_order_acquire);
                 while (s.data.exclusive || s.data.exclusive_waiting_blocked ||
                     s.data.upgrade)
                 {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                    ++suspensions;
+#endif
                     {
                         std::unique_lock<mutex_type> lk(state_change);
                         shared_cond.wait(lk);
@@ -282,6 +337,9 @@ namespace hpx::detail {
                     break;
                 }
             }
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.acquired(start, suspensions != 0, suspensions, false);
+#endif
         }
 
         bool try_lock_upgrade()
@@ -341,6 +399,10 @@ namespace hpx::detail {
 
         void unlock_upgrade_and_lock()
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            std::int64_t const start = profile.start();
+            std::size_t suspensions = 0;
+#endif
             while (true)
             {
                 auto s = state.load(std::memory_order_acquire);
@@ -355,6 +417,9 @@ namespace hpx::detail {
                 s = state.load(std::memory_order_acquire);
                 while (s.data.shared_count != 0)
                 {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                    ++suspensions;
+#endif
                     {
                         std::unique_lock<mutex_type> lk(state_change);
                         upgrade_cond.wait(lk);
@@ -371,10 +436,16 @@ namespace hpx::detail {
                     break;
                 }
             }
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.acquired(start, suspensions != 0, suspensions);
+#endif
         }
 
         void unlock_and_lock_upgrade()
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.released();
+#endif
             while (true)
             {
                 auto s = state.load(std::memory_order_acquire);
@@ -397,6 +468,9 @@ namespace hpx::detail {
 
         void unlock_and_lock_shared()
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.released();
+#endif
             while (true)
             {
                 auto s = state.load(std::memory_order_acquire);
@@ -436,6 +510,9 @@ namespace hpx::detail {
                     break;
                 }
             }
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            profile.acquired(profile.start(), false);
+#endif
             return true;
         }
 
@@ -488,10 +565,18 @@ namespace hpx::detail {
         using shared_state = typename shared_mutex_data<Mutex>::shared_state;
 
     public:
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        // the lock site is the location the shared_mutex is constructed at
+        shared_mutex(util::lock_site const& site = util::lock_site::current())
+          : data_(new shared_mutex_data<Mutex>(site), false)
+        {
+        }
+#else
         shared_mutex()
           : data_(new shared_mutex_data<Mutex>, false)
         {
         }
+#endif
 
         void lock_shared()
         {
@@ -22,6 +22,7 @@
 #include <hpx/execution_base/this_thread.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/modules/itt_notify.hpp>
+#include <hpx/synchronization/detail/lock_contention.hpp>
 
 #include <atomic>
 #include <cstddef>
@@ -46,9 +47,54 @@ namespace hpx {
 
         private:
             std::atomic<bool> v_;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            util::lock_contention_profile profile_;
+#endif
 
         public:
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            // the lock site is the location the spinlock is constructed at
 #if defined(HPX_HAVE_ITTNOTIFY)
+            spinlock(util::lock_site const& site =
+                         util::lock_site::current()) noexcept
+              : v_(false)
+              , profile_("hpx::spinlock", nullptr, site)
+            {
+                HPX_ITT_SYNC_CREATE(this, "hpx::spinlock", nullptr);
+            }
+
+            explicit spinlock(char const* const desc,
+                util::lock_site const& site =
+                    util::lock_site::current()) noexcept
+              : v_(false)
+              , profile_("hpx::spinlock", desc, site)
+            {
+                HPX_ITT_SYNC_CREATE(this, "hpx::spinlock", desc);
+            }
+
+            ~spinlock()
+            {
+                HPX_ITT_SYNC_DESTROY(this);
+            }
+#else
+            constexpr spinlock(util::lock_site const& site =
+                                   util::lock_site::current()) noexcept
+              : v_(false)
+              , profile_("hpx::spinlock", nullptr, site)
+            {
+            }
+
+            explicit constexpr spinlock(char const* const desc,
+                util::lock_site const& site =
+                    util::lock_site::current()) noexcept
+              : v_(false)
+              , profile_("hpx::spinlock", desc, site)
+            {
+            }
+
+            ~spinlock() = default;
+#endif
+#elif defined(HPX_HAVE_ITTNOTIFY)
             spinlock() noexcept
               : v_(false)
             {
@@ -82,6 +128,10 @@ namespace hpx {
             void lock()
             {
                 HPX_ITT_SYNC_PREPARE(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                std::int64_t const start = profile_.start();
+                bool contended = false;
+#endif
 
                 // Checking for the value in is_locked() ensures that
                 // acquire_lock is only called when is_locked computes to false.
@@ -104,6 +154,9 @@ namespace hpx {
                 //      but the nature of execution will still remain the same.
                 if (!acquire_lock())
                 {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                    contended = true;
+#endif
                     auto pred = [this]() noexcept { return is_locked(); };
                     do
                     {
@@ -113,6 +166,9 @@ namespace hpx {
 
                 HPX_ITT_SYNC_ACQUIRED(this);
                 util::register_lock(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                profile_.acquired(start, contended);
+#endif
             }
 
             bool try_lock() noexcept(
@@ -124,6 +180,9 @@ namespace hpx {
                 {
                     HPX_ITT_SYNC_ACQUIRED(this);
                     util::register_lock(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                    profile_.acquired(profile_.start(), false);
+#endif
                     return true;
                 }
 
@@ -135,6 +194,9 @@ namespace hpx {
                 noexcept(util::unregister_lock(std::declval<spinlock*>())))
             {
                 HPX_ITT_SYNC_RELEASING(this);
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+                profile_.released();
+#endif
 
                 relinquish_lock();
 
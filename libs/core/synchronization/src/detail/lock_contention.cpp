@@ -0,0 +1,487 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/synchronization/detail/lock_contention.hpp>
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+#include <hpx/threading_base/thread_description.hpp>
+#include <hpx/threading_base/threading_base_fwd.hpp>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+    namespace detail {
+
+        std::atomic<bool> lock_contention_profiling(false);
+
+        // the number of longest waits kept for each lock site
+        constexpr std::size_t max_worst_waiters = 5;
+
+        template <typename T>
+        void update_maximum(std::atomic<T>& value, T new_value) noexcept
+        {
+            T current = value.load(std::memory_order_relaxed);
+            while (current < new_value &&
+                !value.compare_exchange_weak(
+                    current, new_value, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Note: this must not use any of the HPX locks as those are profiled.
+        struct lock_contention_site
+        {
+            lock_contention_site(std::string name, char const* kind)
+              : name_(HPX_MOVE(name))
+              , kind_(kind)
+            {
+            }
+
+            void reset() noexcept
+            {
+                acquisitions_.store(0, std::memory_order_relaxed);
+                contentions_.store(0, std::memory_order_relaxed);
+                suspensions_.store(0, std::memory_order_relaxed);
+                wait_time_.store(0, std::memory_order_relaxed);
+                max_wait_time_.store(0, std::memory_order_relaxed);
+                hold_time_.store(0, std::memory_order_relaxed);
+                max_hold_time_.store(0, std::memory_order_relaxed);
+
+                std::lock_guard<std::mutex> l(mtx_);
+                worst_waiters_.clear();
+                worst_waiters_threshold_.store(0, std::memory_order_relaxed);
+            }
+
+            lock_contention_data get_data(bool reset)
+            {
+                lock_contention_data data;
+                data.site = name_;
+                data.kind = kind_;
+                data.acquisitions =
+                    acquisitions_.load(std::memory_order_relaxed);
+                data.contentions = contentions_.load(std::memory_order_relaxed);
+                data.suspensions = suspensions_.load(std::memory_order_relaxed);
+                data.wait_time = wait_time_.load(std::memory_order_relaxed);
+                data.max_wait_time =
+                    max_wait_time_.load(std::memory_order_relaxed);
+                data.hold_time = hold_time_.load(std::memory_order_relaxed);
+                data.max_hold_time =
+                    max_hold_time_.load(std::memory_order_relaxed);
+                {
+                    std::lock_guard<std::mutex> l(mtx_);
+                    data.worst_waiters = worst_waiters_;
+                }
+
+                if (reset)
+                {
+                    this->reset();
+                }
+                return data;
+            }
+
+            void add_waiter(std::int64_t wait_time)
+            {
+                // the description is retrieved without holding the lock as
+                // this might acquire other (profiled) locks
+                std::string thread = "<unknown>";
+                if (threads::thread_id_type const id = threads::get_self_id())
+                {
+                    thread = threads::as_string(
+                        threads::get_thread_description(id));
+                }
+
+                std::lock_guard<std::mutex> l(mtx_);
+
+                auto const it = std::find_if(worst_waiters_.begin(),
+                    worst_waiters_.end(),
+                    [&](lock_contention_waiter const& waiter) {
+                        return waiter.wait_time < wait_time;
+                    });
+                if (it == worst_waiters_.end() &&
+                    worst_waiters_.size() == max_worst_waiters)
+                {
+                    return;
+                }
+
+                worst_waiters_.insert(
+                    it, lock_contention_waiter{wait_time, HPX_MOVE(thread)});
+                if (worst_waiters_.size() > max_worst_waiters)
+                {
+                    worst_waiters_.pop_back();
+                }
+
+                if (worst_waiters_.size() == max_worst_waiters)
+                {
+                    worst_waiters_threshold_.store(
+                        worst_waiters_.back().wait_time,
+                        std::memory_order_relaxed);
+                }
+            }
+
+            std::string const name_;
+            char const* const kind_;
+
+            std::atomic<std::uint64_t> acquisitions_{0};
+            std::atomic<std::uint64_t> contentions_{0};
+            std::atomic<std::uint64_t> suspensions_{0};
+            std::atomic<std::int64_t> wait_time_{0};
+            std::atomic<std::int64_t> max_wait_time_{0};
+            std::atomic<std::int64_t> hold_time_{0};
+            std::atomic<std::int64_t> max_hold_time_{0};
+
+            // a wait has to be longer than this to be recorded as one of the
+            // worst waits
+            std::atomic<std::int64_t> worst_waiters_threshold_{0};
+
+            std::mutex mtx_;
+            std::vector<lock_contention_waiter> worst_waiters_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        class lock_contention_sites
+        {
+            using key_type = std::pair<std::string, std::string>;
+
+        public:
+            lock_contention_site* get(char const* kind,
+                char const* description, lock_site const& location)
+            {
+                std::string const file = location.file_name();
+                std::uint_least32_t const line = location.line();
+
+                // sites are identified by their location if available,
+                // otherwise by the lock description
+                std::string name;
+                if (!file.empty())
+                {
+                    name = file + ":" + std::to_string(line);
+                }
+                else if (description != nullptr && *description != '\0')
+                {
+                    name = description;
+                }
+                else
+                {
+                    name = kind;
+                }
+
+                key_type key(name, kind);
+
+                std::lock_guard<std::mutex> l(mtx_);
+                auto it = sites_.find(key);
+                if (it == sites_.end())
+                {
+                    it = sites_
+                             .emplace(HPX_MOVE(key),
+                                 std::make_unique<lock_contention_site>(
+                                     HPX_MOVE(name), kind))
+                             .first;
+                }
+                return it->second.get();
+            }
+
+            std::vector<lock_contention_data> get_data(bool reset)
+            {
+                std::vector<lock_contention_data> result;
+
+                std::lock_guard<std::mutex> l(mtx_);
+                result.reserve(sites_.size());
+                for (auto& site : sites_)
+                {
+                    result.push_back(site.second->get_data(reset));
+                }
+                return result;
+            }
+
+        private:
+            std::mutex mtx_;
+            std::map<key_type, std::unique_ptr<lock_contention_site>> sites_;
+        };
+
+        // Locks are used until the very end of the program, the sites are
+        // never destroyed.
+        lock_contention_sites& get_lock_contention_sites()
+        {
+            static auto* sites = new lock_contention_sites;
+            return *sites;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    detail::lock_contention_site* lock_contention_profile::get_site() noexcept
+    {
+        detail::lock_contention_site* site =
+            site_.load(std::memory_order_acquire);
+        if (site == nullptr)
+        {
+            try
+            {
+                site = detail::get_lock_contention_sites().get(
+                    kind_, description_, location_);
+            }
+            catch (...)
+            {
+                return nullptr;
+            }
+            site_.store(site, std::memory_order_release);
+        }
+        return site;
+    }
+
+    void lock_contention_profile::record_acquired(std::int64_t wait_time,
+        bool contended, std::size_t suspensions) noexcept
+    {
+        detail::lock_contention_site* site = get_site();
+        if (site == nullptr)
+        {
+            return;
+        }
+
+        site->acquisitions_.fetch_add(1, std::memory_order_relaxed);
+        if (!contended)
+        {
+            return;
+        }
+
+        site->contentions_.fetch_add(1, std::memory_order_relaxed);
+        site->suspensions_.fetch_add(suspensions, std::memory_order_relaxed);
+        site->wait_time_.fetch_add(wait_time, std::memory_order_relaxed);
+        detail::update_maximum(site->max_wait_time_, wait_time);
+
+        if (wait_time >
+            site->worst_waiters_threshold_.load(std::memory_order_relaxed))
+        {
+            try
+            {
+                site->add_waiter(wait_time);
+            }
+            catch (...)
+            {
+                // ignore errors, the waiter is not recorded
+            }
+        }
+    }
+
+    void lock_contention_profile::record_released(
+        std::int64_t hold_time) noexcept
+    {
+        if (detail::lock_contention_site* site = get_site(); site != nullptr)
+        {
+            site->hold_time_.fetch_add(hold_time, std::memory_order_relaxed);
+            detail::update_maximum(site->max_hold_time_, hold_time);
+        }
+    }
+#endif
+
+    ///////////////////////////////////////////////////////////////////////////
+    void enable_lock_contention_profiling([[maybe_unused]] bool enable) noexcept
+    {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        detail::lock_contention_profiling.store(
+            enable, std::memory_order_relaxed);
+#endif
+    }
+
+    bool lock_contention_profiling_enabled() noexcept
+    {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        return detail::lock_contention_profiling.load(
+            std::memory_order_relaxed);
+#else
+        return false;
+#endif
+    }
+
+    std::vector<lock_contention_data> get_lock_contention_data(
+        [[maybe_unused]] bool reset)
+    {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        return detail::get_lock_contention_sites().get_data(reset);
+#else
+        return {};
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        void print_json_string(std::ostream& os, std::string const& str)
+        {
+            os << '"';
+            for (char const c : str)
+            {
+                switch (c)
+                {
+                case '"':
+                    os << "\\\"";
+                    break;
+                case '\\':
+                    os << "\\\\";
+                    break;
+                case '\n':
+                    os << "\\n";
+                    break;
+                case '\t':
+                    os << "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(c) < 0x20)
+                    {
+                        os << ' ';
+                    }
+                    else
+                    {
+                        os << c;
+                    }
+                    break;
+                }
+            }
+            os << '"';
+        }
+
+        void print_json(
+            std::ostream& os, std::vector<lock_contention_data> const& data)
+        {
+            os << "{\"sites\": [";
+            bool first = true;
+            for (lock_contention_data const& d : data)
+            {
+                os << (first ? "\n" : ",\n") << "  {\"site\": ";
+                first = false;
+
+                print_json_string(os, d.site);
+                os << ", \"kind\": ";
+                print_json_string(os, d.kind);
+                os << ", \"acquisitions\": " << d.acquisitions
+                   << ", \"contentions\": " << d.contentions
+                   << ", \"suspensions\": " << d.suspensions
+                   << ", \"wait_time\": " << d.wait_time
+                   << ", \"max_wait_time\": " << d.max_wait_time
+                   << ", \"hold_time\": " << d.hold_time
+                   << ", \"max_hold_time\": " << d.max_hold_time
+                   << ", \"worst_waiters\": [";
+
+                bool first_waiter = true;
+                for (lock_contention_waiter const& w : d.worst_waiters)
+                {
+                    os << (first_waiter ? "" : ", ")
+                       << "{\"wait_time\": " << w.wait_time
+                       << ", \"thread\": ";
+                    print_json_string(os, w.thread);
+                    os << "}";
+                    first_waiter = false;
+                }
+                os << "]}";
+            }
+            os << "\n]}\n";
+        }
+
+        void print_text(
+            std::ostream& os, std::vector<lock_contention_data> const& data)
+        {
+            os << "lock contention profile (times in [ns]):\n";
+            for (lock_contention_data const& d : data)
+            {
+                os << d.site << " (" << d.kind << ")\n"
+                   << "  acquisitions: " << d.acquisitions
+                   << ", contended: " << d.contentions
+                   << ", suspensions: " << d.suspensions << "\n"
+                   << "  wait time: " << d.wait_time
+                   << " (max: " << d.max_wait_time << ")\n"
+                   << "  hold time: " << d.hold_time
+                   << " (max: " << d.max_hold_time << ")\n";
+
+                if (!d.worst_waiters.empty())
+                {
+                    os << "  worst waiters:\n";
+                    for (lock_contention_waiter const& w : d.worst_waiters)
+                    {
+                        os << "    " << w.wait_time << ": " << w.thread
+                           << "\n";
+                    }
+                }
+            }
+        }
+    }    // namespace
+
+    void print_lock_contention_data(std::ostream& os, bool json)
+    {
+        std::vector<lock_contention_data> data = get_lock_contention_data();
+
+        // print the sites which were used, most contended sites first
+        data.erase(std::remove_if(data.begin(), data.end(),
+                       [](lock_contention_data const& d) {
+                           return d.acquisitions == 0;
+                       }),
+            data.end());
+        std::stable_sort(data.begin(), data.end(),
+            [](lock_contention_data const& lhs,
+                lock_contention_data const& rhs) {
+                return lhs.wait_time > rhs.wait_time;
+            });
+
+        if (json)
+        {
+            print_json(os, data);
+        }
+        else
+        {
+            print_text(os, data);
+        }
+    }
+
+    void print_lock_contention_data(
+        std::string const& destination, std::string const& format)
+    {
+        if (format != "text" && format != "json")
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "print_lock_contention_data",
+                "invalid format for the lock contention report: '{}' (valid "
+                "formats are 'text' and 'json')",
+                format);
+        }
+
+        bool const json = format == "json";
+        if (destination == "cout")
+        {
+            print_lock_contention_data(std::cout, json);
+        }
+        else if (destination == "cerr")
+        {
+            print_lock_contention_data(std::cerr, json);
+        }
+        else
+        {
+            std::ofstream out(destination);
+            if (!out)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "print_lock_contention_data",
+                    "unable to open the lock contention report file: '{}'",
+                    destination);
+            }
+            print_lock_contention_data(out, json);
+        }
+    }
+}    // namespace hpx::util
@@ -17,6 +17,8 @@
 #include <hpx/threading_base/thread_data.hpp>
 #include <hpx/timing/steady_clock.hpp>
 
+#include <cstddef>
+#include <cstdint>
 #include <mutex>
 #include <utility>
 
@@ -24,8 +26,14 @@ namespace hpx {
 
     ///////////////////////////////////////////////////////////////////////////
 #if HPX_HAVE_ITTNOTIFY != 0
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+    mutex::mutex(char const* const description, util::lock_site const& site)
+      : owner_id_(threads::invalid_thread_id)
+      , profile_("hpx::mutex", description, site)
+#else
     mutex::mutex(char const* const description)
       : owner_id_(threads::invalid_thread_id)
+#endif
     {
         HPX_ITT_SYNC_CREATE(this, "hpx::mutex", description);
         HPX_ITT_SYNC_RENAME(this, "hpx::mutex");
@@ -45,6 +53,10 @@ namespace hpx {
     {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        std::int64_t const start = profile_.start();
+        std::size_t suspensions = 0;
+#endif
         HPX_ITT_SYNC_PREPARE(this);
         std::unique_lock<mutex_type> l(mtx_);
 
@@ -60,6 +72,9 @@ namespace hpx {
 
         while (owner_id_ != threads::invalid_thread_id)
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            ++suspensions;
+#endif
             cond_.wait(l, ec);
             if (ec)
             {
@@ -71,6 +86,9 @@ namespace hpx {
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
         owner_id_ = self_id;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        profile_.acquired(start, suspensions != 0, suspensions);
+#endif
     }
 
     bool mutex::try_lock(char const* /* description */, error_code& /* ec */)
@@ -90,6 +108,9 @@ namespace hpx {
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
         owner_id_ = self_id;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        profile_.acquired(profile_.start(), false);
+#endif
         return true;
     }
 
@@ -111,6 +132,9 @@ namespace hpx {
             return;
         }
 
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        profile_.released();
+#endif
         HPX_ITT_SYNC_RELEASED(this);
         owner_id_ = threads::invalid_thread_id;
 
@@ -133,10 +157,18 @@ namespace hpx {
     }
 
     ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+    timed_mutex::timed_mutex(
+        char const* const description, util::lock_site const& site)
+      : mutex(description, site)
+    {
+    }
+#else
     timed_mutex::timed_mutex(char const* const description)
       : mutex(description)
     {
     }
+#endif
 
     timed_mutex::~timed_mutex() = default;
 
@@ -146,12 +178,19 @@ namespace hpx {
     {
         HPX_ASSERT(threads::get_self_ptr() != nullptr);
 
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        std::int64_t const start = profile_.start();
+        bool contended = false;
+#endif
         HPX_ITT_SYNC_PREPARE(this);
         std::unique_lock<mutex_type> l(mtx_);
 
         threads::thread_id_type const self_id = threads::get_self_id();
         if (owner_id_ != threads::invalid_thread_id)
         {
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+            contended = true;
+#endif
             threads::thread_restart_state const reason =
                 cond_.wait_until(l, abs_time, ec);
             if (ec)
@@ -176,6 +215,9 @@ namespace hpx {
         util::register_lock(this);
         HPX_ITT_SYNC_ACQUIRED(this);
         owner_id_ = self_id;
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        profile_.acquired(start, contended, contended ? 1 : 0);
+#endif
         return true;
     }
 }    // namespace hpx
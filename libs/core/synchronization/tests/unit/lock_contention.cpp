@@ -0,0 +1,173 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+#include <hpx/future.hpp>
+#include <hpx/init.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/synchronization/detail/lock_contention.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Return the statistics of the lock constructed at the given line of this file
+// (or with the given description, if source locations are not available).
+hpx::util::lock_contention_data get_site_data(
+    std::size_t line, char const* description)
+{
+    std::string const suffix = "lock_contention.cpp:" + std::to_string(line);
+    for (auto const& data : hpx::util::get_lock_contention_data())
+    {
+        if (data.site == description ||
+            (data.site.size() >= suffix.size() &&
+                data.site.compare(data.site.size() - suffix.size(),
+                    suffix.size(), suffix) == 0))
+        {
+            return data;
+        }
+    }
+    return {};
+}
+
+// block the worker thread (instead of suspending the HPX thread) while holding
+// the lock to avoid tripping lock detection
+template <typename Mutex>
+void lock_and_sleep(Mutex& mtx)
+{
+    std::lock_guard<Mutex> l(mtx);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+void test_mutex()
+{
+    std::size_t const line = __LINE__ + 1;
+    hpx::mutex mtx("lock_contention_mutex");
+
+    std::vector<hpx::future<void>> futures;
+    for (int i = 0; i != 16; ++i)
+    {
+        futures.push_back(hpx::async([&mtx]() { lock_and_sleep(mtx); }));
+    }
+    hpx::wait_all(futures);
+
+    auto const data = get_site_data(line, "lock_contention_mutex");
+    HPX_TEST_EQ(data.kind, std::string("hpx::mutex"));
+    HPX_TEST_EQ(data.acquisitions, std::uint64_t(16));
+    HPX_TEST_LT(std::uint64_t(0), data.contentions);
+    HPX_TEST_LT(std::uint64_t(0), data.suspensions);
+    HPX_TEST_LT(std::int64_t(0), data.wait_time);
+    HPX_TEST_LTE(std::int64_t(16000000), data.hold_time);
+    HPX_TEST(!data.worst_waiters.empty());
+}
+
+void test_spinlock()
+{
+    std::size_t const line = __LINE__ + 1;
+    hpx::spinlock mtx("lock_contention_spinlock");
+
+    HPX_TEST(mtx.try_lock());
+    mtx.unlock();
+    lock_and_sleep(mtx);
+
+    auto const data = get_site_data(line, "lock_contention_spinlock");
+    HPX_TEST_EQ(data.kind, std::string("hpx::spinlock"));
+    HPX_TEST_EQ(data.acquisitions, std::uint64_t(2));
+    HPX_TEST_EQ(data.contentions, std::uint64_t(0));
+    HPX_TEST_EQ(data.suspensions, std::uint64_t(0));
+    HPX_TEST_LTE(std::int64_t(1000000), data.hold_time);
+}
+
+void test_shared_mutex()
+{
+    std::size_t const line = __LINE__ + 1;
+    hpx::shared_mutex mtx;
+
+    {
+        std::shared_lock<hpx::shared_mutex> l1(mtx);
+        std::shared_lock<hpx::shared_mutex> l2(mtx);
+    }
+    lock_and_sleep(mtx);
+
+    // shared ownership is not taken into account for the hold time
+    auto const data = get_site_data(line, "hpx::shared_mutex");
+    HPX_TEST_EQ(data.kind, std::string("hpx::shared_mutex"));
+    HPX_TEST_EQ(data.acquisitions, std::uint64_t(3));
+    HPX_TEST_LTE(std::int64_t(1000000), data.hold_time);
+    HPX_TEST_LTE(data.max_hold_time, data.hold_time);
+}
+
+void test_report()
+{
+    std::ostringstream text;
+    hpx::util::print_lock_contention_data(text);
+    HPX_TEST_NEQ(text.str().find("hpx::mutex"), std::string::npos);
+
+    std::ostringstream json;
+    hpx::util::print_lock_contention_data(json, true);
+    HPX_TEST_EQ(json.str().find("{\"sites\": ["), std::size_t(0));
+
+    bool caught_exception = false;
+    try
+    {
+        hpx::util::print_lock_contention_data("cout", "xml");
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // resetting the statistics keeps the lock sites
+    HPX_TEST(!hpx::util::get_lock_contention_data(true).empty());
+    for (auto const& data : hpx::util::get_lock_contention_data())
+    {
+        HPX_TEST_EQ(data.acquisitions, std::uint64_t(0));
+        HPX_TEST(data.worst_waiters.empty());
+    }
+}
+
+int hpx_main()
+{
+    HPX_TEST(hpx::util::lock_contention_profiling_enabled());
+
+    test_mutex();
+    test_spinlock();
+    test_shared_mutex();
+
+    hpx::util::enable_lock_contention_profiling(false);
+    test_report();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=4", "hpx.lock_contention_profiling=1"};
+
+    hpx::local::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::local::init(hpx_main, argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
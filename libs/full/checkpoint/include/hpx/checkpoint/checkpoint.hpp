@@ -18,6 +18,7 @@
 #include <hpx/actions_base/traits/is_client.hpp>
 #include <hpx/async_distributed/dataflow.hpp>
 #include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/agas_interface.hpp>
@@ -32,6 +33,7 @@
 #include <cstdint>
 #include <iosfwd>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -850,4 +852,82 @@ namespace hpx { namespace util {
     inline void restore_checkpoint(checkpoint const&) {}
     /// \endcond
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        struct save_file_funct_obj
+        {
+            template <typename... Ts>
+            std::size_t operator()(
+                std::string const& filename, Ts&&... ts) const
+            {
+                return hpx::util::save_checkpoint_data_file(
+                    filename, HPX_FORWARD(Ts, ts)...);
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_file
+    ///
+    /// \tparam Ts          Containers passed to save_checkpoint_file to be
+    ///                     serialized and written to the file.
+    ///
+    /// \param filename     The name of the file to write the checkpoint to.
+    ///
+    /// \param ts           The containers to store.
+    ///
+    /// Save_checkpoint_file works like save_checkpoint, except that the data
+    /// is written to the given file while the objects are being serialized.
+    /// The checkpoint is never held in memory as a whole. Use
+    /// restore_checkpoint_file to restore the objects.
+    ///
+    /// \returns Save_checkpoint_file returns a future to the number of bytes
+    ///          written to the file.
+    template <typename... Ts>
+    hpx::future<std::size_t> save_checkpoint_file(
+        std::string filename, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_file_funct_obj{}, HPX_MOVE(filename),
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    /// \cond NOINTERNAL
+    // Same as above, but synchronous
+    template <typename... Ts>
+    std::size_t save_checkpoint_file(
+        hpx::launch::sync_policy sync_p, std::string filename, Ts&&... ts)
+    {
+        return hpx::dataflow(sync_p, detail::save_file_funct_obj{},
+            HPX_MOVE(filename), detail::prepare_client(HPX_FORWARD(Ts, ts))...)
+            .get();
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint_file
+    ///
+    /// \tparam T           A container to restore.
+    ///
+    /// \tparam Ts          Other containers to restore. Containers
+    ///                     must be in the same order that they were
+    ///                     written to the file.
+    ///
+    /// \param filename     The name of the file written by
+    ///                     save_checkpoint_file.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore.
+    ///
+    /// Restore_checkpoint_file maps the given file into memory and
+    /// de-serializes the objects directly from the mapped data.
+    template <typename T, typename... Ts>
+    void restore_checkpoint_file(std::string const& filename, T& t, Ts&... ts)
+    {
+        mapped_checkpoint_file const file(filename);
+        hpx::util::restore_checkpoint_data_func(
+            file, detail::restore_impl{}, t, ts...);
+    }
+
 }}    // namespace hpx::util
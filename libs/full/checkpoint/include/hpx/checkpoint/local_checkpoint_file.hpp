@@ -0,0 +1,208 @@
+// Copyright (c) 2025 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/checkpoint/local_checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+#include <hpx/modules/naming_base.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    namespace detail {
+
+        // Appends one archive to a checkpoint file that may already hold
+        // other archives (the archive positions start at zero).
+        class checkpoint_record_sink
+        {
+        public:
+            explicit checkpoint_record_sink(checkpoint_file_sink& sink) noexcept
+              : sink_(sink)
+              , start_(sink.size())
+            {
+            }
+
+            [[nodiscard]] std::size_t size() const noexcept
+            {
+                return sink_.size() - start_;
+            }
+
+            void write(void const* data, std::size_t count)
+            {
+                sink_.write(data, count);
+            }
+
+        private:
+            checkpoint_file_sink& sink_;
+            std::size_t start_;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Describes one object stored in the checkpoint file of a locality
+    struct checkpoint_manifest_entry
+    {
+        /// The global id of the object (if any)
+        naming::gid_type id;
+
+        /// The sequence number of the object (e.g. the partition number)
+        std::uint64_t index = 0;
+
+        /// The position and size of the serialized object in the data file
+        std::uint64_t offset = 0;
+        std::uint64_t size = 0;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned)
+        {
+            // clang-format off
+            ar & id & index & offset & size;
+            // clang-format on
+        }
+    };
+
+    /// Return the name of the checkpoint data file written by the given
+    /// locality, the manifest is stored in a file with the same name and the
+    /// additional extension '.manifest'.
+    HPX_EXPORT std::string get_local_checkpoint_filename(
+        std::string const& basename, std::uint32_t locality_id);
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// local_checkpoint_writer
+    ///
+    /// Part of a distributed checkpoint: writes the objects stored on one
+    /// locality to a data file local to that locality, and describes the
+    /// stored objects in a separate manifest file. Every object is serialized
+    /// into its own archive, which allows to restore the objects individually.
+    class HPX_EXPORT local_checkpoint_writer
+    {
+    public:
+        local_checkpoint_writer(
+            std::string const& basename, std::uint32_t locality_id);
+
+        local_checkpoint_writer(local_checkpoint_writer const&) = delete;
+        local_checkpoint_writer(local_checkpoint_writer&&) = delete;
+        local_checkpoint_writer& operator=(
+            local_checkpoint_writer const&) = delete;
+        local_checkpoint_writer& operator=(local_checkpoint_writer&&) = delete;
+
+        ~local_checkpoint_writer();
+
+        /// Add the given object to the checkpoint
+        template <typename T>
+        void save(naming::gid_type const& id, std::uint64_t index, T const& t)
+        {
+            detail::checkpoint_record_sink record(data_);
+            std::uint64_t const offset = data_.size();
+            save_checkpoint_data(record, t);
+            manifest_.push_back(
+                checkpoint_manifest_entry{id, index, offset, record.size()});
+        }
+
+        /// Write the manifest and close all files
+        ///
+        /// \returns the number of objects stored in the checkpoint
+        std::size_t close();
+
+    private:
+        std::string filename_;
+        checkpoint_file_sink data_;
+        std::vector<checkpoint_manifest_entry> manifest_;
+        bool closed_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// local_checkpoint_reader
+    ///
+    /// Gives access to the objects written by a local_checkpoint_writer. The
+    /// data file is mapped into memory.
+    class HPX_EXPORT local_checkpoint_reader
+    {
+    public:
+        local_checkpoint_reader(
+            std::string const& basename, std::uint32_t locality_id);
+
+        [[nodiscard]] std::vector<checkpoint_manifest_entry> const& manifest()
+            const noexcept
+        {
+            return manifest_;
+        }
+
+        /// Return the entry for the object with the given id, or nullptr
+        [[nodiscard]] checkpoint_manifest_entry const* find(
+            naming::gid_type const& id) const noexcept;
+
+        /// Return the entry for the object with the given index, or nullptr
+        [[nodiscard]] checkpoint_manifest_entry const* find(
+            std::uint64_t index) const noexcept;
+
+        /// Return the serialized data of the given object
+        [[nodiscard]] std::string_view get_data(
+            checkpoint_manifest_entry const& entry) const;
+
+        /// Restore the given object
+        template <typename T>
+        void restore(checkpoint_manifest_entry const& entry, T& t) const
+        {
+            std::string_view const data = get_data(entry);
+            restore_checkpoint_data(data, t);
+        }
+
+    private:
+        std::string filename_;
+        mapped_checkpoint_file data_;
+        std::vector<checkpoint_manifest_entry> manifest_;
+    };
+}    // namespace hpx::util
+
+namespace hpx::traits {
+
+    template <>
+    struct serialization_access_data<util::detail::checkpoint_record_sink>
+      : default_serialization_access_data<
+            util::detail::checkpoint_record_sink>
+    {
+        [[nodiscard]] static std::size_t size(
+            util::detail::checkpoint_record_sink const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        static constexpr void resize(
+            util::detail::checkpoint_record_sink&, std::size_t) noexcept
+        {
+        }
+
+        static void write(util::detail::checkpoint_record_sink& cont,
+            std::size_t count, [[maybe_unused]] std::size_t current,
+            void const* address)
+        {
+            HPX_ASSERT(current == cont.size());
+            cont.write(address, count);
+        }
+    };
+}    // namespace hpx::traits
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,139 @@
+// Copyright (c) 2025 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint/local_checkpoint_file.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace hpx::util {
+
+    namespace {
+
+        std::string get_manifest_filename(std::string const& filename)
+        {
+            return filename + ".manifest";
+        }
+
+        // Remove the manifest of a previous checkpoint before its data file
+        // is overwritten, a crash while writing the new checkpoint must not
+        // leave behind a manifest referring to the new data.
+        std::string const& remove_manifest(std::string const& filename)
+        {
+            std::remove(get_manifest_filename(filename).c_str());
+            return filename;
+        }
+    }    // namespace
+
+    std::string get_local_checkpoint_filename(
+        std::string const& basename, std::uint32_t locality_id)
+    {
+        return basename + "." + std::to_string(locality_id);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    local_checkpoint_writer::local_checkpoint_writer(
+        std::string const& basename, std::uint32_t locality_id)
+      : filename_(get_local_checkpoint_filename(basename, locality_id))
+      , data_(remove_manifest(filename_))
+      , closed_(false)
+    {
+    }
+
+    local_checkpoint_writer::~local_checkpoint_writer()
+    {
+        // an incomplete checkpoint is left without a manifest
+        if (!closed_ && std::uncaught_exceptions() == 0)
+        {
+            try
+            {
+                close();
+            }
+            catch (...)
+            {
+                // errors are reported only by an explicit call to close()
+            }
+        }
+    }
+
+    std::size_t local_checkpoint_writer::close()
+    {
+        if (!closed_)
+        {
+            // the manifest is written last, its existence marks the
+            // checkpoint as complete
+            data_.close();
+            save_checkpoint_data_file(
+                get_manifest_filename(filename_), manifest_);
+            closed_ = true;
+        }
+        return manifest_.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    local_checkpoint_reader::local_checkpoint_reader(
+        std::string const& basename, std::uint32_t locality_id)
+      : filename_(get_local_checkpoint_filename(basename, locality_id))
+    {
+        restore_checkpoint_data_file(
+            get_manifest_filename(filename_), manifest_);
+        data_ = mapped_checkpoint_file(filename_);
+
+        for (auto const& entry : manifest_)
+        {
+            if (entry.offset > data_.size() ||
+                entry.size > data_.size() - entry.offset)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "local_checkpoint_reader::local_checkpoint_reader",
+                    "the manifest of checkpoint file {} refers to data "
+                    "outside of the file",
+                    filename_);
+            }
+        }
+    }
+
+    checkpoint_manifest_entry const* local_checkpoint_reader::find(
+        naming::gid_type const& id) const noexcept
+    {
+        for (auto const& entry : manifest_)
+        {
+            if (entry.id == id)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    checkpoint_manifest_entry const* local_checkpoint_reader::find(
+        std::uint64_t index) const noexcept
+    {
+        for (auto const& entry : manifest_)
+        {
+            if (entry.index == index)
+            {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    std::string_view local_checkpoint_reader::get_data(
+        checkpoint_manifest_entry const& entry) const
+    {
+        return data_.view().substr(static_cast<std::size_t>(entry.offset),
+            static_cast<std::size_t>(entry.size));
+    }
+}    // namespace hpx::util
@@ -0,0 +1,200 @@
+// Copyright (c) 2025 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/checkpoint_base/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// checkpoint_file_sink
+    ///
+    /// A checkpoint_file_sink can be used as the container for
+    /// save_checkpoint_data. It writes the serialized data to a file while it
+    /// is being produced instead of collecting all of it in memory first.
+    /// Smaller pieces of data are collected in an internal buffer of the given
+    /// size, larger pieces (e.g. the contents of big arrays) are written to the
+    /// file directly from the memory of the serialized object.
+    class HPX_EXPORT checkpoint_file_sink
+    {
+    public:
+        static constexpr std::size_t default_buffer_size = 1024 * 1024;
+
+        explicit checkpoint_file_sink(std::string const& filename,
+            std::size_t buffer_size = default_buffer_size);
+
+        checkpoint_file_sink(checkpoint_file_sink const&) = delete;
+        checkpoint_file_sink(checkpoint_file_sink&&) = delete;
+        checkpoint_file_sink& operator=(checkpoint_file_sink const&) = delete;
+        checkpoint_file_sink& operator=(checkpoint_file_sink&&) = delete;
+
+        // closes the file, errors are ignored
+        ~checkpoint_file_sink();
+
+        /// Return the number of bytes written so far
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        /// Append the given data to the file
+        void write(void const* data, std::size_t count);
+
+        /// Write all buffered data to the file
+        void flush();
+
+        /// Flush all data and close the file
+        void close();
+
+    private:
+        void write_file(void const* data, std::size_t count);
+
+        std::string filename_;
+        std::FILE* file_;
+        std::vector<char> buffer_;
+        std::size_t size_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// mapped_checkpoint_file
+    ///
+    /// A mapped_checkpoint_file gives read-only access to the contents of a
+    /// file by mapping it into memory. It can be used as the container for
+    /// restore_checkpoint_data, in which case the data is de-serialized
+    /// directly from the mapped memory without reading the file into an
+    /// intermediate buffer first.
+    class HPX_EXPORT mapped_checkpoint_file
+    {
+    public:
+        mapped_checkpoint_file() = default;
+        explicit mapped_checkpoint_file(std::string const& filename);
+
+        mapped_checkpoint_file(mapped_checkpoint_file const&) = delete;
+        mapped_checkpoint_file(mapped_checkpoint_file&& rhs) noexcept;
+        mapped_checkpoint_file& operator=(
+            mapped_checkpoint_file const&) = delete;
+        mapped_checkpoint_file& operator=(
+            mapped_checkpoint_file&& rhs) noexcept;
+
+        ~mapped_checkpoint_file();
+
+        [[nodiscard]] constexpr char const* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] constexpr char const& operator[](
+            std::size_t pos) const noexcept
+        {
+            HPX_ASSERT(pos < size_);
+            return data_[pos];
+        }
+
+        [[nodiscard]] constexpr std::string_view view() const noexcept
+        {
+            return {data_, size_};
+        }
+
+    private:
+        void reset() noexcept;
+
+        char const* data_ = nullptr;
+        std::size_t size_ = 0;
+#if defined(HPX_WINDOWS)
+        // the file contents are read into memory
+        std::vector<char> contents_;
+#endif
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// save_checkpoint_data_file
+    ///
+    /// \tparam Ts           Types of variables to checkpoint
+    ///
+    /// \param filename      The name of the file to write the data to
+    /// \param ts            Variable instances to be inserted into the
+    ///                      checkpoint.
+    ///
+    /// save_checkpoint_data_file streams the serialized objects to the given
+    /// file. The data is equivalent to the data produced by
+    /// save_checkpoint_data.
+    ///
+    /// \returns the number of bytes written to the file
+    template <typename... Ts>
+    std::size_t save_checkpoint_data_file(
+        std::string const& filename, Ts&&... ts)
+    {
+        checkpoint_file_sink sink(filename);
+        save_checkpoint_data(sink, HPX_FORWARD(Ts, ts)...);
+        sink.close();
+        return sink.size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// restore_checkpoint_data_file
+    ///
+    /// \tparam Ts           Types of variables to restore
+    ///
+    /// \param filename      The name of the file the data was written to
+    /// \param ts            Variable instances to be restored from the file
+    ///
+    /// restore_checkpoint_data_file restores the given objects from a file
+    /// that was written by save_checkpoint_data_file.
+    template <typename... Ts>
+    void restore_checkpoint_data_file(std::string const& filename, Ts&... ts)
+    {
+        mapped_checkpoint_file const file(filename);
+        restore_checkpoint_data(file, ts...);
+    }
+}    // namespace hpx::util
+
+namespace hpx::traits {
+
+    template <>
+    struct serialization_access_data<util::checkpoint_file_sink>
+      : default_serialization_access_data<util::checkpoint_file_sink>
+    {
+        [[nodiscard]] static constexpr std::size_t size(
+            util::checkpoint_file_sink const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        // the size of the sink grows while data is written
+        static constexpr void resize(
+            util::checkpoint_file_sink&, std::size_t) noexcept
+        {
+        }
+
+        static void write(util::checkpoint_file_sink& cont, std::size_t count,
+            [[maybe_unused]] std::size_t current, void const* address)
+        {
+            HPX_ASSERT(current == cont.size());
+            cont.write(address, count);
+        }
+    };
+}    // namespace hpx::traits
+
+#include <hpx/config/warnings_suffix.hpp>
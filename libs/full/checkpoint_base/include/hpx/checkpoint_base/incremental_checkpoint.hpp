@@ -0,0 +1,139 @@
+// Copyright (c) 2025 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/checkpoint_base/incremental_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::util {
+
+    namespace detail {
+
+        // Compute a (non-cryptographic) hash of the serialized data of an
+        // object, used to detect changes between epochs.
+        HPX_EXPORT std::uint64_t checkpoint_hash(
+            void const* data, std::size_t size) noexcept;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// incremental_checkpoint
+    ///
+    /// An incremental_checkpoint writes a sequence of checkpoint files (one
+    /// per epoch) for the same list of objects. The first epoch contains all
+    /// objects, every subsequent epoch contains only the objects whose
+    /// serialized representation has changed since the previous epoch.
+    /// Restoring an incremental_checkpoint combines the most recent version of
+    /// each object from all epochs.
+    ///
+    /// The objects are identified by their position in the argument list,
+    /// save and restore must be invoked with the same sequence of objects.
+    /// Writing the first epoch removes the files of any later epochs left
+    /// behind by a previous run.
+    class HPX_EXPORT incremental_checkpoint
+    {
+    public:
+        /// The checkpoint files are named <base_filename>.<epoch>
+        explicit incremental_checkpoint(std::string base_filename);
+
+        /// Return the name of the checkpoint file for the given epoch
+        [[nodiscard]] std::string get_filename(std::size_t epoch) const;
+
+        /// Return the number of epochs written so far
+        [[nodiscard]] constexpr std::size_t epoch() const noexcept
+        {
+            return epoch_;
+        }
+
+        /// Write a new epoch containing all objects that have changed since
+        /// the previous epoch.
+        ///
+        /// \returns the number of objects that were written
+        template <typename... Ts>
+        std::size_t save(Ts const&... ts)
+        {
+            checkpoint_file_sink sink(begin_epoch(sizeof...(Ts)));
+
+            std::size_t index = 0;
+            std::size_t written = 0;
+            std::vector<char> buffer;
+            (save_one(sink, buffer, index++, ts, written), ...);
+
+            sink.close();
+            ++epoch_;
+
+            return written;
+        }
+
+        /// Restore the given objects from the epochs written so far. If no
+        /// epoch was written by this instance, the existing checkpoint files
+        /// are used. Subsequent save operations continue with the next epoch.
+        template <typename... Ts>
+        void restore(Ts&... ts)
+        {
+            std::vector<mapped_checkpoint_file> files;
+            std::vector<std::string_view> const records =
+                load_epochs(files, sizeof...(Ts));
+
+            std::size_t index = 0;
+            (restore_checkpoint_data(records[index++], ts), ...);
+        }
+
+    private:
+        // open the file for the next epoch and write its header
+        std::string begin_epoch(std::size_t num_objects);
+
+        // Return whether the object with the given index has changed, remember
+        // the new hash
+        bool has_changed(std::size_t index, std::uint64_t hash);
+
+        static void write_record_header(checkpoint_file_sink& sink,
+            std::size_t index, std::size_t size);
+
+        template <typename T>
+        void save_one(checkpoint_file_sink& sink, std::vector<char>& buffer,
+            std::size_t index, T const& t, std::size_t& written)
+        {
+            // serialize the object only once, the data is written only if
+            // its hash has changed
+            buffer.clear();
+            save_checkpoint_data(buffer, t);
+
+            std::uint64_t const hash =
+                detail::checkpoint_hash(buffer.data(), buffer.size());
+            if (has_changed(index, hash))
+            {
+                write_record_header(sink, index, buffer.size());
+                sink.write(buffer.data(), buffer.size());
+                ++written;
+            }
+        }
+
+        // map the files of all epochs and return the most recent record of
+        // each object
+        std::vector<std::string_view> load_epochs(
+            std::vector<mapped_checkpoint_file>& files,
+            std::size_t num_objects);
+
+        std::string base_filename_;
+        std::size_t epoch_;
+        std::vector<std::uint64_t> hashes_;
+    };
+}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,238 @@
+// Copyright (c) 2025 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if !defined(HPX_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx::util {
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file_sink::checkpoint_file_sink(
+        std::string const& filename, std::size_t buffer_size)
+      : filename_(filename)
+      , file_(std::fopen(filename.c_str(), "wb"))
+      , size_(0)
+    {
+        if (file_ == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_sink::checkpoint_file_sink",
+                "could not open checkpoint file {} for writing: {}", filename,
+                std::strerror(errno));
+        }
+        buffer_.reserve(buffer_size);
+    }
+
+    checkpoint_file_sink::~checkpoint_file_sink()
+    {
+        if (file_ != nullptr)
+        {
+            if (!buffer_.empty())
+            {
+                std::fwrite(buffer_.data(), 1, buffer_.size(), file_);
+            }
+            std::fclose(file_);
+        }
+    }
+
+    void checkpoint_file_sink::write(void const* data, std::size_t count)
+    {
+        if (buffer_.size() + count > buffer_.capacity())
+        {
+            flush();
+
+            // write larger pieces of data without copying them first
+            if (count >= buffer_.capacity())
+            {
+                write_file(data, count);
+                size_ += count;
+                return;
+            }
+        }
+
+        auto const* p = static_cast<char const*>(data);
+        buffer_.insert(buffer_.end(), p, p + count);
+        size_ += count;
+    }
+
+    void checkpoint_file_sink::flush()
+    {
+        if (!buffer_.empty())
+        {
+            write_file(buffer_.data(), buffer_.size());
+            buffer_.clear();
+        }
+    }
+
+    void checkpoint_file_sink::close()
+    {
+        if (file_ == nullptr)
+        {
+            return;
+        }
+
+        flush();
+
+        std::FILE* file = std::exchange(file_, nullptr);
+        if (std::fclose(file) != 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_sink::close",
+                "could not close checkpoint file {}: {}", filename_,
+                std::strerror(errno));
+        }
+    }
+
+    void checkpoint_file_sink::write_file(void const* data, std::size_t count)
+    {
+        if (file_ == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                "checkpoint_file_sink::write",
+                "checkpoint file {} was already closed", filename_);
+        }
+
+        if (std::fwrite(data, 1, count, file_) != count)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "checkpoint_file_sink::write",
+                "could not write to checkpoint file {}: {}", filename_,
+                std::strerror(errno));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    mapped_checkpoint_file::mapped_checkpoint_file(std::string const& filename)
+    {
+#if defined(HPX_WINDOWS)
+        std::FILE* file = std::fopen(filename.c_str(), "rb");
+        if (file == nullptr)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "mapped_checkpoint_file::mapped_checkpoint_file",
+                "could not open checkpoint file {}: {}", filename,
+                std::strerror(errno));
+        }
+
+        char buffer[64 * 1024];
+        std::size_t read = 0;
+        while ((read = std::fread(buffer, 1, sizeof(buffer), file)) != 0)
+        {
+            contents_.insert(contents_.end(), buffer, buffer + read);
+        }
+        std::fclose(file);
+
+        data_ = contents_.data();
+        size_ = contents_.size();
+#else
+        int const fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "mapped_checkpoint_file::mapped_checkpoint_file",
+                "could not open checkpoint file {}: {}", filename,
+                std::strerror(errno));
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) == -1)
+        {
+            int const err = errno;
+            ::close(fd);
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "mapped_checkpoint_file::mapped_checkpoint_file",
+                "could not determine the size of checkpoint file {}: {}",
+                filename, std::strerror(err));
+        }
+
+        auto const size = static_cast<std::size_t>(st.st_size);
+        if (size == 0)
+        {
+            // empty files can't be mapped
+            ::close(fd);
+            return;
+        }
+
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "mapped_checkpoint_file::mapped_checkpoint_file",
+                "could not map checkpoint file {}: {}", filename,
+                std::strerror(err));
+        }
+
+        // the file is read sequentially during de-serialization
+        ::madvise(data, size, MADV_SEQUENTIAL);
+
+        data_ = static_cast<char const*>(data);
+        size_ = size;
+#endif
+    }
+
+    mapped_checkpoint_file::mapped_checkpoint_file(
+        mapped_checkpoint_file&& rhs) noexcept
+      : data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+#if defined(HPX_WINDOWS)
+      , contents_(HPX_MOVE(rhs.contents_))
+#endif
+    {
+    }
+
+    mapped_checkpoint_file& mapped_checkpoint_file::operator=(
+        mapped_checkpoint_file&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+#if defined(HPX_WINDOWS)
+            contents_ = HPX_MOVE(rhs.contents_);
+#endif
+        }
+        return *this;
+    }
+
+    mapped_checkpoint_file::~mapped_checkpoint_file()
+    {
+        reset();
+    }
+
+    void mapped_checkpoint_file::reset() noexcept
+    {
+#if defined(HPX_WINDOWS)
+        contents_.clear();
+#else
+        if (data_ != nullptr)
+        {
+            ::munmap(const_cast<char*>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+}    // namespace hpx::util
@@ -0,0 +1,229 @@
+// Copyright (c) 2025 The STE||AR-Group
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint_base/checkpoint_file.hpp>
+#include <hpx/checkpoint_base/incremental_checkpoint.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace hpx::util {
+
+    namespace {
+
+        // every epoch file starts with this marker followed by the number of
+        // objects in the checkpoint
+        constexpr std::uint64_t epoch_file_magic = 0x4850584350543031ULL;
+
+        bool file_exists(std::string const& filename) noexcept
+        {
+            std::FILE* file = std::fopen(filename.c_str(), "rb");
+            if (file == nullptr)
+            {
+                return false;
+            }
+            std::fclose(file);
+            return true;
+        }
+
+        std::uint64_t read_value(std::string_view data, std::size_t& pos,
+            std::string const& filename)
+        {
+            std::uint64_t value = 0;
+            if (data.size() - pos < sizeof(value))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "incremental_checkpoint::restore",
+                    "checkpoint file {} is truncated", filename);
+            }
+            std::memcpy(&value, data.data() + pos, sizeof(value));
+            pos += sizeof(value);
+            return value;
+        }
+    }    // namespace
+
+    namespace detail {
+
+        // FNV-1a style hash consuming eight bytes at a time
+        std::uint64_t checkpoint_hash(
+            void const* data, std::size_t size) noexcept
+        {
+            constexpr std::uint64_t prime = 0x100000001b3ULL;
+
+            auto const* p = static_cast<unsigned char const*>(data);
+            std::uint64_t hash = 0xcbf29ce484222325ULL;
+
+            std::size_t i = 0;
+            for (/**/; i + sizeof(std::uint64_t) <= size;
+                i += sizeof(std::uint64_t))
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, p + i, sizeof(word));
+                hash = (hash ^ word) * prime;
+                hash ^= hash >> 32;
+            }
+            for (/**/; i != size; ++i)
+            {
+                hash = (hash ^ p[i]) * prime;
+            }
+            return (hash ^ static_cast<std::uint64_t>(size)) * prime;
+        }
+    }    // namespace detail
+
+    incremental_checkpoint::incremental_checkpoint(std::string base_filename)
+      : base_filename_(HPX_MOVE(base_filename))
+      , epoch_(0)
+    {
+    }
+
+    std::string incremental_checkpoint::get_filename(std::size_t epoch) const
+    {
+        return base_filename_ + "." + std::to_string(epoch);
+    }
+
+    std::string incremental_checkpoint::begin_epoch(std::size_t num_objects)
+    {
+        if (!hashes_.empty() && hashes_.size() != num_objects)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "incremental_checkpoint::save",
+                "the number of objects ({}) differs from the number of "
+                "objects in the previous epochs ({})",
+                num_objects, hashes_.size());
+        }
+        hashes_.resize(num_objects, 0);
+
+        // The first epoch starts a new sequence of files, remove the files
+        // of later epochs written by a previous run as those would otherwise
+        // be picked up by a subsequent restore.
+        if (epoch_ == 0)
+        {
+            for (std::size_t epoch = 1; file_exists(get_filename(epoch));
+                ++epoch)
+            {
+                std::remove(get_filename(epoch).c_str());
+            }
+        }
+
+        return get_filename(epoch_);
+    }
+
+    bool incremental_checkpoint::has_changed(
+        std::size_t index, std::uint64_t hash)
+    {
+        // all objects are written to the first epoch
+        if (epoch_ != 0 && hashes_[index] == hash)
+        {
+            return false;
+        }
+        hashes_[index] = hash;
+        return true;
+    }
+
+    void incremental_checkpoint::write_record_header(
+        checkpoint_file_sink& sink, std::size_t index, std::size_t size)
+    {
+        if (sink.size() == 0)
+        {
+            std::uint64_t const magic = epoch_file_magic;
+            sink.write(&magic, sizeof(magic));
+        }
+
+        std::uint64_t const header[2] = {static_cast<std::uint64_t>(index),
+            static_cast<std::uint64_t>(size)};
+        sink.write(header, sizeof(header));
+    }
+
+    std::vector<std::string_view> incremental_checkpoint::load_epochs(
+        std::vector<mapped_checkpoint_file>& files, std::size_t num_objects)
+    {
+        // pick up the epochs written by a previous run
+        if (epoch_ == 0)
+        {
+            while (file_exists(get_filename(epoch_)))
+            {
+                ++epoch_;
+            }
+        }
+
+        if (epoch_ == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "incremental_checkpoint::restore",
+                "no checkpoint files found for {}", base_filename_);
+        }
+
+        std::vector<std::string_view> records(num_objects);
+
+        files.reserve(epoch_);
+        for (std::size_t epoch = 0; epoch != epoch_; ++epoch)
+        {
+            std::string const filename = get_filename(epoch);
+            std::string_view const data =
+                files.emplace_back(filename).view();
+
+            // epochs without any changed objects are empty
+            if (data.empty())
+            {
+                continue;
+            }
+
+            std::size_t pos = 0;
+            if (read_value(data, pos, filename) != epoch_file_magic)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "incremental_checkpoint::restore",
+                    "{} is not a checkpoint file", filename);
+            }
+
+            while (pos != data.size())
+            {
+                auto const index =
+                    static_cast<std::size_t>(read_value(data, pos, filename));
+                auto const size =
+                    static_cast<std::size_t>(read_value(data, pos, filename));
+
+                if (index >= num_objects || data.size() - pos < size)
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "incremental_checkpoint::restore",
+                        "invalid object record in checkpoint file {}",
+                        filename);
+                }
+
+                records[index] = data.substr(pos, size);
+                pos += size;
+            }
+        }
+
+        hashes_.assign(num_objects, 0);
+        for (std::size_t i = 0; i != num_objects; ++i)
+        {
+            if (records[i].empty())
+            {
+                HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                    "incremental_checkpoint::restore",
+                    "object {} is missing from the checkpoint files of {}", i,
+                    base_filename_);
+            }
+
+            // the hash of the stored data allows to detect changes during
+            // the next epoch
+            hashes_[i] =
+                detail::checkpoint_hash(records[i].data(), records[i].size());
+        }
+
+        return records;
+    }
+}    // namespace hpx::util
@@ -0,0 +1,154 @@
+// Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint_base.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <vector>
+
+void test_checkpoint_file()
+{
+    std::string const filename = "checkpoint_file_test.dat";
+
+    int integer = 42;
+    std::string str = "I am a string of characters";
+
+    // larger than the buffer of the file sink
+    std::vector<double> vec(1024 * 1024);
+    std::iota(vec.begin(), vec.end(), 0.0);
+
+    std::size_t const size = hpx::util::save_checkpoint_data_file(
+        filename, integer, str, vec);
+    HPX_TEST_EQ(size, hpx::util::prepare_checkpoint_data(integer, str, vec));
+
+    // the file holds the same data as a checkpoint created in memory
+    std::vector<char> archive;
+    hpx::util::save_checkpoint_data(archive, integer, str, vec);
+    {
+        hpx::util::mapped_checkpoint_file const file(filename);
+        HPX_TEST_EQ(file.size(), archive.size());
+        HPX_TEST(file.view() == std::string_view(archive.data(), size));
+    }
+
+    int integer2 = 0;
+    std::string str2;
+    std::vector<double> vec2;
+    hpx::util::restore_checkpoint_data_file(filename, integer2, str2, vec2);
+
+    HPX_TEST_EQ(integer, integer2);
+    HPX_TEST_EQ(str, str2);
+    HPX_TEST(vec == vec2);
+
+    std::remove(filename.c_str());
+}
+
+void test_incremental_checkpoint()
+{
+    std::string const base_filename = "incremental_checkpoint_test";
+
+    int integer = 42;
+    std::string str = "I am a string of characters";
+    std::vector<double> vec(1000);
+    std::iota(vec.begin(), vec.end(), 0.0);
+
+    std::size_t epochs = 0;
+    {
+        hpx::util::incremental_checkpoint ckp(base_filename);
+
+        // all objects are written to the first epoch
+        HPX_TEST_EQ(ckp.save(integer, str, vec), std::size_t(3));
+
+        // only changed objects are written subsequently
+        vec[500] = -1.0;
+        HPX_TEST_EQ(ckp.save(integer, str, vec), std::size_t(1));
+
+        HPX_TEST_EQ(ckp.save(integer, str, vec), std::size_t(0));
+
+        integer = 43;
+        str = "I am a different string";
+        HPX_TEST_EQ(ckp.save(integer, str, vec), std::size_t(2));
+
+        epochs = ckp.epoch();
+        HPX_TEST_EQ(epochs, std::size_t(4));
+    }
+
+    {
+        // pick up the existing files
+        hpx::util::incremental_checkpoint ckp(base_filename);
+
+        int integer2 = 0;
+        std::string str2;
+        std::vector<double> vec2;
+        ckp.restore(integer2, str2, vec2);
+
+        HPX_TEST_EQ(ckp.epoch(), epochs);
+        HPX_TEST_EQ(integer, integer2);
+        HPX_TEST_EQ(str, str2);
+        HPX_TEST(vec == vec2);
+
+        // nothing has changed since the restored epoch
+        HPX_TEST_EQ(ckp.save(integer2, str2, vec2), std::size_t(0));
+
+        for (std::size_t i = 0; i != ckp.epoch(); ++i)
+        {
+            std::remove(ckp.get_filename(i).c_str());
+        }
+    }
+}
+
+void test_stale_epochs()
+{
+    std::string const base_filename = "incremental_checkpoint_stale_test";
+
+    int integer = 1;
+    {
+        // a longer run leaves behind three epochs
+        hpx::util::incremental_checkpoint ckp(base_filename);
+        for (int i = 0; i != 3; ++i)
+        {
+            integer = i;
+            ckp.save(integer);
+        }
+    }
+
+    {
+        // a shorter run starting over writes a single epoch only
+        hpx::util::incremental_checkpoint ckp(base_filename);
+        integer = 42;
+        ckp.save(integer);
+        HPX_TEST_EQ(ckp.epoch(), std::size_t(1));
+    }
+
+    {
+        // the epochs of the longer run must not be picked up
+        hpx::util::incremental_checkpoint ckp(base_filename);
+
+        int integer2 = 0;
+        ckp.restore(integer2);
+
+        HPX_TEST_EQ(ckp.epoch(), std::size_t(1));
+        HPX_TEST_EQ(integer2, 42);
+
+        std::remove(ckp.get_filename(0).c_str());
+    }
+}
+
+int main()
+{
+    test_checkpoint_file();
+    test_incremental_checkpoint();
+    test_stale_epochs();
+
+    return hpx::util::report_errors();
+}
@@ -193,6 +193,10 @@ namespace hpx::collectives {
         HPX_EXPORT std::pair<num_sites_arg, this_site_arg> get_info()
             const noexcept;
 
+        // Return the number of tags for which values sent to this site were
+        // not retrieved yet or get operations on this site are still pending.
+        HPX_EXPORT std::size_t num_pending_channels() const;
+
     private:
         std::shared_ptr<detail::channel_communicator> comm_;
     };
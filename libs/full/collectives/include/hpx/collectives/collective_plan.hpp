@@ -0,0 +1,423 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file collective_plan.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// A persistent all_reduce operation
+    ///
+    /// An all_reduce_plan is created once for a channel communicator and can
+    /// be started any number of times. All decisions which do not depend on
+    /// the reduced values are taken when the plan is created: the partners
+    /// of every step of the (recursive doubling) algorithm are computed and
+    /// the communicator's peers are already resolved. Starting the plan only
+    /// exchanges the values. Every start uses the next generation number,
+    /// all sites have to start their plans in the same order.
+    ///
+    template <typename T, typename F>
+    class all_reduce_plan
+    {
+    public:
+        /// Create an empty plan
+        all_reduce_plan() = default;
+
+        /// Create a plan reducing values of type \a T using the given
+        /// operation \a op on all sites of the given communicator
+        ///
+        /// \param  comm        A communicator object returned from
+        ///                     \a create_channel_communicator. The
+        ///                     communicator should not be used concurrently
+        ///                     for other operations.
+        /// \param  op          Reduction operation to apply to the values.
+        ///                     The operation has to be associative.
+        /// \param  generation  The generation number used by the first
+        ///                     invocation of \a start (default: 1).
+        ///
+        explicit all_reduce_plan(channel_communicator comm, F op = F(),
+            generation_arg generation = generation_arg());
+
+        /// Start the reduction of the given value
+        ///
+        /// \returns    This function returns a future holding the result of
+        ///             the reduction.
+        ///
+        hpx::future<T> start(T local_result);
+
+        /// Reduce the given value and wait for the result
+        T start(hpx::launch::sync_policy, T local_result);
+
+        /// Return the generation number used by the next invocation of
+        /// \a start
+        std::size_t generation() const noexcept;
+    };
+
+    /// A persistent all_gather operation
+    ///
+    /// An all_gather_plan is created once for a channel communicator and can
+    /// be started any number of times. The values are gathered using the
+    /// Bruck algorithm, which needs ceil(log2(num_sites)) steps for any
+    /// number of sites.
+    ///
+    template <typename T>
+    class all_gather_plan
+    {
+    public:
+        /// Create an empty plan
+        all_gather_plan() = default;
+
+        /// Create a plan gathering values of type \a T from all sites of the
+        /// given communicator
+        explicit all_gather_plan(channel_communicator comm,
+            generation_arg generation = generation_arg());
+
+        /// Start gathering the given value
+        ///
+        /// \returns    This function returns a future holding the values of
+        ///             all sites, ordered by site.
+        ///
+        hpx::future<std::vector<T>> start(T local_result);
+
+        /// Gather the given value and wait for the result
+        std::vector<T> start(hpx::launch::sync_policy, T local_result);
+
+        /// Return the generation number used by the next invocation of
+        /// \a start
+        std::size_t generation() const noexcept;
+    };
+}}
+// clang-format on
+#else
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/pipelined_all_reduce.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The steps of a recursive doubling all_reduce. Sites beyond the
+        // largest power of two fold their value into their right neighbor
+        // before the first step and receive the result after the last step.
+        struct HPX_EXPORT recursive_doubling_schedule
+        {
+            static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+            recursive_doubling_schedule() = default;
+            recursive_doubling_schedule(
+                std::size_t num_sites, std::size_t this_site);
+
+            struct step
+            {
+                std::size_t partner;
+                bool partner_first;    // the partner's value comes first
+            };
+
+            std::size_t fold_partner = npos;
+            bool folded = false;    // this site does not take part in steps
+            std::vector<step> steps;
+        };
+
+        // The steps of a Bruck all_gather. In every step a site sends the
+        // first 'count' values it holds to 'send_to' and appends the values
+        // received from 'receive_from'.
+        struct HPX_EXPORT bruck_schedule
+        {
+            bruck_schedule() = default;
+            bruck_schedule(std::size_t num_sites, std::size_t this_site);
+
+            struct step
+            {
+                std::size_t send_to;
+                std::size_t receive_from;
+                std::size_t count;
+            };
+
+            std::size_t num_sites = 1;
+            std::size_t this_site = 0;
+            std::vector<step> steps;
+        };
+
+        // the tag of the message sent after the last step to sites which
+        // folded their values
+        inline constexpr std::size_t plan_unfold_step = 0xffff;
+
+        inline void wait_for_plan_sends(std::vector<hpx::future<void>>& sends)
+        {
+            hpx::wait_all(sends);
+            for (auto& f : sends)
+            {
+                f.get();    // rethrow exceptions
+            }
+        }
+
+        inline std::size_t check_plan_generation(
+            char const* function, generation_arg generation)
+        {
+            if (generation == 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter, function,
+                    "the generation number shouldn't be zero");
+            }
+            return generation == static_cast<std::size_t>(-1) ? 1 :
+                                                                generation;
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename F>
+    class all_reduce_plan
+    {
+        struct plan_data
+        {
+            plan_data(channel_communicator&& comm, F&& op,
+                std::size_t generation)
+              : comm_(HPX_MOVE(comm))
+              , op_(HPX_MOVE(op))
+              , generation_(generation)
+            {
+                auto [num_sites, this_site] = comm_.get_info();
+                schedule_ =
+                    detail::recursive_doubling_schedule(num_sites, this_site);
+            }
+
+            T run(T value, std::size_t generation)
+            {
+                using detail::all_reduce_tag;
+
+                std::vector<hpx::future<void>> sends;
+                sends.reserve(schedule_.steps.size() + 1);
+
+                std::size_t const fold_partner = schedule_.fold_partner;
+                if (schedule_.folded)
+                {
+                    sends.push_back(
+                        set(comm_, that_site_arg(fold_partner), HPX_MOVE(value),
+                            tag_arg(all_reduce_tag(generation, 0))));
+                    value = get<T>(hpx::launch::sync, comm_,
+                        that_site_arg(fold_partner),
+                        tag_arg(all_reduce_tag(
+                            generation, detail::plan_unfold_step)));
+
+                    detail::wait_for_plan_sends(sends);
+                    return value;
+                }
+
+                if (fold_partner != detail::recursive_doubling_schedule::npos)
+                {
+                    value = op_(get<T>(hpx::launch::sync, comm_,
+                                    that_site_arg(fold_partner),
+                                    tag_arg(all_reduce_tag(generation, 0))),
+                        value);
+                }
+
+                std::size_t step = 1;
+                for (auto const& s : schedule_.steps)
+                {
+                    std::size_t const tag = all_reduce_tag(generation, step++);
+                    sends.push_back(set(
+                        comm_, that_site_arg(s.partner), value, tag_arg(tag)));
+
+                    T received = get<T>(hpx::launch::sync, comm_,
+                        that_site_arg(s.partner), tag_arg(tag));
+                    value = s.partner_first ? op_(HPX_MOVE(received), value) :
+                                              op_(value, HPX_MOVE(received));
+                }
+
+                if (fold_partner != detail::recursive_doubling_schedule::npos)
+                {
+                    sends.push_back(set(comm_, that_site_arg(fold_partner),
+                        value,
+                        tag_arg(all_reduce_tag(
+                            generation, detail::plan_unfold_step))));
+                }
+
+                detail::wait_for_plan_sends(sends);
+                return value;
+            }
+
+            channel_communicator comm_;
+            F op_;
+            std::size_t generation_;
+            detail::recursive_doubling_schedule schedule_;
+        };
+
+    public:
+        all_reduce_plan() = default;
+
+        explicit all_reduce_plan(channel_communicator comm, F op = F(),
+            generation_arg generation = generation_arg())
+          : data_(std::make_shared<plan_data>(HPX_MOVE(comm), HPX_MOVE(op),
+                detail::check_plan_generation(
+                    "hpx::collectives::all_reduce_plan", generation)))
+        {
+        }
+
+        hpx::future<T> start(T local_result)
+        {
+            HPX_ASSERT(data_);
+
+            std::size_t const generation = data_->generation_++;
+            if (data_->schedule_.steps.empty() &&
+                data_->schedule_.fold_partner ==
+                    detail::recursive_doubling_schedule::npos)
+            {
+                // there is only one site
+                return hpx::make_ready_future(HPX_MOVE(local_result));
+            }
+
+            return hpx::async(
+                [data = data_, value = HPX_MOVE(local_result),
+                    generation]() mutable -> T {
+                    return data->run(HPX_MOVE(value), generation);
+                });
+        }
+
+        T start(hpx::launch::sync_policy, T local_result)
+        {
+            HPX_ASSERT(data_);
+            return data_->run(HPX_MOVE(local_result), data_->generation_++);
+        }
+
+        std::size_t generation() const noexcept
+        {
+            HPX_ASSERT(data_);
+            return data_->generation_;
+        }
+
+    private:
+        std::shared_ptr<plan_data> data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    class all_gather_plan
+    {
+        struct plan_data
+        {
+            plan_data(channel_communicator&& comm, std::size_t generation)
+              : comm_(HPX_MOVE(comm))
+              , generation_(generation)
+            {
+                auto [num_sites, this_site] = comm_.get_info();
+                schedule_ = detail::bruck_schedule(num_sites, this_site);
+            }
+
+            std::vector<T> run(T value, std::size_t generation)
+            {
+                std::vector<T> result;
+                result.reserve(schedule_.num_sites);
+                result.push_back(HPX_MOVE(value));
+
+                std::vector<hpx::future<void>> sends;
+                sends.reserve(schedule_.steps.size());
+
+                std::size_t step = 1;
+                for (auto const& s : schedule_.steps)
+                {
+                    std::size_t const tag =
+                        detail::all_reduce_tag(generation, step++);
+                    auto const last = result.begin() + s.count;
+                    sends.push_back(set(comm_, that_site_arg(s.send_to),
+                        std::vector<T>(result.begin(), last), tag_arg(tag)));
+
+                    std::vector<T> received =
+                        get<std::vector<T>>(hpx::launch::sync, comm_,
+                            that_site_arg(s.receive_from), tag_arg(tag));
+                    std::move(received.begin(), received.end(),
+                        std::back_inserter(result));
+                }
+                HPX_ASSERT(result.size() == schedule_.num_sites);
+
+                // the values are ordered relative to this site
+                std::rotate(result.begin(),
+                    result.begin() +
+                        (schedule_.num_sites - schedule_.this_site) %
+                            schedule_.num_sites,
+                    result.end());
+
+                detail::wait_for_plan_sends(sends);
+                return result;
+            }
+
+            channel_communicator comm_;
+            std::size_t generation_;
+            detail::bruck_schedule schedule_;
+        };
+
+    public:
+        all_gather_plan() = default;
+
+        explicit all_gather_plan(channel_communicator comm,
+            generation_arg generation = generation_arg())
+          : data_(std::make_shared<plan_data>(HPX_MOVE(comm),
+                detail::check_plan_generation(
+                    "hpx::collectives::all_gather_plan", generation)))
+        {
+        }
+
+        hpx::future<std::vector<T>> start(T local_result)
+        {
+            HPX_ASSERT(data_);
+
+            std::size_t const generation = data_->generation_++;
+            if (data_->schedule_.steps.empty())
+            {
+                // there is only one site
+                std::vector<T> result;
+                result.push_back(HPX_MOVE(local_result));
+                return hpx::make_ready_future(HPX_MOVE(result));
+            }
+
+            return hpx::async(
+                [data = data_, value = HPX_MOVE(local_result),
+                    generation]() mutable -> std::vector<T> {
+                    return data->run(HPX_MOVE(value), generation);
+                });
+        }
+
+        std::vector<T> start(hpx::launch::sync_policy, T local_result)
+        {
+            HPX_ASSERT(data_);
+            return data_->run(HPX_MOVE(local_result), data_->generation_++);
+        }
+
+        std::size_t generation() const noexcept
+        {
+            HPX_ASSERT(data_);
+            return data_->generation_;
+        }
+
+    private:
+        std::shared_ptr<plan_data> data_;
+    };
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
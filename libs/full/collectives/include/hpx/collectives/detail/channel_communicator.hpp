@@ -16,11 +16,12 @@
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/datastructures/any.hpp>
 #include <hpx/futures/future.hpp>
-#include <hpx/lcos_local/channel.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <cstddef>
+#include <deque>
 #include <map>
 #include <mutex>
 #include <utility>
@@ -33,8 +34,15 @@ namespace hpx::collectives::detail {
       : public hpx::components::component_base<channel_communicator_server>
     {
     private:
-        using channel_type =
-            lcos::local::one_element_channel<unique_any_nonser>;
+        // Values sent to a tag which were not retrieved yet and get requests
+        // for a tag which were not satisfied yet. At most one of the two is
+        // non-empty at any time. The entry is erased as soon as both are
+        // empty again, otherwise every tag ever used would stay around.
+        struct channel_type
+        {
+            std::deque<unique_any_nonser> values_;
+            std::deque<hpx::promise<unique_any_nonser>> requests_;
+        };
 
     public:
         channel_communicator_server()    //-V730
@@ -57,8 +65,21 @@ namespace hpx::collectives::detail {
                 std::unique_lock l(data_[which].mtx_);
                 [[maybe_unused]] util::ignore_while_checking il(&l);
 
-                channel_type& c = data_[which].channels_[tag];
-                f = c.get();
+                auto& channels = data_[which].channels_;
+                auto it = channels.try_emplace(tag).first;
+                if (channel_type& c = it->second; !c.values_.empty())
+                {
+                    f = hpx::make_ready_future(HPX_MOVE(c.values_.front()));
+                    c.values_.pop_front();
+                    if (c.values_.empty())
+                    {
+                        channels.erase(it);
+                    }
+                }
+                else
+                {
+                    f = c.requests_.emplace_back().get_future();
+                }
             }
 
             return f.then(
@@ -80,10 +101,32 @@ namespace hpx::collectives::detail {
         template <typename T>
         void set(std::size_t which, T value, std::size_t tag)
         {
-            std::unique_lock l(data_[which].mtx_);
-            [[maybe_unused]] util::ignore_while_checking il(&l);
+            hpx::promise<unique_any_nonser> p;
+
+            {
+                std::unique_lock l(data_[which].mtx_);
+                [[maybe_unused]] util::ignore_while_checking il(&l);
 
-            data_[which].channels_[tag].set(unique_any_nonser(HPX_MOVE(value)));
+                auto& channels = data_[which].channels_;
+                auto it = channels.try_emplace(tag).first;
+                channel_type& c = it->second;
+                if (c.requests_.empty())
+                {
+                    c.values_.emplace_back(HPX_MOVE(value));
+                    return;
+                }
+
+                p = HPX_MOVE(c.requests_.front());
+                c.requests_.pop_front();
+                if (c.requests_.empty())
+                {
+                    channels.erase(it);
+                }
+            }
+
+            // make the value available outside of the lock, this may run
+            // continuations attached to the future returned from get()
+            p.set_value(unique_any_nonser(HPX_MOVE(value)));
         }
 
         template <typename T>
@@ -95,6 +138,30 @@ namespace hpx::collectives::detail {
         {
         };
 
+        // Return the number of tags for which either values or get requests
+        // are pending.
+        std::size_t num_channels() const
+        {
+            std::size_t result = 0;
+            for (locality_data& data : data_)
+            {
+                std::unique_lock l(data.mtx_);
+                [[maybe_unused]] util::ignore_while_checking il(&l);
+
+                result += data.channels_.size();
+            }
+            return result;
+        }
+
+        struct num_channels_action
+          : hpx::actions::make_action<std::size_t (
+                                          channel_communicator_server::*)()
+                                          const,
+                &channel_communicator_server::num_channels,
+                num_channels_action>::type
+        {
+        };
+
     private:
         struct locality_data
         {
@@ -153,6 +220,13 @@ namespace hpx::collectives::detail {
             return std::make_pair(clients_.size(), this_site_);
         }
 
+        std::size_t num_channels() const
+        {
+            using action_type =
+                channel_communicator_server::num_channels_action;
+            return hpx::sync(action_type(), clients_[this_site_]);
+        }
+
     private:
         std::size_t this_site_;
         std::vector<client_type> clients_;
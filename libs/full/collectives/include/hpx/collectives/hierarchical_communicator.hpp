@@ -0,0 +1,374 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hierarchical_communicator.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// A two-level communicator taking the placement of the participating
+    /// sites onto nodes into account
+    ///
+    /// The sites are grouped by the name of the node they run on. The first
+    /// site of every node is the leader of that node. A hierarchical
+    /// communicator consists of a communicator connecting all sites of the
+    /// same node and a communicator connecting the leaders of all nodes.
+    /// The collective operations using a hierarchical communicator combine
+    /// the data on each node first and exchange only one value per node
+    /// between the nodes.
+    ///
+    /// All sites have to invoke the collective operations on a hierarchical
+    /// communicator in the same order, the generation numbers of the
+    /// underlying communicators are managed by the hierarchical
+    /// communicator.
+    class hierarchical_communicator
+    {
+    public:
+        /// The overall number of participating sites
+        std::size_t num_sites() const noexcept;
+
+        /// The sequence number of this site
+        std::size_t this_site() const noexcept;
+
+        /// The number of nodes the sites are placed on
+        std::size_t num_nodes() const noexcept;
+
+        /// The sequence number of the node this site is placed on
+        std::size_t node() const noexcept;
+
+        /// The number of sites placed on the same node as this site
+        std::size_t num_local_sites() const noexcept;
+
+        /// The sequence number of this site among the sites placed on the
+        /// same node
+        std::size_t local_site() const noexcept;
+
+        /// Return whether this site is the leader of its node
+        bool is_leader() const noexcept;
+
+        /// The communicator connecting all sites of this node
+        communicator const& node_communicator() const noexcept;
+
+        /// The communicator connecting the leaders of all nodes (valid on
+        /// leaders only)
+        communicator const& leader_communicator() const noexcept;
+    };
+
+    /// Create a new hierarchical communicator
+    ///
+    /// \param basename     The base name identifying the collective operation
+    /// \param num_sites    The number of participating sites (default: all
+    ///                     localities).
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param node_name    The name of the node this site is placed on. This
+    ///                     value is optional and defaults to the host name
+    ///                     returned by hpx::get_locality_name().
+    ///
+    /// \returns    This function returns a future to a new hierarchical
+    ///             communicator.
+    ///
+    hpx::future<hierarchical_communicator> create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        std::string const& node_name = std::string());
+
+    /// AllReduce a value over all sites of a hierarchical communicator
+    ///
+    /// The values are reduced on the leader of every node first, the
+    /// leaders reduce the per-node results, and the leaders broadcast the
+    /// result to the sites of their node.
+    ///
+    /// \returns    This function returns a future holding the result of the
+    ///             reduction.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(
+        hierarchical_communicator const& comm, T&& local_result, F&& op);
+
+    /// Broadcast a value from site zero to all sites of a hierarchical
+    /// communicator. This function has to be invoked on site zero.
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(
+        hierarchical_communicator const& comm, T&& local_result);
+
+    /// Receive the value broadcast from site zero of a hierarchical
+    /// communicator
+    template <typename T>
+    hpx::future<T> broadcast_from(hierarchical_communicator const& comm);
+
+    /// Wait for all sites of a hierarchical communicator
+    ///
+    /// \returns    This function returns a future that becomes ready once
+    ///             all sites have entered the barrier.
+    ///
+    hpx::future<void> barrier(hierarchical_communicator const& comm);
+}}
+// clang-format on
+#else
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/all_reduce.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/broadcast.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/reduce.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    class hierarchical_communicator
+    {
+        struct data
+        {
+            communicator node_comm_;
+            communicator leader_comm_;
+            std::size_t num_sites_ = 0;
+            std::size_t this_site_ = 0;
+            std::size_t num_nodes_ = 0;
+            std::size_t node_ = 0;
+            std::size_t num_local_sites_ = 0;
+            std::size_t local_site_ = 0;
+
+            // generation numbers of the next operation on the communicators
+            std::atomic<std::size_t> node_generation_{1};
+            std::atomic<std::size_t> leader_generation_{1};
+        };
+
+        friend HPX_EXPORT hierarchical_communicator
+        create_hierarchical_communicator(hpx::launch::sync_policy,
+            char const* basename, num_sites_arg num_sites,
+            this_site_arg this_site, std::string const& node_name);
+
+    public:
+        hierarchical_communicator() = default;
+
+        std::size_t num_sites() const noexcept
+        {
+            return data_->num_sites_;
+        }
+        std::size_t this_site() const noexcept
+        {
+            return data_->this_site_;
+        }
+        std::size_t num_nodes() const noexcept
+        {
+            return data_->num_nodes_;
+        }
+        std::size_t node() const noexcept
+        {
+            return data_->node_;
+        }
+        std::size_t num_local_sites() const noexcept
+        {
+            return data_->num_local_sites_;
+        }
+        std::size_t local_site() const noexcept
+        {
+            return data_->local_site_;
+        }
+        bool is_leader() const noexcept
+        {
+            return data_->local_site_ == 0;
+        }
+
+        communicator const& node_communicator() const noexcept
+        {
+            return data_->node_comm_;
+        }
+        communicator const& leader_communicator() const noexcept
+        {
+            return data_->leader_comm_;
+        }
+
+        explicit operator bool() const noexcept
+        {
+            return !!data_;
+        }
+
+        // Reserve the given number of consecutive generations on the node
+        // and the leader communicators, returns the first reserved ones.
+        std::pair<std::size_t, std::size_t> reserve_generations(
+            std::size_t node_count, std::size_t leader_count) const noexcept
+        {
+            return std::make_pair(data_->node_generation_ += node_count,
+                data_->leader_generation_ += leader_count);
+        }
+
+    private:
+        std::shared_ptr<data> data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    HPX_EXPORT hpx::future<hierarchical_communicator>
+    create_hierarchical_communicator(char const* basename,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        std::string const& node_name = std::string());
+
+    HPX_EXPORT hierarchical_communicator create_hierarchical_communicator(
+        hpx::launch::sync_policy, char const* basename,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        std::string const& node_name = std::string());
+
+    ///////////////////////////////////////////////////////////////////////////
+    // two-level all_reduce
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(
+        hierarchical_communicator const& comm, T&& local_result, F&& op)
+    {
+        using arg_type = std::decay_t<T>;
+
+        // reduce and broadcast on the node, all_reduce among the leaders
+        auto [node_last, leader_last] = comm.reserve_generations(2, 1);
+        std::size_t const node_generation = node_last - 2;
+        std::size_t const leader_generation = leader_last - 1;
+
+        return hpx::async([comm, value = arg_type(HPX_FORWARD(T, local_result)),
+                              op = HPX_FORWARD(F, op), node_generation,
+                              leader_generation]() mutable -> arg_type {
+            communicator const& node = comm.node_communicator();
+            this_site_arg const local_site(comm.local_site());
+
+            if (!comm.is_leader())
+            {
+                reduce_there(node, HPX_MOVE(value), local_site,
+                    generation_arg(node_generation))
+                    .get();
+                return broadcast_from<arg_type>(
+                    node, local_site, generation_arg(node_generation + 1))
+                    .get();
+            }
+
+            bool const has_local_sites = comm.num_local_sites() > 1;
+            if (has_local_sites)
+            {
+                value = reduce_here(node, HPX_MOVE(value), op, local_site,
+                    generation_arg(node_generation))
+                            .get();
+            }
+            if (comm.num_nodes() > 1)
+            {
+                value = all_reduce(comm.leader_communicator(), HPX_MOVE(value),
+                    op, this_site_arg(comm.node()),
+                    generation_arg(leader_generation))
+                            .get();
+            }
+            if (has_local_sites)
+            {
+                broadcast_to(node, value, local_site,
+                    generation_arg(node_generation + 1))
+                    .get();
+            }
+            return value;
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // two-level broadcast
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(
+        hierarchical_communicator const& comm, T&& local_result)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (comm.this_site() != 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::broadcast_to",
+                    "a broadcast on a hierarchical communicator has to be "
+                    "started on site zero"));
+        }
+
+        auto [node_last, leader_last] = comm.reserve_generations(1, 1);
+        std::size_t const node_generation = node_last - 1;
+        std::size_t const leader_generation = leader_last - 1;
+
+        // site zero is the leader of node zero
+        return hpx::async([comm, value = arg_type(HPX_FORWARD(T, local_result)),
+                              node_generation,
+                              leader_generation]() mutable -> arg_type {
+            if (comm.num_nodes() > 1)
+            {
+                broadcast_to(comm.leader_communicator(), value,
+                    this_site_arg(0), generation_arg(leader_generation))
+                    .get();
+            }
+            if (comm.num_local_sites() > 1)
+            {
+                broadcast_to(comm.node_communicator(), value, this_site_arg(0),
+                    generation_arg(node_generation))
+                    .get();
+            }
+            return value;
+        });
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from(hierarchical_communicator const& comm)
+    {
+        auto [node_last, leader_last] = comm.reserve_generations(1, 1);
+        std::size_t const node_generation = node_last - 1;
+        std::size_t const leader_generation = leader_last - 1;
+
+        return hpx::async(
+            [comm, node_generation, leader_generation]() mutable -> T {
+                communicator const& node = comm.node_communicator();
+                if (!comm.is_leader())
+                {
+                    return broadcast_from<T>(node,
+                        this_site_arg(comm.local_site()),
+                        generation_arg(node_generation))
+                        .get();
+                }
+
+                T value = broadcast_from<T>(comm.leader_communicator(),
+                    this_site_arg(comm.node()),
+                    generation_arg(leader_generation))
+                              .get();
+                if (comm.num_local_sites() > 1)
+                {
+                    broadcast_to(node, value, this_site_arg(0),
+                        generation_arg(node_generation))
+                        .get();
+                }
+                return value;
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // two-level barrier
+    HPX_EXPORT hpx::future<void> barrier(hierarchical_communicator const& comm);
+
+    inline void barrier(
+        hpx::launch::sync_policy, hierarchical_communicator const& comm)
+    {
+        barrier(comm).get();
+    }
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
@@ -0,0 +1,559 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file pipelined_all_reduce.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// The algorithms available for reducing vectors using a
+    /// channel_communicator
+    enum class all_reduce_algorithm
+    {
+        /// select the algorithm based on the number of sites and the size
+        /// of the data (see \a select_all_reduce_algorithm)
+        automatic,
+
+        /// exchange the full vectors in log(p) steps, best for small vectors
+        recursive_doubling,
+
+        /// reduce-scatter by recursive halving followed by an all-gather by
+        /// recursive doubling, best for medium sized vectors
+        recursive_halving,
+
+        /// reduce-scatter followed by an all-gather along a ring of all sites,
+        /// the data is split into segments which are pipelined through the
+        /// ring, best for large vectors
+        ring
+    };
+
+    /// Return the name of the given all_reduce algorithm
+    char const* get_all_reduce_algorithm_name(
+        all_reduce_algorithm algorithm) noexcept;
+
+    /// Return the algorithm used by all_reduce for the given number of
+    /// participating sites and the given size of the data (in bytes)
+    all_reduce_algorithm select_all_reduce_algorithm(
+        std::size_t num_sites, std::size_t num_bytes) noexcept;
+
+    /// AllReduce a vector of values from all participating sites
+    ///
+    /// This function reduces the vectors provided by all sites of the given
+    /// channel communicator element-wise, every site receives the result.
+    /// In contrast to the all_reduce operation based on a \a communicator,
+    /// the data is not collected on a single root site. All sites exchange
+    /// (parts of) their data directly with each other, which keeps the
+    /// amount of data sent by each site (almost) independent of the number
+    /// of sites.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The vector to reduce, all sites have to supply
+    ///                     vectors of the same size.
+    /// \param  op          Reduction operation to apply element-wise. The
+    ///                     operation has to be associative and commutative.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. This is required only if
+    ///                     several operations on the same communicator are
+    ///                     in flight at the same time.
+    /// \param  algorithm   The algorithm to use (default: automatic). All sites
+    ///                     have to use the same algorithm.
+    /// \param  algorithm_used If not nullptr, this will receive the algorithm
+    ///                     that is used for the operation.
+    ///
+    /// \returns    This function returns a future holding the reduced vector.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> all_reduce(channel_communicator comm,
+        std::vector<T> local_result, F&& op,
+        generation_arg generation = generation_arg(),
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic,
+        all_reduce_algorithm* algorithm_used = nullptr);
+}}
+// clang-format on
+#else
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    enum class all_reduce_algorithm : std::uint8_t
+    {
+        automatic = 0,
+        recursive_doubling = 1,
+        recursive_halving = 2,
+        ring = 3
+    };
+
+    HPX_EXPORT char const* get_all_reduce_algorithm_name(
+        all_reduce_algorithm algorithm) noexcept;
+
+    HPX_EXPORT all_reduce_algorithm select_all_reduce_algorithm(
+        std::size_t num_sites, std::size_t num_bytes) noexcept;
+
+    // The number of bytes sent as one message by the ring algorithm
+    inline constexpr std::size_t all_reduce_segment_size = 64 * 1024;
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Every message of an all_reduce operation uses its own tag, derived
+        // from the generation, the step of the algorithm, and the segment.
+        constexpr std::size_t all_reduce_tag(std::size_t generation,
+            std::size_t step, std::size_t segment = 0,
+            std::size_t num_segments = 1) noexcept
+        {
+            return (generation << 32) + step * num_segments + segment;
+        }
+
+        template <typename T, typename F>
+        class pipelined_all_reduce
+        {
+        public:
+            pipelined_all_reduce(channel_communicator comm,
+                std::vector<T>& data, F& op, std::size_t generation)
+              : comm_(HPX_MOVE(comm))
+              , data_(data)
+              , op_(op)
+              , generation_(generation)
+            {
+                auto [num_sites, this_site] = comm_.get_info();
+                num_sites_ = num_sites;
+                this_site_ = this_site;
+            }
+
+            void recursive_doubling()
+            {
+                std::vector<hpx::future<void>> sends;
+
+                std::size_t const rank = fold(sends);
+                if (rank != npos)
+                {
+                    std::size_t step = 1;
+                    for (std::size_t d = 1; d < pow2_; d <<= 1, ++step)
+                    {
+                        std::size_t const partner = rank ^ d;
+                        exchange(sends, site_of(partner), step, 0,
+                            data_.size(), 0, data_.size(), partner < rank);
+                    }
+                }
+                unfold(sends, steps_unfold);
+
+                wait(sends);
+            }
+
+            void recursive_halving()
+            {
+                std::vector<hpx::future<void>> sends;
+
+                std::size_t const rank = fold(sends);
+                if (rank != npos)
+                {
+                    // reduce-scatter: every step halves the range of blocks
+                    // this site is responsible for
+                    std::vector<std::pair<std::size_t, std::size_t>> ranges;
+
+                    std::size_t first = 0;
+                    std::size_t last = pow2_;
+                    std::size_t step = 1;
+                    for (std::size_t d = pow2_ / 2; d != 0; d >>= 1, ++step)
+                    {
+                        std::size_t const partner = rank ^ d;
+                        std::size_t const mid = first + (last - first) / 2;
+
+                        ranges.emplace_back(first, last);
+
+                        std::size_t send_first = mid, send_last = last;
+                        if (rank & d)
+                        {
+                            send_first = first;
+                            send_last = mid;
+                            first = mid;
+                        }
+                        else
+                        {
+                            last = mid;
+                        }
+
+                        exchange(sends, site_of(partner), step,
+                            block_offset(send_first), block_offset(send_last),
+                            block_offset(first), block_offset(last),
+                            partner < rank);
+                    }
+
+                    // all-gather: every step doubles the range of blocks
+                    for (std::size_t d = 1; d < pow2_; d <<= 1, ++step)
+                    {
+                        std::size_t const partner = rank ^ d;
+
+                        auto const [parent_first, parent_last] =
+                            ranges.back();
+                        ranges.pop_back();
+
+                        std::size_t recv_first = parent_first;
+                        std::size_t recv_last = first;
+                        if (first == parent_first)
+                        {
+                            recv_first = last;
+                            recv_last = parent_last;
+                        }
+
+                        copy_exchange(sends, site_of(partner), step,
+                            block_offset(first), block_offset(last),
+                            block_offset(recv_first), block_offset(recv_last));
+
+                        first = parent_first;
+                        last = parent_last;
+                    }
+                }
+                unfold(sends, steps_unfold);
+
+                wait(sends);
+            }
+
+            void ring()
+            {
+                std::size_t const max_chunk =
+                    (data_.size() + num_sites_ - 1) / num_sites_;
+                std::size_t const segment =
+                    (std::max)(all_reduce_segment_size / sizeof(T),
+                        static_cast<std::size_t>(1));
+                std::size_t const num_segments =
+                    (std::max)((max_chunk + segment - 1) / segment,
+                        static_cast<std::size_t>(1));
+
+                // the segments are independent of each other, every segment
+                // is pipelined through the ring by its own task
+                std::vector<hpx::future<void>> segments;
+                segments.reserve(num_segments);
+                for (std::size_t k = 0; k != num_segments; ++k)
+                {
+                    segments.push_back(hpx::async(
+                        [this, k, segment, num_segments]() {
+                            ring_segment(k, segment, num_segments);
+                        }));
+                }
+
+                wait(segments);
+            }
+
+        private:
+            static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+            static constexpr std::size_t steps_unfold = 0xffff;
+
+            void ring_segment(std::size_t k, std::size_t segment,
+                std::size_t num_segments)
+            {
+                std::vector<hpx::future<void>> sends;
+
+                std::size_t const p = num_sites_;
+                std::size_t const right = (this_site_ + 1) % p;
+                std::size_t const left = (this_site_ + p - 1) % p;
+
+                auto segment_range = [&](std::size_t chunk) {
+                    std::size_t const chunk_first = chunk * data_.size() / p;
+                    std::size_t const chunk_last =
+                        (chunk + 1) * data_.size() / p;
+                    std::size_t const first =
+                        (std::min)(chunk_first + k * segment, chunk_last);
+                    return std::make_pair(
+                        first, (std::min)(first + segment, chunk_last));
+                };
+
+                // reduce-scatter: after p - 1 steps this site holds the
+                // fully reduced segment of chunk (this_site + 1) % p
+                std::size_t step = 0;
+                for (std::size_t s = 0; s != p - 1; ++s, ++step)
+                {
+                    auto const [send_first, send_last] =
+                        segment_range((this_site_ + p - s) % p);
+                    auto const [recv_first, recv_last] =
+                        segment_range((this_site_ + 2 * p - s - 1) % p);
+
+                    // empty segments are not sent
+                    std::size_t const tag =
+                        all_reduce_tag(generation_, step, k, num_segments);
+                    if (send_first != send_last)
+                    {
+                        send(sends, right, tag, send_first, send_last);
+                    }
+                    if (recv_first != recv_last)
+                    {
+                        combine(receive(left, tag), recv_first, recv_last,
+                            true);
+                    }
+                }
+
+                // all-gather: pass the reduced segments along the ring
+                for (std::size_t s = 0; s != p - 1; ++s, ++step)
+                {
+                    auto const [send_first, send_last] =
+                        segment_range((this_site_ + 1 + p - s) % p);
+                    auto const [recv_first, recv_last] =
+                        segment_range((this_site_ + p - s) % p);
+
+                    std::size_t const tag =
+                        all_reduce_tag(generation_, step, k, num_segments);
+                    if (send_first != send_last)
+                    {
+                        send(sends, right, tag, send_first, send_last);
+                    }
+                    if (recv_first != recv_last)
+                    {
+                        std::vector<T> const recv = receive(left, tag);
+                        std::copy(recv.begin(), recv.end(),
+                            data_.begin() + recv_first);
+                    }
+                }
+
+                wait(sends);
+            }
+
+            // Sites beyond the largest power of two send their data to a
+            // neighbor, which makes the remaining number of sites a power of
+            // two. Returns the rank of this site among the remaining sites.
+            std::size_t fold(std::vector<hpx::future<void>>& sends)
+            {
+                pow2_ = 1;
+                while (pow2_ * 2 <= num_sites_)
+                {
+                    pow2_ *= 2;
+                }
+                rem_ = num_sites_ - pow2_;
+
+                if (this_site_ >= 2 * rem_)
+                {
+                    return this_site_ - rem_;
+                }
+
+                std::size_t const tag = all_reduce_tag(generation_, 0);
+                if (this_site_ % 2 == 0)
+                {
+                    send(sends, this_site_ + 1, tag, 0, data_.size());
+                    return npos;
+                }
+
+                combine(receive(this_site_ - 1, tag), 0, data_.size(), true);
+                return this_site_ / 2;
+            }
+
+            void unfold(
+                std::vector<hpx::future<void>>& sends, std::size_t step)
+            {
+                if (this_site_ >= 2 * rem_)
+                {
+                    return;
+                }
+
+                std::size_t const tag = all_reduce_tag(generation_, step);
+                if (this_site_ % 2 == 0)
+                {
+                    data_ = receive(this_site_ + 1, tag);
+                }
+                else
+                {
+                    send(sends, this_site_ - 1, tag, 0, data_.size());
+                }
+            }
+
+            // map the rank among the remaining sites to the site number
+            std::size_t site_of(std::size_t rank) const noexcept
+            {
+                return rank < rem_ ? 2 * rank + 1 : rank + rem_;
+            }
+
+            std::size_t block_offset(std::size_t block) const noexcept
+            {
+                return block * data_.size() / pow2_;
+            }
+
+            // send [send_first, send_last) to the partner, combine the
+            // received data with [recv_first, recv_last)
+            void exchange(std::vector<hpx::future<void>>& sends,
+                std::size_t partner, std::size_t step, std::size_t send_first,
+                std::size_t send_last, std::size_t recv_first,
+                std::size_t recv_last, bool partner_first)
+            {
+                std::size_t const tag = all_reduce_tag(generation_, step);
+                send(sends, partner, tag, send_first, send_last);
+                combine(receive(partner, tag), recv_first, recv_last,
+                    partner_first);
+            }
+
+            // send [send_first, send_last) to the partner, store the received
+            // data in [recv_first, recv_last)
+            void copy_exchange(std::vector<hpx::future<void>>& sends,
+                std::size_t partner, std::size_t step, std::size_t send_first,
+                std::size_t send_last, std::size_t recv_first,
+                [[maybe_unused]] std::size_t recv_last)
+            {
+                std::size_t const tag = all_reduce_tag(generation_, step);
+                send(sends, partner, tag, send_first, send_last);
+
+                std::vector<T> const recv = receive(partner, tag);
+                HPX_ASSERT(recv.size() == recv_last - recv_first);
+                std::copy(
+                    recv.begin(), recv.end(), data_.begin() + recv_first);
+            }
+
+            void send(std::vector<hpx::future<void>>& sends, std::size_t site,
+                std::size_t tag, std::size_t first, std::size_t last)
+            {
+                sends.push_back(set(comm_, that_site_arg(site),
+                    std::vector<T>(
+                        data_.begin() + first, data_.begin() + last),
+                    tag_arg(tag)));
+            }
+
+            std::vector<T> receive(std::size_t site, std::size_t tag)
+            {
+                return get<std::vector<T>>(hpx::launch::sync, comm_,
+                    that_site_arg(site), tag_arg(tag));
+            }
+
+            // Combine the received data with the local data. The data of the
+            // site with the lower rank is always passed as the first argument
+            // which ensures that all sites compute the same result.
+            void combine(std::vector<T> const& recv, std::size_t first,
+                [[maybe_unused]] std::size_t last, bool recv_first)
+            {
+                HPX_ASSERT(recv.size() == last - first);
+
+                auto it = data_.begin() + first;
+                for (T const& value : recv)
+                {
+                    *it = recv_first ? op_(value, *it) : op_(*it, value);
+                    ++it;
+                }
+            }
+
+            static void wait(std::vector<hpx::future<void>>& futures)
+            {
+                hpx::wait_all(futures);
+                for (auto& f : futures)
+                {
+                    f.get();    // rethrow exceptions
+                }
+            }
+
+            channel_communicator comm_;
+            std::vector<T>& data_;
+            F& op_;
+            std::size_t generation_;
+            std::size_t num_sites_ = 0;
+            std::size_t this_site_ = 0;
+            std::size_t pow2_ = 1;
+            std::size_t rem_ = 0;
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // all_reduce vectors using a channel communicator
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> all_reduce(channel_communicator comm,
+        std::vector<T> local_result, F&& op,
+        generation_arg generation = generation_arg(),
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic,
+        all_reduce_algorithm* algorithm_used = nullptr)
+    {
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<T>>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::all_reduce",
+                    "the generation number shouldn't be zero"));
+        }
+
+        // the generation is optional for operations which are not executed
+        // concurrently on the same communicator
+        std::size_t const gen =
+            generation == static_cast<std::size_t>(-1) ? 1 : generation;
+
+        std::size_t const num_sites = comm.get_info().first;
+        if (algorithm == all_reduce_algorithm::automatic)
+        {
+            algorithm = select_all_reduce_algorithm(
+                num_sites, local_result.size() * sizeof(T));
+        }
+        if (algorithm_used != nullptr)
+        {
+            *algorithm_used = algorithm;
+        }
+
+        if (num_sites == 1)
+        {
+            return hpx::make_ready_future(HPX_MOVE(local_result));
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              data = HPX_MOVE(local_result),
+                              op = HPX_FORWARD(F, op), gen,
+                              algorithm]() mutable -> std::vector<T> {
+            detail::pipelined_all_reduce<T, std::decay_t<F>> impl(
+                HPX_MOVE(comm), data, op, gen);
+
+            switch (algorithm)
+            {
+            case all_reduce_algorithm::recursive_doubling:
+                impl.recursive_doubling();
+                break;
+
+            case all_reduce_algorithm::recursive_halving:
+                impl.recursive_halving();
+                break;
+
+            case all_reduce_algorithm::ring:
+                impl.ring();
+                break;
+
+            default:
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "hpx::collectives::all_reduce",
+                    "unknown all_reduce algorithm: {}",
+                    static_cast<int>(algorithm));
+            }
+            return HPX_MOVE(data);
+        });
+    }
+
+    template <typename T, typename F>
+    std::vector<T> all_reduce(hpx::launch::sync_policy,
+        channel_communicator comm, std::vector<T> local_result, F&& op,
+        generation_arg generation = generation_arg(),
+        all_reduce_algorithm algorithm = all_reduce_algorithm::automatic,
+        all_reduce_algorithm* algorithm_used = nullptr)
+    {
+        return all_reduce(HPX_MOVE(comm), HPX_MOVE(local_result),
+            HPX_FORWARD(F, op), generation, algorithm, algorithm_used)
+            .get();
+    }
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
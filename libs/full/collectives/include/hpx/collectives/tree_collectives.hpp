@@ -0,0 +1,846 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file tree_collectives.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(DOXYGEN)
+// clang-format off
+namespace hpx { namespace collectives {
+
+    /// Broadcast a value to all sites of a channel communicator
+    ///
+    /// This function sends the given value from this (root) site to all
+    /// other sites of the given channel communicator. The value is
+    /// forwarded along a k-nomial tree rooted at this site (a binomial tree
+    /// for the default arity of two), every site sends the value to at most
+    /// (arity - 1) * log_arity(num_sites) other sites.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to send to all sites.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the operation performed on the given
+    ///                     communicator. This is required only if several
+    ///                     operations on the same communicator are in flight
+    ///                     at the same time.
+    /// \param  arity       The arity of the tree used to forward the data
+    ///                     (default: 2). All sites have to use the same arity.
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent.
+    ///
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(channel_communicator comm,
+        T&& local_result, generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg());
+
+    /// Receive a value that was broadcast to all sites of a channel
+    /// communicator
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  root_site   The site that called \a broadcast_to.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the operation performed on the given
+    ///                     communicator.
+    /// \param  arity       The arity of the tree used to forward the data.
+    ///
+    /// \returns    This function returns a future holding the value that was
+    ///             sent by the root site.
+    ///
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg());
+
+    /// Scatter the given values to all sites of a channel communicator
+    ///
+    /// The element of \a local_result with the index of a site is delivered
+    /// to that site. Every site forwards the elements destined for its
+    /// subtree to its children in the k-nomial tree rooted at this site.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result One value for each of the sites.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the operation performed on the given
+    ///                     communicator.
+    /// \param  arity       The arity of the tree used to forward the data.
+    ///
+    /// \returns    This function returns a future holding the value destined
+    ///             for this site.
+    ///
+    template <typename T>
+    hpx::future<T> scatter_to(channel_communicator comm,
+        std::vector<T>&& local_result,
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg());
+
+    /// Receive the value scattered to this site of a channel communicator
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  root_site   The site that called \a scatter_to.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the operation performed on the given
+    ///                     communicator.
+    /// \param  arity       The arity of the tree used to forward the data.
+    ///
+    /// \returns    This function returns a future holding the value destined
+    ///             for this site.
+    ///
+    template <typename T>
+    hpx::future<T> scatter_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg());
+
+    /// Gather the values of all sites of a channel communicator on this site
+    ///
+    /// Every site of the k-nomial tree rooted at this site collects the
+    /// values of its subtree and sends them to its parent as one message.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value contributed by this site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the operation performed on the given
+    ///                     communicator.
+    /// \param  arity       The arity of the tree used to collect the data.
+    ///
+    /// \returns    This function returns a future holding the values of all
+    ///             sites, ordered by site.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        channel_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg());
+
+    /// Contribute a value to a gather operation on a channel communicator
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value contributed by this site.
+    /// \param  root_site   The site that called \a gather_here.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the operation performed on the given
+    ///                     communicator.
+    /// \param  arity       The arity of the tree used to collect the data.
+    ///
+    /// \returns    This function returns a future that becomes ready once
+    ///             the data of this site's subtree was sent.
+    ///
+    template <typename T>
+    hpx::future<void> gather_there(channel_communicator comm,
+        T&& local_result, root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg());
+
+    /// Reduce the vectors of all sites of a channel communicator on this
+    /// site
+    ///
+    /// The vectors are reduced element-wise along the k-nomial tree rooted
+    /// at this site. Large vectors are split into segments (see
+    /// \a all_reduce_segment_size) which are reduced independently of each
+    /// other, this pipelines the transfer of one segment with the reduction
+    /// of the other segments.
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The vector contributed by this site, all sites
+    ///                     have to supply vectors of the same size.
+    /// \param  op          Reduction operation to apply element-wise. The
+    ///                     operation has to be associative, the values are
+    ///                     combined in the order of the sites.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the operation performed on the given
+    ///                     communicator.
+    /// \param  arity       The arity of the tree used to reduce the data.
+    ///
+    /// \returns    This function returns a future holding the reduced vector.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_here(channel_communicator comm,
+        std::vector<T> local_result, F&& op,
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg());
+
+    /// Contribute a vector to a reduce operation on a channel communicator
+    ///
+    /// \param  comm        A communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The vector contributed by this site.
+    /// \param  op          Reduction operation to apply element-wise.
+    /// \param  root_site   The site that called \a reduce_here.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the operation performed on the given
+    ///                     communicator.
+    /// \param  arity       The arity of the tree used to reduce the data.
+    ///
+    /// \returns    This function returns a future that becomes ready once
+    ///             the partial result of this site's subtree was sent.
+    ///
+    template <typename T, typename F>
+    hpx::future<void> reduce_there(channel_communicator comm,
+        std::vector<T> local_result, F&& op,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg());
+}}
+// clang-format on
+#else
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/pipelined_all_reduce.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // Every message of a tree based operation uses a tag derived from the
+        // generation and the segment of the data it carries.
+        constexpr std::size_t tree_tag(
+            std::size_t generation, std::size_t segment = 0) noexcept
+        {
+            return (generation << 32) + segment;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // A k-nomial tree spanning all sites of a communicator. The sites are
+        // ranked relative to the root, the parent of a rank is found by
+        // clearing its lowest non-zero digit (in base 'arity'). Every rank
+        // is the root of a contiguous range of ranks, its children are
+        // visited in the order of their ranks.
+        /*
+            arity 2:         0
+                           / | \
+                          1  2  4
+                             |  | \
+                             3  5  6
+                                   |
+                                   7
+        */
+        class knomial_tree
+        {
+        public:
+            knomial_tree(std::size_t num_sites, std::size_t this_site,
+                std::size_t root, std::size_t arity) noexcept
+              : num_sites_(num_sites)
+              , root_(root)
+              , arity_(arity)
+              , rank_((this_site + num_sites - root) % num_sites)
+            {
+                while (
+                    extent_ < num_sites_ && rank_ % (extent_ * arity_) == 0)
+                {
+                    extent_ *= arity_;
+                }
+            }
+
+            bool is_root() const noexcept
+            {
+                return rank_ == 0;
+            }
+
+            std::size_t rank() const noexcept
+            {
+                return rank_;
+            }
+
+            std::size_t parent() const noexcept
+            {
+                HPX_ASSERT(!is_root());
+                return site_of(rank_ - rank_ % (extent_ * arity_));
+            }
+
+            // the number of ranks in the subtree rooted at this rank
+            std::size_t subtree_size() const noexcept
+            {
+                return subtree_size(rank_, is_root() ? num_sites_ : extent_);
+            }
+
+            // invoke f(child_rank, child_subtree_size) for all children in
+            // ascending order of their rank
+            template <typename F>
+            void for_each_child(F&& f) const
+            {
+                for (std::size_t m = 1; m < extent_ && m < num_sites_;
+                     m *= arity_)
+                {
+                    for (std::size_t d = 1; d != arity_; ++d)
+                    {
+                        std::size_t const child = rank_ + d * m;
+                        if (child >= num_sites_)
+                        {
+                            return;
+                        }
+                        f(child, subtree_size(child, m));
+                    }
+                }
+            }
+
+            std::size_t site_of(std::size_t rank) const noexcept
+            {
+                return (rank + root_) % num_sites_;
+            }
+
+            // the ranks starting here belong to the sites before the root
+            std::size_t first_wrapped_rank() const noexcept
+            {
+                return num_sites_ - root_;
+            }
+
+        private:
+            std::size_t subtree_size(
+                std::size_t rank, std::size_t extent) const noexcept
+            {
+                return (std::min)(rank + extent, num_sites_) - rank;
+            }
+
+            std::size_t num_sites_;
+            std::size_t root_;
+            std::size_t arity_;
+            std::size_t rank_;
+            std::size_t extent_ = 1;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        inline void wait_for_sends(std::vector<hpx::future<void>>& sends)
+        {
+            hpx::wait_all(sends);
+            for (auto& f : sends)
+            {
+                f.get();    // rethrow exceptions
+            }
+        }
+
+        template <typename T>
+        T tree_broadcast(channel_communicator const& comm,
+            knomial_tree const& tree, std::size_t tag, T value)
+        {
+            if (!tree.is_root())
+            {
+                value = get<T>(hpx::launch::sync, comm,
+                    that_site_arg(tree.parent()), tag_arg(tag));
+            }
+
+            // the children with the largest subtrees are served first
+            std::vector<std::size_t> children;
+            tree.for_each_child([&](std::size_t child, std::size_t) {
+                children.push_back(child);
+            });
+
+            std::vector<hpx::future<void>> sends;
+            sends.reserve(children.size());
+            for (auto it = children.rbegin(); it != children.rend(); ++it)
+            {
+                sends.push_back(set(comm, that_site_arg(tree.site_of(*it)),
+                    value, tag_arg(tag)));
+            }
+            wait_for_sends(sends);
+
+            return value;
+        }
+
+        // The data holds the values destined for the subtree of this site,
+        // ordered by rank.
+        template <typename T>
+        T tree_scatter(channel_communicator const& comm,
+            knomial_tree const& tree, std::size_t tag, std::vector<T> data)
+        {
+            if (!tree.is_root())
+            {
+                data = get<std::vector<T>>(hpx::launch::sync, comm,
+                    that_site_arg(tree.parent()), tag_arg(tag));
+            }
+            HPX_ASSERT(data.size() == tree.subtree_size());
+
+            std::vector<std::pair<std::size_t, std::size_t>> children;
+            tree.for_each_child([&](std::size_t child, std::size_t size) {
+                children.emplace_back(child, size);
+            });
+
+            std::vector<hpx::future<void>> sends;
+            sends.reserve(children.size());
+            for (auto it = children.rbegin(); it != children.rend(); ++it)
+            {
+                auto const first = data.begin() + (it->first - tree.rank());
+                sends.push_back(set(comm,
+                    that_site_arg(tree.site_of(it->first)),
+                    std::vector<T>(first, first + it->second), tag_arg(tag)));
+            }
+            wait_for_sends(sends);
+
+            return HPX_MOVE(data[0]);
+        }
+
+        // Returns the values of the subtree of this site, ordered by rank.
+        template <typename T>
+        std::vector<T> tree_gather(channel_communicator const& comm,
+            knomial_tree const& tree, std::size_t tag, T value)
+        {
+            std::vector<hpx::future<std::vector<T>>> received;
+            tree.for_each_child([&](std::size_t child, std::size_t) {
+                received.push_back(get<std::vector<T>>(
+                    comm, that_site_arg(tree.site_of(child)), tag_arg(tag)));
+            });
+
+            std::vector<T> data;
+            data.reserve(tree.subtree_size());
+            data.push_back(HPX_MOVE(value));
+            for (auto& f : received)
+            {
+                std::vector<T> values = f.get();
+                std::move(
+                    values.begin(), values.end(), std::back_inserter(data));
+            }
+            HPX_ASSERT(data.size() == tree.subtree_size());
+
+            if (!tree.is_root())
+            {
+                set(hpx::launch::sync, comm, that_site_arg(tree.parent()),
+                    HPX_MOVE(data), tag_arg(tag));
+                return {};
+            }
+            return data;
+        }
+
+        // Reduce the elements [first, last) of the data in the order of the
+        // sites. The ranks of a subtree are contiguous, but the ranks from
+        // first_wrapped_rank() on belong to the sites before the root. The
+        // partial results of these (wrapped) ranks are combined separately
+        // and are sent after the partial result of the other ranks of the
+        // subtree, the root finally puts them in front.
+        template <typename T, typename F>
+        void tree_reduce_segment(channel_communicator const& comm,
+            knomial_tree const& tree, std::size_t tag, std::vector<T>& data,
+            F& op, std::size_t first, std::size_t last)
+        {
+            std::vector<std::pair<std::size_t, std::size_t>> children;
+            std::vector<hpx::future<std::vector<T>>> received;
+            tree.for_each_child([&](std::size_t child, std::size_t size) {
+                children.emplace_back(child, size);
+                received.push_back(get<std::vector<T>>(
+                    comm, that_site_arg(tree.site_of(child)), tag_arg(tag)));
+            });
+
+            auto const combine = [&op](auto dest, auto src, auto src_last) {
+                for (/**/; src != src_last; ++src, ++dest)
+                {
+                    *dest = op(*dest, *src);
+                }
+            };
+
+            std::size_t const count = last - first;
+            std::size_t const wrapped = tree.first_wrapped_rank();
+
+            // the partial result of the wrapped ranks of the children, used
+            // only if the rank of this site isn't wrapped itself
+            bool has_wrapped = false;
+            std::vector<T> wrapped_data;
+
+            for (std::size_t i = 0; i != received.size(); ++i)
+            {
+                std::vector<T> values = received[i].get();
+                std::size_t const child = children[i].first;
+                HPX_ASSERT(values.size() ==
+                    (child < wrapped && child + children[i].second > wrapped ?
+                            2 * count :
+                            count));
+
+                auto it = values.begin();
+                if (child < wrapped || tree.rank() >= wrapped)
+                {
+                    combine(data.begin() + first, it, it + count);
+                    it += count;
+                }
+
+                if (it == values.end())
+                {
+                    continue;
+                }
+
+                if (!has_wrapped)
+                {
+                    wrapped_data.assign(std::make_move_iterator(it),
+                        std::make_move_iterator(values.end()));
+                    has_wrapped = true;
+                }
+                else
+                {
+                    combine(wrapped_data.begin(), it, values.end());
+                }
+            }
+
+            if (!tree.is_root())
+            {
+                std::vector<T> values(
+                    data.begin() + first, data.begin() + last);
+                std::move(wrapped_data.begin(), wrapped_data.end(),
+                    std::back_inserter(values));
+
+                set(hpx::launch::sync, comm, that_site_arg(tree.parent()),
+                    HPX_MOVE(values), tag_arg(tag));
+            }
+            else if (has_wrapped)
+            {
+                auto it = data.begin() + first;
+                for (T& value : wrapped_data)
+                {
+                    *it = op(HPX_MOVE(value), *it);
+                    ++it;
+                }
+            }
+        }
+
+        template <typename T, typename F>
+        void tree_reduce(channel_communicator const& comm,
+            knomial_tree const& tree, std::size_t generation,
+            std::vector<T>& data, F& op)
+        {
+            std::size_t const segment =
+                (std::max)(all_reduce_segment_size / sizeof(T),
+                    static_cast<std::size_t>(1));
+            std::size_t const num_segments =
+                (data.size() + segment - 1) / segment;
+
+            if (num_segments <= 1)
+            {
+                tree_reduce_segment(comm, tree, tree_tag(generation), data, op,
+                    0, data.size());
+                return;
+            }
+
+            // the segments are independent of each other, every segment is
+            // reduced along the tree by its own task
+            std::vector<hpx::future<void>> segments;
+            segments.reserve(num_segments);
+            for (std::size_t k = 0; k != num_segments; ++k)
+            {
+                std::size_t const first = k * segment;
+                std::size_t const last =
+                    (std::min)(first + segment, data.size());
+                segments.push_back(hpx::async([&, k, first, last]() {
+                    tree_reduce_segment(comm, tree, tree_tag(generation, k),
+                        data, op, first, last);
+                }));
+            }
+            wait_for_sends(segments);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Verify the arguments common to all tree based operations, return
+        // an empty string if they are valid.
+        inline char const* check_tree_arguments(
+            channel_communicator const& comm, std::size_t root_site,
+            generation_arg generation, arity_arg arity) noexcept
+        {
+            if (generation == 0)
+            {
+                return "the generation number shouldn't be zero";
+            }
+            if (arity != static_cast<std::size_t>(-1) && arity < 2)
+            {
+                return "the arity of the tree must be at least two";
+            }
+            if (root_site >= comm.get_info().first)
+            {
+                return "the root site must be smaller than the number of "
+                       "sites";
+            }
+            return "";
+        }
+
+        // the generation is optional for operations which are not executed
+        // concurrently on the same communicator
+        constexpr std::size_t tree_generation(
+            generation_arg generation) noexcept
+        {
+            return generation == static_cast<std::size_t>(-1) ? 1 : generation;
+        }
+
+        constexpr std::size_t tree_arity(arity_arg arity) noexcept
+        {
+            return arity == static_cast<std::size_t>(-1) ? 2 : arity;
+        }
+
+        inline knomial_tree make_tree(channel_communicator const& comm,
+            std::size_t root_site, arity_arg arity) noexcept
+        {
+            auto [num_sites, this_site] = comm.get_info();
+            return knomial_tree(
+                num_sites, this_site, root_site, tree_arity(arity));
+        }
+
+        template <typename T>
+        hpx::future<T> make_tree_error(
+            char const* function, char const* error)
+        {
+            return hpx::make_exceptional_future<T>(
+                HPX_GET_EXCEPTION(hpx::error::bad_parameter, function, error));
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // broadcast using a channel communicator
+    template <typename T>
+    hpx::future<std::decay_t<T>> broadcast_to(channel_communicator comm,
+        T&& local_result, generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg())
+    {
+        using value_type = std::decay_t<T>;
+
+        std::size_t const this_site = comm.get_info().second;
+        if (char const* error = detail::check_tree_arguments(
+                comm, this_site, generation, arity);
+            *error)
+        {
+            return detail::make_tree_error<value_type>(
+                "hpx::collectives::broadcast_to", error);
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              value = value_type(HPX_FORWARD(T, local_result)),
+                              tag = detail::tree_tag(
+                                  detail::tree_generation(generation)),
+                              this_site, arity]() mutable -> value_type {
+            return detail::tree_broadcast(comm,
+                detail::make_tree(comm, this_site, arity), tag,
+                HPX_MOVE(value));
+        });
+    }
+
+    template <typename T>
+    hpx::future<T> broadcast_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg())
+    {
+        if (char const* error = detail::check_tree_arguments(
+                comm, root_site, generation, arity);
+            *error)
+        {
+            return detail::make_tree_error<T>(
+                "hpx::collectives::broadcast_from", error);
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              tag = detail::tree_tag(
+                                  detail::tree_generation(generation)),
+                              root_site, arity]() -> T {
+            return detail::tree_broadcast(comm,
+                detail::make_tree(comm, root_site, arity), tag, T());
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // scatter using a channel communicator
+    template <typename T>
+    hpx::future<T> scatter_to(channel_communicator comm,
+        std::vector<T>&& local_result,
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg())
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        if (char const* error = detail::check_tree_arguments(
+                comm, this_site, generation, arity);
+            *error)
+        {
+            return detail::make_tree_error<T>(
+                "hpx::collectives::scatter_to", error);
+        }
+        if (local_result.size() != num_sites)
+        {
+            return detail::make_tree_error<T>("hpx::collectives::scatter_to",
+                "the number of values to scatter must be equal to the "
+                "number of sites");
+        }
+
+        // order the values by the rank of the sites relative to this site
+        std::rotate(local_result.begin(),
+            local_result.begin() + static_cast<std::size_t>(this_site),
+            local_result.end());
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              data = HPX_MOVE(local_result),
+                              tag = detail::tree_tag(
+                                  detail::tree_generation(generation)),
+                              this_site = static_cast<std::size_t>(this_site),
+                              arity]() mutable -> T {
+            return detail::tree_scatter(comm,
+                detail::make_tree(comm, this_site, arity), tag,
+                HPX_MOVE(data));
+        });
+    }
+
+    template <typename T>
+    hpx::future<T> scatter_from(channel_communicator comm,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg())
+    {
+        if (char const* error = detail::check_tree_arguments(
+                comm, root_site, generation, arity);
+            *error)
+        {
+            return detail::make_tree_error<T>(
+                "hpx::collectives::scatter_from", error);
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              tag = detail::tree_tag(
+                                  detail::tree_generation(generation)),
+                              root_site, arity]() -> T {
+            return detail::tree_scatter(comm,
+                detail::make_tree(comm, root_site, arity), tag,
+                std::vector<T>());
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // gather using a channel communicator
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> gather_here(
+        channel_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg())
+    {
+        using value_type = std::decay_t<T>;
+
+        std::size_t const this_site = comm.get_info().second;
+        if (char const* error = detail::check_tree_arguments(
+                comm, this_site, generation, arity);
+            *error)
+        {
+            return detail::make_tree_error<std::vector<value_type>>(
+                "hpx::collectives::gather_here", error);
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              value = value_type(HPX_FORWARD(T, local_result)),
+                              tag = detail::tree_tag(
+                                  detail::tree_generation(generation)),
+                              this_site,
+                              arity]() mutable -> std::vector<value_type> {
+            std::vector<value_type> data = detail::tree_gather(comm,
+                detail::make_tree(comm, this_site, arity), tag,
+                HPX_MOVE(value));
+
+            // order the values by site instead of by their rank relative to
+            // this site
+            std::rotate(data.begin(),
+                data.begin() + (data.size() - this_site) % data.size(),
+                data.end());
+            return data;
+        });
+    }
+
+    template <typename T>
+    hpx::future<void> gather_there(channel_communicator comm,
+        T&& local_result, root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg())
+    {
+        using value_type = std::decay_t<T>;
+
+        if (char const* error = detail::check_tree_arguments(
+                comm, root_site, generation, arity);
+            *error)
+        {
+            return detail::make_tree_error<void>(
+                "hpx::collectives::gather_there", error);
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              value = value_type(HPX_FORWARD(T, local_result)),
+                              tag = detail::tree_tag(
+                                  detail::tree_generation(generation)),
+                              root_site, arity]() mutable {
+            detail::tree_gather(comm,
+                detail::make_tree(comm, root_site, arity), tag,
+                HPX_MOVE(value));
+        });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // reduce vectors using a channel communicator
+    template <typename T, typename F>
+    hpx::future<std::vector<T>> reduce_here(channel_communicator comm,
+        std::vector<T> local_result, F&& op,
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg())
+    {
+        std::size_t const this_site = comm.get_info().second;
+        if (char const* error = detail::check_tree_arguments(
+                comm, this_site, generation, arity);
+            *error)
+        {
+            return detail::make_tree_error<std::vector<T>>(
+                "hpx::collectives::reduce_here", error);
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              data = HPX_MOVE(local_result),
+                              op = HPX_FORWARD(F, op),
+                              gen = detail::tree_generation(generation),
+                              this_site, arity]() mutable -> std::vector<T> {
+            detail::tree_reduce(comm,
+                detail::make_tree(comm, this_site, arity), gen, data, op);
+            return HPX_MOVE(data);
+        });
+    }
+
+    template <typename T, typename F>
+    hpx::future<void> reduce_there(channel_communicator comm,
+        std::vector<T> local_result, F&& op,
+        root_site_arg root_site = root_site_arg(),
+        generation_arg generation = generation_arg(),
+        arity_arg arity = arity_arg())
+    {
+        if (char const* error = detail::check_tree_arguments(
+                comm, root_site, generation, arity);
+            *error)
+        {
+            return detail::make_tree_error<void>(
+                "hpx::collectives::reduce_there", error);
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              data = HPX_MOVE(local_result),
+                              op = HPX_FORWARD(F, op),
+                              gen = detail::tree_generation(generation),
+                              root_site, arity]() mutable {
+            detail::tree_reduce(comm,
+                detail::make_tree(comm, root_site, arity), gen, data, op);
+        });
+    }
+}    // namespace hpx::collectives
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
+#endif    // DOXYGEN
@@ -9,6 +9,9 @@
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
 
 #include <hpx/collectives/all_reduce.hpp>
+#include <hpx/collectives/pipelined_all_reduce.hpp>
+
+#include <cstddef>
 
 namespace hpx::traits::communication {
 
@@ -21,4 +24,54 @@ namespace hpx::traits::communication {
     }
 }    // namespace hpx::traits::communication
 
+namespace hpx::collectives {
+
+    char const* get_all_reduce_algorithm_name(
+        all_reduce_algorithm algorithm) noexcept
+    {
+        switch (algorithm)
+        {
+        case all_reduce_algorithm::automatic:
+            return "automatic";
+        case all_reduce_algorithm::recursive_doubling:
+            return "recursive_doubling";
+        case all_reduce_algorithm::recursive_halving:
+            return "recursive_halving";
+        case all_reduce_algorithm::ring:
+            return "ring";
+        default:
+            break;
+        }
+        return "unknown";
+    }
+
+    all_reduce_algorithm select_all_reduce_algorithm(
+        std::size_t num_sites, std::size_t num_bytes) noexcept
+    {
+        // Small vectors are dominated by the latency of the log(p) steps,
+        // exchanging the full data in each step is fastest.
+        constexpr std::size_t small_message_size = 16 * 1024;
+
+        // Recursive halving and the ring both send about 2n bytes per site.
+        // Recursive halving needs only 2 log(p) steps, but sites beyond the
+        // largest power of two cause an additional exchange of the full data.
+        // The ring needs 2 (p - 1) steps, which are overlapped by pipelining
+        // the segments of the data.
+        constexpr std::size_t medium_message_size = 512 * 1024;
+
+        if (num_sites <= 2 || num_bytes < small_message_size)
+        {
+            return all_reduce_algorithm::recursive_doubling;
+        }
+
+        bool const is_power_of_two = (num_sites & (num_sites - 1)) == 0;
+        if (num_bytes < medium_message_size ||
+            (is_power_of_two && num_bytes < 2 * medium_message_size))
+        {
+            return all_reduce_algorithm::recursive_halving;
+        }
+        return all_reduce_algorithm::ring;
+    }
+}    // namespace hpx::collectives
+
 #endif
@@ -62,6 +62,11 @@ namespace hpx::collectives {
             num_sites_arg(num_localities), this_site_arg(this_locality));
     }
 
+    std::size_t channel_communicator::num_pending_channels() const
+    {
+        return comm_->num_channels();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<channel_communicator> create_channel_communicator(
         char const* basename, num_sites_arg num_sites, this_site_arg this_site)
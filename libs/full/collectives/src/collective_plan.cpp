@@ -0,0 +1,77 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/collectives/collective_plan.hpp>
+
+#include <algorithm>
+#include <cstddef>
+
+namespace hpx::collectives::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    recursive_doubling_schedule::recursive_doubling_schedule(
+        std::size_t num_sites, std::size_t this_site)
+    {
+        HPX_ASSERT(this_site < num_sites);
+
+        std::size_t pow2 = 1;
+        while (pow2 * 2 <= num_sites)
+        {
+            pow2 *= 2;
+        }
+        std::size_t const rem = num_sites - pow2;
+
+        // The first 2 * rem sites are paired, the even site of each pair
+        // folds its value into the odd one.
+        std::size_t rank = this_site - rem;
+        if (this_site < 2 * rem)
+        {
+            if (this_site % 2 == 0)
+            {
+                fold_partner = this_site + 1;
+                folded = true;
+                return;
+            }
+
+            fold_partner = this_site - 1;
+            rank = this_site / 2;
+        }
+
+        // map the rank among the remaining sites to the site number
+        auto site_of = [rem](std::size_t r) {
+            return r < rem ? 2 * r + 1 : r + rem;
+        };
+
+        for (std::size_t d = 1; d < pow2; d <<= 1)
+        {
+            std::size_t const partner = rank ^ d;
+            steps.push_back(step{site_of(partner), partner < rank});
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bruck_schedule::bruck_schedule(std::size_t sites, std::size_t site)
+      : num_sites(sites)
+      , this_site(site)
+    {
+        HPX_ASSERT(site < sites);
+
+        // after the step with distance d every site holds the values of the
+        // sites [site, site + 2 * d)
+        for (std::size_t d = 1; d < sites; d <<= 1)
+        {
+            steps.push_back(step{(site + sites - d) % sites, (site + d) % sites,
+                (std::min)(d, sites - d)});
+        }
+    }
+}    // namespace hpx::collectives::detail
+
+#endif
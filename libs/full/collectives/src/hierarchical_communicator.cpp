@@ -0,0 +1,126 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/hierarchical_communicator.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/runtime_local/get_locality_name.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx::collectives {
+
+    ///////////////////////////////////////////////////////////////////////////
+    hierarchical_communicator create_hierarchical_communicator(
+        hpx::launch::sync_policy, char const* basename,
+        num_sites_arg num_sites, this_site_arg this_site,
+        std::string const& node_name)
+    {
+        // set defaults for arguments
+        if (num_sites == static_cast<std::size_t>(-1))
+        {
+            num_sites = static_cast<std::size_t>(
+                agas::get_num_localities(hpx::launch::sync));
+        }
+        if (this_site == static_cast<std::size_t>(-1))
+        {
+            this_site = static_cast<std::size_t>(agas::get_locality_id());
+        }
+
+        HPX_ASSERT(this_site < num_sites);
+
+        std::string const name(basename);
+
+        // collect the node names of all sites
+        std::vector<std::string> const node_names =
+            all_gather(hpx::launch::sync, (name + "/node_names/").c_str(),
+                node_name.empty() ? hpx::get_locality_name() : node_name,
+                num_sites, this_site);
+
+        // The nodes are numbered in the order of their first site, which
+        // makes site zero the leader of node zero.
+        auto data = std::make_shared<hierarchical_communicator::data>();
+        data->num_sites_ = num_sites;
+        data->this_site_ = this_site;
+
+        std::vector<std::string> nodes;
+        for (std::size_t site = 0; site != num_sites; ++site)
+        {
+            std::size_t node = 0;
+            while (node != nodes.size() && nodes[node] != node_names[site])
+            {
+                ++node;
+            }
+            if (node == nodes.size())
+            {
+                nodes.push_back(node_names[site]);
+            }
+
+            if (node_names[site] == node_names[this_site])
+            {
+                if (site < this_site)
+                {
+                    ++data->local_site_;
+                }
+                ++data->num_local_sites_;
+                data->node_ = node;
+            }
+        }
+        data->num_nodes_ = nodes.size();
+
+        data->node_comm_ = create_communicator(
+            (name + "/node/" + std::to_string(data->node_) + "/").c_str(),
+            num_sites_arg(data->num_local_sites_),
+            this_site_arg(data->local_site_));
+
+        if (data->local_site_ == 0)
+        {
+            data->leader_comm_ = create_communicator(
+                (name + "/leaders/").c_str(), num_sites_arg(data->num_nodes_),
+                this_site_arg(data->node_));
+        }
+
+        hierarchical_communicator result;
+        result.data_ = HPX_MOVE(data);
+        return result;
+    }
+
+    hpx::future<hierarchical_communicator> create_hierarchical_communicator(
+        char const* basename, num_sites_arg num_sites, this_site_arg this_site,
+        std::string const& node_name)
+    {
+        return hpx::async(
+            [name = std::string(basename), num_sites, this_site, node_name]() {
+                return create_hierarchical_communicator(hpx::launch::sync,
+                    name.c_str(), num_sites, this_site, node_name);
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<void> barrier(hierarchical_communicator const& comm)
+    {
+        // no site leaves the reduction before all sites have entered it
+        return all_reduce(comm, 0, std::plus<>())
+            .then(hpx::launch::sync, [](hpx::future<int>&& f) { f.get(); });
+    }
+}    // namespace hpx::collectives
+
+#endif
@@ -0,0 +1,141 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the latency per iteration of small reductions, as used by
+// iterative solvers, comparing the all_reduce operations with a persistent
+// all_reduce_plan.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+std::size_t iterations = 1000;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double measure(F&& f)
+{
+    // make sure all sites start at the same time
+    hpx::distributed::barrier::synchronize();
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        f(i + 1);
+    }
+    double const elapsed = t.elapsed();
+
+    hpx::distributed::barrier::synchronize();
+    return elapsed / static_cast<double>(iterations);
+}
+
+void print_timing(char const* kind, double elapsed)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        hpx::util::format_to(hpx::cout, "{},{},{}\n", kind,
+            hpx::get_num_localities(hpx::launch::sync), elapsed)
+            << std::flush;
+        hpx::util::print_cdash_timing(
+            (std::string("all_reduce_") + kind).c_str(), elapsed);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_sites = hpx::get_num_localities(hpx::launch::sync);
+    std::size_t const this_site = hpx::get_locality_id();
+
+    if (vm.count("no-header") == 0 && this_site == 0)
+    {
+        hpx::cout << "kind,localities,average_time[s]\n" << std::flush;
+    }
+
+    double const value = static_cast<double>(this_site);
+
+    // all_reduce using a communicator, the root site collects all values
+    {
+        communicator comm =
+            create_communicator("/collective_plan_performance/communicator",
+                num_sites_arg(num_sites), this_site_arg(this_site));
+
+        double const elapsed = measure([&](std::size_t generation) {
+            all_reduce(comm, value, std::plus<>(), this_site_arg(this_site),
+                generation_arg(generation))
+                .get();
+        });
+        print_timing("communicator", elapsed);
+    }
+
+    // all_reduce using a channel communicator, every invocation derives the
+    // algorithm and the partners of all steps
+    {
+        channel_communicator comm = create_channel_communicator(
+            hpx::launch::sync, "/collective_plan_performance/channel",
+            num_sites_arg(num_sites), this_site_arg(this_site));
+
+        double const elapsed = measure([&](std::size_t generation) {
+            all_reduce(comm, std::vector<double>(1, value), std::plus<>(),
+                generation_arg(generation))
+                .get();
+        });
+        print_timing("channel_communicator", elapsed);
+    }
+
+    // persistent all_reduce plan
+    {
+        channel_communicator comm = create_channel_communicator(
+            hpx::launch::sync, "/collective_plan_performance/plan",
+            num_sites_arg(num_sites), this_site_arg(this_site));
+
+        all_reduce_plan<double, std::plus<>> plan(comm);
+
+        double elapsed = measure(
+            [&](std::size_t) { plan.start(hpx::launch::sync, value); });
+        print_timing("plan_sync", elapsed);
+
+        elapsed = measure([&](std::size_t) { plan.start(value).get(); });
+        print_timing("plan", elapsed);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("iterations",
+            hpx::program_options::value<std::size_t>(&iterations)
+                ->default_value(1000),
+            "number of reductions to perform (default: 1000)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,304 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Compare the flat collective operations based on a communicator (the root
+// site talks to all other sites directly) with the tree based operations
+// using a channel communicator.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace hpx::collectives;
+
+std::size_t iterations = 100;
+std::size_t data_size = 1024;
+std::size_t arity = 2;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<double> elementwise_plus(
+    std::vector<double> const& lhs, std::vector<double> const& rhs)
+{
+    std::vector<double> result(lhs);
+    for (std::size_t i = 0; i != result.size(); ++i)
+    {
+        result[i] += rhs[i];
+    }
+    return result;
+}
+
+template <typename F>
+double measure(F&& f)
+{
+    // make sure all sites start at the same time
+    hpx::distributed::barrier::synchronize();
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        f(i + 1);
+    }
+    double const elapsed = t.elapsed();
+
+    hpx::distributed::barrier::synchronize();
+    return elapsed / static_cast<double>(iterations);
+}
+
+void print_timing(char const* operation, char const* kind, double elapsed)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        hpx::util::format_to(hpx::cout, "{},{},{},{},{}\n", operation, kind,
+            hpx::get_num_localities(hpx::launch::sync), data_size, elapsed)
+            << std::flush;
+        hpx::util::print_cdash_timing(
+            (std::string(operation) + "_" + kind).c_str(), elapsed);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void benchmark_broadcast(communicator flat, channel_communicator tree,
+    std::size_t this_site)
+{
+    std::vector<double> const data(data_size, 1.0);
+
+    double elapsed = measure([&](std::size_t generation) {
+        if (this_site == 0)
+        {
+            broadcast_to(flat, data, this_site_arg(this_site),
+                generation_arg(generation))
+                .get();
+        }
+        else
+        {
+            broadcast_from<std::vector<double>>(
+                flat, this_site_arg(this_site), generation_arg(generation))
+                .get();
+        }
+    });
+    print_timing("broadcast", "flat", elapsed);
+
+    elapsed = measure([&](std::size_t generation) {
+        if (this_site == 0)
+        {
+            broadcast_to(
+                tree, data, generation_arg(generation), arity_arg(arity))
+                .get();
+        }
+        else
+        {
+            broadcast_from<std::vector<double>>(tree, root_site_arg(0),
+                generation_arg(generation), arity_arg(arity))
+                .get();
+        }
+    });
+    print_timing("broadcast", "tree", elapsed);
+}
+
+void benchmark_scatter(communicator flat, channel_communicator tree,
+    std::size_t num_sites, std::size_t this_site)
+{
+    using value_type = std::vector<double>;
+
+    double elapsed = measure([&](std::size_t generation) {
+        if (this_site == 0)
+        {
+            std::vector<value_type> data(num_sites, value_type(data_size));
+            scatter_to(flat, HPX_MOVE(data), this_site_arg(this_site),
+                generation_arg(generation))
+                .get();
+        }
+        else
+        {
+            scatter_from<value_type>(
+                flat, this_site_arg(this_site), generation_arg(generation))
+                .get();
+        }
+    });
+    print_timing("scatter", "flat", elapsed);
+
+    elapsed = measure([&](std::size_t generation) {
+        if (this_site == 0)
+        {
+            std::vector<value_type> data(num_sites, value_type(data_size));
+            scatter_to(tree, HPX_MOVE(data), generation_arg(generation),
+                arity_arg(arity))
+                .get();
+        }
+        else
+        {
+            scatter_from<value_type>(tree, root_site_arg(0),
+                generation_arg(generation), arity_arg(arity))
+                .get();
+        }
+    });
+    print_timing("scatter", "tree", elapsed);
+}
+
+void benchmark_gather(communicator flat, channel_communicator tree,
+    std::size_t this_site)
+{
+    std::vector<double> const data(data_size, 1.0);
+
+    double elapsed = measure([&](std::size_t generation) {
+        if (this_site == 0)
+        {
+            gather_here(flat, data, this_site_arg(this_site),
+                generation_arg(generation))
+                .get();
+        }
+        else
+        {
+            gather_there(flat, data, this_site_arg(this_site),
+                generation_arg(generation))
+                .get();
+        }
+    });
+    print_timing("gather", "flat", elapsed);
+
+    elapsed = measure([&](std::size_t generation) {
+        if (this_site == 0)
+        {
+            gather_here(tree, data, generation_arg(generation),
+                arity_arg(arity))
+                .get();
+        }
+        else
+        {
+            gather_there(tree, data, root_site_arg(0),
+                generation_arg(generation), arity_arg(arity))
+                .get();
+        }
+    });
+    print_timing("gather", "tree", elapsed);
+}
+
+void benchmark_reduce(communicator flat, channel_communicator tree,
+    std::size_t this_site)
+{
+    std::vector<double> const data(data_size, 1.0);
+
+    double elapsed = measure([&](std::size_t generation) {
+        if (this_site == 0)
+        {
+            reduce_here(flat, data, &elementwise_plus,
+                this_site_arg(this_site), generation_arg(generation))
+                .get();
+        }
+        else
+        {
+            reduce_there(flat, data, this_site_arg(this_site),
+                generation_arg(generation))
+                .get();
+        }
+    });
+    print_timing("reduce", "flat", elapsed);
+
+    elapsed = measure([&](std::size_t generation) {
+        if (this_site == 0)
+        {
+            reduce_here(tree, data, std::plus<>(), generation_arg(generation),
+                arity_arg(arity))
+                .get();
+        }
+        else
+        {
+            reduce_there(tree, data, std::plus<>(), root_site_arg(0),
+                generation_arg(generation), arity_arg(arity))
+                .get();
+        }
+    });
+    print_timing("reduce", "tree", elapsed);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const num_sites = hpx::get_num_localities(hpx::launch::sync);
+    std::size_t const this_site = hpx::get_locality_id();
+
+    if (vm.count("no-header") == 0 && this_site == 0)
+    {
+        hpx::cout << "operation,kind,localities,datasize,average_time[s]\n"
+                  << std::flush;
+    }
+
+    // every operation uses its own pair of communicators, this keeps the
+    // generation numbers of the operations independent of each other
+    auto run = [&](char const* name, auto&& benchmark) {
+        std::string const flat_name =
+            std::string("/tree_collectives_performance/flat/") + name;
+        std::string const tree_name =
+            std::string("/tree_collectives_performance/tree/") + name;
+
+        communicator flat = create_communicator(flat_name.c_str(),
+            num_sites_arg(num_sites), this_site_arg(this_site));
+        channel_communicator tree = create_channel_communicator(
+            hpx::launch::sync, tree_name.c_str(), num_sites_arg(num_sites),
+            this_site_arg(this_site));
+
+        benchmark(HPX_MOVE(flat), HPX_MOVE(tree));
+    };
+
+    run("broadcast", [&](communicator flat, channel_communicator tree) {
+        benchmark_broadcast(HPX_MOVE(flat), HPX_MOVE(tree), this_site);
+    });
+    run("scatter", [&](communicator flat, channel_communicator tree) {
+        benchmark_scatter(
+            HPX_MOVE(flat), HPX_MOVE(tree), num_sites, this_site);
+    });
+    run("gather", [&](communicator flat, channel_communicator tree) {
+        benchmark_gather(HPX_MOVE(flat), HPX_MOVE(tree), this_site);
+    });
+    run("reduce", [&](communicator flat, channel_communicator tree) {
+        benchmark_reduce(HPX_MOVE(flat), HPX_MOVE(tree), this_site);
+    });
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Configure application-specific options.
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("iterations",
+            hpx::program_options::value<std::size_t>(&iterations)
+                ->default_value(100),
+            "number of times each operation is repeated (default: 100)")
+        ("data_size",
+            hpx::program_options::value<std::size_t>(&data_size)
+                ->default_value(1024),
+            "number of doubles sent by each site (default: 1024)")
+        ("arity",
+            hpx::program_options::value<std::size_t>(&arity)
+                ->default_value(2),
+            "arity of the trees used by the tree based operations "
+            "(default: 2)")
+        ("no-header", "do not print out the csv header row")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -0,0 +1,140 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* collective_plan_basename = "/test/collective_plan/";
+constexpr std::size_t iterations = 20;
+constexpr std::size_t repeated_starts = 1000;
+
+void test_site(channel_communicator comm, std::size_t num_sites,
+    std::size_t site)
+{
+    all_reduce_plan<std::size_t, std::plus<>> sum(comm);
+
+    // the operation is not commutative, the values are concatenated in the
+    // order of the sites
+    all_reduce_plan<std::string, std::plus<>> concat(
+        comm, std::plus<>(), generation_arg(1000));
+
+    all_gather_plan<std::size_t> gather(comm, generation_arg(2000));
+
+    std::string expected_concat;
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        expected_concat += static_cast<char>('a' + i);
+    }
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        HPX_TEST_EQ(sum.generation(), i + 1);
+
+        hpx::future<std::size_t> f = sum.start(site + i);
+        HPX_TEST_EQ(f.get(), num_sites * (num_sites - 1) / 2 + num_sites * i);
+
+        HPX_TEST_EQ(concat.start(hpx::launch::sync,
+                        std::string(1, static_cast<char>('a' + site))),
+            expected_concat);
+
+        std::vector<std::size_t> const values =
+            gather.start(hpx::launch::sync, site + 10 * i);
+        HPX_TEST_EQ(values.size(), num_sites);
+        for (std::size_t j = 0; j != values.size(); ++j)
+        {
+            HPX_TEST_EQ(values[j], j + 10 * i);
+        }
+    }
+}
+
+// every start uses new tags, the channels used by earlier starts must not
+// accumulate in the communicator
+void test_repeated_starts(
+    channel_communicator comm, std::size_t num_sites, std::size_t site)
+{
+    all_reduce_plan<std::size_t, std::plus<>> sum(
+        comm, std::plus<>(), generation_arg(10000));
+    all_gather_plan<std::size_t> gather(comm, generation_arg(20000));
+
+    for (std::size_t i = 0; i != repeated_starts; ++i)
+    {
+        HPX_TEST_EQ(sum.start(hpx::launch::sync, site),
+            num_sites * (num_sites - 1) / 2);
+        HPX_TEST_EQ(gather.start(hpx::launch::sync, site).size(), num_sites);
+    }
+}
+
+void test_collective_plan(std::size_t num_sites)
+{
+    std::string const basename =
+        collective_plan_basename + std::to_string(num_sites);
+
+    std::vector<hpx::future<channel_communicator>> comm_fs;
+    comm_fs.reserve(num_sites);
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        comm_fs.push_back(create_channel_communicator(basename.c_str(),
+            num_sites_arg(num_sites), this_site_arg(i)));
+    }
+
+    std::vector<channel_communicator> comms;
+    comms.reserve(num_sites);
+    for (auto& f : comm_fs)
+    {
+        comms.push_back(f.get());
+    }
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_sites);
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        tasks.push_back(hpx::async(test_site, comms[i], num_sites, i));
+    }
+    hpx::wait_all(tasks);
+
+    tasks.clear();
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        tasks.push_back(
+            hpx::async(test_repeated_starts, comms[i], num_sites, i));
+    }
+    hpx::wait_all(tasks);
+
+    // all values sent by the plans were retrieved, no channels are left
+    for (channel_communicator const& comm : comms)
+    {
+        HPX_TEST_EQ(comm.num_pending_channels(), std::size_t(0));
+    }
+}
+
+int hpx_main()
+{
+    for (std::size_t num_sites : {1, 2, 3, 6, 8})
+    {
+        test_collective_plan(num_sites);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
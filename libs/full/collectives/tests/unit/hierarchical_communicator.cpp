@@ -0,0 +1,102 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* hierarchical_communicator_basename =
+    "/test/hierarchical_communicator/";
+constexpr std::size_t iterations = 10;
+
+// the sites are distributed over the nodes in a round robin fashion, which
+// places sites with consecutive numbers on different nodes
+std::string node_name(std::size_t site, std::size_t num_nodes)
+{
+    return "node" + std::to_string(site % num_nodes);
+}
+
+void test_site(std::string const& basename, std::size_t num_sites,
+    std::size_t num_nodes, std::size_t site)
+{
+    hierarchical_communicator comm = create_hierarchical_communicator(
+        hpx::launch::sync, basename.c_str(), num_sites_arg(num_sites),
+        this_site_arg(site), node_name(site, num_nodes));
+
+    std::size_t const expected_nodes = (std::min)(num_sites, num_nodes);
+    HPX_TEST_EQ(comm.num_sites(), num_sites);
+    HPX_TEST_EQ(comm.this_site(), site);
+    HPX_TEST_EQ(comm.num_nodes(), expected_nodes);
+    HPX_TEST_EQ(comm.node(), site % num_nodes);
+    HPX_TEST_EQ(comm.local_site(), site / num_nodes);
+    HPX_TEST_EQ(comm.is_leader(), site < num_nodes);
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        std::size_t const sum =
+            all_reduce(comm, site + i, std::plus<std::size_t>()).get();
+        HPX_TEST_EQ(sum, num_sites * (num_sites - 1) / 2 + num_sites * i);
+
+        std::string const value = "value" + std::to_string(i);
+        if (site == 0)
+        {
+            HPX_TEST_EQ(broadcast_to(comm, value).get(), value);
+        }
+        else
+        {
+            HPX_TEST_EQ(broadcast_from<std::string>(comm).get(), value);
+        }
+
+        barrier(hpx::launch::sync, comm);
+    }
+}
+
+void test_hierarchical_communicator(
+    std::size_t num_sites, std::size_t num_nodes)
+{
+    std::string const basename = hierarchical_communicator_basename +
+        std::to_string(num_sites) + "/" + std::to_string(num_nodes);
+
+    std::vector<hpx::future<void>> tasks;
+    tasks.reserve(num_sites);
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        tasks.push_back(
+            hpx::async(test_site, basename, num_sites, num_nodes, i));
+    }
+
+    hpx::wait_all(tasks);
+}
+
+int hpx_main()
+{
+    test_hierarchical_communicator(1, 1);
+    test_hierarchical_communicator(4, 1);
+    test_hierarchical_communicator(4, 4);
+    test_hierarchical_communicator(7, 3);
+    test_hierarchical_communicator(8, 2);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,148 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* pipelined_all_reduce_basename =
+    "/test/pipelined_all_reduce/";
+
+std::vector<std::size_t> make_data(std::size_t site, std::size_t size)
+{
+    std::vector<std::size_t> data(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        data[i] = site * size + i;
+    }
+    return data;
+}
+
+void test_site(channel_communicator comm, std::size_t num_sites,
+    std::size_t site, std::size_t size, all_reduce_algorithm algorithm,
+    std::size_t generation)
+{
+    all_reduce_algorithm used = all_reduce_algorithm::automatic;
+    std::vector<std::size_t> result = all_reduce(hpx::launch::sync, comm,
+        make_data(site, size), std::plus<>(), generation_arg(generation),
+        algorithm, &used);
+
+    if (algorithm == all_reduce_algorithm::automatic)
+    {
+        HPX_TEST(used ==
+            select_all_reduce_algorithm(
+                num_sites, size * sizeof(std::size_t)));
+    }
+    else
+    {
+        HPX_TEST(used == algorithm);
+    }
+
+    HPX_TEST_EQ(result.size(), size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        // sum over all sites of (s * size + i)
+        std::size_t const expected =
+            size * num_sites * (num_sites - 1) / 2 + num_sites * i;
+        HPX_TEST_EQ(result[i], expected);
+    }
+}
+
+void test_pipelined_all_reduce(std::size_t num_sites)
+{
+    std::string const basename =
+        pipelined_all_reduce_basename + std::to_string(num_sites);
+
+    std::vector<hpx::future<channel_communicator>> comm_fs;
+    comm_fs.reserve(num_sites);
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        comm_fs.push_back(create_channel_communicator(basename.c_str(),
+            num_sites_arg(num_sites), this_site_arg(i)));
+    }
+
+    std::vector<channel_communicator> comms;
+    comms.reserve(num_sites);
+    for (auto& f : comm_fs)
+    {
+        comms.push_back(f.get());
+    }
+
+    std::size_t generation = 1;
+    for (std::size_t size : {0, 1, 7, 1000, 100000})
+    {
+        for (all_reduce_algorithm algorithm :
+            {all_reduce_algorithm::automatic,
+                all_reduce_algorithm::recursive_doubling,
+                all_reduce_algorithm::recursive_halving,
+                all_reduce_algorithm::ring})
+        {
+            std::vector<hpx::future<void>> tasks;
+            tasks.reserve(num_sites);
+
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                tasks.push_back(hpx::async(test_site, comms[i], num_sites, i,
+                    size, algorithm, generation));
+            }
+
+            hpx::wait_all(tasks);
+            ++generation;
+
+            // all values were retrieved, no channels may be left behind
+            for (channel_communicator const& comm : comms)
+            {
+                HPX_TEST_EQ(comm.num_pending_channels(), std::size_t(0));
+            }
+        }
+    }
+}
+
+void test_select_all_reduce_algorithm()
+{
+    // small vectors are always exchanged completely
+    HPX_TEST(select_all_reduce_algorithm(16, 1024) ==
+        all_reduce_algorithm::recursive_doubling);
+
+    // large vectors are pipelined through the ring
+    HPX_TEST(select_all_reduce_algorithm(16, 64 * 1024 * 1024) ==
+        all_reduce_algorithm::ring);
+
+    HPX_TEST_EQ(std::string(get_all_reduce_algorithm_name(
+                    all_reduce_algorithm::recursive_halving)),
+        std::string("recursive_halving"));
+}
+
+int hpx_main()
+{
+    test_select_all_reduce_algorithm();
+
+    // powers of two and other numbers of sites
+    for (std::size_t num_sites : {1, 2, 5, 8})
+    {
+        test_pipelined_all_reduce(num_sites);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
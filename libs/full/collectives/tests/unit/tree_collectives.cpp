@@ -0,0 +1,241 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+///////////////////////////////////////////////////////////////////////////////
+constexpr char const* tree_collectives_basename = "/test/tree_collectives/";
+
+void test_site(channel_communicator comm, std::size_t num_sites,
+    std::size_t site, std::size_t root, std::size_t arity,
+    std::size_t generation)
+{
+    // broadcast
+    std::string const value = "value" + std::to_string(generation);
+    if (site == root)
+    {
+        HPX_TEST_EQ(broadcast_to(comm, value, generation_arg(generation),
+                        arity_arg(arity))
+                        .get(),
+            value);
+    }
+    else
+    {
+        HPX_TEST_EQ(broadcast_from<std::string>(comm, root_site_arg(root),
+                        generation_arg(generation), arity_arg(arity))
+                        .get(),
+            value);
+    }
+
+    // scatter
+    if (site == root)
+    {
+        std::vector<std::size_t> values(num_sites);
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            values[i] = 10 * i + generation;
+        }
+        HPX_TEST_EQ(scatter_to(comm, HPX_MOVE(values),
+                        generation_arg(generation + 1), arity_arg(arity))
+                        .get(),
+            10 * site + generation);
+    }
+    else
+    {
+        HPX_TEST_EQ(scatter_from<std::size_t>(comm, root_site_arg(root),
+                        generation_arg(generation + 1), arity_arg(arity))
+                        .get(),
+            10 * site + generation);
+    }
+
+    // gather
+    if (site == root)
+    {
+        hpx::future<std::vector<std::size_t>> f = gather_here(comm,
+            std::size_t(site + 42), generation_arg(generation + 2),
+            arity_arg(arity));
+
+        std::vector<std::size_t> const result = f.get();
+        HPX_TEST_EQ(result.size(), num_sites);
+        for (std::size_t i = 0; i != result.size(); ++i)
+        {
+            HPX_TEST_EQ(result[i], i + 42);
+        }
+    }
+    else
+    {
+        gather_there(comm, std::size_t(site + 42), root_site_arg(root),
+            generation_arg(generation + 2), arity_arg(arity))
+            .get();
+    }
+
+    // reduce, the large vector is reduced in several segments
+    std::size_t reduce_generation = generation + 3;
+    for (std::size_t size : {0, 1, 100, 20000})
+    {
+        std::vector<std::size_t> data(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            data[i] = site + i;
+        }
+
+        if (site == root)
+        {
+            hpx::future<std::vector<std::size_t>> f = reduce_here(comm,
+                HPX_MOVE(data), std::plus<>(),
+                generation_arg(reduce_generation), arity_arg(arity));
+
+            std::vector<std::size_t> const result = f.get();
+            HPX_TEST_EQ(result.size(), size);
+            for (std::size_t i = 0; i != result.size(); ++i)
+            {
+                HPX_TEST_EQ(
+                    result[i], num_sites * (num_sites - 1) / 2 + num_sites * i);
+            }
+        }
+        else
+        {
+            reduce_there(comm, HPX_MOVE(data), std::plus<>(),
+                root_site_arg(root), generation_arg(reduce_generation),
+                arity_arg(arity))
+                .get();
+        }
+        ++reduce_generation;
+    }
+
+    // the operation is not commutative, the values are concatenated in the
+    // order of the sites regardless of the root
+    std::vector<std::string> strings = {
+        std::string(1, static_cast<char>('a' + site)),
+        std::to_string(site) + ","};
+    if (site == root)
+    {
+        hpx::future<std::vector<std::string>> f = reduce_here(comm,
+            HPX_MOVE(strings), std::plus<>(),
+            generation_arg(reduce_generation), arity_arg(arity));
+
+        std::string expected_letters;
+        std::string expected_numbers;
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            expected_letters += static_cast<char>('a' + i);
+            expected_numbers += std::to_string(i) + ",";
+        }
+
+        std::vector<std::string> const result = f.get();
+        HPX_TEST_EQ(result.size(), std::size_t(2));
+        HPX_TEST_EQ(result[0], expected_letters);
+        HPX_TEST_EQ(result[1], expected_numbers);
+    }
+    else
+    {
+        reduce_there(comm, HPX_MOVE(strings), std::plus<>(),
+            root_site_arg(root), generation_arg(reduce_generation),
+            arity_arg(arity))
+            .get();
+    }
+}
+
+void test_tree_collectives(std::size_t num_sites)
+{
+    std::string const basename =
+        tree_collectives_basename + std::to_string(num_sites);
+
+    std::vector<hpx::future<channel_communicator>> comm_fs;
+    comm_fs.reserve(num_sites);
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        comm_fs.push_back(create_channel_communicator(basename.c_str(),
+            num_sites_arg(num_sites), this_site_arg(i)));
+    }
+
+    std::vector<channel_communicator> comms;
+    comms.reserve(num_sites);
+    for (auto& f : comm_fs)
+    {
+        comms.push_back(f.get());
+    }
+
+    std::size_t generation = 1;
+    for (std::size_t arity : {2, 3, 4})
+    {
+        for (std::size_t root = 0; root < num_sites; root += 3)
+        {
+            std::vector<hpx::future<void>> tasks;
+            tasks.reserve(num_sites);
+
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                tasks.push_back(hpx::async(test_site, comms[i], num_sites, i,
+                    root, arity, generation));
+            }
+
+            hpx::wait_all(tasks);
+            generation += 8;
+        }
+    }
+}
+
+void test_invalid_arguments()
+{
+    channel_communicator comm = create_channel_communicator(hpx::launch::sync,
+        "/test/tree_collectives/invalid", num_sites_arg(1), this_site_arg(0));
+
+    bool caught_exception = false;
+    try
+    {
+        broadcast_from<int>(comm, root_site_arg(1)).get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        broadcast_to(comm, 42, generation_arg(), arity_arg(1)).get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::error::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int hpx_main()
+{
+    test_invalid_arguments();
+
+    for (std::size_t num_sites : {1, 2, 7, 16})
+    {
+        test_tree_collectives(num_sites);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ(hpx::init(argc, argv), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -395,7 +395,12 @@ namespace hpx::util {
                   "   'full' (prints all available counter infos)")
                 ("hpx:print-counter-format", value<std::string>(),
                   "print the performance counter(s) specified with --hpx:print-counter "
-                  "in a given format (default: normal)")
+                  "in a given format, possible values:\n"
+                  "   'normal' (the default)\n"
+                  "   'csv' (with full counter names as header)\n"
+                  "   'csv-short' (with short counter names as header)\n"
+                  "   'binary' (compact binary file, requires "
+                  "--hpx:print-counter-destination)")
                 ("hpx:csv-header",
                   "print the performance counter(s) specified with --hpx:print-counter "
                   "with header when format specified with --hpx:print-counter-format"
@@ -12,10 +12,14 @@
 #include <hpx/collectives/argument_types.hpp>
 #include <hpx/collectives/broadcast.hpp>
 #include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/collectives/collective_plan.hpp>
 #include <hpx/collectives/communication_set.hpp>
 #include <hpx/collectives/create_communicator.hpp>
 #include <hpx/collectives/exclusive_scan.hpp>
 #include <hpx/collectives/gather.hpp>
+#include <hpx/collectives/hierarchical_communicator.hpp>
 #include <hpx/collectives/inclusive_scan.hpp>
+#include <hpx/collectives/pipelined_all_reduce.hpp>
 #include <hpx/collectives/reduce.hpp>
 #include <hpx/collectives/scatter.hpp>
+#include <hpx/collectives/tree_collectives.hpp>
@@ -9,3 +9,5 @@
 
 #include <hpx/parallel/algorithms/equal.hpp>
 #include <hpx/parallel/container_algorithms/equal.hpp>
+
+#include <hpx/parallel/segmented_algorithms/equal.hpp>
@@ -9,3 +9,5 @@
 
 #include <hpx/parallel/algorithms/mismatch.hpp>
 #include <hpx/parallel/container_algorithms/mismatch.hpp>
+
+#include <hpx/parallel/segmented_algorithms/mismatch.hpp>
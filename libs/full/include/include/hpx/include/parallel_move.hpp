@@ -9,3 +9,5 @@
 
 #include <hpx/parallel/algorithms/move.hpp>
 #include <hpx/parallel/container_algorithms/move.hpp>
+
+#include <hpx/parallel/segmented_algorithms/detail/transfer.hpp>
@@ -9,3 +9,5 @@
 
 #include <hpx/parallel/algorithms/replace.hpp>
 #include <hpx/parallel/container_algorithms/replace.hpp>
+
+#include <hpx/parallel/segmented_algorithms/replace.hpp>
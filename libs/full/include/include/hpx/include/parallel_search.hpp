@@ -9,3 +9,5 @@
 
 #include <hpx/parallel/algorithms/search.hpp>
 #include <hpx/parallel/container_algorithms/search.hpp>
+
+#include <hpx/parallel/segmented_algorithms/search.hpp>
@@ -51,6 +51,7 @@
 #include <hpx/runtime_local/startup_function.hpp>
 #include <hpx/string_util/classification.hpp>
 #include <hpx/string_util/split.hpp>
+#include <hpx/synchronization/detail/lock_contention.hpp>
 #include <hpx/threading/thread.hpp>
 #include <hpx/threading_base/detail/get_default_timer_service.hpp>
 #include <hpx/type_support/pack.hpp>
@@ -451,6 +452,10 @@ namespace hpx {
             util::detail::set_spinlock_deadlock_detection_limit(
                 cmdline.rtcfg_.get_spinlock_deadlock_detection_limit());
 #endif
+#ifdef HPX_HAVE_LOCK_CONTENTION_PROFILING
+            util::enable_lock_contention_profiling(
+                cmdline.rtcfg_.enable_lock_contention_profiling());
+#endif
 
 #if defined(HPX_HAVE_LOGGING)
             util::detail::init_logging_full(cmdline.rtcfg_);
@@ -590,6 +595,16 @@ namespace hpx {
                     destination =
                         vm["hpx:print-counter-destination"].as<std::string>();
 
+                if (counter_format == "binary" &&
+                    (destination == "cout" || destination == "none"))
+                {
+                    throw detail::command_line_error(
+                        "Invalid command line option "
+                        "--hpx:print-counter-format=binary, valid in "
+                        "conjunction with --hpx:print-counter-destination "
+                        "naming a file only");
+                }
+
                 bool counter_types = false;
                 if (vm.count("hpx:print-counter-types"))
                     counter_types = true;
@@ -695,6 +710,8 @@ namespace hpx {
             // Dump the configuration after all components have been loaded.
             if (vm.count("hpx:dump-config"))
                 rt.add_startup_function(hpx::local::detail::dump_config(rt));
+
+            hpx::local::detail::add_lock_contention_report(rt);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -22,6 +22,7 @@
 #include <hpx/modules/logging.hpp>
 #include <hpx/parcelset/message_handler_fwd.hpp>
 #include <hpx/performance_counters/agas_counter_types.hpp>
+#include <hpx/performance_counters/lock_contention_counter_types.hpp>
 #include <hpx/performance_counters/parcelhandler_counter_types.hpp>
 #include <hpx/performance_counters/threadmanager_counter_types.hpp>
 #include <hpx/runtime_components/console_logging.hpp>
@@ -68,6 +69,12 @@ namespace hpx { namespace detail {
         lbt_ << "(2nd stage) pre_main: registered thread-manager performance "
                 "counter types";
 
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+        performance_counters::register_lock_contention_counter_types();
+        lbt_ << "(2nd stage) pre_main: registered lock contention performance "
+                "counter types";
+#endif
+
 #if defined(HPX_HAVE_NETWORKING)
         performance_counters::register_parcelhandler_counter_types(
             applier::get_applier().get_parcel_handler());
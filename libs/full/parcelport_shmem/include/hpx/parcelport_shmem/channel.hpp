@@ -0,0 +1,62 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/inbound_segment.hpp>
+#include <hpx/parcelport_shmem/ring_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A channel represents the slot this locality has claimed in the inbound
+    // segment of a peer locality. All connections to the same peer share one
+    // channel, the lock serializes the writers as the ring buffer supports
+    // only one producer.
+    class channel
+    {
+    public:
+        channel(inbound_segment&& segment, std::size_t slot) noexcept
+          : segment_(HPX_MOVE(segment))
+          , ring_(segment_.ring(slot))
+        {
+        }
+
+        channel(channel const&) = delete;
+        channel(channel&&) = delete;
+        channel& operator=(channel const&) = delete;
+        channel& operator=(channel&&) = delete;
+
+        // Try to write all pieces as one frame into the ring buffer, returns
+        // false if the channel is busy or the ring buffer is full.
+        template <typename Pieces>
+        bool try_write(Pieces const& pieces)
+        {
+            std::unique_lock l(mtx_, std::try_to_lock);
+            return l.owns_lock() && ring_.try_write(pieces);
+        }
+
+        // Return the largest frame that can be written to this channel
+        [[nodiscard]] std::size_t max_frame_size() const noexcept
+        {
+            return ring_.max_frame_size();
+        }
+
+    private:
+        inbound_segment segment_;
+        ring_buffer ring_;
+        hpx::spinlock mtx_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,94 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Every message starts with this header. The header is followed by the
+    // message body which is either stored in the ring buffer right after the
+    // header (inline) or in a separate shared memory segment (out-of-line).
+    // The body consists of the transmission chunks, the non-zero-copy data,
+    // and all zero-copy chunks (in this order).
+    struct header
+    {
+        static constexpr std::uint32_t magic_signature = 0x68707873;
+
+        // the body is stored in a separate segment
+        static constexpr std::uint32_t out_of_line = 0x01;
+
+        template <typename Buffer>
+        static header create(Buffer const& buffer, std::int32_t source,
+            std::uint64_t body_size) noexcept
+        {
+            HPX_ASSERT(buffer.num_chunks_.first <=
+                (std::numeric_limits<std::uint32_t>::max)());
+            HPX_ASSERT(buffer.num_chunks_.second <=
+                (std::numeric_limits<std::uint32_t>::max)());
+
+            header h{};
+            h.signature = magic_signature;
+            h.flags = 0;
+            h.source = source;
+            h.num_zero_copy_chunks = buffer.num_chunks_.first;
+            h.num_non_zero_copy_chunks = buffer.num_chunks_.second;
+            h.numbytes = buffer.data_size_;
+            h.numbytes_nonzero_copy = buffer.data_.size();
+            h.body_size = body_size;
+            h.sequence_number = 0;
+            return h;
+        }
+
+        [[nodiscard]] constexpr bool valid() const noexcept
+        {
+            return signature == magic_signature;
+        }
+
+        [[nodiscard]] constexpr bool is_out_of_line() const noexcept
+        {
+            return (flags & out_of_line) != 0;
+        }
+
+        [[nodiscard]] constexpr std::size_t num_transmission_chunks()
+            const noexcept
+        {
+            return num_zero_copy_chunks == 0 ?
+                0 :
+                static_cast<std::size_t>(num_zero_copy_chunks) +
+                    num_non_zero_copy_chunks;
+        }
+
+        std::uint32_t signature;
+        std::uint32_t flags;
+        // process id of the sending locality
+        std::int32_t source;
+        // zero-copy chunk number
+        std::uint32_t num_zero_copy_chunks;
+        // non-zero-copy chunk number
+        std::uint32_t num_non_zero_copy_chunks;
+        // how many bytes in total (including zero-copy and non-zero-copy
+        // chunks)
+        std::uint64_t numbytes;
+        // size of the non-zero-copy data
+        std::uint64_t numbytes_nonzero_copy;
+        // size of the message body
+        std::uint64_t body_size;
+        // identifies the segment holding the body of out-of-line messages
+        std::uint64_t sequence_number;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
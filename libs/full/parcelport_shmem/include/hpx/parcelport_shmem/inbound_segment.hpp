@@ -0,0 +1,210 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/parcelport_shmem/ring_buffer.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // The inbound segment of a locality holds one ring buffer (slot) for
+    // each peer locality sending parcels to it. Peers claim a free slot by
+    // atomically storing their process id into the owner array, after which
+    // they are the sole producer of the corresponding ring buffer. The owning
+    // locality is the sole consumer of all ring buffers.
+    //
+    // Layout: | control block | owner array | ring buffer 0 | ring buffer 1 |
+    class inbound_segment
+    {
+        static constexpr std::uint32_t magic = 0x68707873;    // 'hpxs'
+
+        struct control_block
+        {
+            std::uint32_t magic_;
+            std::uint32_t num_slots_;
+            std::uint64_t slot_capacity_;
+            std::atomic<std::uint32_t> initialized_;
+        };
+
+        static constexpr std::size_t align(std::size_t size) noexcept
+        {
+            constexpr std::size_t alignment = threads::get_cache_line_size();
+            return (size + alignment - 1) & ~(alignment - 1);
+        }
+
+        static constexpr std::size_t owners_offset() noexcept
+        {
+            return align(sizeof(control_block));
+        }
+
+        static constexpr std::size_t slots_offset(
+            std::size_t num_slots) noexcept
+        {
+            return owners_offset() +
+                align(num_slots * sizeof(std::atomic<std::int32_t>));
+        }
+
+        static constexpr std::size_t slot_size(std::size_t capacity) noexcept
+        {
+            return align(ring_buffer::required_size(capacity));
+        }
+
+        static constexpr std::size_t required_size(
+            std::size_t num_slots, std::size_t capacity) noexcept
+        {
+            return slots_offset(num_slots) + num_slots * slot_size(capacity);
+        }
+
+        explicit inbound_segment(shared_memory_segment&& segment) noexcept
+          : segment_(HPX_MOVE(segment))
+          , control_(static_cast<control_block*>(segment_.data()))
+        {
+        }
+
+    public:
+        inbound_segment() = default;
+
+        // Create the inbound segment for this locality
+        static inbound_segment create(std::int32_t pid, std::size_t num_slots,
+            std::size_t slot_capacity, error_code& ec = throws)
+        {
+            shared_memory_segment segment =
+                shared_memory_segment::create(inbound_segment_name(pid),
+                    required_size(num_slots, slot_capacity), ec);
+            if (!segment)
+            {
+                return {};
+            }
+
+            inbound_segment result(HPX_MOVE(segment));
+
+            auto* control = new (result.control_) control_block();
+            control->magic_ = magic;
+            control->num_slots_ = static_cast<std::uint32_t>(num_slots);
+            control->slot_capacity_ = slot_capacity;
+
+            for (std::size_t i = 0; i != num_slots; ++i)
+            {
+                new (&result.owners()[i]) std::atomic<std::int32_t>(0);
+                ring_buffer::create(result.slot_memory(i), slot_capacity);
+            }
+
+            control->initialized_.store(1, std::memory_order_release);
+            return result;
+        }
+
+        // Attach to the inbound segment of a peer locality
+        static inbound_segment open(std::int32_t pid, error_code& ec = throws)
+        {
+            shared_memory_segment segment =
+                shared_memory_segment::open(inbound_segment_name(pid), ec);
+            if (!segment)
+            {
+                return {};
+            }
+
+            inbound_segment result(HPX_MOVE(segment));
+            if (result.segment_.size() < sizeof(control_block) ||
+                result.control_->magic_ != magic ||
+                result.control_->initialized_.load(
+                    std::memory_order_acquire) == 0)
+            {
+                HPX_THROWS_IF(ec, hpx::error::network_error,
+                    "inbound_segment::open",
+                    "shared memory segment of locality {} is not initialized",
+                    pid);
+                return {};
+            }
+            return result;
+        }
+
+        [[nodiscard]] std::size_t num_slots() const noexcept
+        {
+            return control_->num_slots_;
+        }
+
+        [[nodiscard]] std::size_t slot_capacity() const noexcept
+        {
+            return static_cast<std::size_t>(control_->slot_capacity_);
+        }
+
+        [[nodiscard]] ring_buffer ring(std::size_t slot) const noexcept
+        {
+            HPX_ASSERT(slot < num_slots());
+            return ring_buffer(slot_memory(slot));
+        }
+
+        [[nodiscard]] std::int32_t owner(std::size_t slot) const noexcept
+        {
+            HPX_ASSERT(slot < num_slots());
+            return owners()[slot].load(std::memory_order_acquire);
+        }
+
+        // Claim a free slot for the producer with the given process id,
+        // returns false if no slot is available anymore. Slots are never
+        // given back as the set of localities does not change while the
+        // application is running.
+        bool claim_slot(std::int32_t pid, std::size_t& slot) noexcept
+        {
+            std::size_t const slots = num_slots();
+            for (std::size_t i = 0; i != slots; ++i)
+            {
+                std::int32_t expected = 0;
+                if (owners()[i].compare_exchange_strong(
+                        expected, pid, std::memory_order_acq_rel))
+                {
+                    slot = i;
+                    return true;
+                }
+                if (expected == pid)
+                {
+                    // a previous connection of the same process already
+                    // claimed this slot
+                    slot = i;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return static_cast<bool>(segment_);
+        }
+
+    private:
+        [[nodiscard]] std::atomic<std::int32_t>* owners() const noexcept
+        {
+            return reinterpret_cast<std::atomic<std::int32_t>*>(
+                static_cast<char*>(segment_.data()) + owners_offset());
+        }
+
+        [[nodiscard]] void* slot_memory(std::size_t slot) const noexcept
+        {
+            return static_cast<char*>(segment_.data()) +
+                slots_offset(control_->num_slots_) +
+                slot * slot_size(static_cast<std::size_t>(
+                           control_->slot_capacity_));
+        }
+
+        shared_memory_segment segment_;
+        control_block* control_ = nullptr;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
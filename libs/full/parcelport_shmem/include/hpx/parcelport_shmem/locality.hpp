@@ -0,0 +1,85 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/serialization.hpp>
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A shared memory locality is identified by the host it runs on and by
+    // the process id of the locality. The process id is used to derive the
+    // name of the inbound shared memory segment of that locality.
+    class locality
+    {
+    public:
+        locality() noexcept
+          : pid_(-1)
+        {
+        }
+
+        locality(std::string host, std::int32_t pid) noexcept
+          : host_(HPX_MOVE(host))
+          , pid_(pid)
+        {
+        }
+
+        [[nodiscard]] std::string const& host() const noexcept
+        {
+            return host_;
+        }
+
+        [[nodiscard]] constexpr std::int32_t pid() const noexcept
+        {
+            return pid_;
+        }
+
+        [[nodiscard]] static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        [[nodiscard]] explicit operator bool() const noexcept
+        {
+            return pid_ != -1;
+        }
+
+        HPX_EXPORT void save(serialization::output_archive& ar) const;
+        HPX_EXPORT void load(serialization::input_archive& ar);
+
+    private:
+        friend bool operator==(
+            locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.pid_ == rhs.pid_ && lhs.host_ == rhs.host_;
+        }
+
+        friend bool operator<(locality const& lhs, locality const& rhs) noexcept
+        {
+            return lhs.host_ < rhs.host_ ||
+                (lhs.host_ == rhs.host_ && lhs.pid_ < rhs.pid_);
+        }
+
+        friend HPX_EXPORT std::ostream& operator<<(
+            std::ostream& os, locality const& loc) noexcept;
+
+        std::string host_;
+        std::int32_t pid_;
+    };
+
+    // Return the name of the host this locality is running on
+    HPX_EXPORT std::string get_host_name();
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,225 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/inbound_segment.hpp>
+#include <hpx/parcelport_shmem/ring_buffer.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+#include <hpx/parcelset/decode_parcels.hpp>
+#include <hpx/parcelset/parcel_buffer.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    template <typename Parcelport>
+    struct receiver
+    {
+        using buffer_type = parcel_buffer<>;
+
+        receiver(Parcelport& pp, std::size_t num_slots,
+            std::size_t slot_capacity)
+          : pp_(pp)
+          , segment_(inbound_segment::create(get_pid(), num_slots,
+                slot_capacity))
+          , slot_mtxs_(new hpx::spinlock[num_slots])
+          , next_slot_(0)
+        {
+        }
+
+        constexpr static void run() noexcept {}
+
+        bool background_work(std::size_t num_thread = -1)
+        {
+            // slots are claimed in order, so all claimed slots are at the
+            // front
+            std::size_t const num_slots = segment_.num_slots();
+            std::size_t num_claimed = 0;
+            while (num_claimed != num_slots &&
+                segment_.owner(num_claimed) != 0)
+            {
+                ++num_claimed;
+            }
+
+            if (num_claimed == 0)
+            {
+                return false;
+            }
+
+            // start looking at a different slot each time to avoid
+            // starvation of peers with a higher slot number
+            std::size_t const start =
+                next_slot_.fetch_add(1, std::memory_order_relaxed) %
+                num_claimed;
+
+            bool has_work = false;
+            for (std::size_t i = 0; i != num_claimed; ++i)
+            {
+                std::size_t const slot = (start + i) % num_claimed;
+                std::unique_lock l(slot_mtxs_[slot], std::try_to_lock);
+                if (!l.owns_lock())
+                {
+                    continue;
+                }
+
+                ring_buffer ring = segment_.ring(slot);
+                if (ring.peek() != 0)
+                {
+                    receive_message(ring, l, num_thread);
+                    has_work = true;
+                }
+            }
+            return has_work;
+        }
+
+    private:
+        template <typename Lock>
+        void receive_message(
+            ring_buffer& ring, Lock& l, std::size_t num_thread) noexcept
+        {
+            HPX_ASSERT_OWNS_LOCK(l);
+
+            buffer_type buffer;
+            std::vector<std::vector<char>> chunk_buffers;
+            shared_memory_segment segment;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            hpx::chrono::high_resolution_timer const timer;
+#endif
+            header h;
+            ring.read(0, &h, sizeof(h));
+            HPX_ASSERT(h.valid());
+
+            buffer.num_chunks_.first = h.num_zero_copy_chunks;
+            buffer.num_chunks_.second = h.num_non_zero_copy_chunks;
+            buffer.data_size_ = h.numbytes;
+            buffer.transmission_chunks_.resize(h.num_transmission_chunks());
+            buffer.data_.resize(
+                static_cast<std::size_t>(h.numbytes_nonzero_copy));
+            buffer.chunks_.resize(h.num_zero_copy_chunks);
+
+            std::size_t const tchunks_size =
+                buffer.transmission_chunks_.size() *
+                sizeof(buffer_type::transmission_chunk_type);
+
+            if (!h.is_out_of_line())
+            {
+                // copy the body out of the ring buffer
+                std::size_t offset = sizeof(h);
+                if (tchunks_size != 0)
+                {
+                    ring.read(offset, buffer.transmission_chunks_.data(),
+                        tchunks_size);
+                    offset += tchunks_size;
+                }
+
+                ring.read(offset, buffer.data_.data(), buffer.data_.size());
+                offset += buffer.data_.size();
+
+                chunk_buffers.resize(h.num_zero_copy_chunks);
+                for (std::size_t i = 0; i != h.num_zero_copy_chunks; ++i)
+                {
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer.transmission_chunks_[i].second);
+
+                    chunk_buffers[i].resize(chunk_size);
+                    ring.read(offset, chunk_buffers[i].data(), chunk_size);
+                    offset += chunk_size;
+
+                    buffer.chunks_[i] = serialization::create_pointer_chunk(
+                        chunk_buffers[i].data(), chunk_size);
+                }
+                HPX_ASSERT(offset == sizeof(h) + h.body_size);
+
+                ring.pop();
+            }
+            else
+            {
+                // the frame holds only the header, release it right away
+                ring.pop();
+
+                error_code ec(throwmode::lightweight);
+                segment = shared_memory_segment::open(
+                    message_segment_name(h.source, h.sequence_number), ec);
+                if (ec)
+                {
+                    LPT_(error).format(
+                        "shmem::receiver: could not open message segment: {}",
+                        ec.get_message());
+                    return;
+                }
+
+                // nobody else will map this segment again
+                segment.unlink();
+
+                char const* body = static_cast<char const*>(segment.data());
+                if (tchunks_size != 0)
+                {
+                    std::memcpy(static_cast<void*>(
+                                    buffer.transmission_chunks_.data()),
+                        body, tchunks_size);
+                    body += tchunks_size;
+                }
+
+                std::memcpy(buffer.data_.data(), body, buffer.data_.size());
+                body += buffer.data_.size();
+
+                // the zero-copy chunks are de-serialized directly from the
+                // mapped segment
+                for (std::size_t i = 0; i != h.num_zero_copy_chunks; ++i)
+                {
+                    auto const chunk_size = static_cast<std::size_t>(
+                        buffer.transmission_chunks_[i].second);
+
+                    buffer.chunks_[i] =
+                        serialization::create_pointer_chunk(body, chunk_size);
+                    body += chunk_size;
+                }
+            }
+
+            // allow for other threads to receive from the same peer while
+            // this message is being decoded
+            l.unlock();
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            parcelset::data_point& data = buffer.data_point_;
+            data.bytes_ = static_cast<std::size_t>(h.numbytes);
+            data.time_ = timer.elapsed_nanoseconds();
+#endif
+            // decode and handle received data, the segment (if any) stays
+            // mapped until all parcels have been de-serialized
+            handle_received_parcels(
+                decode_parcels(pp_, HPX_MOVE(buffer), num_thread), num_thread);
+        }
+
+        Parcelport& pp_;
+        inbound_segment segment_;
+        std::unique_ptr<hpx::spinlock[]> slot_mtxs_;
+        std::atomic<std::size_t> next_slot_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
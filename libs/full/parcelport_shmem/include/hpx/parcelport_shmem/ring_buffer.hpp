@@ -0,0 +1,222 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/concurrency.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // A single-producer, single-consumer ring buffer of variable sized
+    // frames. The ring buffer does not own its memory, it is placed into a
+    // (shared) memory area provided by the user. All positions are kept as
+    // monotonically increasing 64bit counters, the actual index into the data
+    // area is derived by masking with (capacity - 1). Each frame consists of
+    // an 8 byte length prefix followed by the payload, padded to a multiple
+    // of 8 bytes, which guarantees that the length prefix is never split at
+    // the wrap-around point.
+    class ring_buffer
+    {
+        struct control_block
+        {
+            // written by the producer only
+            util::cache_aligned_data<std::atomic<std::uint64_t>> head_;
+            // written by the consumer only
+            util::cache_aligned_data<std::atomic<std::uint64_t>> tail_;
+            util::cache_aligned_data<std::uint64_t> capacity_;
+        };
+
+        static constexpr std::size_t frame_alignment = sizeof(std::uint64_t);
+
+        static constexpr std::uint64_t padded_size(std::uint64_t size) noexcept
+        {
+            return (size + frame_alignment - 1) & ~(frame_alignment - 1);
+        }
+
+    public:
+        // A piece of a frame to write (pointer and size)
+        using piece_type = std::pair<void const*, std::size_t>;
+
+        constexpr ring_buffer() noexcept = default;
+
+        // Attach to a ring buffer that was already initialized in the given
+        // memory area.
+        explicit ring_buffer(void* memory) noexcept
+          : control_(static_cast<control_block*>(memory))
+          , data_(static_cast<char*>(memory) + sizeof(control_block))
+          , mask_(control_->capacity_.data_ - 1)
+        {
+        }
+
+        // Return the number of bytes needed to place a ring buffer with the
+        // given capacity (which has to be a power of two).
+        static constexpr std::size_t required_size(
+            std::size_t capacity) noexcept
+        {
+            return sizeof(control_block) + capacity;
+        }
+
+        // Initialize a new ring buffer in the given memory area, the area
+        // has to be at least required_size(capacity) bytes large.
+        static ring_buffer create(void* memory, std::size_t capacity) noexcept
+        {
+            HPX_ASSERT(capacity >= frame_alignment &&
+                (capacity & (capacity - 1)) == 0);
+
+            auto* control = new (memory) control_block();
+            control->head_.data_.store(0, std::memory_order_relaxed);
+            control->tail_.data_.store(0, std::memory_order_relaxed);
+            control->capacity_.data_ = capacity;
+
+            std::atomic_thread_fence(std::memory_order_release);
+            return ring_buffer(memory);
+        }
+
+        [[nodiscard]] constexpr std::size_t capacity() const noexcept
+        {
+            return mask_ + 1;
+        }
+
+        // Return the largest payload that could ever be written as a single
+        // frame.
+        [[nodiscard]] constexpr std::size_t max_frame_size() const noexcept
+        {
+            return capacity() - frame_alignment;
+        }
+
+        // Return the number of bytes a frame with the given payload size
+        // occupies in the ring buffer.
+        static constexpr std::size_t frame_size(std::size_t size) noexcept
+        {
+            return frame_alignment + padded_size(size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // producer side: write all given pieces as one frame, returns false
+        // if there is not enough space available
+        template <typename Pieces>
+        bool try_write(Pieces const& pieces) noexcept
+        {
+            std::uint64_t size = 0;
+            for (auto const& p : pieces)
+            {
+                size += p.second;
+            }
+            HPX_ASSERT(size != 0 && size <= max_frame_size());
+
+            std::uint64_t const total = frame_size(size);
+            std::uint64_t const head =
+                control_->head_.data_.load(std::memory_order_relaxed);
+            std::uint64_t const tail =
+                control_->tail_.data_.load(std::memory_order_acquire);
+
+            if (capacity() - (head - tail) < total)
+            {
+                return false;
+            }
+
+            std::memcpy(data_ + (head & mask_), &size, sizeof(size));
+
+            std::uint64_t pos = head + frame_alignment;
+            for (auto const& p : pieces)
+            {
+                copy_in(pos, p.first, p.second);
+                pos += p.second;
+            }
+
+            control_->head_.data_.store(
+                head + total, std::memory_order_release);
+            return true;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // consumer side: return the payload size of the next frame or zero
+        // if the ring buffer is empty
+        [[nodiscard]] std::size_t peek() const noexcept
+        {
+            std::uint64_t const tail =
+                control_->tail_.data_.load(std::memory_order_relaxed);
+            std::uint64_t const head =
+                control_->head_.data_.load(std::memory_order_acquire);
+
+            if (head == tail)
+            {
+                return 0;
+            }
+
+            std::uint64_t size = 0;
+            std::memcpy(&size, data_ + (tail & mask_), sizeof(size));
+            return static_cast<std::size_t>(size);
+        }
+
+        // copy part of the payload of the current frame
+        void read(
+            std::size_t offset, void* dest, std::size_t size) const noexcept
+        {
+            std::uint64_t const tail =
+                control_->tail_.data_.load(std::memory_order_relaxed);
+            copy_out(tail + frame_alignment + offset, dest, size);
+        }
+
+        // release the current frame, making its space available to the
+        // producer
+        void pop() noexcept
+        {
+            std::size_t const size = peek();
+            HPX_ASSERT(size != 0);
+
+            std::uint64_t const tail =
+                control_->tail_.data_.load(std::memory_order_relaxed);
+            control_->tail_.data_.store(
+                tail + frame_size(size), std::memory_order_release);
+        }
+
+    private:
+        void copy_in(std::uint64_t pos, void const* src, std::size_t size) const
+            noexcept
+        {
+            std::size_t const index = pos & mask_;
+            std::size_t const first = (std::min)(size, capacity() - index);
+            std::memcpy(data_ + index, src, first);
+            if (first != size)
+            {
+                std::memcpy(data_, static_cast<char const*>(src) + first,
+                    size - first);
+            }
+        }
+
+        void copy_out(std::uint64_t pos, void* dest, std::size_t size) const
+            noexcept
+        {
+            std::size_t const index = pos & mask_;
+            std::size_t const first = (std::min)(size, capacity() - index);
+            std::memcpy(dest, data_ + index, first);
+            if (first != size)
+            {
+                std::memcpy(
+                    static_cast<char*>(dest) + first, data_, size - first);
+            }
+        }
+
+        control_block* control_ = nullptr;
+        char* data_ = nullptr;
+        std::size_t mask_ = 0;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,210 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_shmem/channel.hpp>
+#include <hpx/parcelport_shmem/inbound_segment.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/sender_connection.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender
+    {
+        using connection_type = sender_connection;
+        using connection_ptr = std::shared_ptr<connection_type>;
+        using connection_list = std::deque<connection_ptr>;
+
+        explicit sender(std::size_t max_inline_size) noexcept
+          : max_inline_size_(max_inline_size)
+          , sequence_number_(0)
+        {
+        }
+
+        constexpr static void run() noexcept {}
+
+        // Return whether the locality with the given process id can be
+        // reached through shared memory. This attaches to the inbound
+        // segment of the destination (if not done before).
+        bool can_connect(std::int32_t pid)
+        {
+            error_code ec(throwmode::lightweight);
+            return get_channel(pid, ec) != nullptr;
+        }
+
+        connection_ptr create_connection(parcelset::locality const& dest,
+            parcelset::parcelport* pp, error_code& ec)
+        {
+            std::shared_ptr<channel> ch =
+                get_channel(dest.get<locality>().pid(), ec);
+            if (!ch)
+            {
+                return {};
+            }
+            return std::make_shared<connection_type>(
+                this, HPX_MOVE(ch), dest, pp, max_inline_size_);
+        }
+
+        void add(connection_ptr const& ptr)
+        {
+            std::unique_lock l(connections_mtx_);
+            connections_.push_back(ptr);
+        }
+
+        std::uint64_t next_sequence_number() noexcept
+        {
+            return ++sequence_number_;
+        }
+
+        void send_messages(connection_ptr connection)
+        {
+            // Check if sending has been completed....
+            if (connection->send())
+            {
+                error_code const ec(throwmode::lightweight);
+                hpx::move_only_function<void(error_code const&,
+                    parcelset::locality const&, connection_ptr)>
+                    postprocess_handler;
+                std::swap(
+                    postprocess_handler, connection->postprocess_handler_);
+                if (postprocess_handler)
+                    postprocess_handler(
+                        ec, connection->destination(), connection);
+            }
+            else
+            {
+                std::unique_lock l(connections_mtx_);
+                connections_.push_back(HPX_MOVE(connection));
+            }
+        }
+
+        bool background_work() noexcept
+        {
+            connection_ptr connection;
+            {
+                std::unique_lock const l(connections_mtx_, std::try_to_lock);
+                if (l && !connections_.empty())
+                {
+                    connection = HPX_MOVE(connections_.front());
+                    connections_.pop_front();
+                }
+            }
+
+            bool has_work = false;
+            if (connection)
+            {
+                send_messages(HPX_MOVE(connection));
+                has_work = true;
+            }
+            return has_work;
+        }
+
+        using parcel_buffer_type = parcel_buffer<>;
+        using callback_fn_type =
+            hpx::move_only_function<void(error_code const&)>;
+
+        bool send_immediate(parcelset::parcelport* pp,
+            parcelset::locality const& dest, parcel_buffer_type buffer,
+            callback_fn_type&& callbackFn)
+        {
+            error_code ec(throwmode::lightweight);
+            auto connection = create_connection(dest, pp, ec);
+            if (!connection)
+            {
+                callbackFn(ec);
+                return false;
+            }
+
+            connection->buffer_ = HPX_MOVE(buffer);
+            connection->async_write(HPX_MOVE(callbackFn), nullptr);
+            return true;
+        }
+
+    private:
+        std::shared_ptr<channel> get_channel(std::int32_t pid, error_code& ec)
+        {
+            std::unique_lock l(channels_mtx_);
+
+            if (auto const it = channels_.find(pid); it != channels_.end())
+            {
+                return it->second;
+            }
+
+            // failing to attach to a segment may be transient (the segment
+            // may not have been created yet or all slots may be in use), so
+            // failed attempts are retried after some time
+            auto const now = std::chrono::steady_clock::now();
+            if (auto const it = unreachable_.find(pid);
+                it != unreachable_.end())
+            {
+                if (now < it->second)
+                {
+                    HPX_THROWS_IF(ec, hpx::error::network_error,
+                        "shmem::sender::get_channel",
+                        "locality {} is not reachable through shared memory",
+                        pid);
+                    return {};
+                }
+                unreachable_.erase(it);
+            }
+
+            inbound_segment segment = inbound_segment::open(pid, ec);
+
+            std::size_t slot = 0;
+            if (!segment || !segment.claim_slot(get_pid(), slot))
+            {
+                unreachable_.emplace(pid, now + retry_interval);
+                if (!ec)
+                {
+                    HPX_THROWS_IF(ec, hpx::error::network_error,
+                        "shmem::sender::get_channel",
+                        "no free slot in the shared memory segment of "
+                        "locality {}",
+                        pid);
+                }
+                return {};
+            }
+
+            auto ch = std::make_shared<channel>(HPX_MOVE(segment), slot);
+            channels_.emplace(pid, ch);
+            return ch;
+        }
+
+        static constexpr std::chrono::seconds retry_interval{1};
+
+        std::size_t max_inline_size_;
+        std::atomic<std::uint64_t> sequence_number_;
+
+        hpx::spinlock channels_mtx_;
+        std::map<std::int32_t, std::shared_ptr<channel>> channels_;
+        std::map<std::int32_t, std::chrono::steady_clock::time_point>
+            unreachable_;
+
+        hpx::spinlock connections_mtx_;
+        connection_list connections_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
@@ -0,0 +1,239 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/serialization.hpp>
+#include <hpx/parcelport_shmem/channel.hpp>
+#include <hpx/parcelport_shmem/header.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/ring_buffer.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+#include <hpx/parcelset/parcelport_connection.hpp>
+#include <hpx/parcelset/parcelset_fwd.hpp>
+#include <hpx/parcelset_base/parcelport.hpp>
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+#include <hpx/modules/timing.hpp>
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace hpx::parcelset::policies::shmem {
+
+    struct sender;
+    struct sender_connection;
+
+    std::uint64_t next_sequence_number(sender*) noexcept;
+    void add_connection(sender*, std::shared_ptr<sender_connection> const&);
+
+    struct sender_connection
+      : parcelset::parcelport_connection<sender_connection>
+    {
+    private:
+        using sender_type = sender;
+        using piece_type = ring_buffer::piece_type;
+
+        using base_type = parcelset::parcelport_connection<sender_connection>;
+
+    public:
+        sender_connection(sender_type* s, std::shared_ptr<channel> ch,
+            parcelset::locality there, parcelset::parcelport* pp,
+            std::size_t max_inline_size) noexcept
+          : sender_(s)
+          , channel_(HPX_MOVE(ch))
+          , max_inline_size_(
+                (std::min)(max_inline_size, channel_->max_frame_size()))
+          , pp_(pp)
+          , there_(HPX_MOVE(there))
+        {
+        }
+
+        parcelset::locality const& destination() const noexcept
+        {
+            return there_;
+        }
+
+        static constexpr void verify_(
+            parcelset::locality const& /* parcel_locality_id */) noexcept
+        {
+        }
+
+        using handler_type = hpx::move_only_function<void(error_code const&)>;
+        using post_handler_type = hpx::move_only_function<void(
+            error_code const&, parcelset::locality const&,
+            std::shared_ptr<sender_connection>)>;
+
+        void async_write(
+            handler_type&& handler, post_handler_type&& parcel_postprocess)
+        {
+            HPX_ASSERT(!handler_);
+            HPX_ASSERT(!buffer_.data_.empty());
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.time_ = static_cast<std::int64_t>(
+                hpx::chrono::high_resolution_clock::now());
+#endif
+            handler_ = HPX_MOVE(handler);
+
+            error_code ec(throwmode::lightweight);
+            prepare_message(ec);
+            if (ec)
+            {
+                // the message could not be prepared (out of shared memory),
+                // report the error back to the caller
+                handler_(ec);
+                handler_.reset();
+                buffer_.clear();
+
+                if (parcel_postprocess)
+                    parcel_postprocess(ec, there_, shared_from_this());
+                return;
+            }
+
+            if (!send())
+            {
+                postprocess_handler_ = HPX_MOVE(parcel_postprocess);
+                add_connection(sender_, shared_from_this());
+            }
+            else
+            {
+                HPX_ASSERT(!handler_);
+                if (parcel_postprocess)
+                    parcel_postprocess(ec, there_, shared_from_this());
+            }
+        }
+
+        // Try to write the message into the ring buffer of the destination,
+        // returns false if the message has to be retried later.
+        bool send()
+        {
+            if (!channel_->try_write(pieces_))
+            {
+                return false;
+            }
+
+            done();
+            return true;
+        }
+
+        post_handler_type postprocess_handler_;
+
+    private:
+        void prepare_message(error_code& ec)
+        {
+            std::vector<piece_type> body;
+            body.reserve(buffer_.chunks_.size() + 2);
+
+            // transmission chunks are needed only if there are zero-copy
+            // chunks
+            auto const& tchunks = buffer_.transmission_chunks_;
+            if (buffer_.num_chunks_.first != 0)
+            {
+                body.emplace_back(tchunks.data(),
+                    tchunks.size() *
+                        sizeof(parcel_buffer_type::transmission_chunk_type));
+            }
+
+            body.emplace_back(buffer_.data_.data(), buffer_.data_.size());
+
+            for (auto const& c : buffer_.chunks_)
+            {
+                if (c.type_ == serialization::chunk_type::chunk_type_pointer)
+                {
+                    body.emplace_back(c.data(), c.size());
+                }
+            }
+
+            std::uint64_t body_size = 0;
+            for (auto const& p : body)
+            {
+                body_size += p.second;
+            }
+
+            header_ = header::create(buffer_, get_pid(), body_size);
+
+            pieces_.clear();
+            pieces_.emplace_back(&header_, sizeof(header_));
+
+            if (sizeof(header_) + body_size <= max_inline_size_)
+            {
+                // small messages are copied directly into the ring buffer
+                pieces_.insert(pieces_.end(), body.begin(), body.end());
+                return;
+            }
+
+            // large messages are placed into a separate segment which is
+            // mapped by the receiver, the receiver unlinks the segment
+            std::uint64_t const sequence_number =
+                next_sequence_number(sender_);
+
+            shared_memory_segment segment = shared_memory_segment::create(
+                message_segment_name(header_.source, sequence_number),
+                static_cast<std::size_t>(body_size), ec);
+            if (ec)
+            {
+                return;
+            }
+
+            char* data = static_cast<char*>(segment.data());
+            for (auto const& p : body)
+            {
+                std::memcpy(data, p.first, p.second);
+                data += p.second;
+            }
+            segment.release();
+
+            header_.flags |= header::out_of_line;
+            header_.sequence_number = sequence_number;
+        }
+
+        void done()
+        {
+            error_code const ec(throwmode::lightweight);
+            handler_(ec);
+            handler_.reset();
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            buffer_.data_point_.bytes_ =
+                static_cast<std::size_t>(header_.numbytes);
+            buffer_.data_point_.time_ =
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now()) -
+                buffer_.data_point_.time_;
+            pp_->add_sent_data(buffer_.data_point_);
+#endif
+            pieces_.clear();
+            buffer_.clear();
+        }
+
+        sender_type* sender_;
+        std::shared_ptr<channel> channel_;
+        std::size_t max_inline_size_;
+
+        handler_type handler_;
+
+        header header_;
+        std::vector<piece_type> pieces_;
+
+        [[maybe_unused]] parcelset::parcelport* pp_;
+
+        parcelset::locality there_;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
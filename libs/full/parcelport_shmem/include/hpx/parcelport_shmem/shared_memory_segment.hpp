@@ -0,0 +1,105 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::shmem {
+
+    // Return the name of the inbound segment of the locality with the given
+    // process id.
+    HPX_EXPORT std::string inbound_segment_name(std::int32_t pid);
+
+    // Return the name of the segment used to transfer the out-of-line part
+    // of a message with the given sequence number sent by the locality with
+    // the given process id.
+    HPX_EXPORT std::string message_segment_name(
+        std::int32_t pid, std::uint64_t sequence_number);
+
+    // Return the process id of the calling process.
+    HPX_EXPORT std::int32_t get_pid() noexcept;
+
+    // RAII wrapper for a POSIX shared memory segment mapped into the address
+    // space of this process. The segment is unmapped on destruction. If the
+    // segment was created by this instance, it is also unlinked unless
+    // release() was called before.
+    class HPX_EXPORT shared_memory_segment
+    {
+    public:
+        shared_memory_segment() noexcept = default;
+
+        shared_memory_segment(shared_memory_segment&& rhs) noexcept;
+        shared_memory_segment& operator=(shared_memory_segment&& rhs) noexcept;
+
+        shared_memory_segment(shared_memory_segment const&) = delete;
+        shared_memory_segment& operator=(shared_memory_segment const&) = delete;
+
+        ~shared_memory_segment();
+
+        // Create a new segment of the given size, an existing (stale)
+        // segment with the same name is removed first.
+        static shared_memory_segment create(
+            std::string name, std::size_t size, error_code& ec = throws);
+
+        // Map an existing segment, the size of the segment is determined
+        // from the underlying shared memory object.
+        static shared_memory_segment open(
+            std::string name, error_code& ec = throws);
+
+        // Remove the name of the segment from the system, the segment stays
+        // mapped until this instance is destroyed.
+        void unlink() noexcept;
+
+        // Do not unlink the segment on destruction, the ownership is
+        // transferred to another process.
+        constexpr void release() noexcept
+        {
+            owner_ = false;
+        }
+
+        [[nodiscard]] constexpr void* data() const noexcept
+        {
+            return data_;
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        [[nodiscard]] std::string const& name() const noexcept
+        {
+            return name_;
+        }
+
+        [[nodiscard]] explicit constexpr operator bool() const noexcept
+        {
+            return data_ != nullptr;
+        }
+
+    private:
+        void reset() noexcept;
+
+        std::string name_;
+        void* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool owner_ = false;
+    };
+}    // namespace hpx::parcelset::policies::shmem
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,368 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/resource_partitioner.hpp>
+#include <hpx/modules/runtime_configuration.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/util.hpp>
+#include <hpx/plugin/traits/plugin_config_data.hpp>
+
+#include <hpx/command_line_handling/command_line_handling.hpp>
+#include <hpx/parcelport_shmem/locality.hpp>
+#include <hpx/parcelport_shmem/receiver.hpp>
+#include <hpx/parcelport_shmem/sender.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+#include <hpx/parcelset/parcelport_impl.hpp>
+#include <hpx/parcelset_base/locality.hpp>
+#include <hpx/plugin_factories/parcelport_factory.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset {
+
+    namespace policies::shmem {
+        class HPX_EXPORT parcelport;
+    }    // namespace policies::shmem
+
+    template <>
+    struct connection_handler_traits<policies::shmem::parcelport>
+    {
+        using connection_type = policies::shmem::sender_connection;
+        using send_early_parcel = std::false_type;
+        using do_background_work = std::true_type;
+        using send_immediate_parcels = std::true_type;
+        using is_connectionless = std::true_type;
+
+        static constexpr const char* type() noexcept
+        {
+            return "shmem";
+        }
+
+        static constexpr const char* pool_name() noexcept
+        {
+            return "parcel-pool-shmem";
+        }
+
+        static constexpr const char* pool_name_postfix() noexcept
+        {
+            return "-shmem";
+        }
+    };
+
+    namespace policies::shmem {
+
+        std::uint64_t next_sequence_number(sender* s) noexcept
+        {
+            return s->next_sequence_number();
+        }
+
+        void add_connection(
+            sender* s, std::shared_ptr<sender_connection> const& ptr)
+        {
+            s->add(ptr);
+        }
+
+        class HPX_EXPORT parcelport : public parcelport_impl<parcelport>
+        {
+            using base_type = parcelport_impl<parcelport>;
+
+            // localities sharing the same host name are assumed to be able to
+            // share memory
+            static std::string host_name(
+                util::runtime_configuration const& ini)
+            {
+                std::string host =
+                    ini.get_entry("hpx.parcel.shmem.host", "");
+                if (host.empty())
+                {
+                    host = get_host_name();
+                }
+                return host;
+            }
+
+            static parcelset::locality here(
+                util::runtime_configuration const& ini)
+            {
+                return parcelset::locality(locality(host_name(ini), get_pid()));
+            }
+
+            static std::size_t background_threads(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(ini,
+                    "hpx.parcel.shmem.background_threads",
+                    static_cast<std::size_t>(-1));
+            }
+
+            static bool enable_send_immediate(
+                util::runtime_configuration const& ini)
+            {
+                if (hpx::util::get_entry_as<std::size_t>(
+                        ini, "hpx.parcel.shmem.sendimm", 1) != 0)
+                {
+                    return true;
+                }
+                return false;
+            }
+
+            static std::size_t ring_buffer_size(
+                util::runtime_configuration const& ini)
+            {
+                // the ring buffer size has to be a power of two
+                auto const size = hpx::util::get_entry_as<std::size_t>(ini,
+                    "hpx.parcel.shmem.ring_buffer_size", 1048576);
+
+                std::size_t result = 4096;
+                while (result < size)
+                {
+                    result <<= 1;
+                }
+                return result;
+            }
+
+            static std::size_t max_inline_size(
+                util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.max_inline_size", 65536);
+            }
+
+            static std::size_t max_peers(util::runtime_configuration const& ini)
+            {
+                return hpx::util::get_entry_as<std::size_t>(
+                    ini, "hpx.parcel.shmem.max_peers", 64);
+            }
+
+        public:
+            using sender_type = sender;
+
+            parcelport(util::runtime_configuration const& ini,
+                threads::policies::callback_notifier const& notifier)
+              : base_type(ini, here(ini), notifier)
+              , stopped_(false)
+              , host_(host_name(ini))
+              , sender_(max_inline_size(ini))
+              , receiver_(*this, max_peers(ini), ring_buffer_size(ini))
+              , background_threads_(background_threads(ini))
+              , enable_send_immediate_(enable_send_immediate(ini))
+            {
+            }
+
+            parcelport(parcelport const&) = delete;
+            parcelport(parcelport&&) = delete;
+            parcelport& operator=(parcelport const&) = delete;
+            parcelport& operator=(parcelport&&) = delete;
+
+            ~parcelport() override = default;
+
+            // Start the handling of connections.
+            bool do_run()
+            {
+                receiver_.run();
+                sender_.run();
+
+                for (std::size_t i = 0; i != io_service_pool_.size(); ++i)
+                {
+                    io_service_pool_.get_io_service(static_cast<int>(i))
+                        .post(hpx::bind(&parcelport::io_service_work, this));
+                }
+                return true;
+            }
+
+            // Stop the handling of connections.
+            void do_stop()
+            {
+                while (do_background_work(0, parcelport_background_mode::all))
+                {
+                    if (threads::get_self_ptr())
+                    {
+                        hpx::this_thread::suspend(
+                            hpx::threads::thread_schedule_state::pending,
+                            "shmem::parcelport::do_stop");
+                    }
+                }
+                stopped_.store(true, std::memory_order_release);
+            }
+
+            /// Return the name of this locality
+            std::string get_locality_name() const override
+            {
+                return host_;
+            }
+
+            // Parcels are sent through shared memory only to localities
+            // running on the same host whose inbound segment can be attached
+            // to, all other destinations use the next parcelport in line.
+            // Alternative parcelports are always enabled after bootstrap,
+            // which must not make this parcelport claim remote hosts.
+            bool can_connect(parcelset::locality const& dest,
+                bool /* use_alternative_parcelport */) override
+            {
+                locality const& l = dest.get<locality>();
+                return l.host() == host_ && sender_.can_connect(l.pid());
+            }
+
+            std::shared_ptr<sender_connection> create_connection(
+                parcelset::locality const& l, error_code& ec)
+            {
+                return sender_.create_connection(l, this, ec);
+            }
+
+            parcelset::locality agas_locality(
+                util::runtime_configuration const&) const override
+            {
+                // this parcelport is never used for bootstrapping
+                return parcelset::locality(locality());
+            }
+
+            parcelset::locality create_locality() const override
+            {
+                return parcelset::locality(locality());
+            }
+
+            bool background_work(
+                std::size_t num_thread, parcelport_background_mode mode)
+            {
+                if (stopped_.load(std::memory_order_acquire) ||
+                    num_thread >= background_threads_)
+                {
+                    return false;
+                }
+
+                bool has_work = false;
+                if (mode & parcelport_background_mode::send)
+                {
+                    has_work = sender_.background_work();
+                }
+                if (mode & parcelport_background_mode::receive)
+                {
+                    has_work =
+                        receiver_.background_work(num_thread) || has_work;
+                }
+                return has_work;
+            }
+
+            constexpr bool can_send_immediate() const noexcept
+            {
+                return enable_send_immediate_;
+            }
+
+            bool send_immediate(parcelset::parcelport* pp,
+                parcelset::locality const& dest,
+                sender::parcel_buffer_type buffer,
+                sender::callback_fn_type&& callbackFn)
+            {
+                return sender_.send_immediate(
+                    pp, dest, HPX_MOVE(buffer), HPX_MOVE(callbackFn));
+            }
+
+        private:
+            std::atomic<bool> stopped_;
+            std::string host_;
+
+            sender sender_;
+            receiver<parcelport> receiver_;
+
+            void io_service_work()
+            {
+                std::size_t k = 0;
+
+                // We only execute work on the IO service while HPX is starting
+                while (hpx::is_starting())
+                {
+                    bool has_work = sender_.background_work();
+                    has_work = receiver_.background_work() || has_work;
+                    if (has_work)
+                    {
+                        k = 0;
+                    }
+                    else
+                    {
+                        ++k;
+                        util::detail::yield_k(k,
+                            "hpx::parcelset::policies::shmem::parcelport::"
+                            "io_service_work");
+                    }
+                }
+            }
+
+            std::size_t background_threads_;
+            bool enable_send_immediate_;
+        };
+    }    // namespace policies::shmem
+}    // namespace hpx::parcelset
+
+#include <hpx/config/warnings_suffix.hpp>
+
+// Inject additional configuration data into the factory registry for this
+// type. This information ends up in the system-wide configuration database
+// under the plugin specific section:
+//
+//      [hpx.parcel.shmem]
+//      ...
+//      priority = 200
+//
+template <>
+struct hpx::traits::plugin_config_data<
+    hpx::parcelset::policies::shmem::parcelport>
+{
+    // the shared memory parcelport is preferred for all destinations it can
+    // reach
+    static constexpr char const* priority() noexcept
+    {
+        return "200";
+    }
+
+    static constexpr void init(int* /* argc */, char*** /* argv */,
+        util::command_line_handling& /* cfg */) noexcept
+    {
+    }
+
+    // by default no additional initialization using the resource
+    // partitioner is required
+    static constexpr void init(hpx::resource::partitioner&) noexcept {}
+
+    static constexpr void destroy() noexcept {}
+
+    static constexpr char const* call() noexcept
+    {
+        return
+            // size of the ring buffer for each peer (rounded up to the next
+            // power of two)
+            "ring_buffer_size = "
+            "${HPX_PARCEL_SHMEM_RING_BUFFER_SIZE:1048576}\n"
+            // messages larger than this are transferred through a separate
+            // shared memory segment
+            "max_inline_size = ${HPX_PARCEL_SHMEM_MAX_INLINE_SIZE:65536}\n"
+            // maximal number of localities sending to this locality
+            "max_peers = ${HPX_PARCEL_SHMEM_MAX_PEERS:64}\n"
+            // name of the host used to decide which localities can share
+            // memory, default: the name reported by gethostname
+            "host = ${HPX_PARCEL_SHMEM_HOST:}\n"
+            // number of cores that do background work, default: all
+            "background_threads = "
+            "${HPX_PARCEL_SHMEM_BACKGROUND_THREADS:-1}\n"
+            "sendimm = 1\n";
+    }
+};    // namespace hpx::traits
+
+HPX_REGISTER_PARCELPORT(hpx::parcelset::policies::shmem::parcelport, shmem)
+
+#endif
@@ -0,0 +1,206 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_SHMEM)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::shmem {
+
+    std::string inbound_segment_name(std::int32_t pid)
+    {
+        return hpx::util::format("/hpx.shmem.{}", pid);
+    }
+
+    std::string message_segment_name(
+        std::int32_t pid, std::uint64_t sequence_number)
+    {
+        return hpx::util::format("/hpx.shmem.{}.{}", pid, sequence_number);
+    }
+
+    std::int32_t get_pid() noexcept
+    {
+        return static_cast<std::int32_t>(::getpid());
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    shared_memory_segment::shared_memory_segment(
+        shared_memory_segment&& rhs) noexcept
+      : name_(HPX_MOVE(rhs.name_))
+      , data_(std::exchange(rhs.data_, nullptr))
+      , size_(std::exchange(rhs.size_, 0))
+      , owner_(std::exchange(rhs.owner_, false))
+    {
+    }
+
+    shared_memory_segment& shared_memory_segment::operator=(
+        shared_memory_segment&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+            name_ = HPX_MOVE(rhs.name_);
+            data_ = std::exchange(rhs.data_, nullptr);
+            size_ = std::exchange(rhs.size_, 0);
+            owner_ = std::exchange(rhs.owner_, false);
+        }
+        return *this;
+    }
+
+    shared_memory_segment::~shared_memory_segment()
+    {
+        reset();
+    }
+
+    void shared_memory_segment::reset() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+        if (owner_)
+        {
+            unlink();
+        }
+    }
+
+    void shared_memory_segment::unlink() noexcept
+    {
+        if (!name_.empty())
+        {
+            ::shm_unlink(name_.c_str());
+        }
+        owner_ = false;
+    }
+
+    shared_memory_segment shared_memory_segment::create(
+        std::string name, std::size_t size, error_code& ec)
+    {
+        // remove stale segments left behind by a previous process that
+        // happened to have the same process id
+        ::shm_unlink(name.c_str());
+
+        int const fd = ::shm_open(
+            name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::create",
+                "could not create shared memory segment {}: {}", name,
+                std::strerror(errno));
+            return {};
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+        {
+            int const err = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::create",
+                "could not resize shared memory segment {} to {} bytes: {}",
+                name, size, std::strerror(err));
+            return {};
+        }
+
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            ::shm_unlink(name.c_str());
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::create",
+                "could not map shared memory segment {}: {}", name,
+                std::strerror(err));
+            return {};
+        }
+
+        shared_memory_segment result;
+        result.name_ = HPX_MOVE(name);
+        result.data_ = data;
+        result.size_ = size;
+        result.owner_ = true;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return result;
+    }
+
+    shared_memory_segment shared_memory_segment::open(
+        std::string name, error_code& ec)
+    {
+        int const fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd == -1)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::open",
+                "could not open shared memory segment {}: {}", name,
+                std::strerror(errno));
+            return {};
+        }
+
+        struct stat st = {};
+        if (::fstat(fd, &st) == -1 || st.st_size == 0)
+        {
+            int const err = errno;
+            ::close(fd);
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::open",
+                "could not determine size of shared memory segment {}: {}",
+                name, std::strerror(err));
+            return {};
+        }
+
+        auto const size = static_cast<std::size_t>(st.st_size);
+        void* data =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        int const err = errno;
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            HPX_THROWS_IF(ec, hpx::error::network_error,
+                "shared_memory_segment::open",
+                "could not map shared memory segment {}: {}", name,
+                std::strerror(err));
+            return {};
+        }
+
+        shared_memory_segment result;
+        result.name_ = HPX_MOVE(name);
+        result.data_ = data;
+        result.size_ = size;
+        result.owner_ = false;
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return result;
+    }
+}    // namespace hpx::parcelset::policies::shmem
+
+#endif
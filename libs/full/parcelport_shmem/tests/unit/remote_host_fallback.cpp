@@ -0,0 +1,76 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Each locality pretends to run on a different host. The shared memory
+// parcelport must not claim the other locality, all parcels have to be sent
+// through the TCP parcelport instead.
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/shared_memory_segment.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::int32_t get_locality_pid()
+{
+    return hpx::parcelset::policies::shmem::get_pid();
+}
+
+HPX_PLAIN_ACTION(get_locality_pid)
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+std::int64_t get_sent_count(std::string const& pp_type)
+{
+    using hpx::performance_counters::performance_counter;
+
+    performance_counter counter(
+        "/parcels{locality#0/total}/count/" + pp_type + "/sent");
+    return counter.get_value<std::int64_t>(hpx::launch::sync);
+}
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        for (int i = 0; i != 10; ++i)
+        {
+            HPX_TEST_NEQ(get_locality_pid_action()(id), std::int32_t(0));
+        }
+    }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+    HPX_TEST_EQ(get_sent_count("shmem"), std::int64_t(0));
+    HPX_TEST_LT(std::int64_t(0), get_sent_count("tcp"));
+#endif
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // use a different (fake) host name for each locality
+    std::vector<std::string> const cfg = {"hpx.parcel.shmem.enable=1",
+        "hpx.parcel.tcp.enable=1",
+        "hpx.parcel.shmem.host=host-" +
+            std::to_string(hpx::parcelset::policies::shmem::get_pid())};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
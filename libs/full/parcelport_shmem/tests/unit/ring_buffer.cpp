@@ -0,0 +1,113 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelport_shmem/ring_buffer.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+using hpx::parcelset::policies::shmem::ring_buffer;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_empty()
+{
+    std::size_t const capacity = 256;
+    std::vector<std::uint64_t> memory(
+        ring_buffer::required_size(capacity) / sizeof(std::uint64_t) + 1);
+
+    ring_buffer ring = ring_buffer::create(memory.data(), capacity);
+    HPX_TEST_EQ(ring.capacity(), capacity);
+    HPX_TEST_EQ(ring.peek(), static_cast<std::size_t>(0));
+
+    // attaching to the same memory gives access to the same ring
+    ring_buffer attached(memory.data());
+    HPX_TEST_EQ(attached.capacity(), capacity);
+    HPX_TEST_EQ(attached.peek(), static_cast<std::size_t>(0));
+}
+
+void test_pieces()
+{
+    std::size_t const capacity = 256;
+    std::vector<std::uint64_t> memory(
+        ring_buffer::required_size(capacity) / sizeof(std::uint64_t) + 1);
+
+    ring_buffer ring = ring_buffer::create(memory.data(), capacity);
+
+    std::array<char, 5> first = {'h', 'e', 'l', 'l', 'o'};
+    std::array<char, 6> second = {' ', 'w', 'o', 'r', 'l', 'd'};
+
+    std::array<ring_buffer::piece_type, 2> const pieces = {
+        ring_buffer::piece_type(first.data(), first.size()),
+        ring_buffer::piece_type(second.data(), second.size())};
+
+    HPX_TEST(ring.try_write(pieces));
+    HPX_TEST_EQ(ring.peek(), first.size() + second.size());
+
+    std::array<char, 11> result = {};
+    ring.read(0, result.data(), 5);
+    ring.read(5, result.data() + 5, 6);
+    HPX_TEST(std::equal(first.begin(), first.end(), result.begin()));
+    HPX_TEST(std::equal(second.begin(), second.end(), result.begin() + 5));
+
+    ring.pop();
+    HPX_TEST_EQ(ring.peek(), static_cast<std::size_t>(0));
+}
+
+void test_full_and_wrap_around()
+{
+    std::size_t const capacity = 128;
+    std::vector<std::uint64_t> memory(
+        ring_buffer::required_size(capacity) / sizeof(std::uint64_t) + 1);
+
+    ring_buffer ring = ring_buffer::create(memory.data(), capacity);
+
+    // frames of 29 bytes occupy 40 bytes each, three of them fit
+    std::vector<char> payload(29);
+    std::array<ring_buffer::piece_type, 1> const pieces = {
+        ring_buffer::piece_type(payload.data(), payload.size())};
+
+    HPX_TEST(ring.try_write(pieces));
+    HPX_TEST(ring.try_write(pieces));
+    HPX_TEST(ring.try_write(pieces));
+    HPX_TEST(!ring.try_write(pieces));
+
+    // writing and reading many frames forces the payload to wrap around the
+    // end of the data area
+    for (int i = 0; i != 100; ++i)
+    {
+        ring.pop();
+
+        std::iota(payload.begin(), payload.end(), static_cast<char>(i));
+        HPX_TEST(ring.try_write(pieces));
+
+        // skip the two older frames
+        ring.pop();
+        ring.pop();
+
+        std::vector<char> result(payload.size());
+        HPX_TEST_EQ(ring.peek(), payload.size());
+        ring.read(0, result.data(), result.size());
+        HPX_TEST(result == payload);
+
+        HPX_TEST(ring.try_write(pieces));
+        HPX_TEST(ring.try_write(pieces));
+    }
+}
+
+int main()
+{
+    test_empty();
+    test_pieces();
+    test_full_and_wrap_around();
+
+    return hpx::util::report_errors();
+}
@@ -13,6 +13,9 @@
 #include <hpx/config.hpp>
 
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
+#endif
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelport_tcp/sender.hpp>
 #include <hpx/parcelset/parcelport_impl.hpp>
@@ -109,6 +112,15 @@ namespace hpx::parcelset {
 
             parcelset::locality create_locality() const override;
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            // Return the io_uring service used for the data transfer, returns
+            // nullptr if the Asio reactor is used
+            io_uring_service* io_uring() const noexcept
+            {
+                return io_uring_.get();
+            }
+#endif
+
         private:
             void handle_accept(std::error_code const& e,
                 std::shared_ptr<receiver> receiver_conn);
@@ -129,6 +141,10 @@ namespace hpx::parcelset {
             using write_connections_set = std::set<std::weak_ptr<sender>>;
             write_connections_set write_connections_;
 #endif
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            std::unique_ptr<io_uring_service> io_uring_;
+#endif
         };
     }    // namespace policies::tcp
 }    // namespace hpx::parcelset
@@ -0,0 +1,144 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/modules/functional.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+#include <sys/uio.h>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::parcelset::policies::tcp {
+
+    // The io_uring_service performs the data transfer on the sockets of the
+    // TCP parcelport using Linux' io_uring interface instead of the Asio
+    // reactor. Connections are still established through Asio, only the
+    // reads and writes on the connected sockets are handed to this service.
+    //
+    // All operations are queued and handed to the kernel in batches by a
+    // single service thread per parcelport, which is registered with the
+    // runtime like the threads of the parcel pool. Completion handlers are
+    // handed to the configured dispatch function (the parcelport runs them on
+    // its parcel pool), they are invoked on the service thread only if none
+    // was given.
+    // Optionally, the submission queue is polled by a kernel thread
+    // (SQPOLL), and data arriving on accepted connections is received using
+    // multishot receive operations into a ring of buffers registered with
+    // the kernel.
+    class HPX_EXPORT io_uring_service
+    {
+    public:
+        using handler_type = hpx::move_only_function<void(
+            std::error_code const&, std::size_t)>;
+
+        using dispatch_type =
+            hpx::function<void(hpx::move_only_function<void()>&&)>;
+
+        struct options
+        {
+            // number of entries of the submission queue
+            unsigned queue_depth = 256;
+
+            // use a kernel thread for polling the submission queue
+            bool sqpoll = false;
+
+            // time (in milliseconds) after which the polling kernel thread
+            // goes to sleep
+            unsigned sqpoll_idle = 1000;
+
+            // use multishot receive operations for streams
+            bool multishot = true;
+
+            // number and size of the buffers registered with the kernel for
+            // multishot receive operations (the number of buffers has to be a
+            // power of two)
+            unsigned num_buffers = 256;
+            std::size_t buffer_size = 16384;
+
+            // used to register the service thread with the runtime, the
+            // thread is announced as thread 'thread_index' of the given pool
+            threads::policies::callback_notifier notifier;
+            char const* pool_name = "io_uring";
+            char const* pool_name_postfix = "";
+            std::size_t thread_index = 0;
+
+            // used to run the completion handlers, they are invoked on the
+            // service thread if this is empty
+            dispatch_type dispatch;
+        };
+
+        // Throws a std::system_error if io_uring is not available
+        explicit io_uring_service(options const& opts);
+
+        io_uring_service(io_uring_service const&) = delete;
+        io_uring_service(io_uring_service&&) = delete;
+        io_uring_service& operator=(io_uring_service const&) = delete;
+        io_uring_service& operator=(io_uring_service&&) = delete;
+
+        ~io_uring_service();
+
+        // Start/stop the service thread. All operations still pending while
+        // the service is stopped are completed with operation_aborted.
+        void start();
+        void stop();
+
+        // Write all of the given buffers to the socket, the handler is
+        // invoked once all data was sent or an error occurred.
+        void async_write(
+            int fd, std::vector<iovec>&& buffers, handler_type&& handler);
+
+        // Fill all of the given buffers from the socket, the handler is
+        // invoked once all data was received or an error occurred.
+        void async_read(
+            int fd, std::vector<iovec>&& buffers, handler_type&& handler);
+
+        // Start receiving data from the given socket using multishot receive
+        // operations. Subsequent reads are served from the received data.
+        // Does nothing if multishot receive operations are not enabled.
+        void start_receive(int fd);
+
+        // Cancel all operations on the given socket. Returns after all
+        // operations have been canceled, the socket can be safely closed
+        // afterwards.
+        void cancel(int fd);
+
+        // Convert a sequence of Asio buffers into I/O vectors
+        template <typename BufferSequence>
+        static std::vector<iovec> make_iovecs(BufferSequence const& buffers)
+        {
+            std::vector<iovec> result;
+            result.reserve(buffers.size());
+            for (auto const& b : buffers)
+            {
+                void const* data = b.data();
+                result.push_back(iovec{const_cast<void*>(data), b.size()});
+            }
+            return result;
+        }
+
+        [[nodiscard]] bool uses_multishot() const noexcept;
+        [[nodiscard]] bool uses_sqpoll() const noexcept;
+
+    private:
+        struct impl;
+        std::unique_ptr<impl> impl_;
+    };
+}    // namespace hpx::parcelset::policies::tcp
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -41,6 +41,7 @@
 #undef VT1
 #undef VT2
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -128,7 +129,7 @@ namespace hpx::parcelset::policies::tcp {
                 void (receiver::*f)(std::error_code const&, std::size_t,
                     Handler) = &receiver::handle_read_header<Handler>;
 
-                asio::async_read(socket_, buffers,
+                read_buffers(buffers,
                     hpx::bind(f, shared_from_this(),
                         placeholders::_1,    // error
                         placeholders::_2,    // bytes_transferred
@@ -138,6 +139,31 @@ namespace hpx::parcelset::policies::tcp {
 
         void shutdown()
         {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_service* service = parcelport_.io_uring();
+                service != nullptr)
+            {
+                // make sure that no io_uring operation refers to the socket
+                // anymore before it is closed, the lock can't be held while
+                // waiting as the completion handlers acquire it
+                int fd = -1;
+                {
+                    std::lock_guard lk(mtx_);
+                    if (socket_.is_open())
+                    {
+                        std::error_code ec;
+                        socket_.shutdown(
+                            asio::ip::tcp::socket::shutdown_both, ec);
+                        fd = socket_.native_handle();
+                    }
+                }
+
+                if (fd != -1)
+                {
+                    service->cancel(fd);
+                }
+            }
+#endif
             std::lock_guard lk(mtx_);
 
             // gracefully and portably shutdown the socket
@@ -156,6 +182,38 @@ namespace hpx::parcelset::policies::tcp {
         }
 
     private:
+        template <typename Buffers, typename Handler>
+        void read_buffers(Buffers const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_service* service = parcelport_.io_uring();
+                service != nullptr)
+            {
+                service->async_read(socket_.native_handle(),
+                    io_uring_service::make_iovecs(buffers),
+                    HPX_FORWARD(Handler, handler));
+                return;
+            }
+#endif
+            asio::async_read(socket_, buffers, HPX_FORWARD(Handler, handler));
+        }
+
+        template <typename Buffers, typename Handler>
+        void write_buffers(Buffers const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_service* service = parcelport_.io_uring();
+                service != nullptr)
+            {
+                service->async_write(socket_.native_handle(),
+                    io_uring_service::make_iovecs(buffers),
+                    HPX_FORWARD(Handler, handler));
+                return;
+            }
+#endif
+            asio::async_write(socket_, buffers, HPX_FORWARD(Handler, handler));
+        }
+
         // Handle a completed read of the message size from the message header.
         template <typename Handler>
         void handle_read_header(std::error_code const& e,
@@ -249,7 +307,7 @@ namespace hpx::parcelset::policies::tcp {
                         quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    asio::async_read(socket_, buffers,
+                    read_buffers(buffers,
                         hpx::bind(f, shared_from_this(),
                             placeholders::_1,    // error,
                             util::protect(handler)));
@@ -370,7 +428,7 @@ namespace hpx::parcelset::policies::tcp {
                         quickack(true);
                     socket_.set_option(quickack);
 #endif
-                    asio::async_read(socket_, buffers,
+                    read_buffers(buffers,
                         hpx::bind(f, shared_from_this(),
                             placeholders::_1,    // error,
                             util::protect(handler)));
@@ -430,8 +488,9 @@ namespace hpx::parcelset::policies::tcp {
                         return;
                     }
 
-                    asio::async_write(socket_,
-                        asio::buffer(&ack_, sizeof(ack_)),
+                    std::array<asio::const_buffer, 1> const buffers = {
+                        asio::buffer(&ack_, sizeof(ack_))};
+                    write_buffers(buffers,
                         hpx::bind(f, shared_from_this(),
                             placeholders::_1,    // error,
                             util::protect(handler)));
@@ -19,6 +19,9 @@
 #include <hpx/modules/threading_base.hpp>
 #include <hpx/modules/timing.hpp>
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
+#endif
 #include <hpx/parcelport_tcp/locality.hpp>
 #include <hpx/parcelset/parcelport_connection.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
@@ -42,6 +45,7 @@
 #undef VT1
 #undef VT2
 
+#include <array>
 #include <cstddef>
 #include <memory>
 #include <system_error>
@@ -93,6 +97,15 @@ namespace hpx::parcelset::policies::tcp {
             return there_;
         }
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // Perform the data transfer using the given io_uring service instead
+        // of Asio (if not nullptr)
+        void set_io_uring_service(io_uring_service* service) noexcept
+        {
+            io_uring_ = service;
+        }
+#endif
+
         void verify_(parcelset::locality const& parcel_locality_id) const
         {
 #if defined(HPX_DEBUG)
@@ -183,12 +196,42 @@ namespace hpx::parcelset::policies::tcp {
             void (sender::*f)(std::error_code const&, std::size_t) =
                 &sender::handle_write;
 
-            asio::async_write(socket_, buffers,
+            write_buffers(buffers,
                 hpx::bind(f, shared_from_this(), hpx::placeholders::_1,
                     hpx::placeholders::_2));
         }
 
     private:
+        template <typename Buffers, typename Handler>
+        void write_buffers(Buffers const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_ != nullptr)
+            {
+                io_uring_->async_write(socket_.native_handle(),
+                    io_uring_service::make_iovecs(buffers),
+                    HPX_FORWARD(Handler, handler));
+                return;
+            }
+#endif
+            asio::async_write(socket_, buffers, HPX_FORWARD(Handler, handler));
+        }
+
+        template <typename Buffers, typename Handler>
+        void read_buffers(Buffers const& buffers, Handler&& handler)
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_ != nullptr)
+            {
+                io_uring_->async_read(socket_.native_handle(),
+                    io_uring_service::make_iovecs(buffers),
+                    HPX_FORWARD(Handler, handler));
+                return;
+            }
+#endif
+            asio::async_read(socket_, buffers, HPX_FORWARD(Handler, handler));
+        }
+
         static void reset_handler(postprocess_handler_type handler)
         {
             handler.reset();
@@ -249,8 +292,10 @@ namespace hpx::parcelset::policies::tcp {
             void (sender::*f)(std::error_code const&) =
                 &sender::handle_read_ack;
 
-            asio::async_read(socket_, asio::buffer(&ack_, sizeof(ack_)),
-                hpx::bind(f, shared_from_this(), placeholders::_1));
+            std::array<asio::mutable_buffer, 1> const buffers = {
+                asio::buffer(&ack_, sizeof(ack_))};
+            read_buffers(
+                buffers, hpx::bind(f, shared_from_this(), placeholders::_1));
         }
 
         void handle_read_ack(std::error_code const& e)
@@ -273,6 +318,10 @@ namespace hpx::parcelset::policies::tcp {
         // Socket for the parcelport_connection.
         asio::ip::tcp::socket socket_;
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        io_uring_service* io_uring_ = nullptr;
+#endif
+
         bool ack_;
 
         // the other (receiving) end of this connection
@@ -15,6 +15,7 @@
 #include <hpx/modules/asio.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/functional.hpp>
+#include <hpx/modules/logging.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/modules/util.hpp>
 
@@ -29,6 +30,7 @@
 #endif
 #include <asio/io_context.hpp>
 #include <asio/ip/tcp.hpp>
+#include <asio/post.hpp>
 
 #include <chrono>
 #include <cstddef>
@@ -76,6 +78,64 @@ namespace hpx::parcelset::policies::tcp {
                 "locality type: {}",
                 here_.type());
         }
+
+        std::string const io_backend =
+            ini.get_entry("hpx.parcel.tcp.io_backend", "asio");
+        if (io_backend == "io_uring")
+        {
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            io_uring_service::options opts;
+            opts.queue_depth = hpx::util::get_entry_as<unsigned>(
+                ini, "hpx.parcel.tcp.io_uring_queue_depth", 256);
+            opts.sqpoll = hpx::util::get_entry_as<int>(
+                              ini, "hpx.parcel.tcp.io_uring_sqpoll", 0) != 0;
+            opts.sqpoll_idle = hpx::util::get_entry_as<unsigned>(
+                ini, "hpx.parcel.tcp.io_uring_sqpoll_idle", 1000);
+            opts.multishot =
+                hpx::util::get_entry_as<int>(
+                    ini, "hpx.parcel.tcp.io_uring_multishot", 1) != 0;
+            opts.num_buffers = hpx::util::get_entry_as<unsigned>(
+                ini, "hpx.parcel.tcp.io_uring_buffers", 256);
+            opts.buffer_size = hpx::util::get_entry_as<std::size_t>(
+                ini, "hpx.parcel.tcp.io_uring_buffer_size", 16384);
+
+            // the service thread is announced as an additional thread of the
+            // parcel pool, which also runs all completion handlers
+            opts.notifier = notifier;
+            opts.pool_name = pool_name();
+            opts.pool_name_postfix = "-io_uring";
+            opts.thread_index = io_service_pool_.size();
+            opts.dispatch = [this](hpx::move_only_function<void()>&& f) {
+                asio::post(io_service_pool_.get_io_service(), HPX_MOVE(f));
+            };
+
+            try
+            {
+                io_uring_ = std::make_unique<io_uring_service>(opts);
+            }
+            catch (std::system_error const& e)
+            {
+                // io_uring might be disabled by the kernel or a seccomp
+                // profile
+                LPT_(warning).format("tcp::parcelport: io_uring is not "
+                                     "available ({}), using Asio instead",
+                    e.what());
+            }
+#else
+            LPT_(warning).format(
+                "tcp::parcelport: io_uring support was not enabled at "
+                "configuration time (HPX_WITH_PARCELPORT_TCP_IO_URING), "
+                "using Asio instead");
+#endif
+        }
+        else if (io_backend != "asio")
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "tcp::parcelport::parcelport",
+                "unknown I/O backend for the TCP parcelport: '{}' (valid "
+                "values are 'asio' and 'io_uring')",
+                io_backend);
+        }
     }
 
     connection_handler::~connection_handler()
@@ -91,6 +151,13 @@ namespace hpx::parcelset::policies::tcp {
         if (nullptr == acceptor_)
             acceptor_ = new tcp::acceptor(io_service);
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        if (io_uring_)
+        {
+            io_uring_->start();
+        }
+#endif
+
         // initialize network
         std::size_t tried = 0;
         exception_list errors;
@@ -151,6 +218,14 @@ namespace hpx::parcelset::policies::tcp {
             delete acceptor_;
             acceptor_ = nullptr;
         }
+
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        // this aborts all operations still in flight
+        if (io_uring_)
+        {
+            io_uring_->stop();
+        }
+#endif
     }
 
     std::shared_ptr<sender> connection_handler::create_connection(
@@ -232,6 +307,9 @@ namespace hpx::parcelset::policies::tcp {
         s.set_option(asio::ip::tcp::no_delay(true));
         s.set_option(asio::socket_base::linger(true, 0));
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+        sender_connection->set_io_uring_service(io_uring_.get());
+#endif
 #if defined(HPX_HOLDON_TO_OUTGOING_CONNECTIONS)
         {
             std::lock_guard<hpx::spinlock> lock(connections_mtx_);
@@ -307,6 +385,12 @@ namespace hpx::parcelset::policies::tcp {
             s.set_option(asio::ip::tcp::no_delay(true));
             s.set_option(asio::socket_base::linger(true, 0));
 
+#if defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+            if (io_uring_)
+            {
+                io_uring_->start_receive(s.native_handle());
+            }
+#endif
             // now accept the incoming connection by starting to read from the
             // socket
             c->async_read(hpx::bind(&connection_handler::handle_read_completion,
@@ -0,0 +1,1061 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP) &&        \
+    defined(HPX_HAVE_PARCELPORT_TCP_IO_URING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/parcelport_tcp/io_uring_service.hpp>
+
+#include <asio/error.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <liburing.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace hpx::parcelset::policies::tcp {
+
+    namespace {
+
+        std::error_code make_system_error(int err) noexcept
+        {
+            return {err, std::system_category()};
+        }
+
+        std::error_code make_eof_error() noexcept
+        {
+            return asio::error::make_error_code(asio::error::eof);
+        }
+
+        std::error_code make_aborted_error() noexcept
+        {
+            return asio::error::make_error_code(
+                asio::error::operation_aborted);
+        }
+
+        // the buffer group id used for the buffers registered for multishot
+        // receive operations
+        constexpr int buffer_group = 0;
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct io_uring_service::impl
+    {
+        enum class operation_kind : std::uint8_t
+        {
+            write,
+            read,
+            receive,    // multishot receive
+            start_receive,
+            cancel,
+            wakeup
+        };
+
+        struct stream;
+
+        struct operation
+        {
+            operation(operation_kind kind, int fd) noexcept
+              : kind_(kind)
+              , fd_(fd)
+            {
+            }
+
+            // Skip the given number of bytes in the buffers (copying them
+            // from data, if given), returns the number of bytes consumed.
+            std::size_t consume(
+                std::size_t size, char const* data = nullptr) noexcept
+            {
+                std::size_t consumed = 0;
+                while (first_ != buffers_.size() && consumed != size)
+                {
+                    iovec& b = buffers_[first_];
+                    std::size_t const n =
+                        (std::min)(b.iov_len, size - consumed);
+                    if (data != nullptr)
+                    {
+                        std::memcpy(b.iov_base, data + consumed, n);
+                    }
+                    b.iov_base = static_cast<char*>(b.iov_base) + n;
+                    b.iov_len -= n;
+                    consumed += n;
+
+                    if (b.iov_len == 0)
+                    {
+                        ++first_;
+                    }
+                }
+
+                // skip empty buffers
+                while (first_ != buffers_.size() &&
+                    buffers_[first_].iov_len == 0)
+                {
+                    ++first_;
+                }
+
+                transferred_ += consumed;
+                return consumed;
+            }
+
+            [[nodiscard]] bool done() const noexcept
+            {
+                return first_ == buffers_.size();
+            }
+
+            operation_kind kind_;
+            int fd_;
+            std::vector<iovec> buffers_;
+            std::size_t first_ = 0;
+            std::size_t transferred_ = 0;
+            msghdr msg_{};
+            handler_type handler_;
+
+            // the stream a multishot receive operation belongs to
+            std::shared_ptr<stream> stream_;
+
+            // signaled once a cancel operation has been performed
+            std::shared_ptr<std::atomic<bool>> canceled_;
+        };
+
+        // Data received by a multishot receive operation is handed to the
+        // pending read operation, any excess data is kept until the next
+        // read operation is issued.
+        struct stream
+        {
+            explicit stream(int fd) noexcept
+              : fd_(fd)
+            {
+            }
+
+            int fd_;
+            std::vector<char> staged_;
+            std::size_t staged_offset_ = 0;
+            std::unique_ptr<operation> reader_;
+            std::error_code error_;
+            bool closed_ = false;
+            bool fallback_ = false;    // multishot receive not supported
+        };
+
+        enum class service_state : std::uint8_t
+        {
+            created,
+            running,
+            stopped
+        };
+
+        explicit impl(options const& opts);
+
+        impl(impl const&) = delete;
+        impl(impl&&) = delete;
+        impl& operator=(impl const&) = delete;
+        impl& operator=(impl&&) = delete;
+
+        ~impl();
+
+        void start();
+        void stop();
+
+        void post(std::unique_ptr<operation> op);
+        void cancel(int fd);
+
+    private:
+        void wakeup(bool force = false) noexcept;
+        void run();
+
+        void process(std::unique_ptr<operation> op);
+        void complete(std::unique_ptr<operation> op, std::error_code const& ec);
+        void abort(std::unique_ptr<operation> op);
+        static void invoke(handler_type& handler, std::error_code const& ec,
+            std::size_t transferred) noexcept;
+
+        io_uring_sqe* get_sqe();
+        void submit(operation* op);
+        void arm_wakeup();
+        void reap();
+        void handle_completion(void* data, int res, unsigned flags);
+
+        void setup_buffer_ring();
+        void recycle_buffer(unsigned id) noexcept;
+
+        void start_stream(int fd);
+        void arm_receive(std::shared_ptr<stream> const& s);
+        void handle_receive(operation* op, int res, unsigned flags);
+        void stream_read(stream& s, std::unique_ptr<operation> op);
+        void feed(stream& s, char const* data, std::size_t size);
+        void set_stream_error(stream& s, std::error_code const& ec);
+
+        void cancel_fd(int fd);
+        void cancel_all();
+
+    public:
+        options opts_;
+        bool multishot_;
+        bool sqpoll_;
+
+    private:
+        io_uring ring_{};
+        io_uring_buf_ring* buffer_ring_ = nullptr;
+        std::unique_ptr<char[]> buffers_;
+
+        int wakeup_fd_ = -1;
+        std::uint64_t wakeup_value_ = 0;
+        operation wakeup_op_;
+
+        std::thread thread_;
+        std::atomic<service_state> state_;
+        std::atomic<bool> stopping_;
+        std::atomic<bool> sleeping_;
+
+        hpx::spinlock pending_mtx_;
+        std::vector<std::unique_ptr<operation>> pending_;
+
+        // the following members are accessed by the service thread only
+        std::unordered_set<operation*> in_flight_;
+        std::unordered_map<int, std::shared_ptr<stream>> streams_;
+
+        struct completion
+        {
+            void* data;
+            int res;
+            unsigned flags;
+        };
+        std::vector<completion> completions_;
+    };
+
+    io_uring_service::impl::impl(options const& opts)
+      : opts_(opts)
+      , multishot_(opts.multishot)
+      , sqpoll_(opts.sqpoll)
+      , wakeup_op_(operation_kind::wakeup, -1)
+      , state_(service_state::created)
+      , stopping_(false)
+      , sleeping_(false)
+    {
+        io_uring_params params{};
+        if (sqpoll_)
+        {
+            params.flags |= IORING_SETUP_SQPOLL;
+            params.sq_thread_idle = opts_.sqpoll_idle;
+        }
+
+        int ret =
+            io_uring_queue_init_params(opts_.queue_depth, &ring_, &params);
+        if (ret == -EPERM && sqpoll_)
+        {
+            // older kernels allow SQPOLL for privileged processes only
+            LPT_(warning).format(
+                "tcp::io_uring_service: submission queue polling is not "
+                "permitted, falling back to regular submission");
+
+            sqpoll_ = false;
+            params = io_uring_params{};
+            ret = io_uring_queue_init_params(
+                opts_.queue_depth, &ring_, &params);
+        }
+
+        if (ret < 0)
+        {
+            throw std::system_error(make_system_error(-ret),
+                "tcp::io_uring_service: io_uring_queue_init_params");
+        }
+
+        wakeup_fd_ = ::eventfd(0, EFD_CLOEXEC);
+        if (wakeup_fd_ < 0)
+        {
+            int const err = errno;
+            io_uring_queue_exit(&ring_);
+            throw std::system_error(
+                make_system_error(err), "tcp::io_uring_service: eventfd");
+        }
+
+        if (multishot_)
+        {
+            setup_buffer_ring();
+        }
+    }
+
+    io_uring_service::impl::~impl()
+    {
+        stop();
+
+        // destroying the handlers might release the last reference to a
+        // connection, which in turn tries to cancel its operations
+        std::vector<std::unique_ptr<operation>> ops;
+        {
+            std::lock_guard l(pending_mtx_);
+            std::swap(ops, pending_);
+        }
+        ops.clear();
+
+        if (buffer_ring_ != nullptr)
+        {
+            io_uring_free_buf_ring(
+                &ring_, buffer_ring_, opts_.num_buffers, buffer_group);
+        }
+        io_uring_queue_exit(&ring_);
+        ::close(wakeup_fd_);
+    }
+
+    void io_uring_service::impl::setup_buffer_ring()
+    {
+        // the number of buffers has to be a power of two
+        unsigned num_buffers = 1;
+        while (num_buffers < opts_.num_buffers)
+        {
+            num_buffers <<= 1;
+        }
+        opts_.num_buffers = num_buffers;
+
+        int ret = 0;
+        buffer_ring_ = io_uring_setup_buf_ring(
+            &ring_, opts_.num_buffers, buffer_group, 0, &ret);
+        if (buffer_ring_ == nullptr)
+        {
+            LPT_(warning).format(
+                "tcp::io_uring_service: could not register receive buffers "
+                "({}), disabling multishot receive operations",
+                make_system_error(-ret).message());
+
+            multishot_ = false;
+            return;
+        }
+
+        buffers_.reset(new char[opts_.num_buffers * opts_.buffer_size]);
+
+        int const mask = io_uring_buf_ring_mask(opts_.num_buffers);
+        for (unsigned i = 0; i != opts_.num_buffers; ++i)
+        {
+            io_uring_buf_ring_add(buffer_ring_,
+                buffers_.get() + i * opts_.buffer_size,
+                static_cast<unsigned>(opts_.buffer_size),
+                static_cast<unsigned short>(i), mask, static_cast<int>(i));
+        }
+        io_uring_buf_ring_advance(
+            buffer_ring_, static_cast<int>(opts_.num_buffers));
+    }
+
+    void io_uring_service::impl::recycle_buffer(unsigned id) noexcept
+    {
+        io_uring_buf_ring_add(buffer_ring_,
+            buffers_.get() + id * opts_.buffer_size,
+            static_cast<unsigned>(opts_.buffer_size),
+            static_cast<unsigned short>(id),
+            io_uring_buf_ring_mask(opts_.num_buffers), 0);
+        io_uring_buf_ring_advance(buffer_ring_, 1);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::impl::start()
+    {
+        service_state expected = service_state::created;
+        if (state_.compare_exchange_strong(expected, service_state::running))
+        {
+            thread_ = std::thread(&impl::run, this);
+        }
+    }
+
+    void io_uring_service::impl::stop()
+    {
+        service_state expected = service_state::running;
+        if (state_.compare_exchange_strong(expected, service_state::stopped))
+        {
+            stopping_.store(true);
+            wakeup(true);
+            thread_.join();
+        }
+        state_.store(service_state::stopped);
+
+        // complete all operations which were never handed to the kernel
+        std::vector<std::unique_ptr<operation>> ops;
+        {
+            std::lock_guard l(pending_mtx_);
+            std::swap(ops, pending_);
+        }
+        for (auto& op : ops)
+        {
+            abort(HPX_MOVE(op));
+        }
+    }
+
+    void io_uring_service::impl::post(std::unique_ptr<operation> op)
+    {
+        // Handlers are never invoked from inside this function as the caller
+        // might hold locks the handler acquires. Operations posted after the
+        // service was stopped are discarded on destruction.
+        {
+            std::lock_guard l(pending_mtx_);
+            pending_.push_back(HPX_MOVE(op));
+        }
+        wakeup();
+    }
+
+    void io_uring_service::impl::cancel(int fd)
+    {
+        if (std::this_thread::get_id() == thread_.get_id())
+        {
+            // completion handlers are allowed to cancel operations
+            cancel_fd(fd);
+            io_uring_submit(&ring_);
+            return;
+        }
+
+        if (state_.load() != service_state::running)
+        {
+            // nothing can be in flight, abort all queued operations
+            std::vector<std::unique_ptr<operation>> ops;
+            {
+                std::lock_guard l(pending_mtx_);
+                auto const it = std::stable_partition(pending_.begin(),
+                    pending_.end(),
+                    [fd](auto const& op) { return op->fd_ != fd; });
+                std::move(it, pending_.end(), std::back_inserter(ops));
+                pending_.erase(it, pending_.end());
+            }
+            for (auto& op : ops)
+            {
+                abort(HPX_MOVE(op));
+            }
+            return;
+        }
+
+        auto canceled = std::make_shared<std::atomic<bool>>(false);
+
+        auto op = std::make_unique<operation>(operation_kind::cancel, fd);
+        op->canceled_ = canceled;
+        post(HPX_MOVE(op));
+
+        // nothing is in flight anymore once the service was stopped
+        hpx::util::yield_while(
+            [&]() {
+                return !canceled->load() &&
+                    state_.load() == service_state::running;
+            },
+            "tcp::io_uring_service::cancel");
+    }
+
+    void io_uring_service::impl::wakeup(bool force) noexcept
+    {
+        if (sleeping_.exchange(false) || force)
+        {
+            std::uint64_t const value = 1;
+            [[maybe_unused]] auto const ret =
+                ::write(wakeup_fd_, &value, sizeof(value));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::impl::run()
+    {
+        opts_.notifier.on_start_thread(opts_.thread_index, opts_.thread_index,
+            opts_.pool_name, opts_.pool_name_postfix);
+
+        arm_wakeup();
+
+        bool canceled_all = false;
+        std::vector<std::unique_ptr<operation>> ops;
+        while (true)
+        {
+            {
+                std::lock_guard l(pending_mtx_);
+                std::swap(ops, pending_);
+            }
+
+            // prepare all operations queued since the last iteration, those
+            // are handed to the kernel as one batch below
+            for (auto& op : ops)
+            {
+                process(HPX_MOVE(op));
+            }
+            ops.clear();
+
+            if (stopping_.load())
+            {
+                if (!canceled_all)
+                {
+                    cancel_all();
+                    canceled_all = true;
+                }
+
+                if (in_flight_.empty())
+                {
+                    break;
+                }
+            }
+
+            // announce that this thread is about to wait for completions,
+            // operations posted after this point will wake it up
+            sleeping_.store(true);
+
+            bool wait = true;
+            {
+                std::lock_guard l(pending_mtx_);
+                wait = pending_.empty();
+            }
+            if (!wait)
+            {
+                sleeping_.store(false);
+            }
+
+            int const ret = io_uring_submit_and_wait(&ring_, wait ? 1 : 0);
+            if (ret < 0 && ret != -EINTR && ret != -EAGAIN && ret != -EBUSY)
+            {
+                LPT_(error).format(
+                    "tcp::io_uring_service: io_uring_submit_and_wait: {}",
+                    make_system_error(-ret).message());
+            }
+
+            sleeping_.store(false);
+            reap();
+        }
+
+        // complete operations that were posted while shutting down
+        {
+            std::lock_guard l(pending_mtx_);
+            std::swap(ops, pending_);
+        }
+        for (auto& op : ops)
+        {
+            abort(HPX_MOVE(op));
+        }
+
+        opts_.notifier.on_stop_thread(opts_.thread_index, opts_.thread_index,
+            opts_.pool_name, opts_.pool_name_postfix);
+    }
+
+    void io_uring_service::impl::process(std::unique_ptr<operation> op)
+    {
+        switch (op->kind_)
+        {
+        case operation_kind::write:
+            [[fallthrough]];
+        case operation_kind::read:
+        {
+            if (stopping_.load())
+            {
+                abort(HPX_MOVE(op));
+                return;
+            }
+
+            if (op->kind_ == operation_kind::read)
+            {
+                if (auto const it = streams_.find(op->fd_);
+                    it != streams_.end())
+                {
+                    // keep the stream alive, the read might complete inline
+                    std::shared_ptr<stream> const s = it->second;
+                    stream_read(*s, HPX_MOVE(op));
+                    return;
+                }
+            }
+
+            // skip empty buffers, nothing to do if there is no data
+            op->consume(0);
+            if (op->done())
+            {
+                complete(HPX_MOVE(op), std::error_code());
+                return;
+            }
+            submit(op.release());
+            break;
+        }
+
+        case operation_kind::start_receive:
+            start_stream(op->fd_);
+            break;
+
+        case operation_kind::cancel:
+            cancel_fd(op->fd_);
+            io_uring_submit(&ring_);
+            op->canceled_->store(true);
+            break;
+
+        case operation_kind::receive:
+            [[fallthrough]];
+        case operation_kind::wakeup:
+            [[fallthrough]];
+        default:
+            HPX_ASSERT(false);
+            break;
+        }
+    }
+
+    void io_uring_service::impl::complete(
+        std::unique_ptr<operation> op, std::error_code const& ec)
+    {
+        handler_type handler = HPX_MOVE(op->handler_);
+        std::size_t const transferred = op->transferred_;
+        op.reset();
+
+        if (!opts_.dispatch)
+        {
+            invoke(handler, ec, transferred);
+            return;
+        }
+
+        // keep the service thread free for reaping completions
+        opts_.dispatch(
+            [handler = HPX_MOVE(handler), ec, transferred]() mutable {
+                invoke(handler, ec, transferred);
+            });
+    }
+
+    void io_uring_service::impl::invoke(handler_type& handler,
+        std::error_code const& ec, std::size_t transferred) noexcept
+    {
+        try
+        {
+            handler(ec, transferred);
+        }
+        catch (std::exception const& e)
+        {
+            LPT_(error).format(
+                "tcp::io_uring_service: completion handler threw: {}",
+                e.what());
+        }
+    }
+
+    void io_uring_service::impl::abort(std::unique_ptr<operation> op)
+    {
+        if (op->kind_ == operation_kind::cancel)
+        {
+            op->canceled_->store(true);
+        }
+        else if (op->handler_)
+        {
+            complete(HPX_MOVE(op), make_aborted_error());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_sqe* io_uring_service::impl::get_sqe()
+    {
+        io_uring_sqe* sqe = io_uring_get_sqe(&ring_);
+        while (sqe == nullptr)
+        {
+            // the submission queue is full, hand the current batch to the
+            // kernel
+            io_uring_submit(&ring_);
+            sqe = io_uring_get_sqe(&ring_);
+        }
+        return sqe;
+    }
+
+    void io_uring_service::impl::submit(operation* op)
+    {
+        HPX_ASSERT(!op->done());
+
+        op->msg_ = msghdr{};
+        op->msg_.msg_iov = op->buffers_.data() + op->first_;
+        op->msg_.msg_iovlen = (std::min)(op->buffers_.size() - op->first_,
+            static_cast<std::size_t>(IOV_MAX));
+
+        io_uring_sqe* sqe = get_sqe();
+        if (op->kind_ == operation_kind::write)
+        {
+            io_uring_prep_sendmsg(sqe, op->fd_, &op->msg_, MSG_NOSIGNAL);
+        }
+        else
+        {
+            io_uring_prep_recvmsg(sqe, op->fd_, &op->msg_, 0);
+        }
+        io_uring_sqe_set_data(sqe, op);
+
+        in_flight_.insert(op);
+    }
+
+    void io_uring_service::impl::arm_wakeup()
+    {
+        io_uring_sqe* sqe = get_sqe();
+        io_uring_prep_read(
+            sqe, wakeup_fd_, &wakeup_value_, sizeof(wakeup_value_), 0);
+        io_uring_sqe_set_data(sqe, &wakeup_op_);
+    }
+
+    void io_uring_service::impl::reap()
+    {
+        // copy the completions first to make room in the completion queue
+        // before any of the handlers is invoked
+        std::array<io_uring_cqe*, 64> cqes{};
+        while (true)
+        {
+            unsigned const count = io_uring_peek_batch_cqe(
+                &ring_, cqes.data(), static_cast<unsigned>(cqes.size()));
+            if (count == 0)
+            {
+                break;
+            }
+
+            completions_.clear();
+            for (unsigned i = 0; i != count; ++i)
+            {
+                completions_.push_back(completion{
+                    io_uring_cqe_get_data(cqes[i]), cqes[i]->res,
+                    cqes[i]->flags});
+            }
+            io_uring_cq_advance(&ring_, count);
+
+            for (completion const& c : completions_)
+            {
+                handle_completion(c.data, c.res, c.flags);
+            }
+        }
+    }
+
+    void io_uring_service::impl::handle_completion(
+        void* data, int res, unsigned flags)
+    {
+        if (data == nullptr)
+        {
+            return;    // completion of a cancel request
+        }
+
+        if (data == &wakeup_op_)
+        {
+            if (!stopping_.load())
+            {
+                arm_wakeup();
+            }
+            return;
+        }
+
+        auto* op = static_cast<operation*>(data);
+        if (op->kind_ == operation_kind::receive)
+        {
+            handle_receive(op, res, flags);
+            return;
+        }
+
+        in_flight_.erase(op);
+        std::unique_ptr<operation> p(op);
+
+        if (res < 0)
+        {
+            if ((res == -EINTR || res == -EAGAIN) && !stopping_.load())
+            {
+                submit(p.release());
+                return;
+            }
+
+            complete(HPX_MOVE(p),
+                res == -ECANCELED ? make_aborted_error() :
+                                    make_system_error(-res));
+            return;
+        }
+
+        if (res == 0 && p->kind_ == operation_kind::read)
+        {
+            complete(HPX_MOVE(p), make_eof_error());
+            return;
+        }
+
+        p->consume(static_cast<std::size_t>(res));
+        if (p->done())
+        {
+            complete(HPX_MOVE(p), std::error_code());
+        }
+        else
+        {
+            // partial transfer, continue with the remaining data
+            submit(p.release());
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void io_uring_service::impl::start_stream(int fd)
+    {
+        auto s = std::make_shared<stream>(fd);
+        streams_[fd] = s;
+
+        if (multishot_)
+        {
+            arm_receive(s);
+        }
+        else
+        {
+            s->fallback_ = true;
+        }
+    }
+
+    void io_uring_service::impl::arm_receive(std::shared_ptr<stream> const& s)
+    {
+        auto* op = new operation(operation_kind::receive, s->fd_);
+        op->stream_ = s;
+
+        io_uring_sqe* sqe = get_sqe();
+        io_uring_prep_recv_multishot(sqe, s->fd_, nullptr, 0, 0);
+        sqe->flags |= IOSQE_BUFFER_SELECT;
+        sqe->buf_group = buffer_group;
+        io_uring_sqe_set_data(sqe, op);
+
+        in_flight_.insert(op);
+    }
+
+    void io_uring_service::impl::handle_receive(
+        operation* op, int res, unsigned flags)
+    {
+        // keep the stream alive, handlers might cancel it
+        std::shared_ptr<stream> const s = op->stream_;
+
+        if (res > 0)
+        {
+            HPX_ASSERT((flags & IORING_CQE_F_BUFFER) != 0);
+            unsigned const id = flags >> IORING_CQE_BUFFER_SHIFT;
+            if (!s->closed_)
+            {
+                feed(*s, buffers_.get() + id * opts_.buffer_size,
+                    static_cast<std::size_t>(res));
+            }
+            recycle_buffer(id);
+        }
+
+        if ((flags & IORING_CQE_F_MORE) != 0)
+        {
+            return;    // the receive operation is still active
+        }
+
+        // the multishot receive operation has terminated
+        in_flight_.erase(op);
+        delete op;
+
+        if (s->closed_ || stopping_.load())
+        {
+            return;
+        }
+
+        if (res > 0 || res == -ENOBUFS)
+        {
+            // the kernel stopped the operation (for instance, because all
+            // buffers are in use), simply restart it
+            arm_receive(s);
+        }
+        else if (res == -EINVAL || res == -EOPNOTSUPP)
+        {
+            // multishot receive operations are not supported by this
+            // kernel, use regular read operations from now on
+            LPT_(warning).format(
+                "tcp::io_uring_service: multishot receive operations are "
+                "not supported, disabling them");
+
+            multishot_ = false;
+            s->fallback_ = true;
+            if (s->reader_)
+            {
+                submit(s->reader_.release());
+            }
+        }
+        else if (res == 0)
+        {
+            set_stream_error(*s, make_eof_error());
+        }
+        else
+        {
+            set_stream_error(*s,
+                res == -ECANCELED ? make_aborted_error() :
+                                    make_system_error(-res));
+        }
+    }
+
+    void io_uring_service::impl::stream_read(
+        stream& s, std::unique_ptr<operation> op)
+    {
+        HPX_ASSERT(!s.reader_);
+
+        // serve the read operation from data received earlier
+        if (s.staged_offset_ != s.staged_.size())
+        {
+            s.staged_offset_ +=
+                op->consume(s.staged_.size() - s.staged_offset_,
+                    s.staged_.data() + s.staged_offset_);
+
+            if (s.staged_offset_ == s.staged_.size())
+            {
+                s.staged_.clear();
+                s.staged_offset_ = 0;
+            }
+        }
+        else
+        {
+            op->consume(0);
+        }
+
+        if (op->done())
+        {
+            complete(HPX_MOVE(op), std::error_code());
+        }
+        else if (s.error_)
+        {
+            complete(HPX_MOVE(op), s.error_);
+        }
+        else if (s.fallback_)
+        {
+            submit(op.release());
+        }
+        else
+        {
+            s.reader_ = HPX_MOVE(op);
+        }
+    }
+
+    void io_uring_service::impl::feed(
+        stream& s, char const* data, std::size_t size)
+    {
+        if (s.reader_)
+        {
+            std::size_t const consumed = s.reader_->consume(size, data);
+            data += consumed;
+            size -= consumed;
+
+            if (s.reader_->done())
+            {
+                complete(HPX_MOVE(s.reader_), std::error_code());
+            }
+        }
+
+        if (size != 0)
+        {
+            s.staged_.insert(s.staged_.end(), data, data + size);
+        }
+    }
+
+    void io_uring_service::impl::set_stream_error(
+        stream& s, std::error_code const& ec)
+    {
+        s.error_ = ec;
+        if (s.reader_)
+        {
+            complete(HPX_MOVE(s.reader_), ec);
+        }
+    }
+
+    void io_uring_service::impl::cancel_fd(int fd)
+    {
+        if (auto const it = streams_.find(fd); it != streams_.end())
+        {
+            std::shared_ptr<stream> const s = it->second;
+            streams_.erase(it);
+
+            s->closed_ = true;
+            if (s->reader_)
+            {
+                complete(HPX_MOVE(s->reader_), make_aborted_error());
+            }
+        }
+
+        for (operation* op : in_flight_)
+        {
+            if (op->fd_ == fd)
+            {
+                io_uring_sqe* sqe = get_sqe();
+                io_uring_prep_cancel(sqe, op, 0);
+                io_uring_sqe_set_data(sqe, nullptr);
+            }
+        }
+    }
+
+    void io_uring_service::impl::cancel_all()
+    {
+        for (auto& s : streams_)
+        {
+            s.second->closed_ = true;
+            if (s.second->reader_)
+            {
+                complete(HPX_MOVE(s.second->reader_), make_aborted_error());
+            }
+        }
+        streams_.clear();
+
+        for (operation* op : in_flight_)
+        {
+            io_uring_sqe* sqe = get_sqe();
+            io_uring_prep_cancel(sqe, op, 0);
+            io_uring_sqe_set_data(sqe, nullptr);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    io_uring_service::io_uring_service(options const& opts)
+      : impl_(std::make_unique<impl>(opts))
+    {
+    }
+
+    io_uring_service::~io_uring_service() = default;
+
+    void io_uring_service::start()
+    {
+        impl_->start();
+    }
+
+    void io_uring_service::stop()
+    {
+        impl_->stop();
+    }
+
+    void io_uring_service::async_write(
+        int fd, std::vector<iovec>&& buffers, handler_type&& handler)
+    {
+        auto op = std::make_unique<impl::operation>(
+            impl::operation_kind::write, fd);
+        op->buffers_ = HPX_MOVE(buffers);
+        op->handler_ = HPX_MOVE(handler);
+        impl_->post(HPX_MOVE(op));
+    }
+
+    void io_uring_service::async_read(
+        int fd, std::vector<iovec>&& buffers, handler_type&& handler)
+    {
+        auto op = std::make_unique<impl::operation>(
+            impl::operation_kind::read, fd);
+        op->buffers_ = HPX_MOVE(buffers);
+        op->handler_ = HPX_MOVE(handler);
+        impl_->post(HPX_MOVE(op));
+    }
+
+    void io_uring_service::start_receive(int fd)
+    {
+        impl_->post(std::make_unique<impl::operation>(
+            impl::operation_kind::start_receive, fd));
+    }
+
+    void io_uring_service::cancel(int fd)
+    {
+        impl_->cancel(fd);
+    }
+
+    bool io_uring_service::uses_multishot() const noexcept
+    {
+        return impl_->multishot_;
+    }
+
+    bool io_uring_service::uses_sqpoll() const noexcept
+    {
+        return impl_->sqpoll_;
+    }
+}    // namespace hpx::parcelset::policies::tcp
+
+#endif
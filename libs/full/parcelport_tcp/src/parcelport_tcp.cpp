@@ -42,7 +42,19 @@ struct hpx::traits::plugin_config_data<
 
     static constexpr char const* call() noexcept
     {
-        return "";
+        return
+            // I/O backend used for the data transfer: 'asio' or 'io_uring'
+            "io_backend = ${HPX_PARCEL_TCP_IO_BACKEND:asio}\n"
+            // settings used by the io_uring backend
+            "io_uring_queue_depth = "
+            "${HPX_PARCEL_TCP_IO_URING_QUEUE_DEPTH:256}\n"
+            "io_uring_sqpoll = ${HPX_PARCEL_TCP_IO_URING_SQPOLL:0}\n"
+            "io_uring_sqpoll_idle = "
+            "${HPX_PARCEL_TCP_IO_URING_SQPOLL_IDLE:1000}\n"
+            "io_uring_multishot = ${HPX_PARCEL_TCP_IO_URING_MULTISHOT:1}\n"
+            "io_uring_buffers = ${HPX_PARCEL_TCP_IO_URING_BUFFERS:256}\n"
+            "io_uring_buffer_size = "
+            "${HPX_PARCEL_TCP_IO_URING_BUFFER_SIZE:16384}\n";
     }
 };    // namespace hpx::traits
 
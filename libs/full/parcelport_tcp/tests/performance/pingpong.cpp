@@ -0,0 +1,119 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Round trip latency of the TCP parcelport for messages of increasing size.
+// Run with --hpx:ini=hpx.parcel.tcp.io_backend=io_uring to measure the
+// io_uring backend instead of the Asio (epoll) backend.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using buffer_type = hpx::serialization::serialize_buffer<char>;
+
+buffer_type pong(buffer_type const& buffer)
+{
+    return buffer;
+}
+HPX_PLAIN_DIRECT_ACTION(pong)
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::vector<hpx::id_type> const localities =
+        hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        std::cout << "This benchmark needs to be run on at least two "
+                     "localities\n";
+        return hpx::finalize();
+    }
+    hpx::id_type const there = localities[0];
+
+    auto const min_size = vm["min-size"].as<std::size_t>();
+    auto const max_size = vm["max-size"].as<std::size_t>();
+    auto const iterations = vm["iterations"].as<std::size_t>();
+    auto const skip = vm["skip"].as<std::size_t>();
+
+    std::cout << "# TCP parcelport ping-pong, I/O backend: "
+              << hpx::get_config_entry("hpx.parcel.tcp.io_backend", "asio")
+              << "\n# Size    Latency (microsec)" << std::endl;
+
+    std::vector<char> data(max_size, 'x');
+
+    pong_action act;
+    for (std::size_t size = min_size; size <= max_size; size *= 2)
+    {
+        buffer_type const buffer(data.data(), size, buffer_type::reference);
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t i = 0; i != iterations + skip; ++i)
+        {
+            // do not measure the warm up phase
+            if (i == skip)
+            {
+                t.restart();
+            }
+            act(there, buffer);
+        }
+
+        double const latency =
+            t.elapsed() * 1e6 / static_cast<double>(2 * iterations);
+
+        std::cout << std::left << std::setw(10) << size << std::fixed
+                  << std::setprecision(2) << latency << std::endl;
+
+        if (size == 0)
+        {
+            size = 1;
+        }
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description cmdline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("min-size",
+         hpx::program_options::value<std::size_t>()->default_value(1),
+         "minimal message size (default: 1)")
+        ("max-size",
+         hpx::program_options::value<std::size_t>()->default_value(1048576),
+         "maximal message size (default: 1048576)")
+        ("iterations",
+         hpx::program_options::value<std::size_t>()->default_value(1000),
+         "number of round trips per message size (default: 1000)")
+        ("skip",
+         hpx::program_options::value<std::size_t>()->default_value(100),
+         "number of round trips used for warming up (default: 100)")
+        ;
+    // clang-format on
+
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=0"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
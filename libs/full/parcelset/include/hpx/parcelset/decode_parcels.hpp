@@ -12,6 +12,7 @@
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
 #include <hpx/modules/functional.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/runtime_local.hpp>
@@ -19,6 +20,7 @@
 #include <hpx/modules/timing.hpp>
 
 #include <hpx/components_base/agas_interface.hpp>
+#include <hpx/parcelset/detail/parcel_index.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/parcel_route_handler.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
@@ -27,6 +29,8 @@
 #include <boost/exception/exception.hpp>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -261,11 +265,291 @@ namespace hpx::parcelset {
         }
     }
 
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // make sure the given parcel ended up on the right locality
+        inline void verify_parcel_destination(parcelset::parcel const& p)
+        {
+            std::uint32_t const here = agas::get_locality_id();
+            if (hpx::get_runtime_ptr() && here != naming::invalid_locality_id &&
+                (naming::get_locality_id_from_gid(p.destination_locality()) !=
+                    here))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::invalid_status,
+                    "hpx::parcelset::decode_message",
+                    "parcel destination does not match locality which "
+                    "received the parcel ({}), {}",
+                    here, p);
+            }
+        }
+
+        // Provide the memory arena used for constructing the arguments of a
+        // single parcel while it is being de-serialized. The arena itself
+        // stays alive for as long as any of the objects allocated from it
+        // (i.e. the arguments of the action) exist.
+        class deserialization_arena_scope
+        {
+        public:
+            deserialization_arena_scope(
+                [[maybe_unused]] serialization::input_archive& archive,
+                [[maybe_unused]] std::size_t arena_size)
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+              : archive_(archive)
+#endif
+            {
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+                if (arena_size != 0)
+                {
+                    using serialization::deserialization_arena;
+                    arena_ = deserialization_arena::create(arena_size);
+                    archive_.set_memory_resource(arena_.get());
+                }
+#endif
+            }
+
+            deserialization_arena_scope(
+                deserialization_arena_scope const&) = delete;
+            deserialization_arena_scope(deserialization_arena_scope&&) = delete;
+            deserialization_arena_scope& operator=(
+                deserialization_arena_scope const&) = delete;
+            deserialization_arena_scope& operator=(
+                deserialization_arena_scope&&) = delete;
+
+            ~deserialization_arena_scope()
+            {
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+                if (arena_)
+                {
+                    archive_.set_memory_resource(nullptr);
+                }
+#endif
+            }
+
+        private:
+#if defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+            serialization::input_archive& archive_;
+            serialization::deserialization_arena::pointer_type arena_;
+#endif
+        };
+
+        // De-serialize the parcels [first, last) of a message carrying a
+        // parcel index, using a separate archive positioned at the start of
+        // the first parcel.
+        template <typename Parcelport, typename Buffer>
+        void decode_parcel_range([[maybe_unused]] Parcelport& pp,
+            Buffer& buffer,
+            std::vector<serialization::serialization_chunk>& chunks,
+            std::vector<parcel_index_entry> const& index,
+            std::vector<std::size_t> const& zero_copy_bytes,
+            std::size_t first, std::size_t last, bool allow_zero_copy_receive,
+            std::size_t num_thread,
+            std::vector<parcelset::parcel>& deferred_parcels)
+        {
+            auto const inbound_data_size = static_cast<std::size_t>(
+                static_cast<std::uint64_t>(buffer.data_size_));
+            serialization::input_archive archive(
+                buffer.data_, inbound_data_size, &chunks);
+
+            if (allow_zero_copy_receive)
+            {
+                // tag the archive to allow for zero-copy receive operations
+                archive.get_extra_data<
+                    serialization::detail::allow_zero_copy_receive>();
+            }
+
+            // The position in the overall archive is the position in the
+            // data plus the size of all zero-copy chunks preceding the
+            // current chunk.
+            auto const pos = static_cast<std::size_t>(index[first].pos);
+            auto const chunk = static_cast<std::size_t>(index[first].chunk);
+
+            std::size_t chunk_offset = 0;
+            std::size_t archive_pos = pos;
+            if (!chunks.empty())
+            {
+                if (chunk >= zero_copy_bytes.size())
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                        "hpx::parcelset::decode_parcel_range",
+                        "invalid chunk index in parcel index ({})", chunk);
+                }
+
+                if (chunk != chunks.size() &&
+                    chunks[chunk].type_ ==
+                        serialization::chunk_type::chunk_type_index)
+                {
+                    chunk_offset = pos - chunks[chunk].data_.index_;
+                }
+                archive_pos += zero_copy_bytes[chunk];
+            }
+            archive.set_position(pos, chunk, chunk_offset, archive_pos);
+
+            for (std::size_t i = first; i != last; ++i)
+            {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
+    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                hpx::chrono::high_resolution_timer const timer;
+                std::size_t const parcel_pos = archive.current_pos();
+#endif
+                // direct actions are scheduled by the caller after all
+                // parcels have been decoded
+                bool deferred_schedule = true;
+
+                parcelset::parcel p;
+                bool migrated = false;
+                {
+                    deserialization_arena_scope arena(
+                        archive, pp.get_deserialization_arena_size());
+                    migrated =
+                        p.load_schedule(archive, num_thread, deferred_schedule);
+                }
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
+    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                parcelset::data_point action_data;
+                action_data.bytes_ = archive.current_pos() - parcel_pos;
+                action_data.serialization_time_ = timer.elapsed_nanoseconds();
+                action_data.num_parcels_ = 1;
+                pp.add_received_data(p.get_action_name(), action_data);
+#endif
+                verify_parcel_destination(p);
+
+                if (migrated && !allow_zero_copy_receive)
+                {
+                    // route parcels to migrated targets, but only if we're
+                    // not zero-copy receiving
+                    agas::route(HPX_MOVE(p),
+                        &parcelset::detail::parcel_route_handler,
+                        threads::thread_priority::normal);
+                }
+                else if (deferred_schedule || allow_zero_copy_receive)
+                {
+                    deferred_parcels.emplace_back(HPX_MOVE(p));
+                }
+            }
+        }
+
+        // Decode the parcels of a message carrying a parcel index. The
+        // parcels are split into ranges that are de-serialized (and, for
+        // non-direct actions, scheduled) concurrently on separate HPX
+        // threads. The parcels that still need to be scheduled are returned
+        // in the order they were sent.
+        template <typename Parcelport, typename Buffer>
+        std::vector<parcelset::parcel> decode_parcels_parallel(
+            Parcelport& pp, Buffer& buffer,
+            std::vector<serialization::serialization_chunk>& chunks,
+            std::size_t parcel_count, bool allow_zero_copy_receive,
+            std::size_t num_thread)
+        {
+            std::vector<parcel_index_entry> const index =
+                extract_parcel_index(buffer, parcel_count);
+
+            // accumulated size of the zero-copy chunks preceding each chunk
+            std::vector<std::size_t> zero_copy_bytes;
+            if (!chunks.empty())
+            {
+                zero_copy_bytes.reserve(chunks.size() + 1);
+                zero_copy_bytes.push_back(0);
+                for (auto const& c : chunks)
+                {
+                    std::size_t size = zero_copy_bytes.back();
+                    if (c.type_ ==
+                        serialization::chunk_type::chunk_type_pointer)
+                    {
+                        size += c.size_;
+                    }
+                    zero_copy_bytes.push_back(size);
+                }
+            }
+
+            // don't create tasks decoding only a handful of parcels
+            constexpr std::size_t min_parcels_per_task = 16;
+
+            std::size_t num_tasks = 1;
+            if (hpx::get_runtime_ptr() != nullptr)
+            {
+                num_tasks = (std::min)(hpx::get_num_worker_threads(),
+                    (parcel_count + min_parcels_per_task - 1) /
+                        min_parcels_per_task);
+                num_tasks = (std::max)(num_tasks, std::size_t(1));
+            }
+
+            std::vector<std::vector<parcelset::parcel>> parcels(num_tasks);
+            std::vector<std::exception_ptr> errors(num_tasks);
+            std::atomic<std::size_t> remaining(num_tasks);
+
+            std::size_t const parcels_per_task = parcel_count / num_tasks;
+            std::size_t const remainder = parcel_count % num_tasks;
+
+            auto decode = [&](std::size_t task) {
+                std::size_t const first = task * parcels_per_task +
+                    (std::min)(task, remainder);
+                std::size_t const last =
+                    first + parcels_per_task + (task < remainder ? 1 : 0);
+
+                try
+                {
+                    parcels[task].reserve(last - first);
+                    decode_parcel_range(pp, buffer, chunks, index,
+                        zero_copy_bytes, first, last, allow_zero_copy_receive,
+                        num_thread, parcels[task]);
+                }
+                catch (...)
+                {
+                    errors[task] = std::current_exception();
+                }
+                remaining.fetch_sub(1, std::memory_order_release);
+            };
+
+            // decode all but the first range on new threads
+            for (std::size_t task = 1; task != num_tasks; ++task)
+            {
+                hpx::threads::thread_init_data init_data(
+                    hpx::threads::make_thread_function_nullary(
+                        util::deferred_call(decode, task)),
+                    "decode_parcels", threads::thread_priority::boost,
+                    threads::thread_schedule_hint(),
+                    threads::thread_stacksize::default_,
+                    threads::thread_schedule_state::pending, true);
+                hpx::threads::register_thread(init_data);
+            }
+            decode(0);
+
+            // wait for all ranges to be decoded, the tasks refer to local
+            // variables
+            hpx::util::yield_while(
+                [&] {
+                    return remaining.load(std::memory_order_acquire) != 0;
+                },
+                "hpx::parcelset::detail::decode_parcels_parallel");
+
+            for (std::exception_ptr const& e : errors)
+            {
+                if (e)
+                {
+                    std::rethrow_exception(e);
+                }
+            }
+
+            std::vector<parcelset::parcel> deferred_parcels =
+                HPX_MOVE(parcels[0]);
+            for (std::size_t task = 1; task != num_tasks; ++task)
+            {
+                deferred_parcels.insert(deferred_parcels.end(),
+                    std::make_move_iterator(parcels[task].begin()),
+                    std::make_move_iterator(parcels[task].end()));
+            }
+            return deferred_parcels;
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     std::vector<parcelset::parcel> decode_message_with_chunks(
         serialization::input_archive& archive, [[maybe_unused]] Parcelport& pp,
         [[maybe_unused]] Buffer& buffer, std::size_t parcel_count,
+        std::vector<serialization::serialization_chunk>& chunks,
         std::size_t num_thread = -1)
     {
         bool const allow_zero_copy_receive =
@@ -289,6 +573,25 @@ namespace hpx::parcelset {
                 if (parcel_count == 0)
                 {
                     archive >> parcel_count;    //-V128
+
+                    // messages carrying a parcel index are decoded in
+                    // parallel
+                    if (parcel_count & detail::parcel_index_flag)
+                    {
+                        parcel_count &= ~detail::parcel_index_flag;
+                        deferred_parcels = detail::decode_parcels_parallel(pp,
+                            buffer, chunks, parcel_count,
+                            allow_zero_copy_receive, num_thread);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                        data.num_parcels_ = parcel_count;
+                        data.raw_bytes_ = static_cast<std::size_t>(
+                            static_cast<std::uint64_t>(buffer.data_size_));
+                        data.serialization_time_ = timer.elapsed_nanoseconds();
+                        pp.add_received_data(data);
+#endif
+                        return deferred_parcels;
+                    }
                 }
                 if (parcel_count > 1 || allow_zero_copy_receive)
                 {
@@ -312,8 +615,13 @@ namespace hpx::parcelset {
                     // be loaded is a non direct action. If we only got one
                     // parcel to decode, deferred_schedule will be preset to
                     // false and the direct action will be called directly
-                    bool const migrated =
-                        p.load_schedule(archive, num_thread, deferred_schedule);
+                    bool migrated = false;
+                    {
+                        detail::deserialization_arena_scope arena(
+                            archive, pp.get_deserialization_arena_size());
+                        migrated = p.load_schedule(
+                            archive, num_thread, deferred_schedule);
+                    }
 
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                     std::int64_t const add_parcel_time =
@@ -330,18 +638,7 @@ namespace hpx::parcelset {
                     pp.add_received_data(p.get_action_name(), action_data);
 #endif
                     // make sure this parcel ended up on the right locality
-                    std::uint32_t const here = agas::get_locality_id();
-                    if (hpx::get_runtime_ptr() &&
-                        here != naming::invalid_locality_id &&
-                        (naming::get_locality_id_from_gid(
-                             p.destination_locality()) != here))
-                    {
-                        HPX_THROW_EXCEPTION(hpx::error::invalid_status,
-                            "hpx::parcelset::decode_message",
-                            "parcel destination does not match locality "
-                            "which received the parcel ({}), {}",
-                            here, p);
-                    }
+                    detail::verify_parcel_destination(p);
 
                     if (migrated && !allow_zero_copy_receive)
                     {
@@ -427,7 +724,7 @@ namespace hpx::parcelset {
             buffer.data_, inbound_data_size, &chunks);
 
         return decode_message_with_chunks(
-            archive, pp, buffer, parcel_count, num_thread);
+            archive, pp, buffer, parcel_count, chunks, num_thread);
     }
 
     template <typename Parcelport, typename Buffer>
@@ -472,7 +769,7 @@ namespace hpx::parcelset {
             .get_extra_data<serialization::detail::allow_zero_copy_receive>();
 
         return decode_message_with_chunks(
-            archive, pp, buffer, parcel_count, num_thread);
+            archive, pp, buffer, parcel_count, chunks, num_thread);
     }
 
     template <typename Parcelport, typename Buffer>
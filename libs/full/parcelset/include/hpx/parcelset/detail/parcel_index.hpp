@@ -0,0 +1,111 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/serialization.hpp>
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Messages carrying many parcels can be prepared for parallel decoding on the
+// receiving end. For this, the sender appends an index to the serialized data
+// (after the bytes consumed by the archive) that describes where each of the
+// parcels starts. The presence of the index is announced by setting the most
+// significant bit of the parcel count stored in the archive.
+//
+// Parcels in such a message are serialized independently of each other, i.e.
+// tracked pointers are not shared between parcels.
+namespace hpx::parcelset::detail {
+
+    inline constexpr std::size_t parcel_index_flag = std::size_t(1)
+        << (sizeof(std::size_t) * CHAR_BIT - 1);
+
+    struct parcel_index_entry
+    {
+        // position of the parcel in the (non-zero-copy) data
+        std::uint64_t pos;
+
+        // index of the serialization chunk that is current at that position
+        std::uint64_t chunk;
+    };
+
+    // Create the index entry describing the current position of an archive
+    // writing to the given data and chunks.
+    inline parcel_index_entry make_parcel_index_entry(
+        serialization::output_archive& archive,
+        std::vector<serialization::serialization_chunk> const& chunks)
+    {
+        // make sure that the next parcel doesn't refer to pointers tracked
+        // while serializing previous parcels
+        if (auto* tracker = archive.try_get_extra_data<
+                serialization::detail::output_pointer_tracker>())
+        {
+            tracker->clear();
+        }
+
+        // An index chunk that has not been completed yet (has a size of zero)
+        // will receive the next bytes written, otherwise a new chunk will be
+        // started.
+        std::size_t chunk = chunks.size();
+        if (!chunks.empty() &&
+            chunks.back().type_ ==
+                serialization::chunk_type::chunk_type_index &&
+            chunks.back().size_ == 0)
+        {
+            --chunk;
+        }
+        return {archive.current_pos(), chunk};
+    }
+
+    // Append the index to the serialized data
+    template <typename Buffer>
+    void append_parcel_index(
+        Buffer& buffer, std::vector<parcel_index_entry> const& index)
+    {
+        std::size_t const size = buffer.data_.size();
+        std::size_t const index_size = index.size() * sizeof(index[0]);
+
+        buffer.data_.resize(size + index_size);
+        std::memcpy(buffer.data_.data() + size, index.data(), index_size);
+    }
+
+    // Extract the index appended to the serialized data
+    template <typename Buffer>
+    std::vector<parcel_index_entry> extract_parcel_index(
+        Buffer const& buffer, std::size_t parcel_count)
+    {
+        auto const data_size = static_cast<std::size_t>(
+            static_cast<std::uint64_t>(buffer.data_size_));
+
+        std::vector<parcel_index_entry> index(parcel_count);
+        std::size_t const index_size = index.size() * sizeof(index[0]);
+
+        if (buffer.data_.size() < data_size ||
+            buffer.data_.size() - data_size != index_size)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::serialization_error,
+                "hpx::parcelset::detail::extract_parcel_index",
+                "the size of the parcel index does not match the number of "
+                "parcels in the message ({})",
+                parcel_count);
+        }
+
+        std::memcpy(index.data(), buffer.data_.data() + data_size, index_size);
+        return index;
+    }
+}    // namespace hpx::parcelset::detail
+
+#endif
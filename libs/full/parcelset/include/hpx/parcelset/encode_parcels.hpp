@@ -23,6 +23,7 @@
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/detail/parcel_index.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
@@ -177,6 +178,7 @@ namespace hpx::parcelset {
                 int archive_flags = archive_flags_;
                 if (filter)
                 {
+                    filter->set_name(ps[0].get_action_name());
                     archive_flags = archive_flags |
                         static_cast<int>(
                             serialization::archive_flags::enable_compression);
@@ -195,6 +197,22 @@ namespace hpx::parcelset {
                 buffer.data_.reserve(arg_size);
                 buffer.chunks_.reserve(num_chunks);
 
+                // prepare messages carrying many parcels for being decoded
+                // in parallel on the receiving end (not supported for
+                // compressed data)
+                std::size_t const parallel_decode_threshold =
+                    pp.get_parallel_decode_threshold();
+                bool const create_index = !filter &&
+                    num_parcels != static_cast<std::size_t>(-1) &&
+                    parallel_decode_threshold != 0 &&
+                    parcels_sent >= parallel_decode_threshold;
+
+                std::vector<detail::parcel_index_entry> index;
+                if (create_index)
+                {
+                    index.reserve(parcels_sent);
+                }
+
                 // mark start of serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 hpx::chrono::high_resolution_timer const timer;
@@ -210,8 +228,14 @@ namespace hpx::parcelset {
                         archive_flags, &buffer.chunks_, filter.get(),
                         pp.get_zero_copy_serialization_threshold());
 
-                    if (num_parcels != static_cast<std::size_t>(-1))
+                    if (create_index)
+                    {
+                        archive << (parcels_sent | detail::parcel_index_flag);
+                    }
+                    else if (num_parcels != static_cast<std::size_t>(-1))
+                    {
                         archive << parcels_sent;    //-V128
+                    }
 
                     for (std::size_t i = 0; i != parcels_sent; ++i)
                     {
@@ -223,6 +247,12 @@ namespace hpx::parcelset {
 #endif
                         LPT_(debug) << ps[i];
 
+                        if (create_index)
+                        {
+                            index.push_back(detail::make_parcel_index_entry(
+                                archive, buffer.chunks_));
+                        }
+
                         auto split_gids_map = ps[i].move_split_gids();
                         if (!split_gids_map.empty())
                         {
@@ -248,6 +278,11 @@ namespace hpx::parcelset {
                     arg_size = archive.bytes_written();
                 }
 
+                if (create_index)
+                {
+                    detail::append_parcel_index(buffer, index);
+                }
+
                 // store the time required for serialization
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 buffer.data_point_.serialization_time_ =
@@ -163,6 +163,13 @@ namespace hpx::parcelset {
                 HPX_ASSERT(endian_out == "little" || endian_out == "big");
             }
 
+            // send polymorphic types with the ids derived from their names
+            if (get_config_entry("hpx.parcel.type_ids", "1") != "0")
+            {
+                archive_flags_ = archive_flags_ |
+                    serialization::archive_flags::enable_type_ids;
+            }
+
             if (!this->allow_array_optimizations())
             {
                 archive_flags_ = archive_flags_ |
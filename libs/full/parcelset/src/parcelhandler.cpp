@@ -1402,6 +1402,7 @@ namespace hpx::parcelset {
                 "endian_out = ${HPX_PARCEL_ENDIAN_OUT:little}");
         ini_defs.emplace_back(
             "array_optimization = ${HPX_PARCEL_ARRAY_OPTIMIZATION:1}");
+        ini_defs.emplace_back("type_ids = ${HPX_PARCEL_TYPE_IDS:1}");
         ini_defs.emplace_back(
             "zero_copy_optimization = ${HPX_PARCEL_ZERO_COPY_OPTIMIZATION:"
             "$[hpx.parcel.array_optimization]}");
@@ -1423,6 +1424,10 @@ namespace hpx::parcelset {
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
+        ini_defs.emplace_back("parallel_decode_threshold = "
+                              "${HPX_PARCEL_PARALLEL_DECODE_THRESHOLD:64}");
+        ini_defs.emplace_back("deserialization_arena_size = "
+                              "${HPX_PARCEL_DESERIALIZATION_ARENA_SIZE:0}");
 
         for (plugins::parcelport_factory_base* f :
             parcelhandler::get_parcelport_factories())
@@ -0,0 +1,135 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE) &&                                       \
+    defined(HPX_HAVE_CXX17_MEMORY_RESOURCE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/serialization/deserialization_arena.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The arenas take their memory from the default memory resource, this one
+// keeps track of the memory handed out through it.
+class counting_resource final : public std::pmr::memory_resource
+{
+public:
+    std::atomic<std::size_t> outstanding{0};    // bytes not returned yet
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        outstanding += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(
+        void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        outstanding -= bytes;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(
+        std::pmr::memory_resource const& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+counting_resource upstream;
+
+using vector_type = std::pmr::vector<double>;
+
+// the argument has to be constructed from an arena, which in turn has to take
+// its memory from the default resource
+bool allocated_from_arena(vector_type const& v)
+{
+    using hpx::serialization::deserialization_arena;
+
+    auto* arena =
+        dynamic_cast<deserialization_arena*>(v.get_allocator().resource());
+    return arena != nullptr && arena->num_allocations() != 0 &&
+        upstream.outstanding != 0;
+}
+
+HPX_PLAIN_ACTION(allocated_from_arena)
+
+// the arena is released as soon as the thread which executed the action (and
+// which owned its arguments) has terminated
+bool arena_released()
+{
+    auto const deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (upstream.outstanding != 0)
+    {
+        if (std::chrono::steady_clock::now() > deadline)
+        {
+            return false;
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+HPX_PLAIN_ACTION(arena_released)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_deserialization_arena(hpx::id_type const& id)
+{
+    vector_type v(100);
+    for (std::size_t i = 0; i != v.size(); ++i)
+    {
+        v[i] = static_cast<double>(i);
+    }
+
+    for (int i = 0; i != 10; ++i)
+    {
+        HPX_TEST(allocated_from_arena_action()(id, v));
+        HPX_TEST(arena_released_action()(id));
+    }
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_deserialization_arena(id);
+    }
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::pmr::set_default_resource(&upstream);
+
+    std::vector<std::string> const cfg = {
+        "hpx.parcel.deserialization_arena_size=4096"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+
+    std::pmr::set_default_resource(nullptr);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -82,6 +82,14 @@ namespace hpx::parcelset {
         // serialize an entity
         std::size_t get_zero_copy_serialization_threshold() const noexcept;
 
+        /// Return the minimal number of parcels in a message for which the
+        /// message is prepared for parallel decoding on the receiving end
+        std::size_t get_parallel_decode_threshold() const noexcept;
+
+        /// Return the initial size of the memory arena used for constructing
+        /// the arguments of a received action (zero if no arena is used)
+        std::size_t get_deserialization_arena_size() const noexcept;
+
         /// Start the parcelport I/O thread pool.
         ///
         /// \param blocking [in] If blocking is set to \a true the routine will
@@ -374,6 +382,8 @@ namespace hpx::parcelset {
         std::string type_;
 
         std::size_t zero_copy_serialization_threshold_;
+        std::size_t parallel_decode_threshold_;
+        std::size_t deserialization_arena_size_;
     };
 }    // namespace hpx::parcelset
 
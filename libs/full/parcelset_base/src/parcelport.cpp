@@ -47,6 +47,10 @@ namespace hpx::parcelset {
             ini, "hpx.parcel." + type + ".priority", 0))
       , type_(type)
       , zero_copy_serialization_threshold_(zero_copy_serialization_threshold)
+      , parallel_decode_threshold_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.parallel_decode_threshold", 64))
+      , deserialization_arena_size_(hpx::util::get_entry_as<std::size_t>(
+            ini, "hpx.parcel.deserialization_arena_size", 0))
     {
         std::string key("hpx.parcel.");
         key += type;
@@ -100,6 +104,16 @@ namespace hpx::parcelset {
         return zero_copy_serialization_threshold_;
     }
 
+    std::size_t parcelport::get_parallel_decode_threshold() const noexcept
+    {
+        return parallel_decode_threshold_;
+    }
+
+    std::size_t parcelport::get_deserialization_arena_size() const noexcept
+    {
+        return deserialization_arena_size_;
+    }
+
     locality const& parcelport::here() const noexcept
     {
         return here_;
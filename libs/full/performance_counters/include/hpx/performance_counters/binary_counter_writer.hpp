@@ -0,0 +1,170 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counters_fwd.hpp>
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Write samples of a fixed set of counters to a file using a compact
+    /// binary, column oriented layout. Samples are collected in memory into
+    /// row groups, full row groups are handed to a dedicated (OS) thread
+    /// which writes them to the file. Appending a sample waits for the I/O
+    /// thread only if the configured number of row groups is already
+    /// waiting to be written, which bounds the memory held by the writer.
+    /// Waiting suspends the calling HPX thread instead of blocking its
+    /// worker thread.
+    ///
+    /// All numbers are stored in the byte order of the writing machine, the
+    /// file starts with a header describing the counters:
+    ///
+    ///     char[8]   magic ("HPXCNT01")
+    ///     u32       byte order mark (1)
+    ///     u32       number of counters (N)
+    ///     N times:  u32 length, name, u32 length, unit of measure
+    ///
+    /// followed by any number of row groups holding R samples each:
+    ///
+    ///     u32       row group marker ("RGRP")
+    ///     u32       number of rows (R)
+    ///     u64[R]    time stamps [ns]
+    ///     N times:  f64[R] counter values
+    ///
+    /// Counter values which were not valid at the time of sampling are
+    /// stored as NaN. See tools/counter_reader for a program converting such
+    /// files back into CSV.
+    class HPX_EXPORT binary_counter_writer
+    {
+    public:
+        static constexpr char const magic[] = "HPXCNT01";
+        static constexpr std::uint32_t row_group_marker = 0x50524752;
+
+        /// Create the file \a filename (overwriting an existing one) and
+        /// write the header for the given counters. Samples are written in
+        /// groups of \a row_group_size rows, at most \a max_pending row
+        /// groups are held in memory waiting to be written.
+        binary_counter_writer(std::string const& filename,
+            std::vector<counter_info> const& infos,
+            std::size_t row_group_size = 1024, std::size_t max_pending = 4);
+        ~binary_counter_writer();
+
+        binary_counter_writer(binary_counter_writer const&) = delete;
+        binary_counter_writer(binary_counter_writer&&) = delete;
+        binary_counter_writer& operator=(binary_counter_writer const&) = delete;
+        binary_counter_writer& operator=(binary_counter_writer&&) = delete;
+
+        /// Append one sample holding a value for each of the counters, the
+        /// time stamp of the row is either given explicitly or is the
+        /// current time.
+        void append(std::vector<counter_value> const& values,
+            error_code& ec = throws);
+        void append(std::uint64_t time,
+            std::vector<counter_value> const& values, error_code& ec = throws);
+
+        /// Append one sample like append(), but never wait for the I/O
+        /// thread. Returns whether a full row group was handed to the I/O
+        /// thread, in which case the caller should invoke
+        /// apply_back_pressure() as soon as it doesn't hold any locks.
+        bool append_no_wait(std::vector<counter_value> const& values,
+            error_code& ec = throws);
+        bool append_no_wait(std::uint64_t time,
+            std::vector<counter_value> const& values, error_code& ec = throws);
+
+        /// Wait until fewer than the configured number of row groups are
+        /// waiting to be written, may be called concurrently with any other
+        /// member function except close().
+        void apply_back_pressure();
+
+        /// Hand the samples collected so far to the I/O thread as a
+        /// (possibly partial) row group without waiting for it to be
+        /// written. Like append(), this must not be called concurrently
+        /// with any other member function except wait() and
+        /// apply_back_pressure().
+        void submit_samples();
+
+        /// Wait for all row groups handed to the I/O thread to be written,
+        /// may be called concurrently with append().
+        void wait(error_code& ec = throws);
+
+        /// Write the samples collected so far as a (possibly partial) row
+        /// group and wait for all pending row groups to be written.
+        void flush(error_code& ec = throws);
+
+        /// Flush the remaining samples and close the file, no samples may be
+        /// appended afterwards.
+        void close(error_code& ec = throws);
+
+        std::size_t num_counters() const noexcept
+        {
+            return num_counters_;
+        }
+
+        std::size_t row_group_size() const noexcept
+        {
+            return row_group_size_;
+        }
+
+    private:
+        // a row group stores all time stamps followed by the values of the
+        // first counter, the values of the second counter, etc.
+        struct row_group
+        {
+            row_group(std::size_t num_counters, std::size_t row_group_size);
+
+            std::size_t rows_;
+            std::vector<std::uint64_t> times_;
+            std::vector<double> values_;
+        };
+
+        std::unique_ptr<row_group> get_row_group();
+        void enqueue(std::unique_ptr<row_group> group);
+        void wait_for_writer(std::size_t max_pending);
+        bool check_status(char const* func, error_code& ec);
+
+        void write_header(std::vector<counter_info> const& infos);
+        void write_row_group(row_group const& group);
+        void run();
+
+        std::size_t num_counters_;
+        std::size_t row_group_size_;
+        std::size_t max_pending_;
+        std::unique_ptr<row_group> current_;
+
+        std::string filename_;
+        std::ofstream out_;
+
+        // the state shared with the I/O thread
+        std::mutex mtx_;
+        std::condition_variable cond_;
+        std::deque<std::unique_ptr<row_group>> pending_;
+        std::vector<std::unique_ptr<row_group>> free_;
+        bool writing_;
+        bool failed_;
+        bool stopped_;
+
+        std::thread thread_;
+    };
+}    // namespace hpx::performance_counters
+
+#include <hpx/config/warnings_suffix.hpp>
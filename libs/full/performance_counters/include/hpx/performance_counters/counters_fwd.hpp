@@ -659,6 +659,17 @@ namespace hpx { namespace performance_counters {
         HPX_EXPORT naming::gid_type arithmetics_counter_extended_creator(
             counter_info const&, error_code&);
 
+        // Creation function for percentile counters; to be registered with
+        // the counter types.
+        HPX_EXPORT naming::gid_type percentile_counter_creator(
+            counter_info const&, error_code&);
+
+        // Creation function for percentile counters merging the histograms
+        // of other percentile counters; to be registered with the counter
+        // types.
+        HPX_EXPORT naming::gid_type merged_percentile_counter_creator(
+            counter_info const&, error_code&);
+
         // Creation function for uptime counters.
         HPX_EXPORT naming::gid_type uptime_counter_creator(
             counter_info const&, error_code&);
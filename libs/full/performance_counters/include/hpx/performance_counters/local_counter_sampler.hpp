@@ -0,0 +1,186 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counters_fwd.hpp>
+#include <hpx/performance_counters/server/base_performance_counter.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters {
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A fixed-capacity ring buffer holding the most recent values of one
+    /// counter. The buffer has a single writer and any number of concurrent
+    /// readers, neither of which ever takes a lock or allocates memory. Every
+    /// value is identified by its sequence number, readers ask for all values
+    /// starting at a given sequence number and silently lose values which
+    /// have been overwritten in the meantime.
+    class HPX_EXPORT counter_time_series
+    {
+    public:
+        explicit counter_time_series(std::size_t capacity);
+
+        counter_time_series(counter_time_series const&) = delete;
+        counter_time_series(counter_time_series&&) = delete;
+        counter_time_series& operator=(counter_time_series const&) = delete;
+        counter_time_series& operator=(counter_time_series&&) = delete;
+
+        /// Append a value, may only be called by a single thread at a time.
+        void push(counter_value const& value) noexcept;
+
+        /// Append all values with a sequence number not smaller than \a since
+        /// which are still available to \a values. Returns the sequence number
+        /// of the next value to be written.
+        std::uint64_t read(
+            std::uint64_t since, std::vector<counter_value>& values) const;
+
+        /// Retrieve the most recent value, returns false if no value has been
+        /// written so far.
+        bool latest(counter_value& value) const;
+
+        /// Return the sequence number of the next value to be written, which
+        /// is the number of values written so far.
+        std::uint64_t size() const noexcept
+        {
+            return head_.load(std::memory_order_acquire);
+        }
+
+        std::size_t capacity() const noexcept
+        {
+            return capacity_;
+        }
+
+    private:
+        struct slot
+        {
+            std::atomic<std::uint64_t> time_{0};
+            std::atomic<std::uint64_t> count_{0};
+            std::atomic<std::int64_t> value_{0};
+            std::atomic<std::int64_t> scaling_{1};
+            std::atomic<bool> scale_inverse_{false};
+        };
+
+        void load(slot const& s, counter_value& value) const noexcept;
+
+        std::size_t capacity_;
+        std::unique_ptr<slot[]> slots_;
+
+        // sequence number of the value currently being written (plus one)
+        // and of the next value to be published
+        std::atomic<std::uint64_t> claimed_;
+        std::atomic<std::uint64_t> head_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Periodically sample a set of counters of this locality into
+    /// preallocated ring buffers. The counters are looked up once, using the
+    /// usual counter names (including wild-cards), afterwards sampling and
+    /// reading the samples bypasses actions and AGAS entirely.
+    ///
+    /// The counters are kept in a flat table of fixed capacity, counters can
+    /// be added while the sampler is running.
+    class HPX_EXPORT local_counter_sampler
+    {
+        // avoid warning about using this in member initializer list
+        local_counter_sampler* this_()
+        {
+            return this;
+        }
+
+    public:
+        /// Create a sampler running every \a interval microseconds, keeping
+        /// the last \a capacity samples of up to \a max_counters counters.
+        local_counter_sampler(std::int64_t interval, std::size_t capacity,
+            std::size_t max_counters = 256);
+        ~local_counter_sampler();
+
+        local_counter_sampler(local_counter_sampler const&) = delete;
+        local_counter_sampler(local_counter_sampler&&) = delete;
+        local_counter_sampler& operator=(local_counter_sampler const&) = delete;
+        local_counter_sampler& operator=(local_counter_sampler&&) = delete;
+
+        /// Add the counters matching the given name, possibly containing
+        /// wild-card characters. All matching counters must be located on
+        /// this locality.
+        void add_counters(std::string const& names, error_code& ec = throws);
+        void add_counters(
+            std::vector<std::string> const& names, error_code& ec = throws);
+
+        /// Return the number of counters in this sampler
+        std::size_t size() const noexcept
+        {
+            return size_.load(std::memory_order_acquire);
+        }
+
+        /// Retrieve the counter info for the counter at the given index
+        counter_info const& get_counter_info(std::size_t index) const;
+
+        /// Retrieve the ring buffer of the counter at the given index
+        counter_time_series const& get_time_series(std::size_t index) const;
+
+        /// Start and stop the counters and the periodic sampling
+        bool start(error_code& ec = throws);
+        bool stop(error_code& ec = throws);
+
+        /// Take one sample of all counters, this is what the timer invokes
+        /// periodically. A sample is skipped if another one is still being
+        /// taken concurrently.
+        void sample();
+
+        /// Append the samples of the counter at the given index which are
+        /// newer than \a since to \a values, returns the sequence number to
+        /// pass on the next call.
+        std::uint64_t read(std::size_t index, std::uint64_t since,
+            std::vector<counter_value>& values) const;
+
+        /// Retrieve the most recent sample of every counter in one batch,
+        /// counters which have not been sampled yet report
+        /// counter_status::invalid_data.
+        void read_latest(std::vector<counter_value>& values) const;
+
+    private:
+        struct entry
+        {
+            entry(counter_info const& info,
+                std::shared_ptr<server::base_performance_counter> counter,
+                std::size_t capacity);
+
+            counter_info info_;
+            std::shared_ptr<server::base_performance_counter> counter_;
+            counter_time_series series_;
+        };
+
+        bool add_counter(counter_info const& info, error_code& ec);
+        bool evaluate();
+
+        entry const& get_entry(std::size_t index) const;
+
+        std::size_t capacity_;
+        std::size_t max_counters_;
+
+        std::unique_ptr<std::atomic<entry*>[]> entries_;
+        std::atomic<std::size_t> reserved_;
+        std::atomic<std::size_t> size_;
+        std::atomic<bool> sampling_;
+
+        hpx::util::interval_timer timer_;
+    };
+}    // namespace hpx::performance_counters
+
+#include <hpx/config/warnings_suffix.hpp>
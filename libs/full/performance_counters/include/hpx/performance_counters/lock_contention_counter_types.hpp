@@ -0,0 +1,20 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+namespace hpx::performance_counters {
+
+    // Register the /locks/... counters exposing the statistics collected by
+    // the lock contention profiler (see hpx/synchronization/detail/
+    // lock_contention.hpp).
+    HPX_EXPORT void register_lock_contention_counter_types();
+}    // namespace hpx::performance_counters
+
+#endif
@@ -9,6 +9,7 @@
 #include <hpx/config.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/itt_notify.hpp>
+#include <hpx/performance_counters/binary_counter_writer.hpp>
 #include <hpx/performance_counters/counters_fwd.hpp>
 #include <hpx/performance_counters/performance_counter_set.hpp>
 #include <hpx/runtime_local/interval_timer.hpp>
@@ -16,6 +17,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
 #include <map>
 #endif
@@ -69,6 +71,12 @@ namespace hpx::util {
             std::vector<performance_counters::counter_info> const& infos,
             error_code& ec);
 
+        void write_binary_values(
+            std::vector<performance_counters::counter_info> const& infos,
+            std::vector<std::size_t> const& indices,
+            std::vector<performance_counters::counter_value> const& values,
+            error_code& ec);
+
         template <typename Stream>
         void print_headers(Stream& output,
             std::vector<performance_counters::counter_info> const& infos);
@@ -117,6 +125,9 @@ namespace hpx::util {
         bool print_counters_locally_;
         bool counter_types_;
 
+        // used for --hpx:print-counter-format=binary only
+        std::unique_ptr<performance_counters::binary_counter_writer> writer_;
+
         interval_timer timer_;
 
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
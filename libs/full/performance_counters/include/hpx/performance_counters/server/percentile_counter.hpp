@@ -0,0 +1,139 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/server/component_base.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/performance_counters/performance_counter.hpp>
+#include <hpx/performance_counters/performance_counter_set.hpp>
+#include <hpx/performance_counters/server/base_performance_counter.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters::server {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This counter exposes a percentile of the values of its base counter
+    // sampled at a fixed interval. The samples are recorded in a log-linear
+    // histogram, the histogram itself is exposed as the counter's values
+    // array (see hpx::util::log_linear_histogram::save()).
+    class HPX_EXPORT percentile_counter
+      : public base_performance_counter
+      , public components::component_base<percentile_counter>
+    {
+        using base_type = components::component_base<percentile_counter>;
+
+        // avoid warnings about using this in member initializer list
+        constexpr percentile_counter* this_() noexcept
+        {
+            return this;
+        }
+
+    public:
+        using type_holder = percentile_counter;
+        using base_type_holder = base_performance_counter;
+
+        percentile_counter();
+
+        percentile_counter(counter_info const& info,
+            std::string const& base_counter_name, double percentile,
+            std::size_t interval, bool reset_base_counter);
+
+        /// Overloads from the base_counter base class.
+        hpx::performance_counters::counter_value get_counter_value(
+            bool reset = false) override;
+        hpx::performance_counters::counter_values_array
+        get_counter_values_array(bool reset = false) override;
+
+        bool start() override;
+
+        bool stop() override;
+
+        void reset_counter_value() override;
+
+        void on_terminate();
+
+        // finalize() will be called just before the instance gets destructed
+        void finalize();
+
+        naming::address get_current_address() const;
+
+    protected:
+        bool evaluate_base_counter(counter_value& value);
+        bool evaluate();
+        bool ensure_base_counter();
+
+    private:
+        using mutex_type = hpx::spinlock;
+        mutable mutex_type mtx_;
+
+        // base time interval in milliseconds
+        hpx::util::interval_timer timer_;
+
+        // name of base counter to be queried
+        std::string base_counter_name_;
+        hpx::id_type base_counter_id_;
+
+        hpx::util::log_linear_histogram histogram_;
+        double percentile_;
+
+        // the scaling of the base counter values
+        counter_value base_value_;
+        bool reset_base_counter_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // This counter exposes a percentile of the values recorded by a set of
+    // percentile counters (possibly located on different localities) by
+    // merging their histograms.
+    class HPX_EXPORT merged_percentile_counter
+      : public base_performance_counter
+      , public components::component_base<merged_percentile_counter>
+    {
+        using base_type =
+            components::component_base<merged_percentile_counter>;
+
+    public:
+        using type_holder = merged_percentile_counter;
+        using base_type_holder = base_performance_counter;
+
+        merged_percentile_counter();
+
+        merged_percentile_counter(counter_info const& info, double percentile,
+            std::vector<std::string> const& base_counter_names);
+
+        /// Overloads from the base_counter base class.
+        hpx::performance_counters::counter_value get_counter_value(
+            bool reset = false) override;
+        hpx::performance_counters::counter_values_array
+        get_counter_values_array(bool reset = false) override;
+
+        bool start() override;
+        bool stop() override;
+        void reset_counter_value() override;
+
+        void finalize();
+
+        naming::address get_current_address() const;
+
+    private:
+        hpx::util::log_linear_histogram merge_base_counters(
+            counter_values_array& base_value, bool reset) const;
+
+        // base counters to be queried
+        performance_counter_set counters_;
+        std::vector<performance_counter> base_counters_;
+        double percentile_;
+    };
+}    // namespace hpx::performance_counters::server
@@ -0,0 +1,375 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/performance_counters/binary_counter_writer.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters {
+
+    namespace {
+
+        template <typename T>
+        void write_binary(std::ofstream& out, T const* data, std::size_t count)
+        {
+            out.write(reinterpret_cast<char const*>(data),
+                static_cast<std::streamsize>(count * sizeof(T)));
+        }
+
+        void write_binary(std::ofstream& out, std::uint32_t value)
+        {
+            write_binary(out, &value, 1);
+        }
+
+        void write_binary(std::ofstream& out, std::string const& value)
+        {
+            write_binary(out, static_cast<std::uint32_t>(value.size()));
+            write_binary(out, value.data(), value.size());
+        }
+
+        double get_binary_value(counter_value const& value) noexcept
+        {
+            if (!status_is_valid(value.status_) || value.scaling_ == 0)
+            {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+
+            double const val = static_cast<double>(value.value_);
+            if (value.scaling_ == 1)
+            {
+                return val;
+            }
+            return value.scale_inverse_ ?
+                val / static_cast<double>(value.scaling_) :
+                val * static_cast<double>(value.scaling_);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    binary_counter_writer::row_group::row_group(
+        std::size_t num_counters, std::size_t row_group_size)
+      : rows_(0)
+      , times_(row_group_size)
+      , values_(num_counters * row_group_size)
+    {
+    }
+
+    binary_counter_writer::binary_counter_writer(std::string const& filename,
+        std::vector<counter_info> const& infos, std::size_t row_group_size,
+        std::size_t max_pending)
+      : num_counters_(infos.size())
+      , row_group_size_(row_group_size)
+      , max_pending_(max_pending)
+      , filename_(filename)
+      , out_(filename, std::ofstream::binary | std::ofstream::trunc)
+      , writing_(false)
+      , failed_(false)
+      , stopped_(false)
+    {
+        if (row_group_size == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "binary_counter_writer::binary_counter_writer",
+                "the row group size must not be zero");
+        }
+        if (max_pending == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "binary_counter_writer::binary_counter_writer",
+                "the number of pending row groups must not be zero");
+        }
+        if (!out_)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::filesystem_error,
+                "binary_counter_writer::binary_counter_writer",
+                "unable to open file '{1}' for writing", filename);
+        }
+
+        write_header(infos);
+
+        thread_ = std::thread(&binary_counter_writer::run, this);
+    }
+
+    binary_counter_writer::~binary_counter_writer()
+    {
+        error_code ec(throwmode::lightweight);
+        close(ec);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void binary_counter_writer::write_header(
+        std::vector<counter_info> const& infos)
+    {
+        write_binary(out_, magic, sizeof(magic) - 1);
+        write_binary(out_, std::uint32_t(1));
+        write_binary(out_, static_cast<std::uint32_t>(num_counters_));
+        for (counter_info const& info : infos)
+        {
+            write_binary(out_, info.fullname_);
+            write_binary(out_, info.unit_of_measure_);
+        }
+    }
+
+    void binary_counter_writer::write_row_group(row_group const& group)
+    {
+        write_binary(out_, row_group_marker);
+        write_binary(out_, static_cast<std::uint32_t>(group.rows_));
+        write_binary(out_, group.times_.data(), group.rows_);
+
+        // partial row groups are written column by column
+        if (group.rows_ == row_group_size_)
+        {
+            write_binary(out_, group.values_.data(), group.values_.size());
+        }
+        else
+        {
+            for (std::size_t i = 0; i != num_counters_; ++i)
+            {
+                write_binary(out_,
+                    group.values_.data() + i * row_group_size_, group.rows_);
+            }
+        }
+    }
+
+    // The I/O thread writes the row groups in the order they were submitted
+    // and recycles them afterwards.
+    void binary_counter_writer::run()
+    {
+        std::unique_lock<std::mutex> l(mtx_);
+        while (true)
+        {
+            cond_.wait(l, [this] { return stopped_ || !pending_.empty(); });
+            if (pending_.empty())
+            {
+                break;
+            }
+
+            std::unique_ptr<row_group> group = HPX_MOVE(pending_.front());
+            pending_.pop_front();
+            bool const last = pending_.empty();
+            writing_ = true;
+
+            bool success = true;
+            {
+                unlock_guard<std::unique_lock<std::mutex>> ul(l);
+
+                write_row_group(*group);
+                if (last)
+                {
+                    out_.flush();
+                }
+                success = out_.good();
+            }
+
+            group->rows_ = 0;
+            free_.push_back(HPX_MOVE(group));
+            failed_ = failed_ || !success;
+            writing_ = false;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::unique_ptr<binary_counter_writer::row_group>
+    binary_counter_writer::get_row_group()
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            if (!free_.empty())
+            {
+                std::unique_ptr<row_group> group = HPX_MOVE(free_.back());
+                free_.pop_back();
+                return group;
+            }
+        }
+        return std::make_unique<row_group>(num_counters_, row_group_size_);
+    }
+
+    // Wait until at most max_pending row groups are waiting to be written
+    // (and none is being written, if max_pending is zero). HPX threads are
+    // suspended instead of blocking the worker thread they run on.
+    void binary_counter_writer::wait_for_writer(std::size_t max_pending)
+    {
+        hpx::util::yield_while(
+            [&]() {
+                std::lock_guard<std::mutex> l(mtx_);
+                return pending_.size() > max_pending ||
+                    (max_pending == 0 && writing_);
+            },
+            "binary_counter_writer::wait_for_writer");
+    }
+
+    void binary_counter_writer::enqueue(std::unique_ptr<row_group> group)
+    {
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            pending_.push_back(HPX_MOVE(group));
+        }
+        cond_.notify_all();
+    }
+
+    // The row group just handed to the I/O thread is counted as well, the
+    // next one can be queued without exceeding max_pending_.
+    void binary_counter_writer::apply_back_pressure()
+    {
+        wait_for_writer(max_pending_ - 1);
+    }
+
+    bool binary_counter_writer::check_status(char const* func, error_code& ec)
+    {
+        bool failed = false;
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            failed = failed_;
+        }
+
+        if (failed)
+        {
+            HPX_THROWS_IF(ec, hpx::error::filesystem_error, func,
+                "failed to write to file '{1}'", filename_);
+            return false;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void binary_counter_writer::append(
+        std::vector<counter_value> const& values, error_code& ec)
+    {
+        append(static_cast<std::uint64_t>(
+                   hpx::chrono::high_resolution_clock::now()),
+            values, ec);
+    }
+
+    void binary_counter_writer::append(std::uint64_t time,
+        std::vector<counter_value> const& values, error_code& ec)
+    {
+        if (append_no_wait(time, values, ec))
+        {
+            apply_back_pressure();
+        }
+    }
+
+    bool binary_counter_writer::append_no_wait(
+        std::vector<counter_value> const& values, error_code& ec)
+    {
+        return append_no_wait(static_cast<std::uint64_t>(
+                                  hpx::chrono::high_resolution_clock::now()),
+            values, ec);
+    }
+
+    bool binary_counter_writer::append_no_wait(std::uint64_t time,
+        std::vector<counter_value> const& values, error_code& ec)
+    {
+        if (values.size() != num_counters_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "binary_counter_writer::append",
+                "wrong number of counter values, expected {1}, got {2}",
+                num_counters_, values.size());
+            return false;
+        }
+        if (!thread_.joinable())
+        {
+            HPX_THROWS_IF(ec, hpx::error::invalid_status,
+                "binary_counter_writer::append",
+                "the file '{1}' has already been closed", filename_);
+            return false;
+        }
+
+        if (!current_)
+        {
+            current_ = get_row_group();
+        }
+
+        std::size_t const row = current_->rows_++;
+        current_->times_[row] = time;
+        for (std::size_t i = 0; i != num_counters_; ++i)
+        {
+            current_->values_[i * row_group_size_ + row] =
+                get_binary_value(values[i]);
+        }
+
+        bool const full = current_->rows_ == row_group_size_;
+        if (full)
+        {
+            enqueue(HPX_MOVE(current_));
+        }
+
+        check_status("binary_counter_writer::append", ec);
+        return full;
+    }
+
+    void binary_counter_writer::submit_samples()
+    {
+        if (current_ && current_->rows_ != 0)
+        {
+            enqueue(HPX_MOVE(current_));
+        }
+    }
+
+    void binary_counter_writer::wait(error_code& ec)
+    {
+        wait_for_writer(0);
+        check_status("binary_counter_writer::wait", ec);
+    }
+
+    void binary_counter_writer::flush(error_code& ec)
+    {
+        submit_samples();
+
+        wait_for_writer(0);
+        check_status("binary_counter_writer::flush", ec);
+    }
+
+    void binary_counter_writer::close(error_code& ec)
+    {
+        if (!thread_.joinable())
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return;
+        }
+
+        submit_samples();
+
+        // the I/O thread exits only after all pending row groups have been
+        // written
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            stopped_ = true;
+        }
+        cond_.notify_all();
+        thread_.join();
+
+        out_.close();
+        if (out_.fail())
+        {
+            std::lock_guard<std::mutex> l(mtx_);
+            failed_ = true;
+        }
+
+        check_status("binary_counter_writer::close", ec);
+    }
+}    // namespace hpx::performance_counters
@@ -0,0 +1,385 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/components/get_ptr.hpp>
+#include <hpx/functional/bind.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/local_counter_sampler.hpp>
+#include <hpx/performance_counters/server/base_performance_counter.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters {
+
+    ///////////////////////////////////////////////////////////////////////////
+    counter_time_series::counter_time_series(std::size_t capacity)
+      : capacity_(capacity)
+      , slots_(new slot[capacity])
+      , claimed_(0)
+      , head_(0)
+    {
+        if (capacity == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "counter_time_series::counter_time_series",
+                "the capacity of a counter time series must not be zero");
+        }
+    }
+
+    // The writer announces the slot it is about to overwrite before touching
+    // it, a reader discards everything it has read from a slot which may
+    // have been overwritten while it was reading (seqlock protocol).
+    void counter_time_series::push(counter_value const& value) noexcept
+    {
+        std::uint64_t const seq = head_.load(std::memory_order_relaxed);
+        claimed_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        slot& s = slots_[seq % capacity_];
+        s.time_.store(value.time_, std::memory_order_relaxed);
+        s.count_.store(value.count_, std::memory_order_relaxed);
+        s.value_.store(value.value_, std::memory_order_relaxed);
+        s.scaling_.store(value.scaling_, std::memory_order_relaxed);
+        s.scale_inverse_.store(
+            value.scale_inverse_, std::memory_order_relaxed);
+
+        head_.store(seq + 1, std::memory_order_release);
+    }
+
+    void counter_time_series::load(
+        slot const& s, counter_value& value) const noexcept
+    {
+        value.time_ = s.time_.load(std::memory_order_relaxed);
+        value.count_ = s.count_.load(std::memory_order_relaxed);
+        value.value_ = s.value_.load(std::memory_order_relaxed);
+        value.scaling_ = s.scaling_.load(std::memory_order_relaxed);
+        value.scale_inverse_ = s.scale_inverse_.load(std::memory_order_relaxed);
+        value.status_ = counter_status::new_data;
+    }
+
+    std::uint64_t counter_time_series::read(
+        std::uint64_t since, std::vector<counter_value>& values) const
+    {
+        std::uint64_t const head = head_.load(std::memory_order_acquire);
+        std::uint64_t first = head > capacity_ ? head - capacity_ : 0;
+        if (since > first)
+        {
+            first = since;
+        }
+        if (first >= head)
+        {
+            return head;
+        }
+
+        std::size_t const offset = values.size();
+        values.resize(offset + static_cast<std::size_t>(head - first));
+        for (std::uint64_t seq = first; seq != head; ++seq)
+        {
+            load(slots_[seq % capacity_],
+                values[offset + static_cast<std::size_t>(seq - first)]);
+        }
+
+        // drop the values which might have been overwritten while reading,
+        // the value with the sequence number seq is overwritten by the one
+        // with the sequence number seq + capacity_
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::uint64_t const claimed = claimed_.load(std::memory_order_relaxed);
+        if (claimed > first + capacity_)
+        {
+            std::uint64_t const lost =
+                (std::min)(claimed - capacity_ - first, head - first);
+            values.erase(values.begin() + static_cast<std::ptrdiff_t>(offset),
+                values.begin() + static_cast<std::ptrdiff_t>(offset + lost));
+        }
+        return head;
+    }
+
+    bool counter_time_series::latest(counter_value& value) const
+    {
+        for (;;)
+        {
+            std::uint64_t const head = head_.load(std::memory_order_acquire);
+            if (head == 0)
+            {
+                return false;
+            }
+
+            load(slots_[(head - 1) % capacity_], value);
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (claimed_.load(std::memory_order_relaxed) < head + capacity_)
+            {
+                return true;
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    local_counter_sampler::entry::entry(counter_info const& info,
+        std::shared_ptr<server::base_performance_counter> counter,
+        std::size_t capacity)
+      : info_(info)
+      , counter_(HPX_MOVE(counter))
+      , series_(capacity)
+    {
+    }
+
+    local_counter_sampler::local_counter_sampler(std::int64_t interval,
+        std::size_t capacity, std::size_t max_counters)
+      : capacity_(capacity)
+      , max_counters_(max_counters)
+      , entries_(new std::atomic<entry*>[max_counters])
+      , reserved_(0)
+      , size_(0)
+      , sampling_(false)
+      , timer_(hpx::bind_front(&local_counter_sampler::evaluate, this_()),
+            interval, "local_counter_sampler", true)
+    {
+        if (capacity == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "local_counter_sampler::local_counter_sampler",
+                "the capacity of the counter time series must not be zero");
+        }
+
+        for (std::size_t i = 0; i != max_counters_; ++i)
+        {
+            entries_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    local_counter_sampler::~local_counter_sampler()
+    {
+        timer_.stop(true);
+
+        std::size_t const size = size_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            delete entries_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool local_counter_sampler::add_counter(
+        counter_info const& info, error_code& ec)
+    {
+        hpx::id_type const id = get_counter(info.fullname_, ec);
+        if (HPX_UNLIKELY(!id))
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "local_counter_sampler::add_counter",
+                "unknown performance counter: '{1}' ({2})", info.fullname_,
+                ec.get_message());
+            return false;
+        }
+
+        // this fails for counters which are not located on this locality
+        auto counter = hpx::get_ptr<server::base_performance_counter>(
+            hpx::launch::sync, id, ec);
+        if (ec)
+        {
+            return false;
+        }
+
+        // create the entry before reserving its slot, a slot that has been
+        // reserved has to be published
+        std::unique_ptr<entry> e(new entry(info, HPX_MOVE(counter), capacity_));
+
+        std::size_t const index =
+            reserved_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= max_counters_)
+        {
+            reserved_.fetch_sub(1, std::memory_order_relaxed);
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "local_counter_sampler::add_counter",
+                "too many performance counters, the sampler can hold at most "
+                "{1} counters",
+                max_counters_);
+            return false;
+        }
+
+        entries_[index].store(e.release(), std::memory_order_release);
+
+        // publish the new entries in order, concurrent additions wait for
+        // the entries before theirs to become visible
+        std::size_t expected = index;
+        while (!size_.compare_exchange_weak(
+            expected, index + 1, std::memory_order_release))
+        {
+            expected = index;
+        }
+
+        if (&ec != &throws)
+            ec = make_success_code();
+
+        return true;
+    }
+
+    void local_counter_sampler::add_counters(
+        std::string const& names, error_code& ec)
+    {
+        add_counters(std::vector<std::string>(1, names), ec);
+    }
+
+    void local_counter_sampler::add_counters(
+        std::vector<std::string> const& names, error_code& ec)
+    {
+        using placeholders::_1;
+        using placeholders::_2;
+
+        discover_counter_func func =
+            hpx::bind(&local_counter_sampler::add_counter, this, _1, _2);
+
+        for (std::string const& name : names)
+        {
+            // do INI expansion on counter name
+            std::string n(name);
+            util::expand(n);
+            ensure_counter_prefix(n);
+
+            // find matching counter types
+            discover_counter_type(n, func, discover_counters_mode::full, ec);
+            if (ec)
+                return;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    local_counter_sampler::entry const& local_counter_sampler::get_entry(
+        std::size_t index) const
+    {
+        if (index >= size())
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "local_counter_sampler::get_entry",
+                "counter index out of bounds: {1}", index);
+        }
+        return *entries_[index].load(std::memory_order_acquire);
+    }
+
+    counter_info const& local_counter_sampler::get_counter_info(
+        std::size_t index) const
+    {
+        return get_entry(index).info_;
+    }
+
+    counter_time_series const& local_counter_sampler::get_time_series(
+        std::size_t index) const
+    {
+        return get_entry(index).series_;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool local_counter_sampler::start(error_code& ec)
+    {
+        try
+        {
+            std::size_t const size = this->size();
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                entries_[i].load(std::memory_order_acquire)
+                    ->counter_->start_nonvirt();
+            }
+            return timer_.start(true);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(ec, e, "local_counter_sampler::start");
+            return false;
+        }
+    }
+
+    bool local_counter_sampler::stop(error_code& ec)
+    {
+        try
+        {
+            bool const result = timer_.stop();
+
+            std::size_t const size = this->size();
+            for (std::size_t i = 0; i != size; ++i)
+            {
+                entries_[i].load(std::memory_order_acquire)
+                    ->counter_->stop_nonvirt();
+            }
+            return result;
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(ec, e, "local_counter_sampler::stop");
+            return false;
+        }
+    }
+
+    void local_counter_sampler::sample()
+    {
+        // the ring buffers support a single writer only, skip this sample
+        // if another one is still being taken
+        if (sampling_.exchange(true, std::memory_order_acquire))
+        {
+            return;
+        }
+
+        std::size_t const size = this->size();
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            entry* e = entries_[i].load(std::memory_order_acquire);
+
+            // query the counter object directly instead of sending it an
+            // action
+            counter_value const value =
+                e->counter_->get_counter_value_nonvirt(false);
+            if (status_is_valid(value.status_))
+            {
+                e->series_.push(value);
+            }
+        }
+
+        sampling_.store(false, std::memory_order_release);
+    }
+
+    bool local_counter_sampler::evaluate()
+    {
+        sample();
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t local_counter_sampler::read(std::size_t index,
+        std::uint64_t since, std::vector<counter_value>& values) const
+    {
+        return get_entry(index).series_.read(since, values);
+    }
+
+    void local_counter_sampler::read_latest(
+        std::vector<counter_value>& values) const
+    {
+        std::size_t const size = this->size();
+        values.resize(size);
+        for (std::size_t i = 0; i != size; ++i)
+        {
+            entry const* e = entries_[i].load(std::memory_order_acquire);
+            if (!e->series_.latest(values[i]))
+            {
+                values[i] = counter_value();
+                values[i].status_ = counter_status::invalid_data;
+            }
+        }
+    }
+}    // namespace hpx::performance_counters
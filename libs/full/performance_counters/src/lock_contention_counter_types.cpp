@@ -0,0 +1,155 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/functional.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/lock_contention_counter_types.hpp>
+#include <hpx/performance_counters/manage_counter_type.hpp>
+#include <hpx/synchronization/detail/lock_contention.hpp>
+#include <hpx/util/regex_from_pattern.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <regex>
+#include <string>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters {
+
+    namespace detail {
+
+        using lock_contention_value_func =
+            std::int64_t (*)(util::lock_contention_data const&);
+
+        // The counter value is the sum of the selected statistics over all
+        // lock sites matching the (optional) counter parameter. As the
+        // statistics are shared by all counters, resetting a counter records
+        // a baseline instead of resetting the statistics themselves.
+        naming::gid_type lock_contention_counter_creator(
+            lock_contention_value_func func, counter_info const& info,
+            error_code& ec)
+        {
+            counter_path_elements paths;
+            get_counter_path_elements(info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            std::optional<std::regex> rx;
+            if (!paths.parameters_.empty())
+            {
+                std::string const str_rx =
+                    util::regex_from_pattern(paths.parameters_, ec);
+                if (ec)
+                    return naming::invalid_gid;
+                rx.emplace(str_rx);
+            }
+
+            auto baseline = std::make_shared<std::atomic<std::int64_t>>(0);
+            hpx::function<std::int64_t(bool)> f =
+                [func, rx = HPX_MOVE(rx), baseline = HPX_MOVE(baseline)](
+                    bool reset) -> std::int64_t {
+                std::int64_t value = 0;
+                for (auto const& data : util::get_lock_contention_data())
+                {
+                    if (!rx || std::regex_match(data.site, *rx))
+                        value += func(data);
+                }
+
+                if (reset)
+                    return value - baseline->exchange(value);
+                return value - baseline->load();
+            };
+
+            return locality_raw_counter_creator(info, f, ec);
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    void register_lock_contention_counter_types()
+    {
+        using placeholders::_1;
+        using placeholders::_2;
+
+        detail::lock_contention_value_func const acquisitions =
+            [](util::lock_contention_data const& data) {
+                return static_cast<std::int64_t>(data.acquisitions);
+            };
+        detail::lock_contention_value_func const contentions =
+            [](util::lock_contention_data const& data) {
+                return static_cast<std::int64_t>(data.contentions);
+            };
+        detail::lock_contention_value_func const suspensions =
+            [](util::lock_contention_data const& data) {
+                return static_cast<std::int64_t>(data.suspensions);
+            };
+        detail::lock_contention_value_func const wait_time =
+            [](util::lock_contention_data const& data) {
+                return data.wait_time;
+            };
+        detail::lock_contention_value_func const hold_time =
+            [](util::lock_contention_data const& data) {
+                return data.hold_time;
+            };
+
+        generic_counter_type_data const counter_types[] = {
+            {"/locks/count/acquisitions",
+                counter_type::monotonically_increasing,
+                "returns the number of acquisitions of the profiled locks "
+                "(optionally restricted to the lock sites matching the "
+                "counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&detail::lock_contention_counter_creator,
+                    acquisitions, _1, _2),
+                &locality_counter_discoverer, ""},
+            {"/locks/count/contentions",
+                counter_type::monotonically_increasing,
+                "returns the number of acquisitions of the profiled locks "
+                "which had to wait for the lock to become available "
+                "(optionally restricted to the lock sites matching the "
+                "counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&detail::lock_contention_counter_creator,
+                    contentions, _1, _2),
+                &locality_counter_discoverer, ""},
+            {"/locks/count/suspensions",
+                counter_type::monotonically_increasing,
+                "returns the number of suspensions of threads waiting for "
+                "the profiled locks (optionally restricted to the lock sites "
+                "matching the counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&detail::lock_contention_counter_creator,
+                    suspensions, _1, _2),
+                &locality_counter_discoverer, ""},
+            {"/locks/time/wait", counter_type::elapsed_time,
+                "returns the overall time spent waiting for the profiled "
+                "locks (optionally restricted to the lock sites matching the "
+                "counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&detail::lock_contention_counter_creator, wait_time,
+                    _1, _2),
+                &locality_counter_discoverer, "ns"},
+            {"/locks/time/hold", counter_type::elapsed_time,
+                "returns the overall time the profiled locks were held "
+                "exclusively (optionally restricted to the lock sites "
+                "matching the counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                hpx::bind(&detail::lock_contention_counter_creator, hold_time,
+                    _1, _2),
+                &locality_counter_discoverer, "ns"}};
+
+        install_counter_types(counter_types, std::size(counter_types));
+    }
+}    // namespace hpx::performance_counters
+
+#endif
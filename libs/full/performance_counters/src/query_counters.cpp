@@ -29,6 +29,7 @@
 #include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
@@ -128,6 +129,20 @@ namespace hpx::util {
     {
         timer_.stop(terminate);
         counters_.stop(launch::sync);
+
+        performance_counters::binary_counter_writer* writer = nullptr;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (!writer_)
+                return;
+
+            writer_->submit_samples();
+            writer = writer_.get();
+        }
+
+        // don't hold the lock while waiting for the samples to be written,
+        // the writer is destroyed only together with this object
+        writer->wait();
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -543,15 +558,22 @@ namespace hpx::util {
         if (indices.empty())
             return false;
 
-        std::ostringstream output;
-        if (description && !no_output)
-            output << description << std::endl;
-
         std::vector<performance_counters::counter_value> values =
             counters_.get_counter_values(launch::sync, reset, ec);
 
         HPX_ASSERT(values.size() == indices.size());
 
+        if (format_ == "binary")
+        {
+            if (!no_output)
+                write_binary_values(infos, indices, values, ec);
+            return true;
+        }
+
+        std::ostringstream output;
+        if (description && !no_output)
+            output << description << std::endl;
+
         // Output the performance counter value.
         if (!no_output)
             print_headers(output, infos);
@@ -573,6 +595,53 @@ namespace hpx::util {
         return true;
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    void query_counters::write_binary_values(
+        std::vector<performance_counters::counter_info> const& infos,
+        std::vector<std::size_t> const& indices,
+        std::vector<performance_counters::counter_value> const& values,
+        error_code& ec)
+    {
+        performance_counters::binary_counter_writer* writer = nullptr;
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            // the file is created on first use as the set of counters is known
+            // only after they have been discovered
+            if (!writer_)
+            {
+                std::vector<performance_counters::counter_info> binary_infos;
+                binary_infos.reserve(indices.size());
+                for (std::size_t const i : indices)
+                {
+                    binary_infos.push_back(infos[i]);
+                }
+
+                try
+                {
+                    using performance_counters::binary_counter_writer;
+                    writer_ = std::make_unique<binary_counter_writer>(
+                        destination_, binary_infos);
+                }
+                catch (hpx::exception const& e)
+                {
+                    HPX_RETHROWS_IF(
+                        ec, e, "query_counters::write_binary_values");
+                    return;
+                }
+            }
+
+            // a full row group is only queued here, waiting for the I/O
+            // thread would suspend this thread while holding the lock
+            if (!writer_->append_no_wait(values, ec))
+                return;
+            writer = writer_.get();
+        }
+
+        // the writer is destroyed only together with this object
+        writer->apply_back_pressure();
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     bool query_counters::print_array_counters(bool destination_is_cout,
         bool reset, bool no_output, char const* description,
@@ -599,6 +668,11 @@ namespace hpx::util {
         if (indices.empty())
             return false;
 
+        // the binary format does not support histograms and other arrays of
+        // values
+        if (format_ == "binary")
+            no_output = true;
+
         std::ostringstream output;
         if (description && !no_output)
             output << description << std::endl;
@@ -0,0 +1,644 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async_base/launch_policy.hpp>
+#include <hpx/async_distributed/continuation.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/server/create_component.hpp>
+#include <hpx/functional/bind_front.hpp>
+#include <hpx/pack_traversal/unwrap.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/performance_counter.hpp>
+#include <hpx/performance_counters/server/percentile_counter.hpp>
+#include <hpx/runtime_components/derived_component_factory.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/thread_support/unlock_guard.hpp>
+
+#include <boost/spirit/home/x3/char.hpp>
+#include <boost/spirit/home/x3/core.hpp>
+#include <boost/spirit/home/x3/numeric.hpp>
+#include <boost/spirit/home/x3/operator.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+using percentile_counter_type = hpx::components::component<
+    hpx::performance_counters::server::percentile_counter>;
+
+HPX_REGISTER_DERIVED_COMPONENT_FACTORY(percentile_counter_type,
+    percentile_counter, "base_performance_counter",
+    hpx::components::factory_state::enabled)
+HPX_DEFINE_GET_COMPONENT_TYPE(
+    hpx::performance_counters::server::percentile_counter)
+
+using merged_percentile_counter_type = hpx::components::component<
+    hpx::performance_counters::server::merged_percentile_counter>;
+
+HPX_REGISTER_DERIVED_COMPONENT_FACTORY(merged_percentile_counter_type,
+    merged_percentile_counter, "base_performance_counter",
+    hpx::components::factory_state::enabled)
+HPX_DEFINE_GET_COMPONENT_TYPE(
+    hpx::performance_counters::server::merged_percentile_counter)
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters::server {
+
+    namespace {
+
+        void verify_percentile(char const* func, double percentile)
+        {
+            if (!(percentile >= 0.0 && percentile <= 100.0))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter, func,
+                    "the percentile must be in the range [0, 100], given: "
+                    "{1}",
+                    percentile);
+            }
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    percentile_counter::percentile_counter()
+      : percentile_(0.0)
+      , reset_base_counter_(false)
+    {
+    }
+
+    percentile_counter::percentile_counter(counter_info const& info,
+        std::string const& base_counter_name, double percentile,
+        std::size_t interval, bool reset_base_counter)
+      : base_type_holder(info)
+      , timer_(hpx::bind_front(&percentile_counter::evaluate, this_()),
+            hpx::bind_front(&percentile_counter::on_terminate, this_()),
+            1000 * interval, info.fullname_, true)
+      , base_counter_name_(ensure_counter_prefix(base_counter_name))
+      , percentile_(percentile)
+      , reset_base_counter_(reset_base_counter)
+    {
+        if (interval == 0)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "percentile_counter::percentile_counter",
+                "base interval is specified to be zero");
+        }
+
+        if (info.type_ != counter_type::aggregating)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "percentile_counter::percentile_counter",
+                "unexpected counter type specified");
+        }
+
+        verify_percentile("percentile_counter::percentile_counter", percentile);
+
+        // make sure this counter starts collecting data
+        percentile_counter::start();
+    }
+
+    hpx::performance_counters::counter_value
+    percentile_counter::get_counter_value(bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        counter_value value(histogram_.value_at_percentile(percentile_),
+            base_value_.scaling_, base_value_.scale_inverse_);
+        value.status_ = counter_status::new_data;
+        value.time_ = static_cast<std::int64_t>(hpx::get_system_uptime());
+        value.count_ = ++invocation_count_;
+
+        if (reset)
+            histogram_.reset();
+
+        return value;
+    }
+
+    hpx::performance_counters::counter_values_array
+    percentile_counter::get_counter_values_array(bool reset)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        counter_values_array value(histogram_.save(), base_value_.scaling_,
+            base_value_.scale_inverse_);
+        value.time_ = static_cast<std::int64_t>(hpx::get_system_uptime());
+        value.count_ = ++invocation_count_;
+
+        if (reset)
+            histogram_.reset();
+
+        return value;
+    }
+
+    bool percentile_counter::evaluate()
+    {
+        // gather current base value
+        counter_value base_value;
+        if (!evaluate_base_counter(base_value))
+            return false;
+
+        if (status_is_valid(base_value.status_))
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (base_value.scaling_ != base_value_.scaling_ ||
+                base_value.scale_inverse_ != base_value_.scale_inverse_)
+            {
+                // not supported right now
+                HPX_THROW_EXCEPTION(hpx::error::not_implemented,
+                    "percentile_counter::evaluate",
+                    "base counter should keep scaling constant over time");
+                return false;
+            }
+
+            // recording a value is O(1)
+            histogram_.add(base_value.value_);
+        }
+        return true;
+    }
+
+    bool percentile_counter::ensure_base_counter()
+    {
+        // lock here to avoid checking out multiple reference counted GIDs
+        // from AGAS
+        std::unique_lock<mutex_type> l(mtx_);
+
+        if (!base_counter_id_)
+        {
+            // get or create the base counter
+            error_code ec(throwmode::lightweight);
+            hpx::id_type base_counter_id;
+            {
+                // We need to unlock the lock here since get_counter might
+                // suspend
+                unlock_guard<std::unique_lock<mutex_type>> unlock(l);
+                base_counter_id = get_counter(base_counter_name_, ec);
+            }
+
+            // After reacquiring the lock, we need to check again if
+            // base_counter_id_ hasn't been set yet
+            if (base_counter_id_)
+                return true;
+
+            base_counter_id_ = base_counter_id;
+            if (HPX_UNLIKELY(ec || !base_counter_id_))
+            {
+                // base counter could not be retrieved
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "percentile_counter::ensure_base_counter",
+                    "could not get or create performance counter: '{}'",
+                    base_counter_name_);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool percentile_counter::evaluate_base_counter(counter_value& value)
+    {
+        // query the actual value
+        if (!base_counter_id_ && !ensure_base_counter())
+            return false;
+
+        performance_counters::performance_counter c(base_counter_id_);
+        value = c.get_counter_value(launch::sync, reset_base_counter_);
+
+        return true;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Start and stop this counter. We dispatch the calls to the base counter
+    // and control our own interval_timer.
+    bool percentile_counter::start()
+    {
+        if (!timer_.is_started())
+        {
+            // start base counter
+            if (!base_counter_id_ && !ensure_base_counter())
+                return false;
+
+            performance_counters::performance_counter c(base_counter_id_);
+            bool result = c.start(launch::sync);
+            if (result)
+            {
+                // the scaling of the base counter is expected to stay the
+                // same from now on
+                counter_value base_value;
+                if (evaluate_base_counter(base_value))
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    base_value_ = base_value;
+                    if (status_is_valid(base_value.status_))
+                        histogram_.add(base_value.value_);
+                }
+
+                // start timer
+                timer_.start();
+            }
+            else
+            {
+                // start timer even if base counter does not support being
+                // start/stop operations
+                timer_.start(true);
+            }
+            return result;
+        }
+        return false;
+    }
+
+    bool percentile_counter::stop()
+    {
+        if (timer_.is_started())
+        {
+            timer_.stop();
+
+            if (!base_counter_id_ && !ensure_base_counter())
+                return false;
+
+            performance_counters::performance_counter c(base_counter_id_);
+            return c.stop(launch::sync);
+        }
+        return false;
+    }
+
+    void percentile_counter::reset_counter_value()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        histogram_.reset();
+    }
+
+    void percentile_counter::on_terminate() {}
+
+    void percentile_counter::finalize()
+    {
+        base_performance_counter::finalize();
+        base_type::finalize();
+    }
+
+    naming::address percentile_counter::get_current_address() const
+    {
+        return naming::address(
+            naming::get_gid_from_locality_id(agas::get_locality_id()),
+            components::get_component_type<percentile_counter>(),
+            const_cast<percentile_counter*>(this));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    merged_percentile_counter::merged_percentile_counter()
+      : percentile_(0.0)
+    {
+    }
+
+    merged_percentile_counter::merged_percentile_counter(
+        counter_info const& info, double percentile,
+        std::vector<std::string> const& base_counter_names)
+      : base_type_holder(info)
+      , counters_(base_counter_names)
+      , percentile_(percentile)
+    {
+        if (info.type_ != counter_type::aggregating)
+        {
+            HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                "merged_percentile_counter::merged_percentile_counter",
+                "unexpected counter type specified");
+        }
+
+        verify_percentile(
+            "merged_percentile_counter::merged_percentile_counter", percentile);
+
+        // the counter set does not expose the histograms of counters of type
+        // counter_type::aggregating, query the counters directly
+        for (counter_info const& base_info : counters_.get_counter_infos())
+        {
+            base_counters_.emplace_back(base_info.fullname_);
+        }
+    }
+
+    hpx::util::log_linear_histogram
+    merged_percentile_counter::merge_base_counters(
+        counter_values_array& base_value, bool reset) const
+    {
+        std::vector<hpx::future<counter_values_array>> futures;
+        futures.reserve(base_counters_.size());
+        for (performance_counter const& c : base_counters_)
+        {
+            futures.push_back(c.get_counter_values_array(reset));
+        }
+
+        std::vector<counter_values_array> values = hpx::unwrap(futures);
+
+        hpx::util::log_linear_histogram histogram;
+        bool first = true;
+        for (counter_values_array& value : values)
+        {
+            if (!status_is_valid(value.status_) || value.values_.empty())
+                continue;
+
+            // all histograms must have been recorded with the same precision
+            if (first)
+            {
+                histogram = hpx::util::log_linear_histogram(
+                    static_cast<std::uint32_t>(value.values_[0]));
+                base_value = HPX_MOVE(value);
+                first = false;
+
+                if (!histogram.merge_saved(base_value.values_))
+                {
+                    HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                        "merged_percentile_counter::merge_base_counters",
+                        "the base counters of a merged percentile counter "
+                        "must be percentile counters");
+                }
+            }
+            else if (value.scaling_ != base_value.scaling_ ||
+                value.scale_inverse_ != base_value.scale_inverse_ ||
+                !histogram.merge_saved(value.values_))
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "merged_percentile_counter::merge_base_counters",
+                    "the base counters of a merged percentile counter must "
+                    "be percentile counters using the same scaling");
+            }
+        }
+        return histogram;
+    }
+
+    hpx::performance_counters::counter_value
+    merged_percentile_counter::get_counter_value(bool reset)
+    {
+        counter_values_array base_value;
+        hpx::util::log_linear_histogram const histogram =
+            merge_base_counters(base_value, reset);
+
+        counter_value value(histogram.value_at_percentile(percentile_),
+            base_value.scaling_, base_value.scale_inverse_);
+        value.status_ = counter_status::new_data;
+        value.time_ = static_cast<std::int64_t>(hpx::get_system_uptime());
+        value.count_ = ++invocation_count_;
+        return value;
+    }
+
+    hpx::performance_counters::counter_values_array
+    merged_percentile_counter::get_counter_values_array(bool reset)
+    {
+        counter_values_array base_value;
+        hpx::util::log_linear_histogram const histogram =
+            merge_base_counters(base_value, reset);
+
+        // the merged histogram can be merged again
+        counter_values_array value(
+            histogram.save(), base_value.scaling_, base_value.scale_inverse_);
+        value.time_ = static_cast<std::int64_t>(hpx::get_system_uptime());
+        value.count_ = ++invocation_count_;
+        return value;
+    }
+
+    bool merged_percentile_counter::start()
+    {
+        return counters_.start(hpx::launch::sync);
+    }
+
+    bool merged_percentile_counter::stop()
+    {
+        return counters_.stop(hpx::launch::sync);
+    }
+
+    void merged_percentile_counter::reset_counter_value()
+    {
+        counters_.reset(hpx::launch::sync);
+    }
+
+    void merged_percentile_counter::finalize()
+    {
+        base_performance_counter::finalize();
+        base_type::finalize();
+    }
+
+    naming::address merged_percentile_counter::get_current_address() const
+    {
+        return naming::address(
+            naming::get_gid_from_locality_id(agas::get_locality_id()),
+            components::get_component_type<merged_percentile_counter>(),
+            const_cast<merged_percentile_counter*>(this));
+    }
+}    // namespace hpx::performance_counters::server
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx::performance_counters::detail {
+
+    namespace {
+
+        // Split the parameters of a merged percentile counter into the
+        // percentile and the names of the base counters. Commas nested inside
+        // braces are not treated as separators, and any element not starting
+        // with a '/' is a parameter of the preceding counter name (for
+        // instance the interval in '/statistics{...}/percentile@50,10').
+        std::vector<std::string> split_counter_names(std::string const& params)
+        {
+            std::vector<std::string> result;
+
+            int depth = 0;
+            std::string::size_type start = 0;
+            for (std::string::size_type i = 0; i <= params.size(); ++i)
+            {
+                if (i != params.size())
+                {
+                    if (params[i] == '{')
+                        ++depth;
+                    else if (params[i] == '}')
+                        --depth;
+                    if (params[i] != ',' || depth != 0)
+                        continue;
+                }
+
+                std::string element = params.substr(start, i - start);
+                start = i + 1;
+
+                if (result.size() > 1 && !element.empty() &&
+                    element[0] != '/')
+                {
+                    result.back() += ',';
+                    result.back() += element;
+                }
+                else
+                {
+                    result.push_back(HPX_MOVE(element));
+                }
+            }
+            return result;
+        }
+    }    // namespace
+
+    /// Creation function for percentile counters to be registered with the
+    /// counter types: /statistics{<base>}/percentile@percentile,interval,reset
+    naming::gid_type percentile_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        if (info.type_ != counter_type::aggregating)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "percentile_counter_creator", "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        if (!paths.parentinstance_is_basename_)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "percentile_counter_creator",
+                "invalid aggregate counter "
+                "name (instance name must be valid base counter name)");
+            return naming::invalid_gid;
+        }
+
+        std::string base_name;
+        get_counter_name(paths.parentinstancename_, base_name, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        std::vector<double> parameters;
+        if (!paths.parameters_.empty())
+        {
+            // try to interpret the additional parameters
+            namespace x3 = boost::spirit::x3;
+            if (!x3::parse(paths.parameters_.begin(), paths.parameters_.end(),
+                    x3::double_ % ',', parameters) ||
+                parameters.size() > 3)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "percentile_counter_creator",
+                    "invalid parameter specification format for "
+                    "this counter: {}",
+                    paths.parameters_);
+                return naming::invalid_gid;
+            }
+        }
+
+        double const percentile = !parameters.empty() ? parameters[0] : 99.0;
+        double const interval = parameters.size() > 1 ? parameters[1] : 1000.0;
+        bool const reset_base_counter =
+            parameters.size() > 2 && parameters[2] != 0.0;
+
+        if (!(interval >= 1.0))
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "percentile_counter_creator",
+                "invalid sample interval for this counter: {}",
+                paths.parameters_);
+            return naming::invalid_gid;
+        }
+
+        // make sure parent instance name is set properly
+        counter_info complemented_info = info;
+        complement_counter_info(complemented_info, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        try
+        {
+            using counter_t = hpx::components::component<
+                hpx::performance_counters::server::percentile_counter>;
+
+            return components::server::construct<counter_t>(complemented_info,
+                base_name, percentile, static_cast<std::size_t>(interval),
+                reset_base_counter);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(ec, e, "percentile_counter_creator");
+            return naming::invalid_gid;
+        }
+    }
+
+    /// Creation function for merged percentile counters to be registered with
+    /// the counter types: /arithmetics/percentile@percentile,<base names>
+    naming::gid_type merged_percentile_counter_creator(
+        counter_info const& info, error_code& ec)
+    {
+        if (info.type_ != counter_type::aggregating)
+        {
+            HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                "merged_percentile_counter_creator",
+                "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+
+        counter_path_elements paths;
+        get_counter_path_elements(info.fullname_, paths, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        // the first parameter is the percentile, followed by the names of
+        // the base counters
+        std::vector<std::string> names =
+            split_counter_names(paths.parameters_);
+
+        double percentile = 0.0;
+        {
+            namespace x3 = boost::spirit::x3;
+            auto begin = names.empty() ? std::string::const_iterator() :
+                                         names[0].cbegin();
+            if (names.size() < 2 ||
+                !x3::parse(begin, names[0].cend(), x3::double_, percentile) ||
+                begin != names[0].cend())
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "merged_percentile_counter_creator",
+                    "the parameter specification for a merged percentile "
+                    "counter has to be the percentile followed by a comma "
+                    "separated list of performance counter names: {}",
+                    remove_counter_prefix(info.fullname_));
+                return naming::invalid_gid;
+            }
+        }
+        names.erase(names.begin());
+
+        for (std::string const& name : names)
+        {
+            counter_path_elements paths;
+            if (counter_status::valid_data !=
+                    get_counter_path_elements(name, paths, ec) ||
+                ec)
+            {
+                HPX_THROWS_IF(ec, hpx::error::bad_parameter,
+                    "merged_percentile_counter_creator",
+                    "the given (expanded) counter name is not "
+                    "a validly formed performance counter name: {}",
+                    name);
+                return naming::invalid_gid;
+            }
+        }
+
+        // make sure parent instance name is set properly
+        counter_info complemented_info = info;
+        complement_counter_info(complemented_info, ec);
+        if (ec)
+            return naming::invalid_gid;
+
+        try
+        {
+            using counter_t = hpx::components::component<
+                hpx::performance_counters::server::merged_percentile_counter>;
+
+            return components::server::construct<counter_t>(
+                complemented_info, percentile, names);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(ec, e, "merged_percentile_counter_creator");
+            return naming::invalid_gid;
+        }
+    }
+}    // namespace hpx::performance_counters::detail
@@ -0,0 +1,228 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/binary_counter_writer.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using hpx::performance_counters::binary_counter_writer;
+using hpx::performance_counters::counter_info;
+using hpx::performance_counters::counter_status;
+using hpx::performance_counters::counter_value;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+T read(std::ifstream& in)
+{
+    T value = T();
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+std::string read_string(std::ifstream& in)
+{
+    std::string value(read<std::uint32_t>(in), '\0');
+    in.read(value.data(), static_cast<std::streamsize>(value.size()));
+    return value;
+}
+
+counter_value make_value(std::int64_t value, std::int64_t scaling = 1)
+{
+    counter_value result(value, scaling, true);
+    result.status_ = counter_status::new_data;
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_binary_counter_writer()
+{
+    std::string const filename = "binary_counter_writer_test.bin";
+
+    std::vector<counter_info> infos(2);
+    infos[0].fullname_ = "/test{locality#0/total}/first";
+    infos[1].fullname_ = "/test{locality#0/total}/second";
+    infos[1].unit_of_measure_ = "ns";
+
+    // 10 rows make up two full row groups of four rows and a partial one
+    std::size_t const rows = 10;
+    {
+        binary_counter_writer writer(filename, infos, 4);
+        HPX_TEST_EQ(writer.num_counters(), std::size_t(2));
+
+        std::vector<counter_value> values(2);
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            values[0] = make_value(static_cast<std::int64_t>(i));
+            values[1] = make_value(static_cast<std::int64_t>(i), 2);
+            if (i == 5)
+            {
+                values[1].status_ = counter_status::invalid_data;
+            }
+            writer.append(100 + i, values);
+        }
+
+        // wrong number of values
+        hpx::error_code ec(hpx::throwmode::lightweight);
+        writer.append(std::vector<counter_value>(1), ec);
+        HPX_TEST(ec);
+
+        writer.close();
+    }
+
+    std::ifstream in(filename, std::ifstream::binary);
+    HPX_TEST(in.good());
+
+    char magic[8];
+    in.read(magic, sizeof(magic));
+    HPX_TEST(std::memcmp(magic, "HPXCNT01", sizeof(magic)) == 0);
+    HPX_TEST_EQ(read<std::uint32_t>(in), std::uint32_t(1));
+    HPX_TEST_EQ(read<std::uint32_t>(in), std::uint32_t(2));
+    for (counter_info const& info : infos)
+    {
+        HPX_TEST_EQ(read_string(in), info.fullname_);
+        HPX_TEST_EQ(read_string(in), info.unit_of_measure_);
+    }
+
+    std::size_t row = 0;
+    for (std::size_t group_rows : {4, 4, 2})
+    {
+        HPX_TEST_EQ(read<std::uint32_t>(in),
+            binary_counter_writer::row_group_marker);
+        HPX_TEST_EQ(read<std::uint32_t>(in), std::uint32_t(group_rows));
+        for (std::size_t i = 0; i != group_rows; ++i)
+        {
+            HPX_TEST_EQ(read<std::uint64_t>(in), std::uint64_t(100 + row + i));
+        }
+        for (std::size_t i = 0; i != group_rows; ++i)
+        {
+            HPX_TEST_EQ(read<double>(in), double(row + i));
+        }
+        for (std::size_t i = 0; i != group_rows; ++i)
+        {
+            double const value = read<double>(in);
+            if (row + i == 5)
+            {
+                HPX_TEST(std::isnan(value));
+            }
+            else
+            {
+                HPX_TEST_EQ(value, double(row + i) / 2);
+            }
+        }
+        row += group_rows;
+    }
+
+    HPX_TEST(in.good());
+    in.peek();
+    HPX_TEST(in.eof());
+
+    in.close();
+    std::remove(filename.c_str());
+}
+
+// Only a single row group may wait to be written, appending has to wait for
+// the I/O thread without losing any samples.
+void test_back_pressure()
+{
+    std::string const filename = "binary_counter_writer_pressure.bin";
+
+    std::vector<counter_info> infos(1);
+    infos[0].fullname_ = "/test{locality#0/total}/value";
+
+    bool caught_exception = false;
+    try
+    {
+        binary_counter_writer writer(filename, infos, 2, 0);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    std::size_t const rows = 1001;
+    {
+        binary_counter_writer writer(filename, infos, 2, 1);
+
+        // every other sample completes a row group, half of the samples are
+        // appended without waiting and apply the back-pressure separately
+        std::vector<counter_value> values(1);
+        for (std::size_t i = 0; i != rows; ++i)
+        {
+            values[0] = make_value(static_cast<std::int64_t>(i));
+            if (i % 4 < 2)
+            {
+                writer.append(i, values);
+            }
+            else if (writer.append_no_wait(i, values))
+            {
+                HPX_TEST_EQ(i % 2, std::size_t(1));
+                writer.apply_back_pressure();
+            }
+            else
+            {
+                HPX_TEST_EQ(i % 2, std::size_t(0));
+            }
+        }
+
+        // the partial row group is written as well
+        writer.submit_samples();
+        writer.wait();
+
+        writer.close();
+    }
+
+    std::ifstream in(filename, std::ifstream::binary);
+    HPX_TEST(in.good());
+
+    in.seekg(8 + 4 + 4);
+    HPX_TEST_EQ(read_string(in), infos[0].fullname_);
+    HPX_TEST_EQ(read_string(in), infos[0].unit_of_measure_);
+
+    for (std::size_t row = 0; row < rows; row += 2)
+    {
+        std::size_t const group_rows = row + 1 == rows ? 1 : 2;
+
+        HPX_TEST_EQ(read<std::uint32_t>(in),
+            binary_counter_writer::row_group_marker);
+        HPX_TEST_EQ(read<std::uint32_t>(in), std::uint32_t(group_rows));
+        for (std::size_t i = 0; i != group_rows; ++i)
+        {
+            HPX_TEST_EQ(read<std::uint64_t>(in), std::uint64_t(row + i));
+        }
+        for (std::size_t i = 0; i != group_rows; ++i)
+        {
+            HPX_TEST_EQ(read<double>(in), double(row + i));
+        }
+    }
+
+    HPX_TEST(in.good());
+    in.peek();
+    HPX_TEST(in.eof());
+
+    in.close();
+    std::remove(filename.c_str());
+}
+
+int main()
+{
+    test_binary_counter_writer();
+    test_back_pressure();
+    return hpx::util::report_errors();
+}
+#endif
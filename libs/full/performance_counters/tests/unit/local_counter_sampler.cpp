@@ -0,0 +1,173 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/performance_counters/local_counter_sampler.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int64_t> counter(0);
+
+std::int64_t get_value(bool reset)
+{
+    std::int64_t const result = ++counter;
+    if (reset)
+        counter.store(0);
+    return result;
+}
+
+void register_counter_type()
+{
+    hpx::performance_counters::install_counter_type("/test/value",
+        &get_value, "returns a linearly increasing counter value");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_manual_sampling()
+{
+    using hpx::performance_counters::counter_value;
+
+    std::size_t const capacity = 16;
+    hpx::performance_counters::local_counter_sampler sampler(
+        1000, capacity);
+
+    sampler.add_counters("/test/value");
+    HPX_TEST_EQ(sampler.size(), std::size_t(1));
+    HPX_TEST_EQ(sampler.get_counter_info(0).fullname_,
+        std::string("/test{locality#0/total}/value"));
+
+    // nothing has been sampled yet
+    std::vector<counter_value> values;
+    HPX_TEST_EQ(sampler.read(0, 0, values), std::uint64_t(0));
+    HPX_TEST(values.empty());
+
+    sampler.read_latest(values);
+    HPX_TEST_EQ(values.size(), std::size_t(1));
+    HPX_TEST(values[0].status_ ==
+        hpx::performance_counters::counter_status::invalid_data);
+
+    std::int64_t const first = counter.load() + 1;
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        sampler.sample();
+    }
+
+    values.clear();
+    std::uint64_t since = sampler.read(0, 0, values);
+    HPX_TEST_EQ(since, std::uint64_t(10));
+    HPX_TEST_EQ(values.size(), std::size_t(10));
+    for (std::size_t i = 0; i != values.size(); ++i)
+    {
+        HPX_TEST_EQ(values[i].get_value<std::int64_t>(),
+            first + static_cast<std::int64_t>(i));
+    }
+
+    // only the samples taken since the last read are returned, the oldest
+    // samples are overwritten once the ring buffer is full
+    for (std::size_t i = 0; i != 2 * capacity; ++i)
+    {
+        sampler.sample();
+    }
+
+    values.clear();
+    since = sampler.read(0, since, values);
+    HPX_TEST_EQ(since, std::uint64_t(10 + 2 * capacity));
+    HPX_TEST_EQ(values.size(), capacity);
+    HPX_TEST_EQ(values.back().get_value<std::int64_t>(),
+        first + static_cast<std::int64_t>(10 + 2 * capacity - 1));
+
+    sampler.read_latest(values);
+    HPX_TEST_EQ(values.size(), std::size_t(1));
+    HPX_TEST_EQ(values[0].get_value<std::int64_t>(),
+        first + static_cast<std::int64_t>(10 + 2 * capacity - 1));
+}
+
+void test_timed_sampling()
+{
+    using hpx::performance_counters::counter_value;
+
+    hpx::performance_counters::local_counter_sampler sampler(1000, 1024);
+    sampler.add_counters(std::vector<std::string>{"/test/value"});
+
+    sampler.start();
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    sampler.stop();
+
+    std::vector<counter_value> values;
+    sampler.read(0, 0, values);
+    HPX_TEST(!values.empty());
+    for (std::size_t i = 1; i < values.size(); ++i)
+    {
+        HPX_TEST_LT(values[i - 1].get_value<std::int64_t>(),
+            values[i].get_value<std::int64_t>());
+    }
+}
+
+void test_invalid_parameters()
+{
+    using hpx::performance_counters::local_counter_sampler;
+
+    bool caught_exception = false;
+    try
+    {
+        local_counter_sampler sampler(1000, 0);
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // a failing addition doesn't prevent adding further counters
+    local_counter_sampler sampler(1000, 16, 1);
+    hpx::error_code ec(hpx::throwmode::lightweight);
+    sampler.add_counters(std::vector<std::string>{"/test/unknown"}, ec);
+    HPX_TEST(ec);
+
+    sampler.add_counters(std::vector<std::string>{"/test/value"});
+    HPX_TEST_EQ(sampler.size(), std::size_t(1));
+
+    // the sampler is full
+    ec = hpx::error_code(hpx::throwmode::lightweight);
+    sampler.add_counters(std::vector<std::string>{"/test/value"}, ec);
+    HPX_TEST(ec);
+    HPX_TEST_EQ(sampler.size(), std::size_t(1));
+}
+
+int hpx_main()
+{
+    test_manual_sampling();
+    test_timed_sampling();
+    test_invalid_parameters();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::register_startup_function(&register_counter_type);
+
+    // Initialize and run HPX.
+    std::vector<std::string> const cfg = {"hpx.os_threads=1"};
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,128 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE) &&                                       \
+    defined(HPX_HAVE_LOCK_CONTENTION_PROFILING)
+#include <hpx/future.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/synchronization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Lock sites are named after their source location if available, after the
+// description of the lock otherwise. This pattern matches both.
+char const* const site_pattern = "*lock_contention_counters*";
+
+std::int64_t get_counter_value(std::string const& name,
+    std::string const& parameters = site_pattern, bool reset = false)
+{
+    using hpx::performance_counters::performance_counter;
+
+    std::string counter = "/locks{locality#0/total}/" + name;
+    if (!parameters.empty())
+    {
+        counter += "@" + parameters;
+    }
+
+    return performance_counter(counter).get_value<std::int64_t>(
+        hpx::launch::sync, reset);
+}
+
+// block the worker thread (instead of suspending the HPX thread) while holding
+// the lock to avoid tripping lock detection
+void lock_and_sleep(hpx::mutex& mtx)
+{
+    std::lock_guard<hpx::mutex> l(mtx);
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_lock_counters()
+{
+    hpx::mutex mtx("lock_contention_counters_mutex");
+
+    std::vector<hpx::future<void>> futures;
+    for (int i = 0; i != 16; ++i)
+    {
+        futures.push_back(hpx::async([&mtx]() { lock_and_sleep(mtx); }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(get_counter_value("count/acquisitions"), std::int64_t(16));
+    HPX_TEST_LT(std::int64_t(0), get_counter_value("count/contentions"));
+    HPX_TEST_LT(std::int64_t(0), get_counter_value("count/suspensions"));
+    HPX_TEST_LT(std::int64_t(0), get_counter_value("time/wait"));
+    HPX_TEST_LTE(std::int64_t(16000000), get_counter_value("time/hold"));
+
+    // all lock sites are accounted for without a parameter
+    HPX_TEST_LTE(std::int64_t(16), get_counter_value("count/acquisitions", ""));
+
+    // no lock site matches
+    HPX_TEST_EQ(
+        get_counter_value("count/acquisitions", "no_such_lock_site"),
+        std::int64_t(0));
+}
+
+void test_reset()
+{
+    hpx::mutex mtx("lock_contention_counters_reset_mutex");
+
+    using hpx::performance_counters::performance_counter;
+    performance_counter counter(
+        std::string("/locks{locality#0/total}/count/acquisitions@") +
+        site_pattern);
+
+    // resetting a counter records a baseline, the statistics of the lock
+    // sites are not touched
+    counter.get_value<std::int64_t>(hpx::launch::sync, true);
+    HPX_TEST_EQ(
+        counter.get_value<std::int64_t>(hpx::launch::sync), std::int64_t(0));
+
+    for (int i = 0; i != 4; ++i)
+    {
+        std::lock_guard<hpx::mutex> l(mtx);
+    }
+    HPX_TEST_EQ(
+        counter.get_value<std::int64_t>(hpx::launch::sync), std::int64_t(4));
+
+    HPX_TEST_LTE(std::int64_t(20), get_counter_value("count/acquisitions"));
+}
+
+int hpx_main()
+{
+    test_lock_counters();
+    test_reset();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=4", "hpx.lock_contention_profiling=1"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#else
+int main()
+{
+    return 0;
+}
+#endif
@@ -0,0 +1,159 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/statistics/log_linear_histogram.hpp>
+#include <hpx/thread.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_value(bool)
+{
+    return 1000;
+}
+
+void register_counter_type()
+{
+    hpx::performance_counters::install_counter_type(
+        "/test/value", &get_value, "returns a constant value");
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_log_linear_histogram()
+{
+    hpx::util::log_linear_histogram h(7);
+    HPX_TEST_EQ(h.value_at_percentile(50), std::int64_t(0));
+
+    // values 1 ... 100000
+    for (std::int64_t i = 1; i <= 100000; ++i)
+    {
+        h.add(i);
+    }
+    HPX_TEST_EQ(h.count(), std::uint64_t(100000));
+    HPX_TEST_EQ(h.min(), std::int64_t(1));
+    HPX_TEST_EQ(h.max(), std::int64_t(100000));
+    HPX_TEST_EQ(h.value_at_percentile(100), std::int64_t(100000));
+
+    // the relative error is bounded by 2^-(significant_bits - 1)
+    for (double p : {1.0, 25.0, 50.0, 90.0, 99.0, 99.9})
+    {
+        auto const expected = static_cast<std::int64_t>(p * 1000);
+        std::int64_t const value = h.value_at_percentile(p);
+        HPX_TEST_LTE(expected, value);
+        HPX_TEST_LTE(value - expected, expected / 64 + 1);
+    }
+
+    // merging the saved form is equivalent to merging the histogram
+    hpx::util::log_linear_histogram h1(7), h2(7);
+    h1.merge(h);
+    HPX_TEST(h2.merge_saved(h.save()));
+    for (double p : {1.0, 50.0, 99.0})
+    {
+        HPX_TEST_EQ(h1.value_at_percentile(p), h.value_at_percentile(p));
+        HPX_TEST_EQ(h2.value_at_percentile(p), h.value_at_percentile(p));
+    }
+
+    // histograms with different precision can't be merged
+    hpx::util::log_linear_histogram h3(5);
+    HPX_TEST(!h3.merge_saved(h.save()));
+
+    h.reset();
+    HPX_TEST_EQ(h.count(), std::uint64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_percentile_counter()
+{
+    using hpx::performance_counters::performance_counter;
+
+    std::string const name =
+        "/statistics{/test{locality#0/total}/value}/percentile@50,10";
+
+    performance_counter c(name);
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    HPX_TEST_EQ(c.get_value<std::int64_t>(hpx::launch::sync), 1000);
+
+    // the values array exposes the histogram
+    auto values = c.get_counter_values_array(hpx::launch::sync, false);
+    HPX_TEST_LT(std::size_t(4), values.values_.size());
+    using hpx::util::log_linear_histogram;
+    HPX_TEST_EQ(values.values_[0],
+        std::int64_t(log_linear_histogram::default_significant_bits));
+    HPX_TEST_LTE(std::int64_t(1), values.values_[1]);
+    HPX_TEST_EQ(values.values_[2], 1000);
+    HPX_TEST_EQ(values.values_[3], 1000);
+
+    // merge the histograms of two percentile counters, the base counter
+    // names carry their own parameters (percentile and interval)
+    performance_counter merged(
+        "/arithmetics/percentile@90," + name + "," + name);
+    HPX_TEST_EQ(merged.get_value<std::int64_t>(hpx::launch::sync), 1000);
+
+    performance_counter merged_default(
+        "/arithmetics/percentile@90," + name +
+        ",/statistics{/test{locality#0/total}/value}/percentile@50");
+    HPX_TEST_EQ(
+        merged_default.get_value<std::int64_t>(hpx::launch::sync), 1000);
+
+    HPX_TEST(c.stop(hpx::launch::sync));
+}
+
+void test_invalid_parameters()
+{
+    using hpx::performance_counters::performance_counter;
+
+    for (char const* name :
+        {"/statistics{/test{locality#0/total}/value}/percentile@101",
+            "/statistics{/test{locality#0/total}/value}/percentile@50,0",
+            "/statistics{/test{locality#0/total}/value}/percentile@1,2,3,4",
+            "/arithmetics/percentile@50", "/arithmetics/percentile@x,/a/b"})
+    {
+        bool caught_exception = false;
+        try
+        {
+            performance_counter c(name);
+            c.get_value<std::int64_t>(hpx::launch::sync);
+        }
+        catch (hpx::exception const&)
+        {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+}
+
+int hpx_main()
+{
+    test_log_linear_histogram();
+    test_percentile_counter();
+    test_invalid_parameters();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::register_startup_function(&register_counter_type);
+
+    std::vector<std::string> const cfg = {"hpx.os_threads=1"};
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -1064,6 +1064,18 @@ namespace hpx {
                 &performance_counters::detail::statistics_counter_creator,
                 &performance_counters::default_counter_discoverer, ""},
 
+            // percentile counter
+            {"/statistics/percentile",
+                performance_counters::counter_type::aggregating,
+                "returns the given percentile (default: 99) of the values "
+                "of its base counter sampled over an arbitrary time line; "
+                "pass required base counter as the instance name: "
+                "/statistics{<base_counter_name>}/"
+                "percentile@<percentile>,<interval>,<reset>",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::detail::percentile_counter_creator,
+                &performance_counters::default_counter_discoverer, ""},
+
             // uptime counters
             {
                 "/runtime/uptime",
@@ -1250,6 +1262,20 @@ namespace hpx {
                     &performance_counters::detail::
                         arithmetics_counter_extended_creator,
                     &performance_counters::default_counter_discoverer, ""},
+                // arithmetics percentile counter
+                {"/arithmetics/percentile",
+                    performance_counters::counter_type::aggregating,
+                    "returns the given percentile of the values recorded by "
+                    "all specified percentile counters (merging their "
+                    "histograms); pass the percentile and the required base "
+                    "counters as the parameters: "
+                    "/arithmetics/"
+                    "percentile@<percentile>,<base_counter_name1>,"
+                    "<base_counter_name2>",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    &performance_counters::detail::
+                        merged_percentile_counter_creator,
+                    &performance_counters::default_counter_discoverer, ""},
             };
         performance_counters::install_counter_types(
             arithmetic_counter_types, std::size(arithmetic_counter_types));
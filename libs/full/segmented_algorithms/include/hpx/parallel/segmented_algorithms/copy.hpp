@@ -0,0 +1,249 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/copy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/transfer.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// hpx::copy and hpx::copy_n for segmented iterators are implemented by the
+// segmented transfer in detail/transfer.hpp.
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_copy_if
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Count the elements of the local range of one segment which are
+        // going to be copied.
+        template <typename LocalIter, typename Pred>
+        std::size_t segmented_copy_if_count(
+            LocalIter first, LocalIter last, Pred pred)
+        {
+            using traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+
+            std::size_t count = 0;
+            auto end = traits::local(last);
+            for (auto it = traits::local(first); it != end; ++it)
+            {
+                if (HPX_INVOKE(pred, *it))
+                {
+                    ++count;
+                }
+            }
+            return count;
+        }
+
+        template <typename LocalIter, typename Pred>
+        struct segmented_copy_if_count_action
+          : hpx::actions::make_action<std::size_t (*)(
+                                          LocalIter, LocalIter, Pred),
+                &segmented_copy_if_count<LocalIter, Pred>,
+                segmented_copy_if_count_action<LocalIter, Pred>>::type
+        {
+        };
+
+        // Copy the selected elements of the local range of one segment to
+        // their position in the destination range, this function is executed
+        // on the locality of the source segment.
+        template <typename LocalIter, typename OutLocalIter, typename Pred>
+        void segmented_copy_if_segment(LocalIter first, LocalIter last,
+            Pred pred, std::vector<segment_range<OutLocalIter>> dest,
+            std::size_t offset)
+        {
+            using traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+
+            std::vector<segment_value_t<LocalIter>> selected;
+            auto end = traits::local(last);
+            for (auto it = traits::local(first); it != end; ++it)
+            {
+                if (HPX_INVOKE(pred, *it))
+                {
+                    selected.push_back(*it);
+                }
+            }
+
+            segment_store_values(dest, offset, HPX_MOVE(selected));
+        }
+
+        template <typename LocalIter, typename OutLocalIter, typename Pred>
+        struct segmented_copy_if_segment_action
+          : hpx::actions::make_action<void (*)(LocalIter, LocalIter, Pred,
+                                          std::vector<segment_range<
+                                              OutLocalIter>>,
+                                          std::size_t),
+                &segmented_copy_if_segment<LocalIter, OutLocalIter, Pred>,
+                segmented_copy_if_segment_action<LocalIter, OutLocalIter,
+                    Pred>>::type
+        {
+        };
+
+        // The size of the destination range is known only after the
+        // predicate has been evaluated, the segments count the selected
+        // elements first and copy them to their final position in a second
+        // pass.
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename Pred>
+        util::detail::algorithm_result_t<ExPolicy, SegOutIter>
+        segmented_copy_if(ExPolicy const&, SegIter first, SegIter last,
+            SegOutIter dest, Pred&& pred)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using output_traits =
+                hpx::traits::segmented_iterator_traits<SegOutIter>;
+            using local_iterator_type = typename traits::local_iterator;
+            using local_output_iterator_type =
+                typename output_traits::local_iterator;
+            using result = util::detail::algorithm_result<ExPolicy, SegOutIter>;
+            using pred_type = std::decay_t<Pred>;
+
+            if (first == last)
+            {
+                return result::get(HPX_MOVE(dest));
+            }
+
+            auto ranges = segment_ranges(first, last);
+
+            std::vector<hpx::future<std::size_t>> counts;
+            counts.reserve(ranges.size());
+            for (auto const& r : ranges)
+            {
+                counts.push_back(hpx::async(
+                    segmented_copy_if_count_action<local_iterator_type,
+                        pred_type>(),
+                    hpx::colocated(r.id), r.first, r.last, pred));
+            }
+
+            auto copy = [ranges = HPX_MOVE(ranges), dest,
+                            pred = pred_type(HPX_FORWARD(Pred, pred))](
+                            std::vector<hpx::future<std::size_t>>&& r)
+                -> SegOutIter {
+                // handle any remote exceptions, will throw on error
+                std::list<std::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy>::call(r, errors);
+
+                std::vector<std::size_t> offsets;
+                offsets.reserve(r.size() + 1);
+
+                std::size_t total = 0;
+                for (auto& f : r)
+                {
+                    offsets.push_back(total);
+                    total += f.get();
+                }
+                offsets.push_back(total);
+
+                auto const pieces =
+                    segment_ranges(dest, std::next(dest, total));
+
+                std::vector<hpx::future<void>> segments;
+                segments.reserve(ranges.size());
+                for (std::size_t i = 0; i != ranges.size(); ++i)
+                {
+                    if (offsets[i] != offsets[i + 1])
+                    {
+                        segments.push_back(hpx::async(
+                            segmented_copy_if_segment_action<
+                                local_iterator_type,
+                                local_output_iterator_type, pred_type>(),
+                            hpx::colocated(ranges[i].id), ranges[i].first,
+                            ranges[i].last, pred, pieces, offsets[i]));
+                    }
+                }
+
+                hpx::wait_all(segments);
+                parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy>::call(segments, errors);
+
+                return std::next(dest, total);
+            };
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return result::get(
+                    hpx::dataflow(HPX_MOVE(copy), HPX_MOVE(counts)));
+            }
+            else
+            {
+                hpx::wait_all(counts);
+                return result::get(copy(HPX_MOVE(counts)));
+            }
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter, typename SegOutIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter> &&
+            hpx::traits::is_iterator_v<SegOutIter> &&
+            hpx::traits::is_segmented_iterator_v<SegOutIter>
+        )>
+    // clang-format on
+    SegOutIter tag_invoke(hpx::copy_if_t, SegIter first, SegIter last,
+        SegOutIter dest, Pred pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_copy_if(
+            hpx::execution::seq, first, last, dest, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename SegOutIter,
+        typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter> &&
+            hpx::traits::is_iterator_v<SegOutIter> &&
+            hpx::traits::is_segmented_iterator_v<SegOutIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, SegOutIter>
+    tag_invoke(hpx::copy_if_t, ExPolicy&& policy, SegIter first, SegIter last,
+        SegOutIter dest, Pred pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_copy_if(
+            HPX_FORWARD(ExPolicy, policy), first, last, dest, HPX_MOVE(pred));
+    }
+}    // namespace hpx::segmented
@@ -0,0 +1,130 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Common facilities of the segmented algorithms which rearrange the elements
+// of a range in place (remove_if, unique, partition). Every segment filters
+// its local data, the segments exchange the number of elements they keep and
+// write the kept elements to their final position in bulk.
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    // Write the kept elements of this site to their final position in the
+    // range described by pieces, given the number of elements kept by all
+    // sites. Returns the overall number of kept elements.
+    template <typename LocalIter, typename T>
+    std::size_t segmented_compact_store(
+        std::vector<segment_range<LocalIter>> const& pieces,
+        std::vector<std::size_t> const& counts, std::size_t this_site,
+        std::vector<T>&& kept)
+    {
+        std::size_t offset = 0;
+        std::size_t total = 0;
+        for (std::size_t i = 0; i != counts.size(); ++i)
+        {
+            if (i == this_site)
+            {
+                offset = total;
+            }
+            total += counts[i];
+        }
+
+        segment_store_values(pieces, offset, HPX_MOVE(kept));
+        return total;
+    }
+
+    // Exchange the number of kept elements between all sites. This has to
+    // happen after all sites have read their local data, as the kept
+    // elements may be written to the range of any preceding site.
+    inline std::vector<std::size_t> segmented_compact_counts(
+        std::string const& basename, std::size_t num_sites,
+        std::size_t this_site, std::size_t count)
+    {
+        if (num_sites == 1)
+        {
+            return std::vector<std::size_t>(1, count);
+        }
+
+        using namespace hpx::collectives;
+
+        communicator comm = create_communicator(basename.c_str(),
+            num_sites_arg(num_sites), this_site_arg(this_site));
+
+        return all_gather(comm, count, this_site_arg(this_site)).get();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run the site action for every segment of [first, last), every site
+    // returns the overall number of kept elements.
+    template <typename ExPolicy, typename SegIter, typename Action,
+        typename... Ts>
+    util::detail::algorithm_result_t<ExPolicy, SegIter> segmented_compact(
+        ExPolicy const&, SegIter first, SegIter last, char const* name,
+        Action act, Ts const&... ts)
+    {
+        using result = util::detail::algorithm_result<ExPolicy, SegIter>;
+
+        auto const ranges = segment_ranges(first, last);
+        std::string const basename = segmented_basename(name);
+
+        // all segments have to take part concurrently, even for a
+        // sequenced execution policy
+        std::vector<hpx::future<std::size_t>> segments;
+        segments.reserve(ranges.size());
+        for (std::size_t i = 0; i != ranges.size(); ++i)
+        {
+            segments.push_back(hpx::async(act, hpx::colocated(ranges[i].id),
+                basename, i, ranges, ts...));
+        }
+
+        auto finalize =
+            [first](std::vector<hpx::future<std::size_t>>&& r) -> SegIter {
+            // handle any remote exceptions, will throw on error
+            std::list<std::exception_ptr> errors;
+            parallel::util::detail::handle_remote_exceptions<ExPolicy>::call(
+                r, errors);
+
+            return std::next(first, r.front().get());
+        };
+
+        if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+        {
+            return result::get(
+                hpx::dataflow(HPX_MOVE(finalize), HPX_MOVE(segments)));
+        }
+        else
+        {
+            hpx::wait_all(segments);
+            return result::get(finalize(HPX_MOVE(segments)));
+        }
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -0,0 +1,333 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Common facilities of the segmented algorithms which have to move data
+// between segments. Data is always moved in bulk: every contiguous run of
+// elements which lies within a single segment is transferred in one piece.
+namespace hpx::parallel::detail {
+
+    /// \cond NOINTERNAL
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The non-empty part of a segmented range which lies within one segment.
+    template <typename LocalIter>
+    struct segment_range
+    {
+        hpx::id_type id;
+        LocalIter first;
+        LocalIter last;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned /* version */)
+        {
+            // clang-format off
+            ar & id & first & last;
+            // clang-format on
+        }
+    };
+
+    template <typename SegIter>
+    using segment_range_t = segment_range<typename hpx::traits::
+            segmented_iterator_traits<SegIter>::local_iterator>;
+
+    template <typename SegIter>
+    std::vector<segment_range_t<SegIter>> segment_ranges(
+        SegIter first, SegIter last)
+    {
+        using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+        using segment_iterator = typename traits::segment_iterator;
+        using local_iterator_type = typename traits::local_iterator;
+
+        std::vector<segment_range_t<SegIter>> ranges;
+        if (first == last)
+        {
+            return ranges;
+        }
+
+        segment_iterator sit = traits::segment(first);
+        segment_iterator send = traits::segment(last);
+        if (sit == send)
+        {
+            // all elements are on the same partition
+            local_iterator_type beg = traits::local(first);
+            local_iterator_type end = traits::local(last);
+            if (beg != end)
+            {
+                ranges.push_back({traits::get_id(sit), beg, end});
+            }
+        }
+        else
+        {
+            // handle the remaining part of the first partition
+            local_iterator_type beg = traits::local(first);
+            local_iterator_type end = traits::end(sit);
+            if (beg != end)
+            {
+                ranges.push_back({traits::get_id(sit), beg, end});
+            }
+
+            // handle all full partitions
+            for (++sit; sit != send; ++sit)
+            {
+                beg = traits::begin(sit);
+                end = traits::end(sit);
+                if (beg != end)
+                {
+                    ranges.push_back({traits::get_id(sit), beg, end});
+                }
+            }
+
+            // handle the beginning of the last partition
+            beg = traits::begin(sit);
+            end = traits::local(last);
+            if (beg != end)
+            {
+                ranges.push_back({traits::get_id(sit), beg, end});
+            }
+        }
+        return ranges;
+    }
+
+    template <typename LocalIter>
+    std::size_t segment_range_size(segment_range<LocalIter> const& r)
+    {
+        return static_cast<std::size_t>(std::distance(r.first, r.last));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sequence number making the names of the communicators used by
+    // concurrent operations unique.
+    inline std::atomic<std::size_t> segmented_basename_sequence(0);
+
+    // Return a unique base name for the communicator connecting the sites
+    // taking part in one invocation of the algorithm 'name'.
+    inline std::string segmented_basename(char const* name)
+    {
+        return std::string("/hpx/") + name + "/" +
+            std::to_string(hpx::get_locality_id()) + "/" +
+            std::to_string(++segmented_basename_sequence);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A run of elements which lies within a single segment of both of two
+    // ranges of the same length. The segments of the two ranges do not have
+    // to be aligned, a segment of one range is split into several runs if it
+    // overlaps with several segments of the other range.
+    template <typename LocalIter1, typename LocalIter2>
+    struct segment_run
+    {
+        hpx::id_type id1;
+        LocalIter1 first1;
+        LocalIter1 last1;
+        hpx::id_type id2;
+        LocalIter2 first2;
+    };
+
+    template <typename SegIter1, typename SegIter2>
+    using segment_run_t = segment_run<
+        typename hpx::traits::segmented_iterator_traits<
+            SegIter1>::local_iterator,
+        typename hpx::traits::segmented_iterator_traits<
+            SegIter2>::local_iterator>;
+
+    template <typename SegIter1, typename SegIter2>
+    std::vector<segment_run_t<SegIter1, SegIter2>> segment_runs(
+        SegIter1 first1, SegIter1 last1, SegIter2 first2)
+    {
+        using traits2 = hpx::traits::segmented_iterator_traits<SegIter2>;
+        using segment_iterator2 = typename traits2::segment_iterator;
+        using local_iterator_type2 = typename traits2::local_iterator;
+
+        std::vector<segment_run_t<SegIter1, SegIter2>> runs;
+        if (first1 == last1)
+        {
+            return runs;
+        }
+
+        segment_iterator2 sit2 = traits2::segment(first2);
+        local_iterator_type2 beg2 = traits2::local(first2);
+        local_iterator_type2 end2 = traits2::end(sit2);
+
+        for (auto const& r : segment_ranges(first1, last1))
+        {
+            auto beg1 = r.first;
+            while (beg1 != r.last)
+            {
+                // skip to the next non-empty segment of the second range
+                while (beg2 == end2)
+                {
+                    ++sit2;
+                    beg2 = traits2::begin(sit2);
+                    end2 = traits2::end(sit2);
+                }
+
+                std::ptrdiff_t const count =
+                    (std::min)(static_cast<std::ptrdiff_t>(
+                                   std::distance(beg1, r.last)),
+                        static_cast<std::ptrdiff_t>(std::distance(beg2, end2)));
+
+                auto next1 = std::next(beg1, count);
+                runs.push_back(
+                    {r.id, beg1, next1, traits2::get_id(sit2), beg2});
+
+                beg1 = next1;
+                std::advance(beg2, count);
+            }
+        }
+        return runs;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    inline bool segment_is_local(hpx::id_type const& id)
+    {
+        return naming::get_locality_id_from_id(id) == hpx::get_locality_id();
+    }
+
+    inline bool segments_are_colocated(
+        hpx::id_type const& id1, hpx::id_type const& id2)
+    {
+        return naming::get_locality_id_from_id(id1) ==
+            naming::get_locality_id_from_id(id2);
+    }
+
+    template <typename LocalIter>
+    using segment_value_t = typename std::iterator_traits<
+        typename hpx::traits::segmented_local_iterator_traits<
+            LocalIter>::local_raw_iterator>::value_type;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Read the values of a run, executed on the locality of its segment.
+    template <typename LocalIter>
+    std::vector<segment_value_t<LocalIter>> segment_get_values(
+        LocalIter first, LocalIter last)
+    {
+        using traits = hpx::traits::segmented_local_iterator_traits<LocalIter>;
+        return std::vector<segment_value_t<LocalIter>>(
+            traits::local(first), traits::local(last));
+    }
+
+    template <typename LocalIter>
+    struct segment_get_values_action
+      : hpx::actions::make_action<std::vector<segment_value_t<LocalIter>> (*)(
+                                      LocalIter, LocalIter),
+            &segment_get_values<LocalIter>,
+            segment_get_values_action<LocalIter>>::type
+    {
+    };
+
+    // Write values to the run beginning at dest, executed on the locality
+    // of its segment.
+    template <typename LocalIter, typename T>
+    void segment_set_values(LocalIter dest, std::vector<T> values)
+    {
+        using traits = hpx::traits::segmented_local_iterator_traits<LocalIter>;
+        std::move(values.begin(), values.end(), traits::local(dest));
+    }
+
+    template <typename LocalIter, typename T>
+    struct segment_set_values_action
+      : hpx::actions::make_action<void (*)(LocalIter, std::vector<T>),
+            &segment_set_values<LocalIter, T>,
+            segment_set_values_action<LocalIter, T>>::type
+    {
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Fetch the values of the run [first, last) of the segment id in a
+    // single message, local segments are read directly.
+    template <typename LocalIter>
+    hpx::future<std::vector<segment_value_t<LocalIter>>> segment_fetch_values(
+        hpx::id_type const& id, LocalIter first, LocalIter last)
+    {
+        if (segment_is_local(id))
+        {
+            return hpx::make_ready_future(segment_get_values(first, last));
+        }
+        return hpx::async(segment_get_values_action<LocalIter>(),
+            hpx::colocated(id), first, last);
+    }
+
+    // Store values at dest of the segment id in a single message, local
+    // segments are written directly.
+    template <typename LocalIter, typename T>
+    hpx::future<void> segment_store_values(
+        hpx::id_type const& id, LocalIter dest, std::vector<T>&& values)
+    {
+        if (segment_is_local(id))
+        {
+            segment_set_values(dest, HPX_MOVE(values));
+            return hpx::make_ready_future();
+        }
+        return hpx::async(segment_set_values_action<LocalIter, T>(),
+            hpx::colocated(id), dest, HPX_MOVE(values));
+    }
+
+    // Store values at the given offset of the range described by pieces,
+    // every piece receives its share of the values in a single message.
+    template <typename LocalIter, typename T>
+    void segment_store_values(
+        std::vector<segment_range<LocalIter>> const& pieces,
+        std::size_t offset, std::vector<T>&& values)
+    {
+        std::vector<hpx::future<void>> stored;
+
+        std::size_t pos = 0;
+        std::size_t piece_first = 0;
+        for (auto const& piece : pieces)
+        {
+            if (pos == values.size())
+            {
+                break;
+            }
+
+            std::size_t const size = segment_range_size(piece);
+            if (offset + pos < piece_first + size)
+            {
+                std::size_t const skip = offset + pos - piece_first;
+                std::size_t const count =
+                    (std::min)(size - skip, values.size() - pos);
+
+                auto const it = values.begin() + pos;
+                stored.push_back(segment_store_values(piece.id,
+                    std::next(piece.first, skip),
+                    std::vector<T>(std::make_move_iterator(it),
+                        std::make_move_iterator(it + count))));
+                pos += count;
+            }
+            piece_first += size;
+        }
+        HPX_ASSERT(pos == values.size());
+
+        hpx::wait_all(stored);
+        for (auto& f : stored)
+        {
+            f.get();    // rethrow exceptions
+        }
+    }
+    /// \endcond
+}    // namespace hpx::parallel::detail
@@ -1,4 +1,5 @@
 //  Copyright (c) 2007-2024 Hartmut Kaiser
+//  Copyright (c) 2025 The STE||AR-Group
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -7,13 +8,20 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
 #include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_distributed/async.hpp>
 #include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/move.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
 #include <hpx/parallel/util/result_types.hpp>
@@ -35,93 +43,104 @@ namespace hpx::parallel {
         ///////////////////////////////////////////////////////////////////////
         /// \cond NOINTERNAL
 
-        // sequential remote implementation
-        template <typename Algo, typename ExPolicy, typename SegIter,
-            typename SegOutIter>
-        static typename util::detail::algorithm_result<ExPolicy,
-            util::in_out_result<SegIter, SegOutIter>>::type
-        segmented_transfer(Algo&& algo, ExPolicy const& policy, std::true_type,
-            SegIter first, SegIter last, SegOutIter dest)
+        template <typename Algo>
+        struct is_move_transfer : std::false_type
         {
-            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
-            using segment_iterator = typename traits::segment_iterator;
-            using local_iterator_type = typename traits::local_iterator;
-
-            using output_traits =
-                hpx::traits::segmented_iterator_traits<SegOutIter>;
-            using segment_output_iterator =
-                typename output_traits::segment_iterator;
-            using local_output_iterator_type =
-                typename output_traits::local_iterator;
+        };
 
-            using local_iterator_pair = util::in_out_result<local_iterator_type,
-                local_output_iterator_type>;
-
-            segment_iterator sit = traits::segment(first);
-            segment_iterator send = traits::segment(last);
+        template <typename FwdIter1, typename FwdIter2>
+        struct is_move_transfer<move<FwdIter1, FwdIter2>> : std::true_type
+        {
+        };
+
+        // Copy or move one run of elements to a segment on a different
+        // locality, this function is executed on the locality of the source
+        // segment. The values are sent to the destination in one message.
+        template <typename LocalIter1, typename LocalIter2>
+        void segmented_transfer_run(LocalIter1 first, LocalIter1 last,
+            hpx::id_type dest_id, LocalIter2 dest, bool move_values)
+        {
+            using traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter1>;
 
-            segment_output_iterator sdest = traits::segment(dest);
+            auto beg = traits::local(first);
+            auto end = traits::local(last);
 
-            if (sit == send)
+            std::vector<segment_value_t<LocalIter1>> values;
+            if (move_values)
             {
-                // all elements are on the same partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::local(last);
-
-                if (beg != end)
-                {
-                    local_iterator_pair p =
-                        dispatch(traits::get_id(sit), algo, policy,
-                            std::true_type(), beg, end, traits::local(dest));
-
-                    dest = output_traits::compose(sdest, p.out);
-                }
+                values.assign(
+                    std::make_move_iterator(beg), std::make_move_iterator(end));
             }
             else
             {
-                // handle the remaining part of the first partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
-                local_output_iterator_type out = traits::local(dest);
+                values.assign(beg, end);
+            }
+
+            segment_store_values(dest_id, dest, HPX_MOVE(values)).get();
+        }
+
+        template <typename LocalIter1, typename LocalIter2>
+        struct segmented_transfer_run_action
+          : hpx::actions::make_action<void (*)(LocalIter1, LocalIter1,
+                                          hpx::id_type, LocalIter2, bool),
+                &segmented_transfer_run<LocalIter1, LocalIter2>,
+                segmented_transfer_run_action<LocalIter1, LocalIter2>>::type
+        {
+        };
+
+        // Runs whose source and destination segments are located on the same
+        // locality are handled by the local algorithm, all other runs are
+        // sent in bulk from the source to the destination segment.
+        template <typename Algo, typename ExPolicy, typename IsSeq,
+            typename LocalIter1, typename LocalIter2>
+        hpx::future<void> segmented_transfer_run_async(Algo const& algo,
+            ExPolicy const& policy, IsSeq is_seq,
+            segment_run<LocalIter1, LocalIter2> const& run)
+        {
+            if (segments_are_colocated(run.id1, run.id2))
+            {
+                return hpx::future<void>(dispatch_async(run.id1, algo, policy,
+                    is_seq, run.first1, run.last1, run.first2));
+            }
 
-                if (beg != end)
-                {
-                    local_iterator_pair p = dispatch(traits::get_id(sit), algo,
-                        policy, std::true_type(), beg, end, out);
-                    out = p.out;
-                }
+            return hpx::async(
+                segmented_transfer_run_action<LocalIter1, LocalIter2>(),
+                hpx::colocated(run.id1), run.first1, run.last1, run.id2,
+                run.first2, is_move_transfer<std::decay_t<Algo>>::value);
+        }
 
-                // handle all full partitions
-                for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
-                {
-                    beg = traits::begin(sit);
-                    end = traits::end(sit);
-                    out = traits::begin(sdest);
-
-                    if (beg != end)
-                    {
-                        local_iterator_pair p = dispatch(traits::get_id(sit),
-                            algo, policy, std::true_type(), beg, end, out);
-                        out = p.out;
-                    }
-                }
+        // sequential remote implementation
+        template <typename Algo, typename ExPolicy, typename SegIter,
+            typename SegOutIter>
+        static typename util::detail::algorithm_result<ExPolicy,
+            util::in_out_result<SegIter, SegOutIter>>::type
+        segmented_transfer(Algo&& algo, ExPolicy const& policy, std::true_type,
+            SegIter first, SegIter last, SegOutIter dest)
+        {
+            using result_type = util::in_out_result<SegIter, SegOutIter>;
+
+            auto const runs = segment_runs(first, last, dest);
 
-                // handle the beginning of the last partition
-                beg = traits::begin(sit);
-                end = traits::local(last);
-                if (beg != end)
+            std::vector<hpx::future<void>> segments;
+            segments.reserve(runs.size());
+            for (auto const& run : runs)
+            {
+                segments.push_back(segmented_transfer_run_async(
+                    algo, policy, std::true_type(), run));
+                segments.back().wait();
+                if (segments.back().has_exception())
                 {
-                    local_iterator_pair p =
-                        dispatch(traits::get_id(sit), algo, policy,
-                            std::true_type(), beg, end, traits::begin(sdest));
-                    out = p.out;
+                    break;
                 }
-
-                dest = output_traits::compose(sdest, out);
             }
 
-            using result_type = util::in_out_result<SegIter, SegOutIter>;
+            // handle any remote exceptions, will throw on error
+            std::list<std::exception_ptr> errors;
+            parallel::util::detail::handle_remote_exceptions<ExPolicy>::call(
+                segments, errors);
 
+            std::advance(dest, std::distance(first, last));
             return util::detail::algorithm_result<ExPolicy, result_type>::get(
                 result_type{last, dest});
         }
@@ -134,100 +153,35 @@ namespace hpx::parallel {
         segmented_transfer(Algo&& algo, ExPolicy const& policy, std::false_type,
             SegIter first, SegIter last, SegOutIter dest)
         {
-            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
-            using segment_iterator = typename traits::segment_iterator;
-            using local_iterator_type = typename traits::local_iterator;
-
-            using output_traits =
-                hpx::traits::segmented_iterator_traits<SegOutIter>;
-            using segment_output_iterator =
-                typename output_traits::segment_iterator;
-            using local_output_iterator_type =
-                typename output_traits::local_iterator;
-
-            using local_iterator_pair = util::in_out_result<local_iterator_type,
-                local_output_iterator_type>;
+            using result_type = util::in_out_result<SegIter, SegOutIter>;
 
             using forced_seq = std::integral_constant<bool,
                 !hpx::traits::is_forward_iterator<SegIter>::value>;
 
-            segment_iterator sit = traits::segment(first);
-            segment_iterator send = traits::segment(last);
-
-            segment_output_iterator sdest = traits::segment(dest);
-
-            std::vector<shared_future<local_iterator_pair>> segments;
-            segments.reserve(std::distance(sit, send));
-
-            if (sit == send)
-            {
-                // all elements are on the same partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::local(last);
+            auto const runs = segment_runs(first, last, dest);
 
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, traits::local(dest)));
-                }
-            }
-            else
+            std::vector<hpx::future<void>> segments;
+            segments.reserve(runs.size());
+            for (auto const& run : runs)
             {
-                // handle the remaining part of the first partition
-                local_iterator_type beg = traits::local(first);
-                local_iterator_type end = traits::end(sit);
-                local_output_iterator_type out = traits::local(dest);
-
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, out));
-                }
-
-                // handle all full partitions
-                for ((void) ++sit, ++sdest; sit != send; (void) ++sit, ++sdest)
-                {
-                    beg = traits::begin(sit);
-                    end = traits::end(sit);
-                    out = traits::begin(sdest);
-
-                    if (beg != end)
-                    {
-                        segments.push_back(dispatch_async(traits::get_id(sit),
-                            algo, policy, forced_seq(), beg, end, out));
-                    }
-                }
-
-                // handle the beginning of the last partition
-                beg = traits::begin(sit);
-                end = traits::local(last);
-
-                if (beg != end)
-                {
-                    segments.push_back(dispatch_async(traits::get_id(sit), algo,
-                        policy, forced_seq(), beg, end, traits::begin(sdest)));
-                }
+                segments.push_back(segmented_transfer_run_async(
+                    algo, policy, forced_seq(), run));
             }
 
             // NOLINTNEXTLINE(bugprone-use-after-move)
             HPX_ASSERT(!segments.empty());
 
-            return util::detail::algorithm_result<ExPolicy,
-                util::in_out_result<SegIter, SegOutIter>>::
-                get(hpx::dataflow(
-                    [=](std::vector<shared_future<local_iterator_pair>>&& r)
-                        -> util::in_out_result<SegIter, SegOutIter> {
+            std::advance(dest, std::distance(first, last));
+            return util::detail::algorithm_result<ExPolicy, result_type>::get(
+                hpx::dataflow(
+                    [last, dest](std::vector<hpx::future<void>>&& r)
+                        -> result_type {
                         // handle any remote exceptions, will throw on error
                         std::list<std::exception_ptr> errors;
                         parallel::util::detail::handle_remote_exceptions<
                             ExPolicy>::call(r, errors);
 
-                        local_iterator_pair p = r.back().get();
-                        using result_type =
-                            util::in_out_result<SegIter, SegOutIter>;
-
-                        return result_type{output_traits::compose(sdest, p.in),
-                            output_traits::compose(sdest, p.out)};
+                        return result_type{last, dest};
                     },
                     HPX_MOVE(segments)));
         }
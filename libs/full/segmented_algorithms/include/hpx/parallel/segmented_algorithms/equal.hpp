@@ -0,0 +1,168 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/futures/future.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/equal.hpp>
+#include <hpx/parallel/segmented_algorithms/mismatch.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_equal
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Two ranges are equal if their first mismatch is at their end, the
+        // runs of the ranges are compared where the first range is located.
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Pred>
+        util::detail::algorithm_result_t<ExPolicy, bool> segmented_equal(
+            ExPolicy const&, SegIter1 first1, SegIter1 last1, SegIter2 first2,
+            Pred&& pred)
+        {
+            using result = util::detail::algorithm_result<ExPolicy, bool>;
+
+            if (first1 == last1)
+            {
+                return result::get(true);
+            }
+
+            std::size_t const count = std::distance(first1, last1);
+            return result::get(hpx::make_future<bool>(
+                segmented_mismatch_position<ExPolicy>(
+                    first1, last1, first2, HPX_FORWARD(Pred, pred)),
+                [count](std::size_t pos) { return pos == count; }));
+        }
+
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Pred>
+        util::detail::algorithm_result_t<ExPolicy, bool> segmented_equal(
+            ExPolicy const& policy, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, SegIter2 last2, Pred&& pred)
+        {
+            if (std::distance(first1, last1) != std::distance(first2, last2))
+            {
+                return util::detail::algorithm_result<ExPolicy, bool>::get(
+                    false);
+            }
+
+            return segmented_equal(
+                policy, first1, last1, first2, HPX_FORWARD(Pred, pred));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter1, typename SegIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter1> &&
+            hpx::traits::is_segmented_iterator_v<SegIter1> &&
+            hpx::traits::is_iterator_v<SegIter2> &&
+            hpx::traits::is_segmented_iterator_v<SegIter2>
+        )>
+    // clang-format on
+    bool tag_invoke(hpx::equal_t, SegIter1 first1, SegIter1 last1,
+        SegIter2 first2, SegIter2 last2, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter1> &&
+                hpx::traits::is_forward_iterator_v<SegIter2>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_equal(hpx::execution::seq,
+            first1, last1, first2, last2, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter1, typename SegIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter1> &&
+            hpx::traits::is_segmented_iterator_v<SegIter1> &&
+            hpx::traits::is_iterator_v<SegIter2> &&
+            hpx::traits::is_segmented_iterator_v<SegIter2>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, bool>
+    tag_invoke(hpx::equal_t, ExPolicy&& policy, SegIter1 first1,
+        SegIter1 last1, SegIter2 first2, SegIter2 last2, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter1> &&
+                hpx::traits::is_forward_iterator_v<SegIter2>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_equal(
+            HPX_FORWARD(ExPolicy, policy), first1, last1, first2, last2,
+            HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename SegIter1, typename SegIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter1> &&
+            hpx::traits::is_segmented_iterator_v<SegIter1> &&
+            hpx::traits::is_iterator_v<SegIter2> &&
+            hpx::traits::is_segmented_iterator_v<SegIter2> &&
+            !hpx::traits::is_iterator_v<Pred>
+        )>
+    // clang-format on
+    bool tag_invoke(hpx::equal_t, SegIter1 first1, SegIter1 last1,
+        SegIter2 first2, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter1> &&
+                hpx::traits::is_forward_iterator_v<SegIter2>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_equal(
+            hpx::execution::seq, first1, last1, first2, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter1, typename SegIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter1> &&
+            hpx::traits::is_segmented_iterator_v<SegIter1> &&
+            hpx::traits::is_iterator_v<SegIter2> &&
+            hpx::traits::is_segmented_iterator_v<SegIter2> &&
+            !hpx::traits::is_iterator_v<Pred>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, bool>
+    tag_invoke(hpx::equal_t, ExPolicy&& policy, SegIter1 first1,
+        SegIter1 last1, SegIter2 first2, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter1> &&
+                hpx::traits::is_forward_iterator_v<SegIter2>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_equal(
+            HPX_FORWARD(ExPolicy, policy), first1, last1, first2,
+            HPX_MOVE(pred));
+    }
+}    // namespace hpx::segmented
@@ -0,0 +1,299 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/mismatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_mismatch
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Find the first mismatch of one run of the two ranges, this
+        // function is executed on the locality of the segment of the first
+        // range. The elements of the second range are fetched in one piece
+        // if they are located on a different locality. Returns the length of
+        // the run if all elements match.
+        template <typename LocalIter1, typename LocalIter2, typename Pred>
+        std::size_t segmented_mismatch_run(LocalIter1 first1, LocalIter1 last1,
+            hpx::id_type id2, LocalIter2 first2, Pred pred, bool sequential)
+        {
+            using traits1 =
+                hpx::traits::segmented_local_iterator_traits<LocalIter1>;
+            using traits2 =
+                hpx::traits::segmented_local_iterator_traits<LocalIter2>;
+
+            auto beg1 = traits1::local(first1);
+            auto end1 = traits1::local(last1);
+
+            auto find = [&](auto beg2) -> std::size_t {
+                if (sequential)
+                {
+                    return std::distance(
+                        beg1, std::mismatch(beg1, end1, beg2, pred).first);
+                }
+                return std::distance(beg1,
+                    hpx::mismatch(hpx::execution::par, beg1, end1, beg2, pred)
+                        .first);
+            };
+
+            if (segment_is_local(id2))
+            {
+                return find(traits2::local(first2));
+            }
+
+            auto const values = segment_fetch_values(
+                id2, first2, std::next(first2, std::distance(first1, last1)))
+                                    .get();
+            return find(values.begin());
+        }
+
+        template <typename LocalIter1, typename LocalIter2, typename Pred>
+        struct segmented_mismatch_run_action
+          : hpx::actions::make_action<std::size_t (*)(LocalIter1, LocalIter1,
+                                          hpx::id_type, LocalIter2, Pred, bool),
+                &segmented_mismatch_run<LocalIter1, LocalIter2, Pred>,
+                segmented_mismatch_run_action<LocalIter1, LocalIter2,
+                    Pred>>::type
+        {
+        };
+
+        // Return the position of the first mismatch of [first1, last1) and
+        // the range beginning at first2, or the length of the ranges if
+        // there is none. The segments of the two ranges do not have to be
+        // aligned. A sequenced execution policy stops at the first run which
+        // contains a mismatch.
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Pred>
+        hpx::future<std::size_t> segmented_mismatch_position(
+            SegIter1 first1, SegIter1 last1, SegIter2 first2, Pred&& pred)
+        {
+            using traits1 = hpx::traits::segmented_iterator_traits<SegIter1>;
+            using traits2 = hpx::traits::segmented_iterator_traits<SegIter2>;
+            using pred_type = std::decay_t<Pred>;
+            using action_type =
+                segmented_mismatch_run_action<typename traits1::local_iterator,
+                    typename traits2::local_iterator, pred_type>;
+
+            bool const sequential =
+                hpx::is_sequenced_execution_policy_v<ExPolicy>;
+
+            auto const runs = segment_runs(first1, last1, first2);
+
+            std::vector<std::size_t> sizes;
+            sizes.reserve(runs.size());
+
+            std::vector<hpx::shared_future<std::size_t>> segments;
+            segments.reserve(runs.size());
+            for (auto const& run : runs)
+            {
+                sizes.push_back(std::distance(run.first1, run.last1));
+                segments.push_back(hpx::async(action_type(),
+                    hpx::colocated(run.id1), run.first1, run.last1, run.id2,
+                    run.first2, pred, sequential));
+
+                if (sequential)
+                {
+                    segments.back().wait();
+                    if (segments.back().has_exception() ||
+                        segments.back().get() != sizes.back())
+                    {
+                        break;
+                    }
+                }
+            }
+
+            return hpx::dataflow(
+                [sizes = HPX_MOVE(sizes)](
+                    std::vector<hpx::shared_future<std::size_t>>&& r)
+                    -> std::size_t {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+
+                    std::size_t pos = 0;
+                    for (std::size_t i = 0; i != r.size(); ++i)
+                    {
+                        std::size_t const matched = r[i].get();
+                        pos += matched;
+                        if (matched != sizes[i])
+                        {
+                            break;
+                        }
+                    }
+                    return pos;
+                },
+                HPX_MOVE(segments));
+        }
+
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Pred>
+        util::detail::algorithm_result_t<ExPolicy,
+            std::pair<SegIter1, SegIter2>>
+        segmented_mismatch(ExPolicy const&, SegIter1 first1, SegIter1 last1,
+            SegIter2 first2, Pred&& pred)
+        {
+            using result_type = std::pair<SegIter1, SegIter2>;
+            using result =
+                util::detail::algorithm_result<ExPolicy, result_type>;
+
+            if (first1 == last1)
+            {
+                return result::get(result_type{first1, first2});
+            }
+
+            return result::get(hpx::make_future<result_type>(
+                segmented_mismatch_position<ExPolicy>(
+                    first1, last1, first2, HPX_FORWARD(Pred, pred)),
+                [first1, first2](std::size_t pos) -> result_type {
+                    return {std::next(first1, pos), std::next(first2, pos)};
+                }));
+        }
+
+        template <typename ExPolicy, typename SegIter1, typename SegIter2,
+            typename Pred>
+        util::detail::algorithm_result_t<ExPolicy,
+            std::pair<SegIter1, SegIter2>>
+        segmented_mismatch(ExPolicy const& policy, SegIter1 first1,
+            SegIter1 last1, SegIter2 first2, SegIter2 last2, Pred&& pred)
+        {
+            auto const count = (std::min)(
+                std::distance(first1, last1), std::distance(first2, last2));
+
+            return segmented_mismatch(policy, first1, std::next(first1, count),
+                first2, HPX_FORWARD(Pred, pred));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter1, typename SegIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter1> &&
+            hpx::traits::is_segmented_iterator_v<SegIter1> &&
+            hpx::traits::is_iterator_v<SegIter2> &&
+            hpx::traits::is_segmented_iterator_v<SegIter2>
+        )>
+    // clang-format on
+    std::pair<SegIter1, SegIter2> tag_invoke(hpx::mismatch_t, SegIter1 first1,
+        SegIter1 last1, SegIter2 first2, SegIter2 last2, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter1> &&
+                hpx::traits::is_forward_iterator_v<SegIter2>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_mismatch(hpx::execution::seq,
+            first1, last1, first2, last2, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter1, typename SegIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter1> &&
+            hpx::traits::is_segmented_iterator_v<SegIter1> &&
+            hpx::traits::is_iterator_v<SegIter2> &&
+            hpx::traits::is_segmented_iterator_v<SegIter2>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+        std::pair<SegIter1, SegIter2>>
+    tag_invoke(hpx::mismatch_t, ExPolicy&& policy, SegIter1 first1,
+        SegIter1 last1, SegIter2 first2, SegIter2 last2, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter1> &&
+                hpx::traits::is_forward_iterator_v<SegIter2>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_mismatch(
+            HPX_FORWARD(ExPolicy, policy), first1, last1, first2, last2,
+            HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename SegIter1, typename SegIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter1> &&
+            hpx::traits::is_segmented_iterator_v<SegIter1> &&
+            hpx::traits::is_iterator_v<SegIter2> &&
+            hpx::traits::is_segmented_iterator_v<SegIter2> &&
+            !hpx::traits::is_iterator_v<Pred>
+        )>
+    // clang-format on
+    std::pair<SegIter1, SegIter2> tag_invoke(hpx::mismatch_t, SegIter1 first1,
+        SegIter1 last1, SegIter2 first2, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter1> &&
+                hpx::traits::is_forward_iterator_v<SegIter2>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_mismatch(
+            hpx::execution::seq, first1, last1, first2, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter1, typename SegIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter1> &&
+            hpx::traits::is_segmented_iterator_v<SegIter1> &&
+            hpx::traits::is_iterator_v<SegIter2> &&
+            hpx::traits::is_segmented_iterator_v<SegIter2> &&
+            !hpx::traits::is_iterator_v<Pred>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy,
+        std::pair<SegIter1, SegIter2>>
+    tag_invoke(hpx::mismatch_t, ExPolicy&& policy, SegIter1 first1,
+        SegIter1 last1, SegIter2 first2, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter1> &&
+                hpx::traits::is_forward_iterator_v<SegIter2>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_mismatch(
+            HPX_FORWARD(ExPolicy, policy), first1, last1, first2,
+            HPX_MOVE(pred));
+    }
+}    // namespace hpx::segmented
@@ -0,0 +1,231 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/partition.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/compact.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_partition
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The number of elements of one site which do and do not satisfy the
+        // predicate.
+        struct partition_count
+        {
+            std::size_t selected_ = 0;
+            std::size_t rejected_ = 0;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned /* version */)
+            {
+                // clang-format off
+                ar & selected_ & rejected_;
+                // clang-format on
+            }
+        };
+
+        // Partition the local range of one site, this function is executed
+        // on the locality of the segment. The selected elements of all sites
+        // are stored in front of the rejected ones, both keeping their
+        // relative order. Returns the overall number of selected elements.
+        template <typename LocalIter, typename Pred>
+        std::size_t segmented_partition_segment(std::string basename,
+            std::size_t this_site,
+            std::vector<segment_range<LocalIter>> ranges, Pred pred)
+        {
+            using traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+
+            std::vector<segment_value_t<LocalIter>> selected;
+            std::vector<segment_value_t<LocalIter>> rejected;
+            auto end = traits::local(ranges[this_site].last);
+            for (auto it = traits::local(ranges[this_site].first); it != end;
+                ++it)
+            {
+                if (HPX_INVOKE(pred, *it))
+                {
+                    selected.push_back(HPX_MOVE(*it));
+                }
+                else
+                {
+                    rejected.push_back(HPX_MOVE(*it));
+                }
+            }
+
+            // exchanging the counts also guarantees that all sites have read
+            // their local data before any of them is overwritten
+            std::size_t const num_sites = ranges.size();
+            partition_count const local{selected.size(), rejected.size()};
+            std::vector<partition_count> counts(1, local);
+            if (num_sites != 1)
+            {
+                using namespace hpx::collectives;
+
+                communicator comm = create_communicator(basename.c_str(),
+                    num_sites_arg(num_sites), this_site_arg(this_site));
+
+                counts =
+                    all_gather(comm, local, this_site_arg(this_site)).get();
+            }
+
+            std::size_t selected_offset = 0;
+            std::size_t rejected_offset = 0;
+            std::size_t total_selected = 0;
+            for (std::size_t i = 0; i != counts.size(); ++i)
+            {
+                if (i < this_site)
+                {
+                    selected_offset += counts[i].selected_;
+                    rejected_offset += counts[i].rejected_;
+                }
+                total_selected += counts[i].selected_;
+            }
+
+            segment_store_values(ranges, selected_offset, HPX_MOVE(selected));
+            segment_store_values(ranges, total_selected + rejected_offset,
+                HPX_MOVE(rejected));
+
+            return total_selected;
+        }
+
+        template <typename LocalIter, typename Pred>
+        struct segmented_partition_segment_action
+          : hpx::actions::make_action<std::size_t (*)(std::string, std::size_t,
+                                          std::vector<segment_range<LocalIter>>,
+                                          Pred),
+                &segmented_partition_segment<LocalIter, Pred>,
+                segmented_partition_segment_action<LocalIter, Pred>>::type
+        {
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Pred>
+        util::detail::algorithm_result_t<ExPolicy, SegIter>
+        segmented_partition(
+            ExPolicy const& policy, SegIter first, SegIter last, Pred&& pred)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using pred_type = std::decay_t<Pred>;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, SegIter>::get(
+                    HPX_MOVE(first));
+            }
+
+            return segmented_compact(policy, first, last,
+                "segmented_partition",
+                segmented_partition_segment_action<
+                    typename traits::local_iterator, pred_type>(),
+                pred_type(HPX_FORWARD(Pred, pred)));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // The segmented partition is always stable, it serves both partition
+    // and stable_partition.
+
+    // clang-format off
+    template <typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::partition_t, SegIter first, SegIter last, Pred pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_partition(
+            hpx::execution::seq, first, last, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, SegIter>
+    tag_invoke(hpx::partition_t, ExPolicy&& policy, SegIter first,
+        SegIter last, Pred pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_partition(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::stable_partition_t, SegIter first, SegIter last, Pred pred)
+    {
+        static_assert(hpx::traits::is_bidirectional_iterator_v<SegIter>,
+            "Requires at least bidirectional iterator.");
+
+        return hpx::parallel::detail::segmented_partition(
+            hpx::execution::seq, first, last, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, SegIter>
+    tag_invoke(hpx::stable_partition_t, ExPolicy&& policy, SegIter first,
+        SegIter last, Pred pred)
+    {
+        static_assert(hpx::traits::is_bidirectional_iterator_v<SegIter>,
+            "Requires at least bidirectional iterator.");
+
+        return hpx::parallel::detail::segmented_partition(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(pred));
+    }
+}    // namespace hpx::segmented
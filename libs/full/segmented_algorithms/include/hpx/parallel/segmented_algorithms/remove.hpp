@@ -0,0 +1,199 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/remove.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/compact.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_remove_if
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        template <typename T>
+        struct remove_predicate
+        {
+            T value_;
+
+            bool operator()(T const& val) const
+            {
+                return val == value_;
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned /* version */)
+            {
+                // clang-format off
+                ar & value_;
+                // clang-format on
+            }
+        };
+
+        // Remove the elements of the local range of one site, this function
+        // is executed on the locality of the segment.
+        template <typename LocalIter, typename Pred>
+        std::size_t segmented_remove_if_segment(std::string basename,
+            std::size_t this_site,
+            std::vector<segment_range<LocalIter>> ranges, Pred pred)
+        {
+            using traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+
+            std::vector<segment_value_t<LocalIter>> kept;
+            auto end = traits::local(ranges[this_site].last);
+            for (auto it = traits::local(ranges[this_site].first); it != end;
+                ++it)
+            {
+                if (!HPX_INVOKE(pred, *it))
+                {
+                    kept.push_back(HPX_MOVE(*it));
+                }
+            }
+
+            std::vector<std::size_t> const counts = segmented_compact_counts(
+                basename, ranges.size(), this_site, kept.size());
+
+            return segmented_compact_store(
+                ranges, counts, this_site, HPX_MOVE(kept));
+        }
+
+        template <typename LocalIter, typename Pred>
+        struct segmented_remove_if_segment_action
+          : hpx::actions::make_action<std::size_t (*)(std::string, std::size_t,
+                                          std::vector<segment_range<LocalIter>>,
+                                          Pred),
+                &segmented_remove_if_segment<LocalIter, Pred>,
+                segmented_remove_if_segment_action<LocalIter, Pred>>::type
+        {
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Pred>
+        util::detail::algorithm_result_t<ExPolicy, SegIter>
+        segmented_remove_if(
+            ExPolicy const& policy, SegIter first, SegIter last, Pred&& pred)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using pred_type = std::decay_t<Pred>;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, SegIter>::get(
+                    HPX_MOVE(first));
+            }
+
+            return segmented_compact(policy, first, last,
+                "segmented_remove_if",
+                segmented_remove_if_segment_action<
+                    typename traits::local_iterator, pred_type>(),
+                pred_type(HPX_FORWARD(Pred, pred)));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::remove_if_t, SegIter first, SegIter last, Pred pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_remove_if(
+            hpx::execution::seq, first, last, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, SegIter>
+    tag_invoke(hpx::remove_if_t, ExPolicy&& policy, SegIter first,
+        SegIter last, Pred pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_remove_if(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename SegIter,
+        typename T = typename std::iterator_traits<SegIter>::value_type,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::remove_t, SegIter first, SegIter last, T const& value)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        using value_type = typename std::iterator_traits<SegIter>::value_type;
+
+        return hpx::parallel::detail::segmented_remove_if(hpx::execution::seq,
+            first, last,
+            hpx::parallel::detail::remove_predicate<value_type>{value});
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename T = typename std::iterator_traits<SegIter>::value_type,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, SegIter>
+    tag_invoke(hpx::remove_t, ExPolicy&& policy, SegIter first, SegIter last,
+        T const& value)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        using value_type = typename std::iterator_traits<SegIter>::value_type;
+
+        return hpx::parallel::detail::segmented_remove_if(
+            HPX_FORWARD(ExPolicy, policy), first, last,
+            hpx::parallel::detail::remove_predicate<value_type>{value});
+    }
+}    // namespace hpx::segmented
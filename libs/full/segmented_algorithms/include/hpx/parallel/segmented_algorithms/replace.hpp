@@ -0,0 +1,207 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/functional/invoke.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/for_each.hpp>
+#include <hpx/parallel/algorithms/replace.hpp>
+#include <hpx/parallel/segmented_algorithms/for_each.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_replace
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        template <typename T>
+        struct replace_function
+        {
+            T old_value_;
+            T new_value_;
+
+            void operator()(T& val) const
+            {
+                if (val == old_value_)
+                {
+                    val = new_value_;
+                }
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned /* version */)
+            {
+                // clang-format off
+                ar & old_value_ & new_value_;
+                // clang-format on
+            }
+        };
+
+        template <typename Pred, typename T>
+        struct replace_if_function
+        {
+            Pred pred_;
+            T new_value_;
+
+            void operator()(T& val) const
+            {
+                if (HPX_INVOKE(pred_, val))
+                {
+                    val = new_value_;
+                }
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned /* version */)
+            {
+                // clang-format off
+                ar & pred_ & new_value_;
+                // clang-format on
+            }
+        };
+
+        // The elements are replaced in place on the localities of their
+        // segments, no data is moved.
+        template <typename ExPolicy, typename SegIter, typename F>
+        util::detail::algorithm_result_t<ExPolicy> segmented_replace(
+            ExPolicy&& policy, SegIter first, SegIter last, F&& f)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+            using result = util::detail::algorithm_result<ExPolicy>;
+
+            if (first == last)
+            {
+                return result::get();
+            }
+
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return result::get(segmented_for_each(
+                    detail::for_each<typename traits::local_iterator>(),
+                    HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(F, f), hpx::identity_v, is_seq()));
+            }
+            else
+            {
+                segmented_for_each(
+                    detail::for_each<typename traits::local_iterator>(),
+                    HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(F, f), hpx::identity_v, is_seq());
+                return result::get();
+            }
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename T = typename std::iterator_traits<SegIter>::value_type,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    void tag_invoke(hpx::replace_t, SegIter first, SegIter last,
+        T const& old_value, T const& new_value)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        using value_type = typename std::iterator_traits<SegIter>::value_type;
+
+        hpx::parallel::detail::segmented_replace(hpx::execution::seq, first,
+            last,
+            hpx::parallel::detail::replace_function<value_type>{
+                old_value, new_value});
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename T = typename std::iterator_traits<SegIter>::value_type,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> tag_invoke(
+        hpx::replace_t, ExPolicy&& policy, SegIter first, SegIter last,
+        T const& old_value, T const& new_value)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        using value_type = typename std::iterator_traits<SegIter>::value_type;
+
+        return hpx::parallel::detail::segmented_replace(
+            HPX_FORWARD(ExPolicy, policy), first, last,
+            hpx::parallel::detail::replace_function<value_type>{
+                old_value, new_value});
+    }
+
+    // clang-format off
+    template <typename SegIter, typename Pred,
+        typename T = typename std::iterator_traits<SegIter>::value_type,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    void tag_invoke(hpx::replace_if_t, SegIter first, SegIter last, Pred pred,
+        T const& new_value)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        using value_type = typename std::iterator_traits<SegIter>::value_type;
+
+        hpx::parallel::detail::segmented_replace(hpx::execution::seq, first,
+            last,
+            hpx::parallel::detail::replace_if_function<Pred, value_type>{
+                HPX_MOVE(pred), new_value});
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Pred,
+        typename T = typename std::iterator_traits<SegIter>::value_type,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> tag_invoke(
+        hpx::replace_if_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Pred pred, T const& new_value)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        using value_type = typename std::iterator_traits<SegIter>::value_type;
+
+        return hpx::parallel::detail::segmented_replace(
+            HPX_FORWARD(ExPolicy, policy), first, last,
+            hpx::parallel::detail::replace_if_function<Pred, value_type>{
+                HPX_MOVE(pred), new_value});
+    }
+}    // namespace hpx::segmented
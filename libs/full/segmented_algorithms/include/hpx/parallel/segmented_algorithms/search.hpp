@@ -0,0 +1,285 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/search.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_search
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Collect the pattern on the calling locality, a segmented pattern is
+        // fetched with one message per segment.
+        template <typename FwdIter>
+        std::vector<typename std::iterator_traits<FwdIter>::value_type>
+        segmented_search_pattern(FwdIter first, FwdIter last)
+        {
+            using value_type =
+                typename std::iterator_traits<FwdIter>::value_type;
+
+            if constexpr (hpx::traits::is_segmented_iterator_v<FwdIter>)
+            {
+                auto const ranges = segment_ranges(first, last);
+
+                std::vector<hpx::future<std::vector<value_type>>> parts;
+                parts.reserve(ranges.size());
+                for (auto const& r : ranges)
+                {
+                    parts.push_back(
+                        segment_fetch_values(r.id, r.first, r.last));
+                }
+
+                std::vector<value_type> pattern;
+                for (auto& part : parts)
+                {
+                    auto values = part.get();
+                    pattern.insert(pattern.end(),
+                        std::make_move_iterator(values.begin()),
+                        std::make_move_iterator(values.end()));
+                }
+                return pattern;
+            }
+            else
+            {
+                return std::vector<value_type>(first, last);
+            }
+        }
+
+        // Find the first occurrence of the pattern which starts in the local
+        // range of one segment, this function is executed on the locality of
+        // the segment. Occurrences which reach into the following segments
+        // are found by searching the tail of the local range together with
+        // the first elements of the following segments (halo), which are
+        // fetched in bulk. Returns the size of the local range if there is
+        // no occurrence.
+        template <typename LocalIter, typename T, typename Pred>
+        std::size_t segmented_search_segment(LocalIter first, LocalIter last,
+            std::vector<T> pattern,
+            std::vector<segment_range<LocalIter>> halo, Pred pred)
+        {
+            using traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+            using value_type = segment_value_t<LocalIter>;
+
+            auto beg = traits::local(first);
+            auto end = traits::local(last);
+            std::size_t const size = std::distance(beg, end);
+
+            // occurrences which lie completely in the local range start
+            // before any occurrence reaching into the halo
+            auto it = std::search(
+                beg, end, pattern.begin(), pattern.end(), std::ref(pred));
+            if (it != end)
+            {
+                return std::distance(beg, it);
+            }
+
+            if (halo.empty())
+            {
+                return size;
+            }
+
+            std::vector<hpx::future<std::vector<value_type>>> parts;
+            parts.reserve(halo.size());
+            for (auto const& r : halo)
+            {
+                parts.push_back(segment_fetch_values(r.id, r.first, r.last));
+            }
+
+            std::size_t const tail = (std::min)(pattern.size() - 1, size);
+            std::vector<value_type> window(std::prev(end, tail), end);
+            for (auto& part : parts)
+            {
+                auto values = part.get();
+                window.insert(window.end(),
+                    std::make_move_iterator(values.begin()),
+                    std::make_move_iterator(values.end()));
+            }
+
+            auto wit = std::search(window.begin(), window.end(),
+                pattern.begin(), pattern.end(), std::ref(pred));
+            std::size_t const pos = std::distance(window.begin(), wit);
+            if (pos < tail)
+            {
+                return size - tail + pos;
+            }
+            return size;
+        }
+
+        template <typename LocalIter, typename T, typename Pred>
+        struct segmented_search_segment_action
+          : hpx::actions::make_action<std::size_t (*)(LocalIter, LocalIter,
+                                          std::vector<T>,
+                                          std::vector<segment_range<LocalIter>>,
+                                          Pred),
+                &segmented_search_segment<LocalIter, T, Pred>,
+                segmented_search_segment_action<LocalIter, T, Pred>>::type
+        {
+        };
+
+        template <typename ExPolicy, typename SegIter, typename FwdIter2,
+            typename Pred>
+        util::detail::algorithm_result_t<ExPolicy, SegIter> segmented_search(
+            ExPolicy const&, SegIter first, SegIter last, FwdIter2 s_first,
+            FwdIter2 s_last, Pred&& pred)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using local_iterator_type = typename traits::local_iterator;
+            using value_type =
+                typename std::iterator_traits<FwdIter2>::value_type;
+            using result = util::detail::algorithm_result<ExPolicy, SegIter>;
+            using pred_type = std::decay_t<Pred>;
+            using action_type = segmented_search_segment_action<
+                local_iterator_type, value_type, pred_type>;
+
+            std::size_t const count = std::distance(first, last);
+            std::size_t const pattern_size = std::distance(s_first, s_last);
+            if (pattern_size == 0)
+            {
+                return result::get(HPX_MOVE(first));
+            }
+            if (pattern_size > count)
+            {
+                return result::get(HPX_MOVE(last));
+            }
+
+            auto const pattern = segmented_search_pattern(s_first, s_last);
+            auto const ranges = segment_ranges(first, last);
+
+            std::vector<std::size_t> offsets;
+            offsets.reserve(ranges.size());
+
+            std::vector<hpx::shared_future<std::size_t>> segments;
+            segments.reserve(ranges.size());
+
+            std::size_t offset = 0;
+            for (auto const& r : ranges)
+            {
+                std::size_t const size = segment_range_size(r);
+                std::size_t const halo_last =
+                    (std::min)(count, offset + size + pattern_size - 1);
+
+                offsets.push_back(offset);
+                segments.push_back(hpx::async(action_type(),
+                    hpx::colocated(r.id), r.first, r.last, pattern,
+                    segment_ranges(std::next(first, offset + size),
+                        std::next(first, halo_last)),
+                    pred));
+                offset += size;
+
+                // a sequenced execution policy stops at the first segment
+                // containing an occurrence
+                if constexpr (hpx::is_sequenced_execution_policy_v<ExPolicy>)
+                {
+                    segments.back().wait();
+                    if (segments.back().has_exception() ||
+                        segments.back().get() != size)
+                    {
+                        break;
+                    }
+                }
+            }
+
+            return result::get(hpx::dataflow(
+                [first, last, ranges, offsets = HPX_MOVE(offsets)](
+                    std::vector<hpx::shared_future<std::size_t>>&& r)
+                    -> SegIter {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+
+                    for (std::size_t i = 0; i != r.size(); ++i)
+                    {
+                        std::size_t const pos = r[i].get();
+                        if (pos != segment_range_size(ranges[i]))
+                        {
+                            return std::next(first, offsets[i] + pos);
+                        }
+                    }
+                    return last;
+                },
+                HPX_MOVE(segments)));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter, typename FwdIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter> &&
+            hpx::traits::is_forward_iterator_v<FwdIter2>
+        )>
+    // clang-format on
+    SegIter tag_invoke(hpx::search_t, SegIter first, SegIter last,
+        FwdIter2 s_first, FwdIter2 s_last, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_search(hpx::execution::seq,
+            first, last, s_first, s_last, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename FwdIter2,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter> &&
+            hpx::traits::is_forward_iterator_v<FwdIter2>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, SegIter>
+    tag_invoke(hpx::search_t, ExPolicy&& policy, SegIter first, SegIter last,
+        FwdIter2 s_first, FwdIter2 s_last, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_search(
+            HPX_FORWARD(ExPolicy, policy), first, last, s_first, s_last,
+            HPX_MOVE(pred));
+    }
+}    // namespace hpx::segmented
@@ -0,0 +1,467 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/algorithms/stable_sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Number of samples each site contributes per participating site,
+        // the splitters are selected from the combined samples of all sites.
+        inline constexpr std::size_t sample_sort_oversampling = 16;
+
+        template <typename T>
+        struct sample_sort_samples
+        {
+            std::size_t size_ = 0;
+            std::vector<T> samples_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned /* version */)
+            {
+                // clang-format off
+                ar & size_ & samples_;
+                // clang-format on
+            }
+        };
+
+        // pick evenly spaced samples from the sorted local data
+        template <typename Iter>
+        sample_sort_samples<typename std::iterator_traits<Iter>::value_type>
+        sample_sort_select_samples(
+            Iter first, Iter last, std::size_t num_samples)
+        {
+            std::size_t const size = std::distance(first, last);
+            num_samples = (std::min)(size, num_samples);
+
+            sample_sort_samples<typename std::iterator_traits<Iter>::value_type>
+                result;
+            result.size_ = size;
+            result.samples_.reserve(num_samples);
+            for (std::size_t i = 0; i != num_samples; ++i)
+            {
+                result.samples_.push_back(
+                    *std::next(first, (2 * i + 1) * size / (2 * num_samples)));
+            }
+            return result;
+        }
+
+        // Select num_sites - 1 splitters from the samples of all sites. Every
+        // sample stands for the same share of the data of its site, the
+        // splitters are the samples at which the accumulated shares cross
+        // the boundaries of equally sized buckets.
+        template <typename T, typename Comp>
+        std::vector<T> sample_sort_select_splitters(
+            std::vector<sample_sort_samples<T>> const& samples,
+            std::size_t num_sites, Comp&& comp)
+        {
+            std::vector<std::pair<T const*, double>> weighted;
+            double total = 0.0;
+            for (auto const& s : samples)
+            {
+                total += static_cast<double>(s.size_);
+                for (T const& value : s.samples_)
+                {
+                    weighted.emplace_back(&value,
+                        static_cast<double>(s.size_) /
+                            static_cast<double>(s.samples_.size()));
+                }
+            }
+
+            std::sort(weighted.begin(), weighted.end(),
+                [&](auto const& lhs, auto const& rhs) {
+                    return HPX_INVOKE(comp, *lhs.first, *rhs.first);
+                });
+
+            std::vector<T> splitters;
+            splitters.reserve(num_sites - 1);
+
+            double accumulated = 0.0;
+            for (auto const& w : weighted)
+            {
+                accumulated += w.second;
+                while (splitters.size() != num_sites - 1 &&
+                    accumulated * static_cast<double>(num_sites) >=
+                        total * static_cast<double>(splitters.size() + 1))
+                {
+                    splitters.push_back(*w.first);
+                }
+            }
+            return splitters;
+        }
+
+        // Move the sorted local data into one bucket per site, all elements
+        // equal to a splitter end up in the same bucket on all sites. Missing
+        // splitters (because of rounding) leave the last buckets empty.
+        template <typename Iter, typename T, typename Comp>
+        std::vector<std::vector<T>> sample_sort_make_buckets(Iter first,
+            Iter last, std::vector<T> const& splitters, std::size_t num_sites,
+            Comp&& comp)
+        {
+            std::vector<std::vector<T>> buckets(num_sites);
+            for (std::size_t i = 0; i != num_sites; ++i)
+            {
+                Iter bound = last;
+                if (i < splitters.size())
+                {
+                    bound = std::upper_bound(first, last, splitters[i],
+                        [&](T const& lhs, T const& rhs) {
+                            return HPX_INVOKE(comp, lhs, rhs);
+                        });
+                }
+                buckets[i].assign(std::make_move_iterator(first),
+                    std::make_move_iterator(bound));
+                first = bound;
+            }
+            return buckets;
+        }
+
+        // Merge the sorted runs received from all sites. The runs are merged
+        // pairwise in the order of their sites, which keeps the merge stable.
+        template <typename T, typename Comp>
+        std::vector<T> sample_sort_merge(
+            std::vector<std::vector<T>>&& runs, Comp&& comp)
+        {
+            while (runs.size() > 1)
+            {
+                std::vector<std::vector<T>> merged;
+                merged.reserve((runs.size() + 1) / 2);
+                for (std::size_t i = 0; i + 1 < runs.size(); i += 2)
+                {
+                    std::vector<T> result;
+                    result.reserve(runs[i].size() + runs[i + 1].size());
+                    std::merge(std::make_move_iterator(runs[i].begin()),
+                        std::make_move_iterator(runs[i].end()),
+                        std::make_move_iterator(runs[i + 1].begin()),
+                        std::make_move_iterator(runs[i + 1].end()),
+                        std::back_inserter(result),
+                        [&](T const& lhs, T const& rhs) {
+                            return HPX_INVOKE(comp, lhs, rhs);
+                        });
+                    merged.push_back(HPX_MOVE(result));
+                }
+                if (runs.size() % 2 != 0)
+                {
+                    merged.push_back(HPX_MOVE(runs.back()));
+                }
+                runs = HPX_MOVE(merged);
+            }
+            return runs.empty() ? std::vector<T>() : HPX_MOVE(runs[0]);
+        }
+
+        // Cut the merged bucket of this site into the pieces that belong to
+        // the (unchanged) local ranges of all sites.
+        template <typename T>
+        std::vector<std::vector<T>> sample_sort_make_pieces(
+            std::vector<T>&& merged, std::vector<std::size_t> const& sizes,
+            std::vector<std::size_t> const& merged_sizes, std::size_t this_site)
+        {
+            std::size_t first = 0;
+            for (std::size_t i = 0; i != this_site; ++i)
+            {
+                first += merged_sizes[i];
+            }
+            std::size_t const last = first + merged.size();
+
+            std::vector<std::vector<T>> pieces(sizes.size());
+            std::size_t target_first = 0;
+            for (std::size_t i = 0; i != sizes.size(); ++i)
+            {
+                std::size_t const target_last = target_first + sizes[i];
+                std::size_t const begin = (std::max)(first, target_first);
+                std::size_t const end = (std::min)(last, target_last);
+                if (begin < end)
+                {
+                    auto const it = merged.begin() + (begin - first);
+                    pieces[i].assign(std::make_move_iterator(it),
+                        std::make_move_iterator(it + (end - begin)));
+                }
+                target_first = target_last;
+            }
+            return pieces;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Sort the local range of one site, this function is executed on the
+        // locality of the segment. All sites run concurrently and exchange
+        // their data through a communicator.
+        template <typename LocalIter, typename Comp>
+        void sample_sort_segment(std::string basename, std::size_t num_sites,
+            std::size_t this_site, LocalIter first, LocalIter last, Comp comp,
+            bool sequential, bool stable)
+        {
+            using traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+            using value_type = typename std::iterator_traits<
+                typename traits::local_raw_iterator>::value_type;
+
+            auto beg = traits::local(first);
+            auto end = traits::local(last);
+
+            // sort the local data
+            if (stable && sequential)
+            {
+                hpx::stable_sort(hpx::execution::seq, beg, end, comp);
+            }
+            else if (stable)
+            {
+                hpx::stable_sort(hpx::execution::par, beg, end, comp);
+            }
+            else if (sequential)
+            {
+                hpx::sort(hpx::execution::seq, beg, end, comp);
+            }
+            else
+            {
+                hpx::sort(hpx::execution::par, beg, end, comp);
+            }
+
+            if (num_sites == 1)
+            {
+                return;
+            }
+
+            using namespace hpx::collectives;
+
+            communicator comm = create_communicator(basename.c_str(),
+                num_sites_arg(num_sites), this_site_arg(this_site));
+
+            // exchange samples and the sizes of the local ranges
+            std::vector<sample_sort_samples<value_type>> const samples =
+                all_gather(comm,
+                    sample_sort_select_samples(
+                        beg, end, sample_sort_oversampling * num_sites),
+                    this_site_arg(this_site), generation_arg(1))
+                    .get();
+
+            std::vector<std::size_t> sizes;
+            sizes.reserve(num_sites);
+            for (auto const& s : samples)
+            {
+                sizes.push_back(s.size_);
+            }
+
+            // send every bucket to its site and merge the received runs
+            std::vector<value_type> merged = sample_sort_merge(
+                all_to_all(comm,
+                    sample_sort_make_buckets(beg, end,
+                        sample_sort_select_splitters(samples, num_sites, comp),
+                        num_sites, comp),
+                    this_site_arg(this_site), generation_arg(2))
+                    .get(),
+                comp);
+
+            // redistribute the globally sorted data to the local ranges
+            std::vector<std::size_t> const merged_sizes =
+                all_gather(comm, merged.size(), this_site_arg(this_site),
+                    generation_arg(3))
+                    .get();
+
+            std::vector<std::vector<value_type>> pieces =
+                all_to_all(comm,
+                    sample_sort_make_pieces(
+                        HPX_MOVE(merged), sizes, merged_sizes, this_site),
+                    this_site_arg(this_site), generation_arg(4))
+                    .get();
+
+            for (auto& piece : pieces)
+            {
+                beg = std::move(piece.begin(), piece.end(), beg);
+            }
+            HPX_ASSERT(beg == end);
+        }
+
+        template <typename LocalIter, typename Comp>
+        struct sample_sort_segment_action
+          : hpx::actions::make_action<void (*)(std::string, std::size_t,
+                                          std::size_t, LocalIter, LocalIter,
+                                          Comp, bool, bool),
+                &sample_sort_segment<LocalIter, Comp>,
+                sample_sort_segment_action<LocalIter, Comp>>::type
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Distributed sample sort: every segment sorts its local data, the
+        // segments select splitters from samples of their data, exchange the
+        // elements such that every segment holds one bucket, merge the
+        // received runs, and finally move the sorted data back into place.
+        template <typename ExPolicy, typename SegIter, typename Comp>
+        util::detail::algorithm_result_t<ExPolicy> segmented_sort(
+            ExPolicy const&, SegIter first, SegIter last, Comp&& comp,
+            bool stable)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using local_iterator_type = typename traits::local_iterator;
+            using result = util::detail::algorithm_result<ExPolicy>;
+
+            auto const ranges = segment_ranges(first, last);
+            std::string const basename = segmented_basename("segmented_sort");
+
+            // all segments have to take part concurrently, even for a
+            // sequenced execution policy
+            using comp_type = std::decay_t<Comp>;
+            sample_sort_segment_action<local_iterator_type, comp_type> act;
+
+            std::vector<hpx::future<void>> segments;
+            segments.reserve(ranges.size());
+            for (std::size_t i = 0; i != ranges.size(); ++i)
+            {
+                segments.push_back(hpx::async(act, hpx::colocated(ranges[i].id),
+                    basename, ranges.size(), i, ranges[i].first,
+                    ranges[i].last, comp_type(comp),
+                    hpx::is_sequenced_execution_policy_v<ExPolicy>, stable));
+            }
+
+            return result::get(dataflow(
+                [](std::vector<hpx::future<void>>&& r) -> void {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+                },
+                HPX_MOVE(segments)));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    void tag_invoke(
+        hpx::sort_t, SegIter first, SegIter last, Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return;
+        }
+
+        hpx::parallel::detail::segmented_sort(
+            hpx::execution::seq, first, last, HPX_MOVE(comp), false);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> tag_invoke(
+        hpx::sort_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return hpx::parallel::util::detail::algorithm_result<
+                ExPolicy>::get();
+        }
+
+        return hpx::parallel::detail::segmented_sort(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(comp), false);
+    }
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    void tag_invoke(
+        hpx::stable_sort_t, SegIter first, SegIter last, Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return;
+        }
+
+        hpx::parallel::detail::segmented_sort(
+            hpx::execution::seq, first, last, HPX_MOVE(comp), true);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy> tag_invoke(
+        hpx::stable_sort_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Comp comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        if (first == last)
+        {
+            return hpx::parallel::util::detail::algorithm_result<
+                ExPolicy>::get();
+        }
+
+        return hpx::parallel::detail::segmented_sort(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(comp), true);
+    }
+}    // namespace hpx::segmented
@@ -1,4 +1,5 @@
 //  Copyright (c) 2007-2024 Hartmut Kaiser
+//  Copyright (c) 2025 The STE||AR-Group
 //
 //  SPDX-License-Identifier: BSL-1.0
 //  Distributed under the Boost Software License, Version 1.0. (See accompanying
@@ -7,14 +8,21 @@
 #pragma once
 
 #include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
 #include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/distribution_policies/colocating_distribution_policy.hpp>
 #include <hpx/functional/invoke.hpp>
+#include <hpx/naming_base/id_type.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/transform_reduce.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/segmented_algorithms/detail/reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
 
@@ -189,186 +197,128 @@ namespace hpx { namespace parallel {
                 HPX_MOVE(segments)));
         }
 
-        // sequential remote implementation
-        template <typename Algo, typename ExPolicy, typename FwdIter1,
-            typename FwdIter2, typename T, typename Reduce, typename Convert>
-        static typename util::detail::algorithm_result<ExPolicy, T>::type
-        segmented_transform_reduce(Algo&& algo, ExPolicy const& policy,
-            FwdIter1 first1, FwdIter1 last1, FwdIter2 first2, T&& init,
-            Reduce&& red_op, Convert&& conv_op, std::true_type)
+        // Reduce one run of the two input ranges, this function is executed
+        // on the locality of the segment of the first range. The elements of
+        // the second range are fetched in one piece if they are located on a
+        // different locality.
+        template <typename T, typename LocalIter1, typename LocalIter2,
+            typename Reduce, typename Convert>
+        T segmented_transform_reduce_run(LocalIter1 first1, LocalIter1 last1,
+            hpx::id_type id2, LocalIter2 first2, Reduce red_op,
+            Convert conv_op, bool sequential)
         {
-            typedef hpx::traits::segmented_iterator_traits<FwdIter1> traits1;
-            typedef typename traits1::segment_iterator segment_iterator1;
-            typedef typename traits1::local_iterator local_iterator_type1;
-            typedef hpx::traits::segmented_iterator_traits<FwdIter2> traits2;
-            typedef typename traits2::segment_iterator segment_iterator2;
-            typedef typename traits2::local_iterator local_iterator_type2;
-            typedef util::detail::algorithm_result<ExPolicy, T> result;
-
-            auto last2 = first2;
-            detail::advance(last2, std::distance(first1, last1));
+            using traits1 =
+                hpx::traits::segmented_local_iterator_traits<LocalIter1>;
+            using traits2 =
+                hpx::traits::segmented_local_iterator_traits<LocalIter2>;
 
-            segment_iterator1 sit1 = traits1::segment(first1);
-            segment_iterator1 send1 = traits1::segment(last1);
-            segment_iterator2 sit2 = traits1::segment(first2);
+            auto beg1 = traits1::local(first1);
+            auto end1 = traits1::local(last1);
 
-            T overall_result = init;
-
-            if (sit1 == send1)
-            {
-                // all elements are on the same partition
-                local_iterator_type1 beg1 = traits1::local(first1);
-                local_iterator_type2 beg2 = traits2::local(first2);
-                local_iterator_type1 end1 = traits1::local(last1);
-                if (beg1 != end1)
-                {
-                    overall_result = HPX_INVOKE(red_op, overall_result,
-                        dispatch(traits1::get_id(sit1), algo, policy,
-                            std::true_type(), beg1, end1, beg2, red_op,
-                            conv_op));
-                }
-            }
-            else
-            {
-                // handle the remaining part of the first1 partition
-                local_iterator_type1 beg1 = traits1::local(first1);
-                local_iterator_type2 beg2 = traits2::local(first1);
-                local_iterator_type1 end1 = traits1::end(sit1);
-                if (beg1 != end1)
+            auto reduce = [&](auto beg2) -> T {
+                if (sequential)
                 {
-                    overall_result = HPX_INVOKE(red_op, overall_result,
-                        dispatch(traits1::get_id(sit1), algo, policy,
-                            std::true_type(), beg1, end1, beg2, red_op,
-                            conv_op));
+                    return seg_transform_reduce_binary<T>::sequential(
+                        hpx::execution::seq, beg1, end1, beg2, red_op,
+                        conv_op);
                 }
+                return seg_transform_reduce_binary<T>::parallel(
+                    hpx::execution::par, beg1, end1, beg2, red_op, conv_op);
+            };
 
-                // handle all of the full partitions
-                for (++sit1, ++sit2; sit1 != send1; ++sit1, ++sit2)
-                {
-                    beg1 = traits1::begin(sit1);
-                    beg2 = traits2::begin(sit2);
-                    end1 = traits1::end(sit1);
-                    if (beg1 != end1)
-                    {
-                        overall_result = HPX_INVOKE(red_op, overall_result,
-                            dispatch(traits1::get_id(sit1), algo, policy,
-                                std::true_type(), beg1, end1, beg2, red_op,
-                                conv_op));
-                    }
-                }
-
-                // handle the beginning of the last1 partition
-                beg1 = traits1::begin(sit1);
-                beg2 = traits2::begin(sit2);
-                end1 = traits1::local(last1);
-                if (beg1 != end1)
-                {
-                    overall_result = HPX_INVOKE(red_op, overall_result,
-                        dispatch(traits1::get_id(sit1), algo, policy,
-                            std::true_type(), beg1, end1, beg2, red_op,
-                            conv_op));
-                }
+            if (segment_is_local(id2))
+            {
+                return reduce(traits2::local(first2));
             }
 
-            return result::get(HPX_MOVE(overall_result));
+            auto const values = segment_fetch_values(
+                id2, first2, std::next(first2, std::distance(first1, last1)))
+                                    .get();
+            return reduce(values.begin());
         }
 
-        // parallel remote implementation
-        template <typename Algo, typename ExPolicy, typename FwdIter1,
-            typename FwdIter2, typename T, typename Reduce, typename Convert>
-        static typename util::detail::algorithm_result<ExPolicy, T>::type
-        segmented_transform_reduce(Algo&& algo, ExPolicy const& policy,
-            FwdIter1 first1, FwdIter1 last1, FwdIter2 first2, T&& init,
-            Reduce&& red_op, Convert&& conv_op, std::false_type)
+        template <typename T, typename LocalIter1, typename LocalIter2,
+            typename Reduce, typename Convert>
+        struct segmented_transform_reduce_run_action
+          : hpx::actions::make_action<T (*)(LocalIter1, LocalIter1,
+                                          hpx::id_type, LocalIter2, Reduce,
+                                          Convert, bool),
+                &segmented_transform_reduce_run<T, LocalIter1, LocalIter2,
+                    Reduce, Convert>,
+                segmented_transform_reduce_run_action<T, LocalIter1,
+                    LocalIter2, Reduce, Convert>>::type
         {
-            typedef hpx::traits::segmented_iterator_traits<FwdIter1> traits1;
-            typedef typename traits1::segment_iterator segment_iterator1;
-            typedef typename traits1::local_iterator local_iterator_type1;
-            typedef hpx::traits::segmented_iterator_traits<FwdIter2> traits2;
-            typedef typename traits2::segment_iterator segment_iterator2;
-            typedef typename traits2::local_iterator local_iterator_type2;
-            typedef util::detail::algorithm_result<ExPolicy, T> result;
-
-            auto last2 = first2;
-            detail::advance(last2, std::distance(first1, last1));
-
-            segment_iterator1 sit1 = traits1::segment(first1);
-            segment_iterator1 send1 = traits1::segment(last1);
-            segment_iterator2 sit2 = traits1::segment(first2);
-
-            typedef std::integral_constant<bool,
-                !hpx::traits::is_forward_iterator<FwdIter1>::value>
-                forced_seq;
-
-            std::vector<shared_future<T>> segments;
-            segments.reserve(std::distance(sit1, send1));
+        };
 
-            if (sit1 == send1)
+        // The segments of the two input ranges do not have to be aligned,
+        // the ranges are split into runs which lie within a single segment
+        // of both ranges.
+        template <typename ExPolicy, typename FwdIter1, typename FwdIter2,
+            typename T, typename Reduce, typename Convert>
+        static typename util::detail::algorithm_result<ExPolicy, T>::type
+        segmented_transform_reduce_binary(ExPolicy const&, FwdIter1 first1,
+            FwdIter1 last1, FwdIter2 first2, T&& init, Reduce&& red_op,
+            Convert&& conv_op)
+        {
+            using traits1 = hpx::traits::segmented_iterator_traits<FwdIter1>;
+            using traits2 = hpx::traits::segmented_iterator_traits<FwdIter2>;
+            using result = util::detail::algorithm_result<ExPolicy, T>;
+            using init_type = std::decay_t<T>;
+            using reduce_type = std::decay_t<Reduce>;
+            using convert_type = std::decay_t<Convert>;
+            using action_type = segmented_transform_reduce_run_action<init_type,
+                typename traits1::local_iterator,
+                typename traits2::local_iterator, reduce_type, convert_type>;
+
+            auto const runs = segment_runs(first1, last1, first2);
+
+            bool const sequential =
+                hpx::is_sequenced_execution_policy_v<ExPolicy>;
+
+            std::vector<hpx::future<init_type>> segments;
+            segments.reserve(runs.size());
+            for (auto const& run : runs)
             {
-                // all elements are on the same partition
-                local_iterator_type1 beg1 = traits1::local(first1);
-                local_iterator_type2 beg2 = traits2::local(first2);
-                local_iterator_type1 end1 = traits1::local(last1);
-                if (beg1 != end1)
+                segments.push_back(hpx::async(action_type(),
+                    hpx::colocated(run.id1), run.first1, run.last1, run.id2,
+                    run.first2, reduce_type(red_op), convert_type(conv_op),
+                    sequential));
+
+                if (sequential)
                 {
-                    segments.push_back(
-                        dispatch_async(traits1::get_id(sit1), algo, policy,
-                            forced_seq(), beg1, end1, beg2, red_op, conv_op));
+                    // the runs are processed one after the other
+                    segments.back().wait();
                 }
             }
-            else
-            {
-                // handle the remaining part of the first1 partition
-                local_iterator_type1 beg1 = traits1::local(first1);
-                local_iterator_type2 beg2 = traits2::local(first2);
-                local_iterator_type1 end1 = traits1::end(sit1);
-                if (beg1 != end1)
-                {
-                    segments.push_back(
-                        dispatch_async(traits1::get_id(sit1), algo, policy,
-                            forced_seq(), beg1, end1, beg2, red_op, conv_op));
-                }
 
-                // handle all of the full partitions
-                for (++sit1, ++sit2; sit1 != send1; ++sit1, ++sit2)
+            auto reduce = [init = init_type(HPX_FORWARD(T, init)),
+                              red_op = reduce_type(red_op)](
+                              std::vector<hpx::future<init_type>>&& r)
+                -> init_type {
+                // handle any remote exceptions, will throw on error
+                std::list<std::exception_ptr> errors;
+                parallel::util::detail::handle_remote_exceptions<
+                    ExPolicy>::call(r, errors);
+
+                init_type overall_result = init;
+                for (auto& f : r)
                 {
-                    beg1 = traits1::begin(sit1);
-                    beg2 = traits2::begin(sit2);
-                    end1 = traits1::end(sit1);
-                    if (beg1 != end1)
-                    {
-                        segments.push_back(dispatch_async(traits1::get_id(sit1),
-                            algo, policy, forced_seq(), beg1, end1, beg2,
-                            red_op, conv_op));
-                    }
+                    overall_result =
+                        HPX_INVOKE(red_op, HPX_MOVE(overall_result), f.get());
                 }
+                return overall_result;
+            };
 
-                // handle the beginning of the last1 partition
-                beg1 = traits1::begin(sit1);
-                beg2 = traits2::begin(sit2);
-                end1 = traits1::local(last1);
-                if (beg1 != end1)
-                {
-                    segments.push_back(
-                        dispatch_async(traits1::get_id(sit1), algo, policy,
-                            forced_seq(), beg1, end1, beg2, red_op, conv_op));
-                }
+            if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+            {
+                return result::get(
+                    hpx::dataflow(HPX_MOVE(reduce), HPX_MOVE(segments)));
+            }
+            else
+            {
+                hpx::wait_all(segments);
+                return result::get(reduce(HPX_MOVE(segments)));
             }
-
-            return result::get(dataflow(
-                [=](std::vector<shared_future<T>>&& r) -> T {
-                    // handle any remote exceptions, will throw on error
-                    std::list<std::exception_ptr> errors;
-                    parallel::util::detail::handle_remote_exceptions<
-                        ExPolicy>::call(r, errors);
-
-                    // VS2015RC bails out if red_op is capture by ref
-                    return std::accumulate(r.begin(), r.end(), init,
-                        [=](T const& val, shared_future<T>& curr) {
-                            return red_op(val, curr.get());
-                        });
-                },
-                HPX_MOVE(segments)));
         }
         /// \endcond
     }    // namespace detail
@@ -463,11 +413,9 @@ namespace hpx { namespace segmented {
             return HPX_MOVE(init);
         }
 
-        return hpx::parallel::detail::segmented_transform_reduce(
-            hpx::parallel::detail::seg_transform_reduce_binary<T>(),
-            hpx::execution::seq, first1, last1, first2, HPX_FORWARD(T, init),
-            HPX_FORWARD(Reduce, red_op), HPX_FORWARD(Convert, conv_op),
-            std::true_type{});
+        return hpx::parallel::detail::segmented_transform_reduce_binary(
+            hpx::execution::seq, first1, last1, first2, HPX_MOVE(init),
+            HPX_FORWARD(Reduce, red_op), HPX_FORWARD(Convert, conv_op));
     }
 
     // clang-format off
@@ -490,18 +438,15 @@ namespace hpx { namespace segmented {
                 hpx::traits::is_forward_iterator<FwdIter2>::value,
             "Requires at least forward iterator.");
 
-        using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
-
         if (first1 == last1)
         {
             return parallel::util::detail::algorithm_result<ExPolicy, T>::get(
                 HPX_FORWARD(T, init));
         }
 
-        return hpx::parallel::detail::segmented_transform_reduce(
-            hpx::parallel::detail::seg_transform_reduce_binary<T>(),
+        return hpx::parallel::detail::segmented_transform_reduce_binary(
             HPX_FORWARD(ExPolicy, policy), first1, last1, first2,
-            HPX_FORWARD(T, init), HPX_FORWARD(Reduce, red_op),
-            HPX_FORWARD(Convert, conv_op), is_seq());
+            HPX_MOVE(init), HPX_FORWARD(Reduce, red_op),
+            HPX_FORWARD(Convert, conv_op));
     }
 }}    // namespace hpx::segmented
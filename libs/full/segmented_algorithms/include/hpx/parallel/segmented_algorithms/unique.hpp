@@ -0,0 +1,215 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/execution/algorithms/detail/predicates.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/unique.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/compact.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_runs.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::parallel {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_unique
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // The information every site needs about all other sites to decide
+        // whether the first element of a site duplicates the last element
+        // kept by the preceding sites.
+        template <typename T>
+        struct unique_boundary
+        {
+            std::size_t count_ = 0;
+            T first_;
+            T last_;
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned /* version */)
+            {
+                // clang-format off
+                ar & count_ & first_ & last_;
+                // clang-format on
+            }
+        };
+
+        // Decide for every site whether its first element is kept and
+        // return the number of elements kept by the sites.
+        template <typename T, typename Pred>
+        std::vector<std::size_t> unique_counts(
+            std::vector<unique_boundary<T>> const& boundaries, Pred& pred)
+        {
+            std::vector<std::size_t> counts;
+            counts.reserve(boundaries.size());
+
+            T const* last_kept = nullptr;
+            for (auto const& b : boundaries)
+            {
+                if (last_kept != nullptr &&
+                    HPX_INVOKE(pred, *last_kept, b.first_))
+                {
+                    // the first element is a duplicate
+                    counts.push_back(b.count_ - 1);
+                    if (b.count_ == 1)
+                    {
+                        continue;
+                    }
+                }
+                else
+                {
+                    counts.push_back(b.count_);
+                }
+                last_kept = &b.last_;
+            }
+            return counts;
+        }
+
+        // Remove the consecutive duplicates of the local range of one site,
+        // this function is executed on the locality of the segment.
+        template <typename LocalIter, typename Pred>
+        std::size_t segmented_unique_segment(std::string basename,
+            std::size_t this_site,
+            std::vector<segment_range<LocalIter>> ranges, Pred pred)
+        {
+            using traits =
+                hpx::traits::segmented_local_iterator_traits<LocalIter>;
+            using value_type = segment_value_t<LocalIter>;
+
+            // every element is compared with the last element kept, as
+            // std::unique does
+            std::vector<value_type> kept;
+            auto it = traits::local(ranges[this_site].first);
+            auto end = traits::local(ranges[this_site].last);
+            kept.push_back(HPX_MOVE(*it));
+            for (++it; it != end; ++it)
+            {
+                if (!HPX_INVOKE(pred, kept.back(), *it))
+                {
+                    kept.push_back(HPX_MOVE(*it));
+                }
+            }
+
+            std::size_t const num_sites = ranges.size();
+            std::vector<std::size_t> counts(1, kept.size());
+            if (num_sites != 1)
+            {
+                using namespace hpx::collectives;
+
+                communicator comm = create_communicator(basename.c_str(),
+                    num_sites_arg(num_sites), this_site_arg(this_site));
+
+                counts = unique_counts(
+                    all_gather(comm,
+                        unique_boundary<value_type>{
+                            kept.size(), kept.front(), kept.back()},
+                        this_site_arg(this_site))
+                        .get(),
+                    pred);
+
+                if (counts[this_site] != kept.size())
+                {
+                    kept.erase(kept.begin());
+                }
+            }
+
+            return segmented_compact_store(
+                ranges, counts, this_site, HPX_MOVE(kept));
+        }
+
+        template <typename LocalIter, typename Pred>
+        struct segmented_unique_segment_action
+          : hpx::actions::make_action<std::size_t (*)(std::string, std::size_t,
+                                          std::vector<segment_range<LocalIter>>,
+                                          Pred),
+                &segmented_unique_segment<LocalIter, Pred>,
+                segmented_unique_segment_action<LocalIter, Pred>>::type
+        {
+        };
+
+        template <typename ExPolicy, typename SegIter, typename Pred>
+        util::detail::algorithm_result_t<ExPolicy, SegIter> segmented_unique(
+            ExPolicy const& policy, SegIter first, SegIter last, Pred&& pred)
+        {
+            using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+            using pred_type = std::decay_t<Pred>;
+
+            if (first == last)
+            {
+                return util::detail::algorithm_result<ExPolicy, SegIter>::get(
+                    HPX_MOVE(first));
+            }
+
+            return segmented_compact(policy, first, last, "segmented_unique",
+                segmented_unique_segment_action<
+                    typename traits::local_iterator, pred_type>(),
+                pred_type(HPX_FORWARD(Pred, pred)));
+        }
+        /// \endcond
+    }    // namespace detail
+}    // namespace hpx::parallel
+
+// The segmented iterators we support all live in namespace hpx::segmented
+namespace hpx::segmented {
+
+    // clang-format off
+    template <typename SegIter,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    SegIter tag_invoke(
+        hpx::unique_t, SegIter first, SegIter last, Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_unique(
+            hpx::execution::seq, first, last, HPX_MOVE(pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Pred = hpx::parallel::detail::equal_to,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator_v<SegIter>
+        )>
+    // clang-format on
+    hpx::parallel::util::detail::algorithm_result_t<ExPolicy, SegIter>
+    tag_invoke(hpx::unique_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Pred pred = Pred())
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::detail::segmented_unique(
+            HPX_FORWARD(ExPolicy, policy), first, last, HPX_MOVE(pred));
+    }
+}    // namespace hpx::segmented
@@ -0,0 +1,140 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of the distributed sample sort of a partitioned
+// vector with one partition per locality.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/parallel_generate.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector.hpp>
+#include <hpx/iostream.hpp>
+#include <hpx/modules/format.hpp>
+#include <hpx/modules/program_options.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/modules/timing.hpp>
+
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Define the vector types to be used.
+HPX_REGISTER_PARTITIONED_VECTOR(int)
+unsigned int seed = (unsigned int) std::random_device{}();
+
+///////////////////////////////////////////////////////////////////////////////
+struct random_fill
+{
+    random_fill()
+      : gen(seed)
+      , dist(0, RAND_MAX)
+    {
+    }
+
+    int operator()()
+    {
+        return dist(gen);
+    }
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<> dist;
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    if (hpx::get_locality_id() == 0)
+    {
+        std::size_t const size = vm["vector_size"].as<std::size_t>();
+        int const test_count = vm["test_count"].as<int>();
+        bool const stable = vm.count("stable") != 0;
+
+        std::vector<hpx::id_type> const localities = hpx::find_all_localities();
+        std::size_t const num_localities = localities.size();
+
+        // create as many partitions as we have localities
+        hpx::partitioned_vector<int> v(
+            size * num_localities, hpx::container_layout(localities));
+
+        double elapsed = 0.0;
+        for (int i = 0; i != test_count; ++i)
+        {
+            hpx::generate(
+                hpx::execution::par, v.begin(), v.end(), random_fill());
+
+            hpx::chrono::high_resolution_timer t;
+            if (stable)
+            {
+                hpx::stable_sort(hpx::execution::par, v.begin(), v.end());
+            }
+            else
+            {
+                hpx::sort(hpx::execution::par, v.begin(), v.end());
+            }
+            elapsed += t.elapsed();
+        }
+        elapsed /= test_count;
+
+        if (vm.count("no-header") == 0)
+        {
+            hpx::cout << "localities,elements_per_locality,average_time[s],"
+                         "elements_per_second_per_locality\n";
+        }
+        hpx::util::format_to(hpx::cout, "{},{},{},{}\n", num_localities, size,
+            elapsed, static_cast<double>(size) / elapsed)
+            << std::flush;
+
+        hpx::util::print_cdash_timing(
+            stable ? "segmented_stable_sort" : "segmented_sort", elapsed);
+
+        return hpx::finalize();
+    }
+
+    return 0;
+}
+
+int main(int argc, char* argv[])
+{
+    // initialize program
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all", "hpx.run_hpx_main!=1"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size",
+            hpx::program_options::value<std::size_t>()->default_value(1000000),
+            "number of elements per locality (default: 1000000)")
+        ("test_count",
+            hpx::program_options::value<int>()->default_value(10),
+            "number of tests to be averaged (default: 10)")
+        ("stable", "measure hpx::stable_sort instead of hpx::sort")
+        ("no-header", "do not print out the csv header row")
+        ("seed,s", hpx::program_options::value<unsigned int>(&seed),
+            "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
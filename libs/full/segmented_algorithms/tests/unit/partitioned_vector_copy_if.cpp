@@ -0,0 +1,185 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_move.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+struct is_odd
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return static_cast<int>(val) % 2 != 0;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v, T const& val)
+{
+    for (auto it = v.begin(); it != v.end(); ++it)
+        *it = val;
+}
+
+template <typename T>
+void iota_vector(hpx::partitioned_vector<T>& v)
+{
+    int val = 0;
+    for (auto it = v.begin(); it != v.end(); ++it)
+        *it = T(val++ % 7);
+}
+
+template <typename T>
+std::vector<T> get_values(hpx::partitioned_vector<T> const& v)
+{
+    return std::vector<T>(v.begin(), v.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename DistPolicy1,
+    typename DistPolicy2>
+void copy_algo_tests(std::size_t size, ExPolicy const& policy,
+    DistPolicy1 const& src_policy, DistPolicy2 const& dest_policy)
+{
+    hpx::partitioned_vector<T> v1(size, src_policy);
+    iota_vector(v1);
+
+    // copy and move between differently partitioned vectors
+    hpx::partitioned_vector<T> v2(size, dest_policy);
+    fill_vector(v2, T(43));
+    auto it = hpx::copy(policy, v1.begin(), v1.end(), v2.begin());
+    HPX_TEST(it == v2.end());
+    HPX_TEST(get_values(v1) == get_values(v2));
+
+    hpx::partitioned_vector<T> v3(size, dest_policy);
+    fill_vector(v3, T(43));
+    it = hpx::move(policy, v2.begin(), v2.end(), v3.begin());
+    HPX_TEST(it == v3.end());
+    HPX_TEST(get_values(v1) == get_values(v3));
+
+    // copy a part of the vector to an offset in the destination
+    fill_vector(v2, T(43));
+    std::vector<T> expected = get_values(v2);
+    std::vector<T> const values = get_values(v1);
+    std::copy(std::next(values.begin(), 1), std::prev(values.end(), 2),
+        std::next(expected.begin(), 2));
+
+    it = hpx::copy(policy, std::next(v1.begin(), 1), std::prev(v1.end(), 2),
+        std::next(v2.begin(), 2));
+    HPX_TEST(it == std::prev(v2.end(), 1));
+    HPX_TEST(get_values(v2) == expected);
+}
+
+template <typename T, typename ExPolicy, typename DistPolicy1,
+    typename DistPolicy2>
+void copy_if_algo_tests(std::size_t size, ExPolicy const& policy,
+    DistPolicy1 const& src_policy, DistPolicy2 const& dest_policy)
+{
+    hpx::partitioned_vector<T> v1(size, src_policy);
+    iota_vector(v1);
+
+    hpx::partitioned_vector<T> v2(size, dest_policy);
+    fill_vector(v2, T(43));
+
+    std::vector<T> expected = get_values(v2);
+    std::vector<T> const values = get_values(v1);
+    auto expected_end =
+        std::copy_if(values.begin(), values.end(), expected.begin(), is_odd());
+
+    auto it = hpx::copy_if(policy, v1.begin(), v1.end(), v2.begin(), is_odd());
+    HPX_TEST(it ==
+        std::next(v2.begin(), std::distance(expected.begin(), expected_end)));
+    HPX_TEST(get_values(v2) == expected);
+}
+
+template <typename T, typename ExPolicy, typename DistPolicy1,
+    typename DistPolicy2>
+void copy_if_algo_tests_async(std::size_t size, ExPolicy const& policy,
+    DistPolicy1 const& src_policy, DistPolicy2 const& dest_policy)
+{
+    hpx::partitioned_vector<T> v1(size, src_policy);
+    iota_vector(v1);
+
+    hpx::partitioned_vector<T> v2(size, dest_policy);
+    fill_vector(v2, T(43));
+
+    std::vector<T> expected = get_values(v2);
+    std::vector<T> const values = get_values(v1);
+    auto expected_end =
+        std::copy_if(values.begin(), values.end(), expected.begin(), is_odd());
+
+    auto f = hpx::copy_if(policy(hpx::execution::task), v1.begin(), v1.end(),
+        v2.begin(), is_odd());
+    HPX_TEST(f.get() ==
+        std::next(v2.begin(), std::distance(expected.begin(), expected_end)));
+    HPX_TEST(get_values(v2) == expected);
+}
+
+template <typename T, typename DistPolicy1, typename DistPolicy2>
+void copy_if_tests_with_policy(std::size_t size,
+    DistPolicy1 const& src_policy, DistPolicy2 const& dest_policy)
+{
+    using namespace hpx::execution;
+
+    copy_algo_tests<T>(size, seq, src_policy, dest_policy);
+    copy_algo_tests<T>(size, par, src_policy, dest_policy);
+
+    copy_if_algo_tests<T>(size, seq, src_policy, dest_policy);
+    copy_if_algo_tests<T>(size, par, src_policy, dest_policy);
+
+    copy_if_algo_tests_async<T>(size, seq, src_policy, dest_policy);
+    copy_if_algo_tests_async<T>(size, par, src_policy, dest_policy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void copy_if_tests()
+{
+    std::size_t const length = 37;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    copy_if_tests_with_policy<T>(
+        length, hpx::container_layout, hpx::container_layout);
+    copy_if_tests_with_policy<T>(
+        length, hpx::container_layout(3), hpx::container_layout(3));
+    copy_if_tests_with_policy<T>(length, hpx::container_layout(3, localities),
+        hpx::container_layout(localities));
+    copy_if_tests_with_policy<T>(length, hpx::container_layout(localities),
+        hpx::container_layout(5, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    copy_if_tests<double>();
+    copy_if_tests<int>();
+
+    return hpx::util::report_errors();
+}
+
+#endif
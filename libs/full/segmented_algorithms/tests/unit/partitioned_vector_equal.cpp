@@ -0,0 +1,157 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_equal.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+struct equal_parity
+{
+    template <typename T1, typename T2>
+    bool operator()(T1 const& lhs, T2 const& rhs) const
+    {
+        return static_cast<int>(lhs) % 2 == static_cast<int>(rhs) % 2;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void iota_vector(hpx::partitioned_vector<T>& v)
+{
+    int val = 0;
+    for (auto it = v.begin(); it != v.end(); ++it)
+        *it = T(val++);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename DistPolicy1,
+    typename DistPolicy2>
+void equal_algo_tests(std::size_t size, ExPolicy const& policy,
+    DistPolicy1 const& policy1, DistPolicy2 const& policy2)
+{
+    hpx::partitioned_vector<T> v1(size, policy1);
+    hpx::partitioned_vector<T> v2(size, policy2);
+    iota_vector(v1);
+    iota_vector(v2);
+
+    HPX_TEST(hpx::equal(policy, v1.begin(), v1.end(), v2.begin()));
+    HPX_TEST(hpx::equal(policy, v1.begin(), v1.end(), v2.begin(), v2.end()));
+    HPX_TEST(!hpx::equal(
+        policy, v1.begin(), v1.end(), v2.begin(), std::prev(v2.end())));
+
+    auto r = hpx::mismatch(policy, v1.begin(), v1.end(), v2.begin());
+    HPX_TEST(r.first == v1.end());
+    HPX_TEST(r.second == v2.end());
+
+    // introduce mismatches in the middle and at the end of the ranges
+    std::size_t const pos = size / 2 + 1;
+    v2.set_value(hpx::launch::sync, pos, T(-1));
+    v2.set_value(hpx::launch::sync, size - 1, T(-1));
+
+    HPX_TEST(!hpx::equal(policy, v1.begin(), v1.end(), v2.begin()));
+    HPX_TEST(hpx::equal(
+        policy, v1.begin(), std::next(v1.begin(), pos), v2.begin()));
+    HPX_TEST(!hpx::equal(
+        policy, v1.begin(), v1.end(), v2.begin(), v2.end(), equal_parity()));
+
+    r = hpx::mismatch(policy, v1.begin(), v1.end(), v2.begin(), v2.end());
+    HPX_TEST(r.first == std::next(v1.begin(), pos));
+    HPX_TEST(r.second == std::next(v2.begin(), pos));
+
+    // the remaining mismatch differs in parity, -1 % 2 is neither 0 nor 1
+    v2.set_value(hpx::launch::sync, pos, T(pos + 2));
+    r = hpx::mismatch(
+        policy, v1.begin(), v1.end(), v2.begin(), v2.end(), equal_parity());
+    HPX_TEST(r.first == std::next(v1.begin(), size - 1));
+    HPX_TEST(r.second == std::next(v2.begin(), size - 1));
+}
+
+template <typename T, typename ExPolicy, typename DistPolicy1,
+    typename DistPolicy2>
+void equal_algo_tests_async(std::size_t size, ExPolicy const& policy,
+    DistPolicy1 const& policy1, DistPolicy2 const& policy2)
+{
+    using hpx::execution::task;
+
+    hpx::partitioned_vector<T> v1(size, policy1);
+    hpx::partitioned_vector<T> v2(size, policy2);
+    iota_vector(v1);
+    iota_vector(v2);
+
+    auto f = hpx::equal(policy(task), v1.begin(), v1.end(), v2.begin());
+    HPX_TEST(f.get());
+
+    std::size_t const pos = size / 3;
+    v2.set_value(hpx::launch::sync, pos, T(-1));
+
+    f = hpx::equal(policy(task), v1.begin(), v1.end(), v2.begin());
+    HPX_TEST(!f.get());
+
+    auto r = hpx::mismatch(policy(task), v1.begin(), v1.end(), v2.begin());
+    HPX_TEST(r.get().first == std::next(v1.begin(), pos));
+}
+
+template <typename T, typename DistPolicy1, typename DistPolicy2>
+void equal_tests_with_policy(std::size_t size, DistPolicy1 const& policy1,
+    DistPolicy2 const& policy2)
+{
+    using namespace hpx::execution;
+
+    equal_algo_tests<T>(size, seq, policy1, policy2);
+    equal_algo_tests<T>(size, par, policy1, policy2);
+
+    equal_algo_tests_async<T>(size, seq, policy1, policy2);
+    equal_algo_tests_async<T>(size, par, policy1, policy2);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void equal_tests()
+{
+    std::size_t const length = 37;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    equal_tests_with_policy<T>(
+        length, hpx::container_layout, hpx::container_layout);
+    equal_tests_with_policy<T>(
+        length, hpx::container_layout(3), hpx::container_layout(3));
+    equal_tests_with_policy<T>(length, hpx::container_layout(3, localities),
+        hpx::container_layout(localities));
+    equal_tests_with_policy<T>(length, hpx::container_layout(localities),
+        hpx::container_layout(5, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    equal_tests<double>();
+    equal_tests<int>();
+
+    return hpx::util::report_errors();
+}
+
+#endif
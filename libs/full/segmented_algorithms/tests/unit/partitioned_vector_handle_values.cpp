@@ -12,8 +12,10 @@
 #include <hpx/include/runtime.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
+#include <random>
 #include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -106,6 +108,38 @@ void handle_values_tests_distributed_access(hpx::partitioned_vector<T>& v)
     compare_vectors(values2, result2);
 }
 
+template <typename T>
+void handle_values_tests_random_access(hpx::partitioned_vector<T>& v)
+{
+    fill_vector(v, T(42));
+
+    // visit every element once in random order, which mixes the partitions
+    std::vector<std::size_t> positions(v.size());
+    fill_vector(positions, std::size_t(0), std::size_t(1));
+    std::shuffle(positions.begin(), positions.end(), std::mt19937{42});
+
+    std::vector<T> values(positions.size());
+    fill_vector(values, T(1), T(1));
+
+    v.set_values(hpx::launch::sync, positions, values);
+    std::vector<T> result = v.get_values(hpx::launch::sync, positions);
+
+    compare_vectors(values, result);
+
+    for (std::size_t i = 0; i != positions.size(); ++i)
+    {
+        HPX_TEST_EQ(v.get_value(hpx::launch::sync, positions[i]), values[i]);
+    }
+
+    // positions may be requested more than once
+    std::vector<std::size_t> const repeated = {
+        positions[0], positions[1], positions[0], positions[2]};
+    std::vector<T> const expected = {
+        values[0], values[1], values[0], values[2]};
+
+    compare_vectors(expected, v.get_values(hpx::launch::sync, repeated));
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 template <typename T, typename DistPolicy>
@@ -121,6 +155,11 @@ void handle_values_tests_with_policy(
         hpx::partitioned_vector<T> v(size, policy);
         handle_values_tests_distributed_access(v);
     }
+
+    {
+        hpx::partitioned_vector<T> v(size, policy);
+        handle_values_tests_random_access(v);
+    }
 }
 
 template <typename T>
@@ -0,0 +1,179 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_partition.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+struct less_than
+{
+    int bound = 0;
+
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return static_cast<int>(val) < bound;
+    }
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & bound;
+        // clang-format on
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v, std::vector<T> const& values)
+{
+    auto val = values.begin();
+    for (auto it = v.begin(); it != v.end(); ++it, ++val)
+        *it = *val;
+}
+
+template <typename T>
+std::vector<T> get_values(hpx::partitioned_vector<T> const& v)
+{
+    return std::vector<T>(v.begin(), v.end());
+}
+
+template <typename T>
+std::vector<T> make_values(std::size_t size)
+{
+    std::vector<T> values;
+    values.reserve(size);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        values.push_back(T((i * 7) % 11));
+    }
+    return values;
+}
+
+// The segmented partition is stable, the result has to match
+// std::stable_partition exactly.
+template <typename T, typename It>
+void check_result(hpx::partitioned_vector<T> const& v, It it,
+    std::vector<T> const& values, less_than pred)
+{
+    std::vector<T> expected = values;
+    auto const mid =
+        std::stable_partition(expected.begin(), expected.end(), pred);
+
+    HPX_TEST(it == std::next(v.begin(), std::distance(expected.begin(), mid)));
+    HPX_TEST(get_values(v) == expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename DistPolicy>
+void partition_algo_tests(
+    std::size_t size, ExPolicy const& policy, DistPolicy const& dist_policy)
+{
+    std::vector<T> const values = make_values<T>(size);
+    hpx::partitioned_vector<T> v(size, dist_policy);
+
+    // no element, some elements and all elements are selected
+    for (int bound : {0, 5, 11})
+    {
+        less_than const pred{bound};
+
+        fill_vector(v, values);
+        auto it = hpx::partition(policy, v.begin(), v.end(), pred);
+        check_result(v, it, values, pred);
+
+        fill_vector(v, values);
+        it = hpx::stable_partition(policy, v.begin(), v.end(), pred);
+        check_result(v, it, values, pred);
+    }
+}
+
+template <typename T, typename ExPolicy, typename DistPolicy>
+void partition_algo_tests_async(
+    std::size_t size, ExPolicy const& policy, DistPolicy const& dist_policy)
+{
+    using hpx::execution::task;
+
+    std::vector<T> const values = make_values<T>(size);
+    hpx::partitioned_vector<T> v(size, dist_policy);
+
+    less_than const pred{5};
+
+    fill_vector(v, values);
+    auto f = hpx::partition(policy(task), v.begin(), v.end(), pred);
+    check_result(v, f.get(), values, pred);
+
+    fill_vector(v, values);
+    f = hpx::stable_partition(policy(task), v.begin(), v.end(), pred);
+    check_result(v, f.get(), values, pred);
+}
+
+template <typename T, typename DistPolicy>
+void partition_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    {
+        std::vector<T> const values = make_values<T>(size);
+        hpx::partitioned_vector<T> v(size, policy);
+
+        less_than const pred{5};
+
+        fill_vector(v, values);
+        auto it = hpx::partition(v.begin(), v.end(), pred);
+        check_result(v, it, values, pred);
+    }
+
+    partition_algo_tests<T>(size, seq, policy);
+    partition_algo_tests<T>(size, par, policy);
+
+    partition_algo_tests_async<T>(size, seq, policy);
+    partition_algo_tests_async<T>(size, par, policy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void partition_tests()
+{
+    std::size_t const length = 37;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    partition_tests_with_policy<T>(length, hpx::container_layout);
+    partition_tests_with_policy<T>(length, hpx::container_layout(3));
+    partition_tests_with_policy<T>(
+        length, hpx::container_layout(3, localities));
+    partition_tests_with_policy<T>(length, hpx::container_layout(localities));
+
+    // every partition holds a single element
+    partition_tests_with_policy<T>(7, hpx::container_layout(7, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    partition_tests<double>();
+    partition_tests<int>();
+
+    return hpx::util::report_errors();
+}
+
+#endif
@@ -0,0 +1,190 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_remove.hpp>
+#include <hpx/include/parallel_unique.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+struct is_odd
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return static_cast<int>(val) % 2 != 0;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void fill_vector(hpx::partitioned_vector<T>& v, std::vector<T> const& values)
+{
+    auto val = values.begin();
+    for (auto it = v.begin(); it != v.end(); ++it, ++val)
+        *it = *val;
+}
+
+template <typename T>
+std::vector<T> get_values(hpx::partitioned_vector<T> const& v)
+{
+    return std::vector<T>(v.begin(), v.end());
+}
+
+template <typename T>
+std::vector<T> make_values(std::size_t size)
+{
+    // runs of equal values of different lengths, some of them spanning
+    // several partitions
+    std::vector<T> values;
+    values.reserve(size);
+    for (int run = 0; values.size() != size; ++run)
+    {
+        std::size_t const count =
+            (std::min)(std::size_t(run % 6 + 1), size - values.size());
+        values.insert(values.end(), count, T(run % 4));
+    }
+    return values;
+}
+
+template <typename T, typename It>
+void check_result(hpx::partitioned_vector<T> const& v, It it,
+    std::vector<T> const& expected, std::size_t count)
+{
+    HPX_TEST(it == std::next(v.begin(), count));
+
+    std::vector<T> const values = get_values(v);
+    HPX_TEST(std::equal(values.begin(), std::next(values.begin(), count),
+        expected.begin()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename DistPolicy>
+void remove_algo_tests(
+    std::size_t size, ExPolicy const& policy, DistPolicy const& dist_policy)
+{
+    std::vector<T> const values = make_values<T>(size);
+    hpx::partitioned_vector<T> v(size, dist_policy);
+
+    {
+        fill_vector(v, values);
+        std::vector<T> expected = values;
+        std::size_t const count = std::distance(expected.begin(),
+            std::remove_if(expected.begin(), expected.end(), is_odd()));
+
+        auto it = hpx::remove_if(policy, v.begin(), v.end(), is_odd());
+        check_result(v, it, expected, count);
+    }
+
+    {
+        fill_vector(v, values);
+        std::vector<T> expected = values;
+        std::size_t const count = std::distance(expected.begin(),
+            std::remove(expected.begin(), expected.end(), T(2)));
+
+        auto it = hpx::remove(policy, v.begin(), v.end(), T(2));
+        check_result(v, it, expected, count);
+    }
+
+    {
+        fill_vector(v, values);
+        std::vector<T> expected = values;
+        std::size_t const count = std::distance(
+            expected.begin(), std::unique(expected.begin(), expected.end()));
+
+        auto it = hpx::unique(policy, v.begin(), v.end());
+        check_result(v, it, expected, count);
+    }
+}
+
+template <typename T, typename ExPolicy, typename DistPolicy>
+void remove_algo_tests_async(
+    std::size_t size, ExPolicy const& policy, DistPolicy const& dist_policy)
+{
+    using hpx::execution::task;
+
+    std::vector<T> const values = make_values<T>(size);
+    hpx::partitioned_vector<T> v(size, dist_policy);
+
+    {
+        fill_vector(v, values);
+        std::vector<T> expected = values;
+        std::size_t const count = std::distance(expected.begin(),
+            std::remove_if(expected.begin(), expected.end(), is_odd()));
+
+        auto f = hpx::remove_if(policy(task), v.begin(), v.end(), is_odd());
+        check_result(v, f.get(), expected, count);
+    }
+
+    {
+        fill_vector(v, values);
+        std::vector<T> expected = values;
+        std::size_t const count = std::distance(
+            expected.begin(), std::unique(expected.begin(), expected.end()));
+
+        auto f = hpx::unique(policy(task), v.begin(), v.end());
+        check_result(v, f.get(), expected, count);
+    }
+}
+
+template <typename T, typename DistPolicy>
+void remove_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    remove_algo_tests<T>(size, seq, policy);
+    remove_algo_tests<T>(size, par, policy);
+
+    remove_algo_tests_async<T>(size, seq, policy);
+    remove_algo_tests_async<T>(size, par, policy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void remove_tests()
+{
+    std::size_t const length = 37;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    remove_tests_with_policy<T>(length, hpx::container_layout);
+    remove_tests_with_policy<T>(length, hpx::container_layout(3));
+    remove_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    remove_tests_with_policy<T>(length, hpx::container_layout(localities));
+
+    // every partition holds a single element
+    remove_tests_with_policy<T>(7, hpx::container_layout(7, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    remove_tests<double>();
+    remove_tests<int>();
+
+    return hpx::util::report_errors();
+}
+
+#endif
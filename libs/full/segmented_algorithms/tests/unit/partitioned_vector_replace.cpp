@@ -0,0 +1,148 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_replace.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+struct is_odd
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return static_cast<int>(val) % 2 != 0;
+    }
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void iota_vector(hpx::partitioned_vector<T>& v)
+{
+    int val = 0;
+    for (auto it = v.begin(); it != v.end(); ++it)
+        *it = T(val++ % 5);
+}
+
+template <typename T>
+std::vector<T> get_values(hpx::partitioned_vector<T> const& v)
+{
+    return std::vector<T>(v.begin(), v.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename DistPolicy>
+void replace_algo_tests(
+    std::size_t size, ExPolicy const& policy, DistPolicy const& dist_policy)
+{
+    hpx::partitioned_vector<T> v(size, dist_policy);
+
+    {
+        iota_vector(v);
+        std::vector<T> expected = get_values(v);
+        std::replace(expected.begin(), expected.end(), T(3), T(42));
+
+        hpx::replace(policy, v.begin(), v.end(), T(3), T(42));
+        HPX_TEST(get_values(v) == expected);
+    }
+
+    {
+        iota_vector(v);
+        std::vector<T> expected = get_values(v);
+        std::replace_if(std::next(expected.begin()), std::prev(expected.end()),
+            is_odd(), T(42));
+
+        hpx::replace_if(policy, std::next(v.begin()), std::prev(v.end()),
+            is_odd(), T(42));
+        HPX_TEST(get_values(v) == expected);
+    }
+}
+
+template <typename T, typename ExPolicy, typename DistPolicy>
+void replace_algo_tests_async(
+    std::size_t size, ExPolicy const& policy, DistPolicy const& dist_policy)
+{
+    using hpx::execution::task;
+
+    hpx::partitioned_vector<T> v(size, dist_policy);
+
+    {
+        iota_vector(v);
+        std::vector<T> expected = get_values(v);
+        std::replace(expected.begin(), expected.end(), T(3), T(42));
+
+        auto f = hpx::replace(policy(task), v.begin(), v.end(), T(3), T(42));
+        f.get();
+        HPX_TEST(get_values(v) == expected);
+    }
+
+    {
+        iota_vector(v);
+        std::vector<T> expected = get_values(v);
+        std::replace_if(expected.begin(), expected.end(), is_odd(), T(42));
+
+        auto f =
+            hpx::replace_if(policy(task), v.begin(), v.end(), is_odd(), T(42));
+        f.get();
+        HPX_TEST(get_values(v) == expected);
+    }
+}
+
+template <typename T, typename DistPolicy>
+void replace_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    replace_algo_tests<T>(size, seq, policy);
+    replace_algo_tests<T>(size, par, policy);
+
+    replace_algo_tests_async<T>(size, seq, policy);
+    replace_algo_tests_async<T>(size, par, policy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void replace_tests()
+{
+    std::size_t const length = 37;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    replace_tests_with_policy<T>(length, hpx::container_layout);
+    replace_tests_with_policy<T>(length, hpx::container_layout(3));
+    replace_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    replace_tests_with_policy<T>(length, hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    replace_tests<double>();
+    replace_tests<int>();
+
+    return hpx::util::report_errors();
+}
+
+#endif
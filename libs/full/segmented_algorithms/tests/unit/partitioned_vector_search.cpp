@@ -0,0 +1,137 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_search.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void iota_vector(hpx::partitioned_vector<T>& v)
+{
+    int val = 0;
+    for (auto it = v.begin(); it != v.end(); ++it)
+        *it = T(val++ % 11);
+}
+
+template <typename T>
+std::vector<T> get_values(hpx::partitioned_vector<T> const& v)
+{
+    return std::vector<T>(v.begin(), v.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename DistPolicy>
+void search_algo_tests(
+    std::size_t size, ExPolicy const& policy, DistPolicy const& dist_policy)
+{
+    hpx::partitioned_vector<T> v(size, dist_policy);
+    iota_vector(v);
+
+    std::vector<T> const values = get_values(v);
+
+    // patterns starting at every position, most of them spanning the
+    // boundary between two partitions for some of the layouts
+    for (std::size_t pattern_size : {1, 3, 7})
+    {
+        for (std::size_t pos = 0; pos + pattern_size <= size; pos += 5)
+        {
+            std::vector<T> pattern(std::next(values.begin(), pos),
+                std::next(values.begin(), pos + pattern_size));
+
+            auto expected = std::search(
+                values.begin(), values.end(), pattern.begin(), pattern.end());
+
+            auto it = hpx::search(
+                policy, v.begin(), v.end(), pattern.begin(), pattern.end());
+            HPX_TEST(it ==
+                std::next(v.begin(), std::distance(values.begin(), expected)));
+        }
+    }
+
+    // the pattern is not found
+    std::vector<T> pattern = {T(1), T(3)};
+    auto it =
+        hpx::search(policy, v.begin(), v.end(), pattern.begin(), pattern.end());
+    HPX_TEST(it == v.end());
+
+    // a segmented pattern
+    hpx::partitioned_vector<T> p(5, dist_policy);
+    std::copy(std::next(values.begin(), 20), std::next(values.begin(), 25),
+        p.begin());
+
+    it = hpx::search(policy, v.begin(), v.end(), p.begin(), p.end());
+    HPX_TEST(it == std::next(v.begin(), 9));
+}
+
+template <typename T, typename ExPolicy, typename DistPolicy>
+void search_algo_tests_async(
+    std::size_t size, ExPolicy const& policy, DistPolicy const& dist_policy)
+{
+    using hpx::execution::task;
+
+    hpx::partitioned_vector<T> v(size, dist_policy);
+    iota_vector(v);
+
+    std::vector<T> pattern = {T(8), T(9), T(10), T(0), T(1)};
+    auto f = hpx::search(
+        policy(task), v.begin(), v.end(), pattern.begin(), pattern.end());
+    HPX_TEST(f.get() == std::next(v.begin(), 8));
+}
+
+template <typename T, typename DistPolicy>
+void search_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    search_algo_tests<T>(size, seq, policy);
+    search_algo_tests<T>(size, par, policy);
+
+    search_algo_tests_async<T>(size, seq, policy);
+    search_algo_tests_async<T>(size, par, policy);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void search_tests()
+{
+    std::size_t const length = 37;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    search_tests_with_policy<T>(length, hpx::container_layout);
+    search_tests_with_policy<T>(length, hpx::container_layout(3));
+    search_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    search_tests_with_policy<T>(length, hpx::container_layout(localities));
+
+    // partitions which are smaller than the pattern
+    search_tests_with_policy<T>(length, hpx::container_layout(12, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    search_tests<double>();
+    search_tests<int>();
+
+    return hpx::util::report_errors();
+}
+
+#endif
@@ -0,0 +1,167 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_generate.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+struct random_fill
+{
+    random_fill()
+      : gen(std::random_device{}())
+      , dist(0, 1000)
+    {
+    }
+
+    T operator()()
+    {
+        return static_cast<T>(dist(gen));
+    }
+
+    std::mt19937 gen;
+    std::uniform_int_distribution<> dist;
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+// compares the tens only, which leaves the order of many elements to the
+// stability of the sort
+struct compare_tens
+{
+    template <typename T>
+    bool operator()(T const& lhs, T const& rhs) const
+    {
+        return static_cast<int>(lhs) / 10 < static_cast<int>(rhs) / 10;
+    }
+};
+
+template <typename T>
+std::vector<T> get_values(hpx::partitioned_vector<T> const& v)
+{
+    return std::vector<T>(v.begin(), v.end());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename ExPolicy, typename Comp>
+void sort_tests(ExPolicy const& policy, hpx::partitioned_vector<T>& v,
+    std::size_t first, std::size_t last, Comp comp)
+{
+    hpx::generate(hpx::execution::par, v.begin(), v.end(), random_fill<T>());
+
+    std::vector<T> expected = get_values(v);
+    std::sort(expected.begin() + first, expected.begin() + last, comp);
+
+    hpx::sort(policy, v.begin() + first, v.begin() + last, comp);
+    HPX_TEST(get_values(v) == expected);
+
+    hpx::generate(hpx::execution::par, v.begin(), v.end(), random_fill<T>());
+
+    expected = get_values(v);
+    std::stable_sort(
+        expected.begin() + first, expected.begin() + last, compare_tens());
+
+    hpx::stable_sort(
+        policy, v.begin() + first, v.begin() + last, compare_tens());
+    HPX_TEST(get_values(v) == expected);
+}
+
+template <typename T, typename ExPolicy, typename Comp>
+void sort_tests_async(ExPolicy const& policy, hpx::partitioned_vector<T>& v,
+    std::size_t first, std::size_t last, Comp comp)
+{
+    hpx::generate(hpx::execution::par, v.begin(), v.end(), random_fill<T>());
+
+    std::vector<T> expected = get_values(v);
+    std::sort(expected.begin() + first, expected.begin() + last, comp);
+
+    hpx::future<void> f =
+        hpx::sort(policy, v.begin() + first, v.begin() + last, comp);
+    f.get();
+    HPX_TEST(get_values(v) == expected);
+
+    hpx::generate(hpx::execution::par, v.begin(), v.end(), random_fill<T>());
+
+    expected = get_values(v);
+    std::stable_sort(
+        expected.begin() + first, expected.begin() + last, compare_tens());
+
+    f = hpx::stable_sort(
+        policy, v.begin() + first, v.begin() + last, compare_tens());
+    f.get();
+    HPX_TEST(get_values(v) == expected);
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    hpx::partitioned_vector<T> v(size, policy);
+
+    for (auto range : {std::make_pair(std::size_t(0), size),
+             std::make_pair(std::size_t(3), size - 5)})
+    {
+        sort_tests(seq, v, range.first, range.second, std::less<T>());
+        sort_tests(par, v, range.first, range.second, std::greater<T>());
+
+        sort_tests_async(
+            seq(task), v, range.first, range.second, std::less<T>());
+        sort_tests_async(
+            par(task), v, range.first, range.second, std::greater<T>());
+    }
+
+    // the sequential overloads
+    hpx::generate(hpx::execution::par, v.begin(), v.end(), random_fill<T>());
+
+    std::vector<T> expected = get_values(v);
+    std::sort(expected.begin(), expected.end());
+
+    hpx::sort(v.begin(), v.end());
+    HPX_TEST(get_values(v) == expected);
+}
+
+template <typename T>
+void sort_tests()
+{
+    std::size_t const length = 1007;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sort_tests_with_policy<T>(length, hpx::container_layout);
+    sort_tests_with_policy<T>(length, hpx::container_layout(3));
+    sort_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    sort_tests_with_policy<T>(length, hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return hpx::util::report_errors();
+}
+#endif
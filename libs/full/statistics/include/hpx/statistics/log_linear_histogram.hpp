@@ -0,0 +1,312 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#if defined(HPX_MSVC)
+#include <intrin.h>
+#endif
+
+namespace hpx::util {
+
+    namespace detail {
+
+        // index of the most significant bit set, value must not be zero
+        inline std::uint32_t most_significant_bit(std::uint64_t value) noexcept
+        {
+#if defined(HPX_GCC_VERSION) || defined(HPX_CLANG_VERSION)
+            return 63 - static_cast<std::uint32_t>(__builtin_clzll(value));
+#elif defined(HPX_MSVC) && defined(_WIN64)
+            unsigned long index = 0;
+            _BitScanReverse64(&index, value);
+            return static_cast<std::uint32_t>(index);
+#else
+            std::uint32_t result = 0;
+            for (std::uint32_t shift = 32; shift != 0; shift /= 2)
+            {
+                if (value >> shift)
+                {
+                    value >>= shift;
+                    result += shift;
+                }
+            }
+            return result;
+#endif
+        }
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A histogram of non-negative integer values using log-linear buckets
+    // (similar to HdrHistogram). The first 2^significant_bits values have a
+    // bucket each, every following power of two range is split into
+    // 2^(significant_bits - 1) buckets of equal width. Recording a value is
+    // O(1) and the relative error of any reported value is bounded by
+    // 2^-(significant_bits - 1), independently of the magnitude of the value.
+    //
+    // Histograms with the same number of significant bits can be merged
+    // exactly, which allows to combine the histograms collected on several
+    // localities. Negative values are recorded as zero.
+    class log_linear_histogram
+    {
+    public:
+        static constexpr std::uint32_t default_significant_bits = 7;
+        static constexpr std::uint32_t max_significant_bits = 16;
+
+        explicit log_linear_histogram(
+            std::uint32_t significant_bits = default_significant_bits)
+          : significant_bits_(significant_bits)
+          , count_(0)
+          , min_((std::numeric_limits<std::int64_t>::max)())
+          , max_(0)
+        {
+            if (significant_bits == 0 ||
+                significant_bits > max_significant_bits)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "log_linear_histogram::log_linear_histogram",
+                    "the number of significant bits must be in the range "
+                    "[1, {1}], given: {2}",
+                    max_significant_bits, significant_bits);
+            }
+
+            // values have at most 63 bits
+            counts_.resize(sub_buckets() +
+                (63 - significant_bits_) * (sub_buckets() / 2));
+        }
+
+        // record the given value (count times)
+        void add(std::int64_t value, std::uint64_t count = 1) noexcept
+        {
+            if (value < 0)
+            {
+                value = 0;
+            }
+
+            counts_[bucket_index(value)] += count;
+            count_ += count;
+            min_ = (std::min)(min_, value);
+            max_ = (std::max)(max_, value);
+        }
+
+        // add all values recorded by the given histogram
+        void merge(log_linear_histogram const& rhs)
+        {
+            if (rhs.significant_bits_ != significant_bits_)
+            {
+                HPX_THROW_EXCEPTION(hpx::error::bad_parameter,
+                    "log_linear_histogram::merge",
+                    "histograms with different numbers of significant bits "
+                    "can't be merged: {1} != {2}",
+                    significant_bits_, rhs.significant_bits_);
+            }
+
+            if (rhs.count_ == 0)
+            {
+                return;
+            }
+
+            for (std::size_t i = 0; i != counts_.size(); ++i)
+            {
+                counts_[i] += rhs.counts_[i];
+            }
+            count_ += rhs.count_;
+            min_ = (std::min)(min_, rhs.min_);
+            max_ = (std::max)(max_, rhs.max_);
+        }
+
+        void reset() noexcept
+        {
+            std::fill(counts_.begin(), counts_.end(), 0);
+            count_ = 0;
+            min_ = (std::numeric_limits<std::int64_t>::max)();
+            max_ = 0;
+        }
+
+        // Return the smallest value such that the given percentage (in the
+        // range [0, 100]) of all recorded values is not larger than it, up to
+        // the precision of the histogram. Returns zero if the histogram is
+        // empty.
+        std::int64_t value_at_percentile(double percentile) const noexcept
+        {
+            if (count_ == 0)
+            {
+                return 0;
+            }
+
+            percentile = (std::min)((std::max)(percentile, 0.0), 100.0);
+            auto target = static_cast<std::uint64_t>(
+                std::ceil(percentile / 100.0 * static_cast<double>(count_)));
+            target = (std::max)(target, std::uint64_t(1));
+
+            std::uint64_t total = 0;
+            for (std::size_t i = 0; i != counts_.size(); ++i)
+            {
+                total += counts_[i];
+                if (total >= target)
+                {
+                    return (std::max)(min_,
+                        (std::min)(max_, highest_equivalent_value(i)));
+                }
+            }
+            return max_;
+        }
+
+        std::uint32_t significant_bits() const noexcept
+        {
+            return significant_bits_;
+        }
+
+        // the number of recorded values
+        std::uint64_t count() const noexcept
+        {
+            return count_;
+        }
+
+        // the smallest and largest recorded value (zero if empty)
+        std::int64_t min() const noexcept
+        {
+            return count_ == 0 ? 0 : min_;
+        }
+        std::int64_t max() const noexcept
+        {
+            return max_;
+        }
+
+        std::size_t num_buckets() const noexcept
+        {
+            return counts_.size();
+        }
+
+        std::uint64_t bucket_count(std::size_t index) const noexcept
+        {
+            return counts_[index];
+        }
+
+        // the index of the bucket the given (non-negative) value is recorded in
+        std::size_t bucket_index(std::int64_t value) const noexcept
+        {
+            auto const v = static_cast<std::uint64_t>(value);
+            if (v < sub_buckets())
+            {
+                return static_cast<std::size_t>(v);
+            }
+
+            // the top significant_bits bits of the value select the bucket
+            // inside its power of two range
+            std::uint32_t const shift =
+                detail::most_significant_bit(v) - (significant_bits_ - 1);
+            std::size_t const half = sub_buckets() / 2;
+            return sub_buckets() + (shift - 1) * half +
+                static_cast<std::size_t>(v >> shift) - half;
+        }
+
+        // the range of values recorded in the bucket with the given index
+        std::int64_t lowest_equivalent_value(std::size_t index) const noexcept
+        {
+            if (index < sub_buckets())
+            {
+                return static_cast<std::int64_t>(index);
+            }
+
+            std::size_t const half = sub_buckets() / 2;
+            std::size_t const shift = (index - sub_buckets()) / half + 1;
+            std::uint64_t const mantissa = half + (index - sub_buckets()) % half;
+            return static_cast<std::int64_t>(mantissa << shift);
+        }
+
+        std::int64_t highest_equivalent_value(std::size_t index) const noexcept
+        {
+            if (index < sub_buckets())
+            {
+                return static_cast<std::int64_t>(index);
+            }
+
+            std::size_t const half = sub_buckets() / 2;
+            std::size_t const shift = (index - sub_buckets()) / half + 1;
+            return lowest_equivalent_value(index) +
+                static_cast<std::int64_t>((std::uint64_t(1) << shift) - 1);
+        }
+
+        // Store the histogram in a compact form suitable for sending it to
+        // other localities: the number of significant bits, the number of
+        // values, the minimum and maximum value, followed by pairs of bucket
+        // index and count for all non-empty buckets.
+        std::vector<std::int64_t> save() const
+        {
+            std::vector<std::int64_t> data = {
+                static_cast<std::int64_t>(significant_bits_),
+                static_cast<std::int64_t>(count_), min(), max_};
+
+            for (std::size_t i = 0; i != counts_.size(); ++i)
+            {
+                if (counts_[i] != 0)
+                {
+                    data.push_back(static_cast<std::int64_t>(i));
+                    data.push_back(static_cast<std::int64_t>(counts_[i]));
+                }
+            }
+            return data;
+        }
+
+        // Add the values stored in the given data (as created by save()) to
+        // this histogram, returns false if the data is malformed or was
+        // created using a different number of significant bits.
+        bool merge_saved(std::vector<std::int64_t> const& data) noexcept
+        {
+            if (data.size() < 4 || data.size() % 2 != 0 ||
+                data[0] != static_cast<std::int64_t>(significant_bits_))
+            {
+                return false;
+            }
+
+            for (std::size_t i = 4; i != data.size(); i += 2)
+            {
+                if (data[i] < 0 ||
+                    static_cast<std::size_t>(data[i]) >= counts_.size())
+                {
+                    return false;
+                }
+            }
+
+            if (data[1] == 0)
+            {
+                return true;
+            }
+
+            for (std::size_t i = 4; i != data.size(); i += 2)
+            {
+                counts_[static_cast<std::size_t>(data[i])] +=
+                    static_cast<std::uint64_t>(data[i + 1]);
+            }
+            count_ += static_cast<std::uint64_t>(data[1]);
+            min_ = (std::min)(min_, data[2]);
+            max_ = (std::max)(max_, data[3]);
+            return true;
+        }
+
+    private:
+        std::size_t sub_buckets() const noexcept
+        {
+            return std::size_t(1) << significant_bits_;
+        }
+
+        std::uint32_t significant_bits_;
+        std::uint64_t count_;
+        std::int64_t min_;
+        std::int64_t max_;
+        std::vector<std::uint64_t> counts_;
+    };
+}    // namespace hpx::util
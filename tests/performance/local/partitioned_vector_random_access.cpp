@@ -0,0 +1,196 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure gather and scatter operations using random indices on a
+// partitioned_vector, comparing one request per element (get_value/set_value)
+// with the bulk operations (get_values/set_values) issuing one request per
+// partition.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/chrono.hpp>
+#include <hpx/future.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/iostream.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+int test_count = 10;
+
+///////////////////////////////////////////////////////////////////////////////
+std::uint64_t gather_elementwise(hpx::partitioned_vector<int> const& v,
+    std::vector<std::size_t> const& indices)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<hpx::future<int>> values;
+        values.reserve(indices.size());
+        for (std::size_t index : indices)
+        {
+            values.push_back(v.get_value(index));
+        }
+        hpx::wait_all(values);
+    }
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+std::uint64_t gather_bulk(hpx::partitioned_vector<int> const& v,
+    std::vector<std::size_t> const& indices)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        v.get_values(indices).get();
+    }
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+std::uint64_t scatter_elementwise(hpx::partitioned_vector<int>& v,
+    std::vector<std::size_t> const& indices, std::vector<int> const& values)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        std::vector<hpx::future<void>> results;
+        results.reserve(indices.size());
+        for (std::size_t j = 0; j != indices.size(); ++j)
+        {
+            results.push_back(v.set_value(indices[j], values[j]));
+        }
+        hpx::wait_all(results);
+    }
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+std::uint64_t scatter_bulk(hpx::partitioned_vector<int>& v,
+    std::vector<std::size_t> const& indices, std::vector<int> const& values)
+{
+    std::uint64_t start = hpx::chrono::high_resolution_clock::now();
+
+    for (int i = 0; i != test_count; ++i)
+    {
+        v.set_values(indices, values).get();
+    }
+
+    return (hpx::chrono::high_resolution_clock::now() - start) / test_count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t vector_size = vm["vector_size"].as<std::size_t>();
+    std::size_t num_indices = vm["num_indices"].as<std::size_t>();
+    std::size_t num_partitions = vm["num_partitions"].as<std::size_t>();
+    test_count = vm["test_count"].as<int>();
+
+    unsigned int seed = std::random_device{}();
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    // verify that input is within domain of program
+    if (test_count <= 0)
+    {
+        hpx::cout << "test_count cannot be zero or negative...\n" << std::flush;
+        return hpx::finalize();
+    }
+    if (vector_size == 0 || num_partitions == 0)
+    {
+        hpx::cout << "vector_size and num_partitions cannot be zero...\n"
+                  << std::flush;
+        return hpx::finalize();
+    }
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    hpx::partitioned_vector<int> v(
+        vector_size, 0, hpx::container_layout(num_partitions, localities));
+
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<std::size_t> dist(0, vector_size - 1);
+
+    std::vector<std::size_t> indices(num_indices);
+    std::vector<int> values(num_indices);
+    for (std::size_t i = 0; i != num_indices; ++i)
+    {
+        indices[i] = dist(gen);
+        values[i] = static_cast<int>(i);
+    }
+
+    double const per_element = 1.0 / static_cast<double>(num_indices);
+
+    hpx::cout << "localities: " << localities.size()
+              << ", partitions: " << num_partitions
+              << ", indices: " << num_indices << "\n";
+    hpx::cout << "gather, get_value [ns/element]: "
+              << gather_elementwise(v, indices) * per_element << "\n";
+    hpx::cout << "gather, get_values [ns/element]: "
+              << gather_bulk(v, indices) * per_element << "\n";
+    hpx::cout << "scatter, set_value [ns/element]: "
+              << scatter_elementwise(v, indices, values) * per_element << "\n";
+    hpx::cout << "scatter, set_values [ns/element]: "
+              << scatter_bulk(v, indices, values) * per_element << "\n"
+              << std::flush;
+
+    return hpx::finalize();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    //initialize program
+    std::vector<std::string> const cfg = {"hpx.os_threads=all"};
+
+    hpx::program_options::options_description cmdline(
+        "usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    cmdline.add_options()
+        ("vector_size"
+        , hpx::program_options::value<std::size_t>()->default_value(1000000)
+        , "size of vector (default: 1000000)")
+
+        ("num_indices"
+        , hpx::program_options::value<std::size_t>()->default_value(10000)
+        , "number of random indices accessed per test (default: 10000)")
+
+        ("num_partitions"
+        , hpx::program_options::value<std::size_t>()->default_value(16)
+        , "number of partitions of the vector (default: 16)")
+
+        ("test_count"
+        , hpx::program_options::value<int>()->default_value(10)
+        , "number of tests to be averaged (default: 10)")
+
+        ("seed,s"
+        , hpx::program_options::value<unsigned int>()
+        , "the random number generator seed to use for this run")
+        ;
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = cmdline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
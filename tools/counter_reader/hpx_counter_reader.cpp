@@ -0,0 +1,296 @@
+//  Copyright (c) 2025 The STE||AR-Group
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Convert the files written by --hpx:print-counter-format=binary (see
+// hpx::performance_counters::binary_counter_writer) to CSV.
+//
+//     hpx_counter_reader [options] <file>
+//
+//     --list              list the counters stored in the file
+//     --counter=<arg>     print the given counter only (index or full
+//                         name), can be specified more than once
+//     --no-header         do not print the CSV header
+//     --help              print this help
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+    constexpr char const magic[] = "HPXCNT01";
+    constexpr std::uint32_t row_group_marker = 0x50524752;
+
+    struct counter
+    {
+        std::string name;
+        std::string unit;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T>
+    void read_binary(std::istream& in, T* data, std::size_t count)
+    {
+        in.read(reinterpret_cast<char*>(data),
+            static_cast<std::streamsize>(count * sizeof(T)));
+        if (!in)
+        {
+            throw std::runtime_error("unexpected end of file");
+        }
+    }
+
+    std::uint32_t read_uint32(std::istream& in)
+    {
+        std::uint32_t value = 0;
+        read_binary(in, &value, 1);
+        return value;
+    }
+
+    std::string read_string(std::istream& in)
+    {
+        std::string value(read_uint32(in), '\0');
+        read_binary(in, value.data(), value.size());
+        return value;
+    }
+
+    std::vector<counter> read_header(std::istream& in)
+    {
+        char buffer[sizeof(magic) - 1];
+        read_binary(in, buffer, sizeof(buffer));
+        if (std::memcmp(buffer, magic, sizeof(buffer)) != 0)
+        {
+            throw std::runtime_error("not a performance counter file");
+        }
+        if (read_uint32(in) != 1)
+        {
+            throw std::runtime_error(
+                "the file was written on a machine with different byte order");
+        }
+
+        std::vector<counter> counters(read_uint32(in));
+        for (counter& c : counters)
+        {
+            c.name = read_string(in);
+            c.unit = read_string(in);
+        }
+        return counters;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // the index of a counter is either given directly or is found by name
+    std::size_t find_counter(
+        std::vector<counter> const& counters, std::string const& arg)
+    {
+        for (std::size_t i = 0; i != counters.size(); ++i)
+        {
+            if (counters[i].name == arg)
+            {
+                return i;
+            }
+        }
+
+        char* end = nullptr;
+        unsigned long const index = std::strtoul(arg.c_str(), &end, 10);
+        if (arg.empty() || *end != '\0' || index >= counters.size())
+        {
+            throw std::runtime_error("unknown counter: " + arg);
+        }
+        return static_cast<std::size_t>(index);
+    }
+
+    void print_csv_name(std::ostream& out, std::string const& name)
+    {
+        if (name.find_first_of(",\"") == std::string::npos)
+        {
+            out << name;
+            return;
+        }
+
+        out << '"';
+        for (char const c : name)
+        {
+            if (c == '"')
+            {
+                out << '"';
+            }
+            out << c;
+        }
+        out << '"';
+    }
+
+    // print all rows, reading only the columns of the selected counters
+    void print_rows(std::istream& in, std::size_t num_counters,
+        std::vector<std::size_t> const& selected)
+    {
+        std::vector<std::uint64_t> times;
+        std::vector<std::vector<double>> values(selected.size());
+
+        while (in.peek() != std::char_traits<char>::eof())
+        {
+            if (read_uint32(in) != row_group_marker)
+            {
+                throw std::runtime_error("corrupt row group");
+            }
+
+            std::size_t const rows = read_uint32(in);
+            times.resize(rows);
+            read_binary(in, times.data(), rows);
+
+            std::streamoff const column_size =
+                static_cast<std::streamoff>(rows * sizeof(double));
+            std::streampos const columns = in.tellg();
+            for (std::size_t i = 0; i != selected.size(); ++i)
+            {
+                values[i].resize(rows);
+                in.seekg(columns +
+                    static_cast<std::streamoff>(selected[i]) * column_size);
+                read_binary(in, values[i].data(), rows);
+            }
+            in.seekg(columns +
+                static_cast<std::streamoff>(num_counters) * column_size);
+
+            for (std::size_t row = 0; row != rows; ++row)
+            {
+                std::cout << times[row];
+                for (std::vector<double> const& column : values)
+                {
+                    std::cout << ',';
+                    if (!std::isnan(column[row]))
+                    {
+                        std::cout << column[row];
+                    }
+                }
+                std::cout << '\n';
+            }
+        }
+    }
+
+    void print_help(char const* name)
+    {
+        std::cout
+            << "Usage: " << name << " [options] <file>\n"
+            << "\n"
+            << "Convert a file written with "
+               "--hpx:print-counter-format=binary to CSV\n"
+            << "\n"
+            << "  --list              list the counters stored in the file\n"
+            << "  --counter=<arg>     print the given counter only (index or "
+               "full name),\n"
+            << "                      can be specified more than once\n"
+            << "  --no-header         do not print the CSV header\n"
+            << "  --help              print this help\n";
+    }
+}    // namespace
+
+int main(int argc, char* argv[])
+{
+    std::string filename;
+    std::vector<std::string> counter_args;
+    bool list = false;
+    bool header = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string const arg = argv[i];
+        if (arg == "--help" || arg == "-h")
+        {
+            print_help(argv[0]);
+            return 0;
+        }
+        else if (arg == "--list")
+        {
+            list = true;
+        }
+        else if (arg == "--no-header")
+        {
+            header = false;
+        }
+        else if (arg.compare(0, 10, "--counter=") == 0)
+        {
+            counter_args.push_back(arg.substr(10));
+        }
+        else if (filename.empty() && arg.compare(0, 2, "--") != 0)
+        {
+            filename = arg;
+        }
+        else
+        {
+            std::cerr << argv[0] << ": unknown argument: " << arg << "\n";
+            return 1;
+        }
+    }
+
+    if (filename.empty())
+    {
+        print_help(argv[0]);
+        return 1;
+    }
+
+    try
+    {
+        std::ifstream in(filename, std::ifstream::binary);
+        if (!in)
+        {
+            throw std::runtime_error("unable to open file: " + filename);
+        }
+
+        std::vector<counter> const counters = read_header(in);
+        if (list)
+        {
+            for (std::size_t i = 0; i != counters.size(); ++i)
+            {
+                std::cout << i << ": " << counters[i].name;
+                if (!counters[i].unit.empty())
+                {
+                    std::cout << " [" << counters[i].unit << "]";
+                }
+                std::cout << "\n";
+            }
+            return 0;
+        }
+
+        std::vector<std::size_t> selected;
+        for (std::string const& arg : counter_args)
+        {
+            selected.push_back(find_counter(counters, arg));
+        }
+        if (counter_args.empty())
+        {
+            for (std::size_t i = 0; i != counters.size(); ++i)
+            {
+                selected.push_back(i);
+            }
+        }
+
+        std::cout.precision(15);
+        if (header)
+        {
+            std::cout << "time[ns]";
+            for (std::size_t const i : selected)
+            {
+                std::cout << ',';
+                print_csv_name(std::cout, counters[i].name);
+            }
+            std::cout << '\n';
+        }
+
+        print_rows(in, counters.size(), selected);
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << argv[0] << ": " << filename << ": " << e.what() << "\n";
+        return 1;
+    }
+
+    return 0;
+}